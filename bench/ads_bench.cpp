@@ -0,0 +1,756 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+/*
+ * Hot path benchmarks of the driver, run against the simulation HAL.
+ *
+ *   parse/...	ads_two_axis_parse_read_buffer() through the read callback
+ *				the driver registers, host ns per packet
+ *   util/...	packet field encoding and decoding, host ns per value
+ *   cmd/...	command encoding down to the simulated bus, host ns per call
+ *   stats/...	statistics snapshot, host ns per call, configure with
+ *				-DADS_STATS=ON to measure the counting build
+ *   startup/...	modeled time to initialize ADS_COUNT devices on one bus:
+ *				one after the other and overlapped with the fixed boot
+ *				wait, overlapped with ready polling
+ *   clock/...	sample clock tracking at BENCH_CLOCK_PPM oscillator error and
+ *				up to BENCH_CLOCK_JITTER_US of edge latency: scatter of the
+ *				raw edge and of the corrected time around the true sample,
+ *				error of the drift estimate
+ *   rate/...	rate controller on a joint held still except for
+ *				BENCH_RATE_MOTION_MS of motion: share of the run at 10 Hz,
+ *				modeled ms from motion start to the first 500 Hz sample
+ *   codec/...	sample stream compression of the simulated waveform with
+ *				+-2 units of noise: size of float pairs over encoded size,
+ *				host ns per sample to encode and to decode
+ *   lz/...		embedded firmware image: raw size over compressed size, host
+ *				ns to decode one 64 byte bootloader page
+ *   dfu/...	complete firmware transfer, modeled bus time in ms, host ns
+ *				for the whole update and bootloader acknowledgment reads
+ *   dfu/group/...	the same for BENCH_GROUP_SIZE devices updated together
+ *
+ * Results are written as JSON, to stdout or to the file given as the only
+ * argument, so runs of two driver releases can be compared by a script.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include "ads_two_axis.h"
+#include "ads_two_axis_dfu.h"
+#include "ads_two_axis_rate.h"
+#include "ads_two_axis_codec.h"
+#include "ads_two_axis_lz.h"
+#include "ads_two_axis_fw_v2_lz.h"
+#include "ads_two_axis_sim.h"
+
+#define BENCH_MIN_NS				(20000000.0)	// Each round runs at least this long
+#define BENCH_ROUNDS				(5)
+#define BENCH_GROUP_SIZE			(4)		// Devices in the group update
+#define BENCH_CLOCK_PPM				(500)	// Oscillator error of the simulated device
+#define BENCH_CLOCK_JITTER_US		(300)	// Largest latency of the reported edge
+#define BENCH_CLOCK_SETTLE_MS		(2000)	// Tracking time before the scatter is measured
+#define BENCH_CLOCK_RUN_MS			(5000)
+#define BENCH_RATE_START_MS			(3000)	// Joint starts moving
+#define BENCH_RATE_MOTION_MS		(1000)
+#define BENCH_RATE_RUN_MS			(7000)
+
+typedef struct {
+	const char * name;
+	const char * unit;
+	double value;
+	uint64_t iterations;
+} bench_result_t;
+
+static bench_result_t results[64];
+static unsigned result_count = 0;
+
+static volatile int32_t bench_sink;
+
+
+static void bench_report(const char * name, const char * unit, double value, uint64_t iterations)
+{
+	if(result_count < sizeof(results) / sizeof(results[0]))
+		results[result_count++] = { name, unit, value, iterations };
+
+	fprintf(stderr, "%-24s %12.3f %s\n", name, value, unit);
+}
+
+/**
+ * @brief Best of BENCH_ROUNDS rounds of op(), in ns per call. The iteration
+ *				count is doubled until a round takes BENCH_MIN_NS.
+ */
+template<typename F>
+static void bench_ns_per_op(const char * name, F op)
+{
+	uint64_t iterations = 1;
+	double best = 1e30;
+
+	for(;;)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		for(uint64_t i = 0; i < iterations; i++)
+			op(i);
+
+		double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+		if(ns >= BENCH_MIN_NS)
+		{
+			best = ns / iterations;
+			break;
+		}
+
+		iterations *= 2;
+	}
+
+	for(int r = 1; r < BENCH_ROUNDS; r++)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		for(uint64_t i = 0; i < iterations; i++)
+			op(i);
+
+		double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+		if(ns < best)
+			best = ns;
+	}
+
+	bench_report(name, "ns/op", best, iterations);
+}
+
+
+/************************************************************************/
+/*                               Parsing                                */
+/************************************************************************/
+
+#if ADS_FLOAT_SAMPLES
+static void bench_float_callback(float * sample)
+{
+	bench_sink += (int32_t)sample[0];
+}
+#endif
+
+static void bench_raw_callback(ads_dev_t * dev, const int16_t * raw)
+{
+	(void)dev;
+	bench_sink += raw[0] + raw[1];
+}
+
+static void bench_parse(void)
+{
+	static uint8_t packets[256][ADS_TRANSFER_SIZE];
+
+	for(unsigned i = 0; i < 256; i++)
+	{
+		packets[i][0] = ADS_SAMPLE;
+		ads_uint16_encode((uint16_t)(i * 37 - 4000), &packets[i][1]);
+		ads_uint16_encode((uint16_t)(2900 - i * 23), &packets[i][3]);
+	}
+
+	ads_dev_t * dev = ads_two_axis_get_default_device();
+	ads_hal_dev_t * hal = &dev->hal;
+
+	// The callback registered by ads_two_axis_init() is the parser
+#if ADS_FLOAT_SAMPLES
+	ads_two_axis_set_raw_callback(NULL);
+	bench_ns_per_op("parse/float", [&](uint64_t i) {
+		hal->read_callback(hal, packets[i & 255]);
+	});
+#endif
+
+	ads_two_axis_set_raw_callback(&bench_raw_callback);
+	bench_ns_per_op("parse/raw", [&](uint64_t i) {
+		hal->read_callback(hal, packets[i & 255]);
+	});
+
+	ads_two_axis_set_raw_callback(NULL);
+}
+
+
+/************************************************************************/
+/*                         Field encoding                               */
+/************************************************************************/
+
+static void bench_util(void)
+{
+	static uint8_t buffer[1024];
+
+	for(unsigned i = 0; i < sizeof(buffer); i++)
+		buffer[i] = (uint8_t)(i * 131 + 7);
+
+	bench_ns_per_op("util/int16_decode", [&](uint64_t i) {
+		bench_sink += ads_int16_decode(&buffer[(i * 2) & 1022]);
+	});
+
+	bench_ns_per_op("util/uint16_encode", [&](uint64_t i) {
+		ads_uint16_encode((uint16_t)i, &buffer[(i * 2) & 1022]);
+		bench_sink += buffer[(i * 2) & 1022];
+	});
+}
+
+
+/************************************************************************/
+/*                           Commands                                   */
+/************************************************************************/
+
+static void bench_commands(void)
+{
+	static const ADS_SPS_T rates[] = { ADS_100_HZ, ADS_200_HZ, ADS_10_HZ, ADS_500_HZ };
+
+	bench_ns_per_op("cmd/set_sample_rate", [&](uint64_t i) {
+		bench_sink += ads_two_axis_set_sample_rate(rates[i & 3]);
+	});
+
+	bench_ns_per_op("cmd/calibrate", [&](uint64_t i) {
+		bench_sink += ads_two_axis_calibrate((i & 1) ? ADS_CALIBRATE_CLEAR : ADS_CALIBRATE_FIRST, 0);
+	});
+}
+
+
+/************************************************************************/
+/*                            Statistics                                */
+/************************************************************************/
+
+static void bench_stats(void)
+{
+	ads_stats_t stats;
+
+	bench_ns_per_op("stats/snapshot", [&](uint64_t i) {
+		ads_stats_get(&stats, i & 1);
+		bench_sink += stats.samples;
+	});
+}
+
+
+/************************************************************************/
+/*                          Stream compression                          */
+/************************************************************************/
+
+#define BENCH_CODEC_SAMPLES			(4096)
+
+static int16_t bench_codec_raw[BENCH_CODEC_SAMPLES][2];
+static uint32_t bench_codec_count;
+
+static void bench_codec_collect(ads_dev_t * dev, const int16_t * raw)
+{
+	(void)dev;
+
+	if(bench_codec_count < BENCH_CODEC_SAMPLES)
+	{
+		bench_codec_raw[bench_codec_count][0] = raw[0];
+		bench_codec_raw[bench_codec_count][1] = raw[1];
+		bench_codec_count++;
+	}
+}
+
+static void bench_codec(const char * name_ratio, const char * name_enc, const char * name_dec, ADS_SPS_T sps)
+{
+	static uint8_t stream[BENCH_CODEC_SAMPLES * 5];
+	static int16_t decoded[BENCH_CODEC_SAMPLES * 2];
+
+	// The simulated waveform at sps, the sensor noise added on top
+	bench_codec_count = 0;
+	ads_two_axis_set_raw_callback(&bench_codec_collect);
+	ads_two_axis_set_sample_rate(sps);
+	ads_two_axis_enable_interrupt(true);
+	ads_two_axis_run(true);
+
+	while(bench_codec_count < BENCH_CODEC_SAMPLES)
+		ads_sim_advance_us(10000);
+
+	ads_two_axis_run(false);
+	ads_two_axis_enable_interrupt(false);
+	ads_two_axis_set_raw_callback(NULL);
+
+	uint32_t seed = 1;
+
+	for(uint32_t i = 0; i < BENCH_CODEC_SAMPLES; i++)
+	{
+		for(uint8_t a = 0; a < 2; a++)
+		{
+			seed = seed * 1103515245 + 12345;
+			bench_codec_raw[i][a] += (int16_t)((seed >> 16) % 5) - 2;
+		}
+	}
+
+	ads_codec_enc_t enc;
+	uint32_t len = 0;
+
+	ads_codec_enc_init(&enc, 8);
+
+	for(uint32_t i = 0; i < BENCH_CODEC_SAMPLES; i++)
+		len += ads_codec_encode(&enc, bench_codec_raw[i], i, &stream[len]);
+
+	len += ads_codec_flush(&enc, &stream[len]);
+
+	// A ratio only counts for a stream that decodes to the samples
+	ads_codec_dec_t dec;
+	uint32_t used;
+
+	ads_codec_dec_init(&dec);
+
+	if(ads_codec_decode(&dec, stream, len, decoded, BENCH_CODEC_SAMPLES, &used) != BENCH_CODEC_SAMPLES ||
+	   used != len || memcmp(decoded, bench_codec_raw, sizeof(decoded)) != 0)
+	{
+		fprintf(stderr, "%s: decoded stream differs from the samples\n", name_ratio);
+		return;
+	}
+
+	bench_report(name_ratio, "x", (double)(BENCH_CODEC_SAMPLES * 2 * sizeof(float)) / len, BENCH_CODEC_SAMPLES);
+
+	bench_ns_per_op(name_enc, [&](uint64_t i) {
+		uint32_t n = (uint32_t)(i % BENCH_CODEC_SAMPLES);
+
+		bench_sink += ads_codec_encode(&enc, bench_codec_raw[n], n, &stream[BENCH_CODEC_SAMPLES * 4]);
+	});
+
+	bench_ns_per_op(name_dec, [&](uint64_t i) {
+		if((i % BENCH_CODEC_SAMPLES) == 0)
+		{
+			ads_codec_dec_init(&dec);
+			bench_sink += ads_codec_decode(&dec, stream, len, decoded, BENCH_CODEC_SAMPLES, &used);
+		}
+	});
+}
+
+
+/************************************************************************/
+/*                            Sample timing                             */
+/************************************************************************/
+
+/* Offsets from the true sample time, sums for the standard deviation */
+typedef struct {
+	double sum[2];
+	double sum_sq[2];
+	uint32_t count;
+	bool measure;
+} bench_clock_t;
+
+static bench_clock_t bench_clock_acc;
+
+static void bench_clock_callback(ads_dev_t * dev, const int16_t * raw, const ads_sample_time_t * time)
+{
+	(void)dev;
+	(void)raw;
+
+	bench_clock_t * acc = &bench_clock_acc;
+
+	if(!acc->measure || time->gap)
+		return;
+
+	// The device's edge before the modeled latency was added
+	uint32_t edge = (uint32_t)ads_sim_get_device(0)->edge_us;
+	double offset[2] = { (double)(int32_t)(time->edge_us - edge), (double)(int32_t)(time->time_us - edge) };
+
+	for(int k = 0; k < 2; k++)
+	{
+		acc->sum[k] += offset[k];
+		acc->sum_sq[k] += offset[k] * offset[k];
+	}
+
+	acc->count++;
+}
+
+static double bench_clock_sd(const bench_clock_t * acc, int k)
+{
+	double mean = acc->sum[k] / acc->count;
+
+	return sqrt(acc->sum_sq[k] / acc->count - mean * mean);
+}
+
+static void bench_clock(const char * name_raw, const char * name_corrected, const char * name_drift)
+{
+	ads_sim_config_t config;
+	ads_sim_get_default_config(&config);
+	config.clock_drift_ppm = BENCH_CLOCK_PPM;
+	config.drdy_jitter_us = BENCH_CLOCK_JITTER_US;
+	ads_sim_init(&config);
+
+	ads_init_t init{};
+	init.sps = ADS_100_HZ;
+
+	bench_clock_acc = bench_clock_t();
+
+	ads_two_axis_set_timed_callback(&bench_clock_callback);
+
+	if(ads_two_axis_init(&init) != ADS_OK || ads_two_axis_run(true) != ADS_OK)
+	{
+		fprintf(stderr, "%s: init failed\n", name_raw);
+		ads_two_axis_set_timed_callback(NULL);
+		return;
+	}
+
+	ads_hal_delay(BENCH_CLOCK_SETTLE_MS);
+	bench_clock_acc.measure = true;
+	ads_hal_delay(BENCH_CLOCK_RUN_MS - BENCH_CLOCK_SETTLE_MS);
+	bench_clock_acc.measure = false;
+
+	ads_two_axis_run(false);
+	ads_two_axis_set_timed_callback(NULL);
+
+	bench_report(name_raw, "us", bench_clock_sd(&bench_clock_acc, 0), bench_clock_acc.count);
+	bench_report(name_corrected, "us", bench_clock_sd(&bench_clock_acc, 1), bench_clock_acc.count);
+	bench_report(name_drift, "ppm", fabs((double)ads_two_axis_get_drift_ppm() - BENCH_CLOCK_PPM), bench_clock_acc.count);
+}
+
+
+/************************************************************************/
+/*                          Rate controller                             */
+/************************************************************************/
+
+static uint64_t bench_rate_start_us;
+static uint64_t bench_rate_fast_us;
+
+/* Still joint with sensor noise, one period of a 40 degree swing */
+static void bench_rate_signal(uint8_t device, uint64_t time_us, float * angle)
+{
+	(void)device;
+
+	float noise = (float)((time_us * 2654435761u) >> 20 & 7) * 0.01f;
+	uint64_t motion_us = (uint64_t)BENCH_RATE_MOTION_MS * 1000;
+
+	angle[0] = noise;
+	angle[1] = noise;
+
+	if(time_us >= bench_rate_start_us && time_us < bench_rate_start_us + motion_us)
+		angle[0] += 40.0f * sinf(6.2831853f * (float)(time_us - bench_rate_start_us) / (float)motion_us);
+}
+
+static void bench_rate_callback(ads_dev_t * dev, const int16_t * raw, const ads_sample_time_t * time)
+{
+	(void)raw;
+	(void)time;
+
+	uint64_t now = ads_sim_time_us();
+
+	if(!bench_rate_fast_us && now >= bench_rate_start_us && dev->sps == ADS_500_HZ)
+		bench_rate_fast_us = now;
+}
+
+static void bench_rate(const char * name_slow, const char * name_latency)
+{
+	static ads_rate_t rate;
+
+	ads_sim_init(NULL);
+	ads_sim_set_signal(&bench_rate_signal);
+
+	ads_init_t init{};
+	init.sps = ADS_100_HZ;
+
+	bench_rate_start_us = UINT64_MAX;
+	bench_rate_fast_us = 0;
+
+	ads_two_axis_set_timed_callback(&bench_rate_callback);
+
+	if(ads_two_axis_init(&init) != ADS_OK || ads_rate_init(&rate, NULL) != ADS_OK ||
+	   ads_two_axis_set_rate_control(&rate) != ADS_OK || ads_two_axis_run(true) != ADS_OK)
+	{
+		fprintf(stderr, "%s: init failed\n", name_slow);
+		ads_two_axis_set_rate_control(NULL);
+		ads_two_axis_set_timed_callback(NULL);
+		return;
+	}
+
+	bench_rate_start_us = ads_sim_time_us() + (uint64_t)BENCH_RATE_START_MS * 1000;
+
+	// The application loop writing the picked rates
+	for(uint32_t ms = 0; ms < BENCH_RATE_RUN_MS; ms++)
+	{
+		ads_hal_delay(1);
+		ads_two_axis_service();
+	}
+
+	ads_two_axis_run(false);
+	ads_two_axis_set_rate_control(NULL);
+	ads_two_axis_set_timed_callback(NULL);
+	ads_sim_set_signal(NULL);
+
+	bench_report(name_slow, "%", 100.0 * ads_rate_get_time_ms(&rate, ADS_10_HZ) / BENCH_RATE_RUN_MS, rate.switches);
+	bench_report(name_latency, "ms", (double)(bench_rate_fast_us - bench_rate_start_us) / 1000.0, rate.switches);
+}
+
+
+/************************************************************************/
+/*                              Startup                                 */
+/************************************************************************/
+
+/**
+ * @brief Modeled time until ADS_COUNT freshly powered devices are ready
+ *
+ * @param overlap	reset every device before waiting for any, else
+ *					initialize them one after the other
+ */
+static void bench_startup(const char * name, ADS_STARTUP_T startup, bool overlap)
+{
+	static ads_dev_t devs[ADS_COUNT];
+	uint8_t addresses[ADS_COUNT];
+	ads_init_t inits[ADS_COUNT];
+
+	ads_sim_init(NULL);
+
+	for(uint8_t i = 0; i < ADS_COUNT; i++)
+	{
+		if(i > 0)
+			ads_sim_add_device(ADS_DEFAULT_ADDR + i, ADS_DEV_TWO_AXIS_V2, 6);
+
+		addresses[i] = ADS_DEFAULT_ADDR + i;
+		inits[i] = ads_init_t{};
+		inits[i].sps = ADS_100_HZ;
+		inits[i].reset_pin = i;
+		inits[i].datardy_pin = i;
+		devs[i] = ads_dev_t();
+		ads_two_axis_dev_set_startup(&devs[i], startup, 0);
+	}
+
+	uint64_t sim_start = ads_sim_time_us();
+	int ret = ADS_OK;
+
+	if(overlap)
+	{
+		ret = ads_two_axis_dev_init_all(devs, addresses, inits, ADS_COUNT);
+	}
+	else
+	{
+		for(uint8_t i = 0; i < ADS_COUNT && ret == ADS_OK; i++)
+			ret = ads_two_axis_dev_init(&devs[i], addresses[i], &inits[i]);
+	}
+
+	if(ret == ADS_OK)
+		bench_report(name, "ms", (ads_sim_time_us() - sim_start) / 1000.0, 1);
+	else
+		fprintf(stderr, "%s: init failed with %d\n", name, ret);
+
+	// Frees the HAL device table for the benchmarks after this one
+	for(uint8_t i = 0; i < ADS_COUNT; i++)
+		ads_hal_dev_remove(&devs[i].hal);
+}
+
+
+/************************************************************************/
+/*                          Firmware update                             */
+/************************************************************************/
+
+static void bench_lz(const char * name_ratio, const char * name_page)
+{
+	static ads_lz_dec_t dec;
+	uint8_t page[64];
+
+	bench_report(name_ratio, "x", (double)ads_two_axis_fw_v2_lz_len / sizeof(ads_two_axis_fw_v2_lz), 1);
+
+	ads_lz_dec_init(&dec, ads_two_axis_fw_v2_lz, sizeof(ads_two_axis_fw_v2_lz));
+
+	bench_ns_per_op(name_page, [&](uint64_t i) {
+		(void)i;
+
+		if(ads_lz_read(&dec, page, sizeof(page)) < sizeof(page))
+			ads_lz_dec_init(&dec, ads_two_axis_fw_v2_lz, sizeof(ads_two_axis_fw_v2_lz));
+
+		bench_sink += page[0];
+	});
+}
+
+static void bench_dfu_timing(const ads_dfu_timing_t * timing, void * ctx)
+{
+	*(ads_dfu_timing_t *)ctx = *timing;
+}
+
+static void bench_dfu(const char * name_ms, const char * name_ns, const char * name_reads, uint32_t clock_hz)
+{
+	ads_sim_config_t config;
+	ads_sim_get_default_config(&config);
+	config.i2c_clock_hz = clock_hz;
+	ads_sim_init(&config);
+
+	ads_init_t init{};
+	init.sps = ADS_100_HZ;
+	init.reset_pin = 0;
+	init.datardy_pin = 0;
+
+	if(ads_two_axis_init(&init) != ADS_OK)
+	{
+		fprintf(stderr, "%s: init failed\n", name_ms);
+		return;
+	}
+
+	ads_two_axis_dfu_reset();
+	ads_hal_delay(50);
+
+	uint64_t sim_start = ads_sim_time_us();
+	auto start = std::chrono::steady_clock::now();
+
+	ads_dfu_timing_t timing;
+	int ret = ads_two_axis_dfu_update_timed(&bench_dfu_timing, &timing);
+
+	double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	uint64_t sim_us = ads_sim_time_us() - sim_start;
+
+	if(ret != ADS_OK)
+	{
+		fprintf(stderr, "%s: update failed with %d\n", name_ms, ret);
+		return;
+	}
+
+	bench_report(name_ms, "ms", sim_us / 1000.0, 1);
+	bench_report(name_ns, "ns", ns, 1);
+	bench_report(name_reads, "reads", timing.polls, 1);
+}
+
+static void bench_dfu_group(const char * name_ms, const char * name_ns)
+{
+	ads_sim_init(NULL);
+
+	static ads_dev_t devs[BENCH_GROUP_SIZE];
+	ads_dfu_target_t targets[BENCH_GROUP_SIZE];
+	uint8_t addresses[BENCH_GROUP_SIZE];
+	ads_init_t inits[BENCH_GROUP_SIZE];
+
+	for(uint8_t i = 0; i < BENCH_GROUP_SIZE; i++)
+	{
+		if(i > 0)
+			ads_sim_add_device(ADS_DEFAULT_ADDR + i, ADS_DEV_TWO_AXIS_V2, 6);
+
+		addresses[i] = ADS_DEFAULT_ADDR + i;
+		inits[i] = ads_init_t{};
+		inits[i].sps = ADS_100_HZ;
+		inits[i].reset_pin = i;
+		inits[i].datardy_pin = i;
+		targets[i] = ads_dfu_target_t{};
+		targets[i].dev = &devs[i].hal;
+	}
+
+	if(ads_two_axis_dev_init_all(devs, addresses, inits, BENCH_GROUP_SIZE) != ADS_OK)
+	{
+		fprintf(stderr, "%s: init failed\n", name_ms);
+		return;
+	}
+
+	uint64_t sim_start = ads_sim_time_us();
+	auto start = std::chrono::steady_clock::now();
+
+	int ret = ads_two_axis_dfu_update_group(targets, BENCH_GROUP_SIZE, NULL, NULL);
+
+	double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	uint64_t sim_us = ads_sim_time_us() - sim_start;
+
+	if(ret != ADS_OK)
+	{
+		fprintf(stderr, "%s: update failed with %d\n", name_ms, ret);
+		return;
+	}
+
+	bench_report(name_ms, "ms", sim_us / 1000.0, 1);
+	bench_report(name_ns, "ns", ns, 1);
+}
+
+/**
+ * @brief Up to date check at boot, the version query on the bus against a
+ *				saved update record
+ */
+static void bench_dfu_skip(const char * name_query, const char * name_record)
+{
+	ads_sim_init(NULL);
+
+	ads_init_t init{};
+	init.sps = ADS_100_HZ;
+
+	ads_dfu_record_t record;
+
+	if(ads_two_axis_init(&init) != ADS_OK ||
+	   ads_two_axis_dfu_verify(ads_hal_get_default_device(), ADS_DEV_TWO_AXIS_V2, &record) != ADS_OK)
+	{
+		fprintf(stderr, "%s: verify failed\n", name_query);
+		return;
+	}
+
+	uint64_t sim_start = ads_sim_time_us();
+
+	bench_sink += ads_two_axis_dfu_check(ads_two_axis_fw_v2_lz_rev);
+
+	bench_report(name_query, "ms", (ads_sim_time_us() - sim_start) / 1000.0, 1);
+
+	bench_ns_per_op(name_record, [&](uint64_t i) {
+		(void)i;
+		bench_sink += ads_two_axis_dfu_record_current(&record, ADS_DEFAULT_ADDR, ADS_DEV_TWO_AXIS_V2);
+	});
+}
+
+
+static void bench_write_json(FILE * out)
+{
+	fprintf(out, "{\n  \"suite\": \"ads_two_axis\",\n  \"results\": [\n");
+
+	for(unsigned i = 0; i < result_count; i++)
+	{
+		fprintf(out, "    {\"name\": \"%s\", \"unit\": \"%s\", \"value\": %.3f, \"iterations\": %llu}%s\n",
+				results[i].name, results[i].unit, results[i].value,
+				(unsigned long long)results[i].iterations, i + 1 < result_count ? "," : "");
+	}
+
+	fprintf(out, "  ]\n}\n");
+}
+
+int main(int argc, char ** argv)
+{
+	// Needs every slot of the HAL device table, before the default device
+	bench_startup("startup/fixed_serial", ADS_STARTUP_FIXED, false);
+	bench_startup("startup/fixed", ADS_STARTUP_FIXED, true);
+	bench_startup("startup/poll", ADS_STARTUP_POLL, true);
+
+	ads_sim_init(NULL);
+
+	ads_init_t init{};
+	init.sps = ADS_100_HZ;
+#if ADS_FLOAT_SAMPLES
+	init.ads_sample_callback = &bench_float_callback;
+#endif
+	init.reset_pin = 0;
+	init.datardy_pin = 0;
+
+	if(ads_two_axis_init(&init) != ADS_OK)
+	{
+		fprintf(stderr, "ads_two_axis_init failed\n");
+		return 1;
+	}
+
+	bench_parse();
+	bench_util();
+	bench_commands();
+	bench_stats();
+
+	bench_codec("codec/100hz/ratio", "codec/100hz/encode", "codec/100hz/decode", ADS_100_HZ);
+	bench_codec("codec/500hz/ratio", "codec/500hz/encode", "codec/500hz/decode", ADS_500_HZ);
+
+	bench_lz("lz/fw_v2/ratio", "lz/fw_v2/page");
+
+	bench_clock("clock/raw_jitter", "clock/corrected_jitter", "clock/drift_error");
+	bench_rate("rate/time_at_10hz", "rate/switch_up");
+
+	bench_dfu("dfu/100khz/bus_time", "dfu/100khz/host_time", "dfu/100khz/ack_reads", 100000);
+	bench_dfu("dfu/400khz/bus_time", "dfu/400khz/host_time", "dfu/400khz/ack_reads", 400000);
+	bench_dfu("dfu/1000khz/bus_time", "dfu/1000khz/host_time", "dfu/1000khz/ack_reads", 1000000);
+	bench_dfu_group("dfu/group/bus_time", "dfu/group/host_time");
+	bench_dfu_skip("dfu/skip/query_time", "dfu/skip/record");
+
+	FILE * out = stdout;
+
+	if(argc > 1 && (out = fopen(argv[1], "w")) == NULL)
+	{
+		fprintf(stderr, "can not open %s\n", argv[1]);
+		return 1;
+	}
+
+	bench_write_json(out);
+
+	if(out != stdout)
+		fclose(out);
+
+	return 0;
+}
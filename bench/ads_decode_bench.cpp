@@ -0,0 +1,183 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+/*
+ * Throughput of batch packet decoding. Compares the per packet decode done
+ * by the sample callback path, ads_two_axis_parse_read_buffer() called
+ * through the read callback the driver registers, with every ads_decode
+ * implementation the CPU supports, on a recording sized buffer with a few
+ * non-sample packets mixed in.
+ *
+ * Built as ads_decode_bench by bench/CMakeLists.txt.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "ads_two_axis.h"
+#include "ads_two_axis_decode.h"
+#include "ads_two_axis_sim.h"
+
+#define BENCH_PACKETS				(1u << 20)
+#define BENCH_ROUNDS				(20)
+
+static volatile float bench_sink;
+
+/* Where the sample callbacks store the parsed samples */
+static float * bench_axis_f[2];
+static int16_t * bench_axis_r[2];
+static size_t bench_count;
+
+#if ADS_FLOAT_SAMPLES
+static void bench_parse_float(float * sample)
+{
+	bench_axis_f[0][bench_count] = sample[0];
+	bench_axis_f[1][bench_count] = sample[1];
+	bench_count++;
+}
+#endif
+
+static void bench_parse_raw(ads_dev_t * dev, const int16_t * raw)
+{
+	(void)dev;
+	bench_axis_r[0][bench_count] = raw[0];
+	bench_axis_r[1][bench_count] = raw[1];
+	bench_count++;
+}
+
+/**
+ * @brief Hands every packet to the parser of the default device, one at a
+ *				time as the data ready interrupt does
+ */
+static size_t bench_parse(const uint8_t * packets, size_t n)
+{
+	ads_hal_dev_t * hal = &ads_two_axis_get_default_device()->hal;
+
+	bench_count = 0;
+
+	for(size_t i = 0; i < n; i++, packets += ADS_TRANSFER_SIZE)
+		hal->read_callback(hal, (uint8_t *)packets);
+
+	return bench_count;
+}
+
+template<typename F>
+static double bench_ns_per_packet(F decode)
+{
+	double best = 1e30;
+
+	for(int r = 0; r < BENCH_ROUNDS; r++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		decode();
+		auto end = std::chrono::steady_clock::now();
+
+		double ns = std::chrono::duration<double, std::nano>(end - start).count() / BENCH_PACKETS;
+
+		if(ns < best)
+			best = ns;
+	}
+
+	return best;
+}
+
+int main(void)
+{
+	std::vector<uint8_t> packets(BENCH_PACKETS * ADS_TRANSFER_SIZE);
+	std::vector<float> f0(BENCH_PACKETS), f1(BENCH_PACKETS);
+	std::vector<int16_t> r0(BENCH_PACKETS), r1(BENCH_PACKETS);
+	std::vector<uint8_t> valid(BENCH_PACKETS);
+
+	srand(1);
+
+	for(size_t i = 0; i < packets.size(); i++)
+		packets[i] = (uint8_t)rand();
+
+	// About one packet in 64 is a version or id reply
+	for(size_t i = 0; i < BENCH_PACKETS; i++)
+		packets[i * ADS_TRANSFER_SIZE] = (rand() % 64) ? ADS_SAMPLE : ADS_FW_VER;
+
+	static const struct {
+		ADS_DECODE_IMPL_T impl;
+		const char * name;
+	} impls[] = {
+		{ ADS_DECODE_SCALAR, "scalar" },
+		{ ADS_DECODE_SSE41,  "sse4.1" },
+		{ ADS_DECODE_AVX2,   "avx2" },
+	};
+
+	// The parser of an initialized default device, streaming nowhere
+	ads_sim_init(NULL);
+
+	ads_init_t init{};
+	init.sps = ADS_100_HZ;
+#if ADS_FLOAT_SAMPLES
+	init.ads_sample_callback = &bench_parse_float;
+#endif
+
+	if(ads_two_axis_init(&init) != ADS_OK)
+	{
+		fprintf(stderr, "ads_two_axis_init failed\n");
+		return 1;
+	}
+
+	bench_axis_f[0] = f0.data();
+	bench_axis_f[1] = f1.data();
+	bench_axis_r[0] = r0.data();
+	bench_axis_r[1] = r1.data();
+
+	printf("%-24s %10s %10s %8s\n", "decoder", "ns/packet", "Mpkt/s", "speedup");
+
+#if ADS_FLOAT_SAMPLES
+	double base_float = bench_ns_per_packet([&] {
+		bench_parse(packets.data(), BENCH_PACKETS);
+		bench_sink = f0[0];
+	});
+
+	printf("%-17s float  %10.3f %10.1f %8.2f\n", "parse", base_float, 1e3 / base_float, 1.0);
+#endif
+
+	ads_two_axis_set_raw_callback(&bench_parse_raw);
+
+	double base_raw = bench_ns_per_packet([&] {
+		bench_parse(packets.data(), BENCH_PACKETS);
+		bench_sink = r0[0];
+	});
+
+	ads_two_axis_set_raw_callback(NULL);
+
+	printf("%-17s raw    %10.3f %10.1f %8.2f\n", "parse", base_raw, 1e3 / base_raw, 1.0);
+
+	for(size_t k = 0; k < sizeof(impls) / sizeof(impls[0]); k++)
+	{
+		if(ads_decode_set_impl(impls[k].impl) != impls[k].impl)
+		{
+			printf("%-24s %10s\n", impls[k].name, "n/a");
+			continue;
+		}
+
+#if ADS_FLOAT_SAMPLES
+		double ns_float = bench_ns_per_packet([&] {
+			ads_decode_float(packets.data(), BENCH_PACKETS, f0.data(), f1.data(), valid.data());
+			bench_sink = f0[BENCH_PACKETS - 1];
+		});
+
+		printf("%-17s float  %10.3f %10.1f %8.2f\n", impls[k].name, ns_float, 1e3 / ns_float, base_float / ns_float);
+#endif
+
+		double ns_raw = bench_ns_per_packet([&] {
+			ads_decode_raw(packets.data(), BENCH_PACKETS, r0.data(), r1.data(), valid.data());
+			bench_sink = r0[BENCH_PACKETS - 1];
+		});
+
+		printf("%-17s raw    %10.3f %10.1f %8.2f\n", impls[k].name, ns_raw, 1e3 / ns_raw, base_raw / ns_raw);
+	}
+
+	return 0;
+}
@@ -31,6 +31,53 @@
 #define ADS_RESET_PIN      (3)           // Pin number attached to ads reset line.
 #define ADS_INTERRUPT_PIN  (4)           // Not needed in polled mode.  
 
+/*
+ * Boards with an EEPROM keep a record of the last verified update. While
+ * the sensor and the image stay the same, later boots skip the firmware
+ * version query. Erase the record when a sensor is swapped for another.
+ */
+#if defined(__has_include)
+#if __has_include(<EEPROM.h>)
+#include <EEPROM.h>
+#define ADS_DFU_RECORD_EEPROM
+#endif
+#endif
+
+#define ADS_DFU_RECORD_ADDR  (0)         // EEPROM offset of the update record
+
+bool readUpdateRecord(ads_dfu_record_t * record)
+{
+#ifdef ADS_DFU_RECORD_EEPROM
+  uint8_t blob[ADS_DFU_RECORD_SIZE];
+
+  for(uint16_t i = 0; i < sizeof(blob); i++)
+    blob[i] = EEPROM.read(ADS_DFU_RECORD_ADDR + i);
+
+  return ads_two_axis_dfu_record_load(record, blob, sizeof(blob)) == ADS_OK;
+#else
+  (void)record;
+  return false;
+#endif
+}
+
+void writeUpdateRecord(const ads_dfu_record_t * record)
+{
+#ifdef ADS_DFU_RECORD_EEPROM
+  uint8_t blob[ADS_DFU_RECORD_SIZE];
+
+  ads_two_axis_dfu_record_save(record, blob, sizeof(blob));
+
+  for(uint16_t i = 0; i < sizeof(blob); i++)
+    EEPROM.write(ADS_DFU_RECORD_ADDR + i, blob[i]);
+
+#if defined(ESP8266) || defined(ESP32)
+  EEPROM.commit();
+#endif
+#else
+  (void)record;
+#endif
+}
+
 /* Not used in polled mode. Stub function necessary for library compilation */
 void ads_data_callback(float * sample)
 {
@@ -39,6 +86,10 @@ void ads_data_callback(float * sample)
 
 void setup() {
   Serial.begin(115200);
+
+#if defined(ADS_DFU_RECORD_EEPROM) && (defined(ESP8266) || defined(ESP32))
+  EEPROM.begin(ADS_DFU_RECORD_ADDR + ADS_DFU_RECORD_SIZE);
+#endif
   Serial.println("Press/send any key to update firmware...");
 
   while(!Serial.available());
@@ -77,9 +128,24 @@ void setup() {
     return;
   }
 
-  if (ads_two_axis_dfu_check(ads_two_axis_fw_v2_rev))
+  ads_hal_dev_t * dev = ads_hal_get_default_device();
+  ads_dfu_record_t record;
+
+  // Updated and verified with this image before, no need to ask the sensor
+  if (readUpdateRecord(&record) && ads_two_axis_dfu_record_current(&record, dev->address, dev_type))
+  {
+    Serial.println("Two Axis ADS firmware is up to date.");
+    return;
+  }
+
+  if (!ads_two_axis_dfu_check(ads_two_axis_fw_v2_rev))
   {
-    Serial.println("One Axis ADS firmware is up to date.");
+    Serial.println("Two Axis ADS firmware is up to date.");
+
+    // Record it, the next boot skips the query
+    if (ads_two_axis_dfu_verify(dev, dev_type, &record) == ADS_OK)
+      writeUpdateRecord(&record);
+
     return;
   }
 
@@ -90,7 +156,10 @@ void setup() {
   ads_hal_delay(50); // Give ADS time to reset
   
   ret_val = ads_two_axis_dfu_update();
-  ads_hal_delay(2000); // Let it reinitialize
+
+  // Wait for the new application and check its version
+  if (ret_val == ADS_OK)
+    ret_val = ads_two_axis_dfu_verify(dev, dev_type, &record);
 
   if (ret_val)
   {
@@ -99,6 +168,7 @@ void setup() {
   }
   else
   {
+    writeUpdateRecord(&record);
     Serial.println("Update complete.");
   }
 }
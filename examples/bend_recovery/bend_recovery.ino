@@ -12,10 +12,13 @@
 
 #include <Wire.h>
 #include "ads_two_axis_fw_v2.h"
+#include "ads_two_axis_util.h"
 
 #define ADS_RESET_PIN      (3)           // Pin number attached to ads reset line.
 #define ADS_INTERRUPT_PIN  (4)           // Not needed in polled mode.
 #define SENSOR_ADDRESS    0x12
+#define APP_ADDRESS       0x13           // Default address of the sensor application
+#define APP_BOOT_MS       2000           // Worst case time from reset until the application answers
 
 const uint32_t firmwareSize = sizeof(ads_two_axis_fw_v2); 
 
@@ -24,6 +27,8 @@ bool waitForAck(uint8_t address, char expectedAck, unsigned long timeout);
 int scanI2CBus();
 int uploadFirmware();
 bool getUserConfirmation(const char* prompt);
+bool readAppVersion(uint8_t address, uint16_t* fwVer);
+bool waitForApp(uint8_t address, uint16_t* fwVer, unsigned long timeout);
 
 void setup(){
   Serial.begin(115200);
@@ -32,11 +37,24 @@ void setup(){
     return;
   }
 
+  Wire.begin();
+
+  // A sensor running this image or a newer one needs no recovery
+  uint16_t fwVer;
+
+  if (readAppVersion(APP_ADDRESS, &fwVer)) {
+    Serial.print("Sensor application answers with firmware version ");
+    Serial.println(fwVer);
+
+    if (fwVer >= ads_two_axis_fw_v2_rev &&
+        !getUserConfirmation("Firmware is up to date. Do you want to reflash it anyway? (y/n)")) {
+      return;
+    }
+  }
+
   pinMode(ADS_RESET_PIN, OUTPUT);
   pinMode(ADS_INTERRUPT_PIN, OUTPUT);
 
-  Wire.begin();
-
   // Begin the recovery sequence
   digitalWrite(ADS_RESET_PIN, LOW);  // Put sensor in reset
   delay(100);  // Hold reset for a short period
@@ -86,7 +104,15 @@ void setup(){
   digitalWrite(ADS_RESET_PIN, LOW);  // Put sensor in reset
   delay(100);
   digitalWrite(ADS_RESET_PIN, HIGH);  // Release reset
-  delay(1000);
+
+  // Verify the new application instead of trusting the upload
+  if (waitForApp(APP_ADDRESS, &fwVer, APP_BOOT_MS) && fwVer >= ads_two_axis_fw_v2_rev) {
+    Serial.print("Sensor verified, firmware version ");
+    Serial.println(fwVer);
+    return;
+  }
+
+  Serial.println("Sensor application does not answer at its default address.");
 
   int currentAddress = scanI2CBus();
   if (currentAddress != -1) {
@@ -180,6 +206,42 @@ int uploadFirmware() {
   return 0;  // Success
 }
 
+bool readAppVersion(uint8_t address, uint16_t* fwVer) {
+  uint8_t buffer[5] = {ADS_GET_FW_VER, 0, 0, 0, 0};
+
+  if (writeToI2CDevice(address, buffer, sizeof(buffer)) != 0) {
+    return false;
+  }
+
+  delay(2);  // Give the sensor time to answer
+
+  if (Wire.requestFrom(address, (uint8_t)sizeof(buffer)) != sizeof(buffer)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < sizeof(buffer); i++) {
+    buffer[i] = Wire.read();
+  }
+
+  if (buffer[0] != ADS_FW_VER) {
+    return false;
+  }
+
+  *fwVer = ads_uint16_decode(&buffer[1]);
+  return true;
+}
+
+bool waitForApp(uint8_t address, uint16_t* fwVer, unsigned long timeout) {
+  unsigned long startTime = millis();
+  while (millis() - startTime < timeout) {
+    if (readAppVersion(address, fwVer)) {
+      return true;
+    }
+    delay(5);
+  }
+  return false;
+}
+
 bool getUserConfirmation(const char* prompt) {
   Serial.println(prompt);
   while (true) {
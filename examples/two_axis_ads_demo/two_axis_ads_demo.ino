@@ -17,60 +17,25 @@
 
 #include "Arduino.h"
 #include "ads_two_axis.h"
+#include "ads_two_axis_filter.h"
 
 #define ADS_RESET_PIN       (4)         // Pin number attached to ads reset line.
 #define ADS_INTERRUPT_PIN   (3)         // Pin number attached to the ads data ready line. 
 
 // function prototypes
 void ads_data_callback(float * sample);
-void deadzone_filter(float * sample);
-void signal_filter(float * sample);
 void parse_serial_port(void);
 
 float ang[2];
 volatile bool newData = false;
 
-void signal_filter(float * sample)
-{
-    static float filter_samples[2][6];
-
-    for(uint8_t i=0; i<2; i++)
-    {
-      filter_samples[i][5] = filter_samples[i][4];
-      filter_samples[i][4] = filter_samples[i][3];
-      filter_samples[i][3] = (float)sample[i];
-      filter_samples[i][2] = filter_samples[i][1];
-      filter_samples[i][1] = filter_samples[i][0];
-  
-      // 20 Hz cutoff frequency @ 100 Hz Sample Rate
-      filter_samples[i][0] = filter_samples[i][1]*(0.36952737735124147f) - 0.19581571265583314f*filter_samples[i][2] + \
-        0.20657208382614792f*(filter_samples[i][3] + 2*filter_samples[i][4] + filter_samples[i][5]);   
-
-      sample[i] = filter_samples[i][0];
-    }
-}
-
-void deadzone_filter(float * sample)
-{
-  static float prev_sample[2];
-  float dead_zone = 0.5f;
-
-  for(uint8_t i=0; i<2; i++)
-  {
-    if(fabs(sample[i]-prev_sample[i]) > dead_zone)
-      prev_sample[i] = sample[i];
-    else
-      sample[i] = prev_sample[i];
-  }
-}
+// 20 Hz low pass IIR filter followed by a 0.5 degree deadzone
+ads_filter_chain<ads_lowpass_filter<20>, ads_deadzone_filter<50>> filters;
 
 void ads_data_callback(float * sample)
 {
-  // Low pass IIR filter
-  signal_filter(sample);
-
-  // Deadzone filter
-  deadzone_filter(sample);
+  // Follows the rate changes of the 'f', 'u' and 'n' commands
+  filters.process(ads_two_axis_get_default_device(), sample);
   
   ang[0] = sample[0];
   ang[1] = sample[1];
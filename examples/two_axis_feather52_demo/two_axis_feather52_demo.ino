@@ -12,12 +12,16 @@
 
 #include "Arduino.h"
 #include "ads_two_axis.h"
+#include "ads_two_axis_filter.h"
+#include "ads_two_axis_pkt.h"
 
 #include <bluefruit.h>
 #include <string.h>
 
 #define ADS_RESET_PIN       (27)        // Pin number attached to ads reset line.
 #define ADS_INTERRUPT_PIN   (30)        // Pin number attached to the ads data ready line.  
+#define ADS_RING_SIZE       (64)        // Samples buffered between the data ready interrupt and loop()
+#define ADS_PKT_AGE_MS      (50)        // Longest time a sample waits for its notification
 
 
 BLEService        angms = BLEService(0x1820);
@@ -33,76 +37,42 @@ void startAdv(void);
 void setupANGM(void);
 void connect_callback(uint16_t conn_handle);
 void disconnect_callback(uint16_t conn_handle, uint8_t reason);
-void ads_data_callback(float * sample);
-void deadzone_filter(float * sample);
-void signal_filter(float * sample);
 void parse_serial_port(void);
 
-float ang[2];
-volatile bool newData = false;
+ads_ring_sample_t ring_storage[ADS_RING_SIZE];
+ads_ring_t sample_ring;
 ads_init_t ads_init;
 
-void signal_filter(float * sample)
-{
-    static float filter_samples[2][6];
-
-    for(uint8_t i=0; i<2; i++)
-    {
-      filter_samples[i][5] = filter_samples[i][4];
-      filter_samples[i][4] = filter_samples[i][3];
-      filter_samples[i][3] = (float)sample[i];
-      filter_samples[i][2] = filter_samples[i][1];
-      filter_samples[i][1] = filter_samples[i][0];
-  
-      // 20 Hz cutoff frequency @ 100 Hz Sample Rate
-      filter_samples[i][0] = filter_samples[i][1]*(0.36952737735124147f) - 0.19581571265583314f*filter_samples[i][2] + \
-        0.20657208382614792f*(filter_samples[i][3] + 2*filter_samples[i][4] + filter_samples[i][5]);   
+// Packs several samples into each notification, a second sensor would get
+// its own packetizer with stream 1
+ads_pkt_t packetizer;
+uint16_t conn_handle_active = BLE_CONN_HANDLE_INVALID;
 
-      sample[i] = filter_samples[i][0];
-    }
-}
-
-void deadzone_filter(float * sample)
-{
-  static float prev_sample[2];
-  float dead_zone = 0.5f;
-
-  for(uint8_t i=0; i<2; i++)
-  {
-    if(fabs(sample[i]-prev_sample[i]) > dead_zone)
-      prev_sample[i] = sample[i];
-    else
-      sample[i] = prev_sample[i];
-  }
-}
-
-void ads_data_callback(float * sample)
-{
-  // Low pass IIR filter
-  signal_filter(sample);
-
-  // Deadzone filter
-  deadzone_filter(sample);
-  
-  ang[0] = sample[0];
-  ang[1] = sample[1];
-  
-  newData = true;
-}
+// 20 Hz low pass IIR filter followed by a 0.5 degree deadzone
+ads_filter_chain<ads_lowpass_filter<20>, ads_deadzone_filter<50>> filters;
 
 void setup() {
   Serial.begin(115200);
   Serial.println("Two Axis ADS BLE Example");
   Serial.println("-----------------------\n");
 
+  // Allow the largest ATT MTU so a notification carries up to 39 samples
+  Bluefruit.configPrphBandwidth(BANDWIDTH_MAX);
   Bluefruit.begin();
   
   delay(100);
   
   Serial.println("Initializing the Two Axis Angular Displacement Sensor");
 
+  // Samples are queued by the data ready interrupt and drained in loop()
+  ads_ring_init(&sample_ring, ring_storage, ADS_RING_SIZE);
+  ads_two_axis_set_sample_ring(&sample_ring);
+
+  // Start with the default 23 byte ATT MTU, grows once the central agrees
+  ads_pkt_init(&packetizer, 0, BLE_GATT_ATT_MTU_DEFAULT - 3, ADS_PKT_AGE_MS, send_packet, NULL);
+
   ads_init.sps = ADS_100_HZ;
-  ads_init.ads_sample_callback = &ads_data_callback;
+  ads_init.ads_sample_callback = NULL;
   ads_init.reset_pin = ADS_RESET_PIN;                 // Pin connected to ADS reset line
   ads_init.datardy_pin = ADS_INTERRUPT_PIN;           // Pin connected to ADS data ready interrupt
 
@@ -195,21 +165,35 @@ void setupANGM(void)
 
   // Configure the Angle Measurement characteristic
   // Properties = Notify
-  // Min Len    = 4
-  // Max Len    = 4
-  // Little Endian Float
+  // Min Len    = 13
+  // Max Len    = 244
+  // Packets of timestamped Q10.5 samples, see ads_two_axis_pkt.h
   angmc.setProperties(CHR_PROPS_NOTIFY|CHR_PROPS_WRITE);
   angmc.setPermission(SECMODE_OPEN, SECMODE_OPEN);
+  angmc.setMaxLen(ADS_PKT_MAX_SIZE);
   angmc.setCccdWriteCallback(cccd_callback);  // Optionally capture CCCD updates
   angmc.setWriteCallback(write_callback);
   angmc.begin();
-  uint8_t ang_initial[] = {0,0,0,0,0,0,0,0};
-  angmc.notify(ang_initial, 8);                   // Use .notify instead of .write!
+}
+
+bool send_packet(void * ctx, const uint8_t * packet, uint16_t len)
+{
+  (void) ctx;
+
+  // Nobody listens, the packet is done with
+  if(!Bluefruit.connected() || !angmc.notifyEnabled())
+    return true;
+
+  return angmc.notify(packet, len);                // Use .notify instead of .write!
 }
 
 void connect_callback(uint16_t conn_handle)
 {
     Serial.print("Connected");
+
+    conn_handle_active = conn_handle;
+    Bluefruit.Connection(conn_handle)->requestMtuExchange(ADS_PKT_MAX_SIZE + 3);
+
     ads_two_axis_run(true);
 }
 
@@ -223,7 +207,9 @@ void disconnect_callback(uint16_t conn_handle, uint8_t reason)
   Serial.println("Disconnected");
   Serial.println("Advertising!");
 
+  conn_handle_active = BLE_CONN_HANDLE_INVALID;
   ads_two_axis_run(false);
+  ads_pkt_set_size(&packetizer, BLE_GATT_ATT_MTU_DEFAULT - 3);
 }
 
 void write_callback(BLECharacteristic& chr, unsigned char * rx, short unsigned len, short unsigned dah)
@@ -304,21 +290,51 @@ void parse_serial_port(void)
 
 void loop() {
   // put your main code here, to run repeatedly:
-  
-  if ( newData ) 
+  ads_ring_sample_t samples[8];
+  uint16_t count;
+
+  while((count = ads_ring_pop(&sample_ring, samples, 8)) > 0)
   {
-    if(Bluefruit.connected())
+    for(uint16_t i = 0; i < count; i++)
     {
-      uint8_t ang_encoded[8];
-      memcpy(&ang_encoded[0], &ang[0], sizeof(float));
-      memcpy(&ang_encoded[4], &ang[1], sizeof(float));
-      angmc.notify(ang_encoded, sizeof(ang_encoded));
+      float ang[2];
+      ang[0] = ads_q5_to_float(samples[i].raw[0]);
+      ang[1] = ads_q5_to_float(samples[i].raw[1]);
+
+      // Follows the rate set over BLE or the serial port
+      filters.process(ads_two_axis_get_default_device(), ang);
+
+      int16_t filtered[2];
+      filtered[0] = ads_float_to_q5(ang[0]);
+      filtered[1] = ads_float_to_q5(ang[1]);
+
+      ads_pkt_add(&packetizer, filtered, samples[i].timestamp);
+
+      Serial.print(ang[0]); 
+      Serial.print(","); 
+      Serial.println(ang[1]);
     }
-    newData = false;
+  }
+
+  // Follow the MTU the central agreed to, then send packets that got old
+  if(conn_handle_active != BLE_CONN_HANDLE_INVALID)
+  {
+    uint16_t size = Bluefruit.Connection(conn_handle_active)->getMtu() - 3;
 
-    Serial.print(ang[0]); 
-    Serial.print(","); 
-    Serial.println(ang[1]);
+    if(size > ADS_PKT_MAX_SIZE)
+      size = ADS_PKT_MAX_SIZE;
+
+    if(size != packetizer.size)
+      ads_pkt_set_size(&packetizer, size);
+  }
+
+  ads_pkt_poll(&packetizer, ads_hal_get_time_us());
+
+  uint32_t overruns = ads_ring_take_overruns(&sample_ring);
+  if(overruns)
+  {
+    Serial.print("Samples dropped: ");
+    Serial.println(overruns);
   }
 
   if(Serial.available())
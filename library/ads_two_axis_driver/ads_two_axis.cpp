@@ -9,28 +9,115 @@
  */
 
 #include "ads_two_axis.h"
+#include "ads_two_axis_rate.h"
+#include "ads_two_axis_cal.h"
 
-static ads_callback ads_data_callback;
+static ads_dev_t ads_default_dev;
+
+static_assert(sizeof(ads_sample_t) <= ADS_READ_BUFFER_SIZE, "ads_sample_t must fit the HAL read buffer");
+
+/**
+ * @brief Hands a decoded sample to the callback selected for dev. buffer
+ *				is the packet it was decoded from and is reused for the
+ *				sample record.
+ */
+static void ads_two_axis_deliver(ads_dev_t * dev, uint8_t * buffer, const int16_t * raw)
+{
+	if(dev->ctx_sample_callback)
+	{
+		ads_sample_t * sample = (ads_sample_t *)buffer;
+		
+		sample->raw[0] = raw[0];
+		sample->raw[1] = raw[1];
+		sample->time = dev->time;
+		sample->address = dev->hal.address;
+		sample->axes = dev->axes;
+		sample->status = (dev->time.gap ? ADS_SAMPLE_GAP : 0) | (dev->cal ? ADS_SAMPLE_CALIBRATED : 0);
+		
+		dev->ctx_sample_callback(dev, sample, dev->callback_ctx);
+		return;
+	}
+	
+	if(dev->timed_sample_callback)
+	{
+		dev->timed_sample_callback(dev, raw, &dev->time);
+		return;
+	}
+	
+	if(dev->raw_sample_callback)
+	{
+		dev->raw_sample_callback(dev, raw);
+		return;
+	}
+	
+#if ADS_FLOAT_SAMPLES
+	float sample[2];
+	
+	sample[0] = ads_q5_to_float(raw[0]);
+	sample[1] = ads_q5_to_float(raw[1]);
+	
+	if(dev->dev_sample_callback)
+		dev->dev_sample_callback(dev, sample);
+	else if(dev->sample_callback)
+		dev->sample_callback(sample);
+#endif
+}
 
 /**
- * @brief Parses sample buffer from two axis ADS. Scales to degrees and
- *				executes callback registered in ads_two_axis_init. 
+ * @brief Parses sample buffer from two axis ADS and executes the callback
+ *				registered in ads_two_axis_dev_init. Only the float
+ *				callbacks scale to degrees.
  *				This function is called from ads_two_axis_hal. Application should never call this function.
  */	
-void ads_two_axis_parse_read_buffer(uint8_t * buffer)
+static void ads_two_axis_parse_read_buffer(ads_hal_dev_t * hal, uint8_t * buffer)
 {
-	if(buffer[0] == ADS_SAMPLE)
+	ads_dev_t * dev = (ads_dev_t *)hal->ctx;
+	
+	if(dev->rec)
+		ads_rec_write_packet(dev->rec, hal->sample_time, hal->address, buffer);
+	
+	if(buffer[0] != ADS_SAMPLE)
 	{
-		float sample[2];
-				
-		int16_t temp = ads_int16_decode(&buffer[1]);
-		sample[0] = (float)temp/32.0f;
+		ADS_STATS_INC(dropped_packets);
+		return;
+	}
+	
+	ADS_STATS_INC(samples);
+	
+	int16_t raw[2];
+	
+	raw[0] = ads_int16_decode(&buffer[1]);
+	raw[1] = ads_int16_decode(&buffer[3]);
+	
+	if(dev->cal)
+		ads_cal_apply(dev->cal, raw);
+	
+	dev->time.edge_us = hal->sample_time;
+	dev->time.time_us = ads_clock_update(&dev->clock, hal->sample_time);
+	dev->time.gap = dev->clock.gap;
+	
+	if(dev->ring)
+	{
+		ads_ring_sample_t entry;
 		
-		temp = ads_int16_decode(&buffer[3]);
-		sample[1] = (float)temp/32.0f;
+		entry.timestamp = dev->time.time_us;
+		entry.raw[0] = raw[0];
+		entry.raw[1] = raw[1];
 		
-		ads_data_callback(sample);
+		ads_ring_push(dev->ring, &entry);
 	}
+	else
+	{
+		ADS_STATS_START(start);
+		
+		ads_two_axis_deliver(dev, buffer, raw);
+		
+		ADS_STATS_TIME(callback, start);
+	}
+	
+	// After delivery, the sample was taken at the old rate
+	if(dev->rate)
+		ads_rate_update(dev->rate, raw, &dev->time);
 }
 
 /**
@@ -41,12 +128,7 @@ void ads_two_axis_parse_read_buffer(uint8_t * buffer)
  */
 int ads_two_axis_run(bool run)
 {
-	uint8_t buffer[ADS_TRANSFER_SIZE];
-		
-	buffer[0] = ADS_RUN;
-	buffer[1] = run;
-		
-	return ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
+	return ads_two_axis_dev_run(&ads_default_dev, run);
 }
 
 /**
@@ -57,12 +139,7 @@ int ads_two_axis_run(bool run)
  */
 int ads_two_axis_set_sample_rate(ADS_SPS_T sps)
 {
-	uint8_t buffer[ADS_TRANSFER_SIZE];
-	
-	buffer[0] = ADS_SPS;
-	ads_uint16_encode(sps, &buffer[1]);
-	
-	return ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
+	return ads_two_axis_dev_set_sample_rate(&ads_default_dev, sps);
 }
 
 /**
@@ -73,12 +150,7 @@ int ads_two_axis_set_sample_rate(ADS_SPS_T sps)
  */
 int ads_two_axis_enable_interrupt(bool enable)
 {
-	uint8_t buffer[ADS_TRANSFER_SIZE];
-	
-	buffer[0] = ADS_INTERRUPT_ENABLE;
-	buffer[1] = enable;
-	
-	return ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
+	return ads_two_axis_dev_enable_interrupt(&ads_default_dev, enable);
 }
 
 /**
@@ -92,17 +164,9 @@ int ads_two_axis_enable_interrupt(bool enable)
  */
 int ads_two_axis_update_device_address(uint8_t device, uint8_t address)
 {
-	uint8_t buffer[ADS_TRANSFER_SIZE];
-	
-	buffer[0] = ADS_SET_ADDRESS;
-	buffer[1] = address;
-	
-	if(ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE) != ADS_OK)
-		return ADS_ERR_IO;
+	(void)device;
 	
-	ads_hal_set_address(address);
-	
-	return ADS_OK;
+	return ads_two_axis_dev_update_device_address(&ads_default_dev, address);
 }
 
 
@@ -114,33 +178,82 @@ int ads_two_axis_update_device_address(uint8_t device, uint8_t address)
  */
 int ads_two_axis_init(ads_init_t * ads_init)
 {	
-	ads_hal_init(&ads_two_axis_parse_read_buffer, ads_init->reset_pin, ads_init->datardy_pin);	
-	
-	ads_data_callback = ads_init->ads_sample_callback;
-	
-	// Check that the device id matched ADS_TWO_AXIS
-	// Check that the device type is a one axis
-	ADS_DEV_TYPE_T ads_dev_type;
-	if (ads_get_dev_type(&ads_dev_type) != ADS_OK)
-		return ADS_ERR_DEV_ID;
+	return ads_two_axis_dev_init(&ads_default_dev, ads_hal_get_address(), ads_init);
+}
 
-	switch (ads_dev_type)
+/**
+ * @brief Routes samples into a lock-free ring instead of ads_sample_callback.
+ *				The data ready interrupt then only decodes and stores the
+ *				sample; the application drains the ring with ads_ring_pop().
+ *
+ * @param	ring	initialized ring, NULL to return to the callback
+ * @return	ADS_OK
+ */
+int ads_two_axis_set_sample_ring(ads_ring_t * ring)
+{
+	return ads_two_axis_dev_set_sample_ring(&ads_default_dev, ring);
+}
+
+/**
+ * @brief Records every packet read from the ADS, and configuration changes
+ *
+ * @param	rec		initialized writer, NULL to stop recording
+ */
+void ads_two_axis_set_recorder(ads_rec_writer_t * rec)
+{
+	ads_two_axis_dev_set_recorder(&ads_default_dev, rec);
+}
+
+/**
+ * @brief Delivers samples as raw Q10.5 values instead of degrees
+ *
+ * @param	callback	raw sample callback, NULL to return to the float callbacks
+ */
+void ads_two_axis_set_raw_callback(ads_raw_callback callback)
+{
+	ads_two_axis_dev_set_raw_callback(&ads_default_dev, callback);
+}
+
+/**
+ * @brief Selects deferred read mode. The data ready interrupt then only
+ *				records the edge time and sets a pending flag, and the packet
+ *				is read and parsed by ads_two_axis_service().
+ *
+ * @param	deferred	true to defer reads, false to read in the interrupt
+ * @param	notify		called from interrupt context on each edge, NULL if polled
+ */
+void ads_two_axis_set_deferred(bool deferred, void (*notify)(void))
+{
+	ads_two_axis_dev_set_deferred(&ads_default_dev, deferred, notify);
+}
+
+/**
+ * @brief Reads and parses pending samples of every device in deferred mode,
+ *				then writes the rate changes picked by rate controllers
+ *
+ * @return	number of samples parsed or ADS_ERR_IO if a transfer failed
+ */
+int ads_two_axis_service(void)
+{
+	int handled = ads_hal_service();
+
+	if(handled < 0)
+		return handled;
+
+	for(uint8_t i = 0; i < ADS_COUNT; i++)
 	{
-	case ADS_DEV_TWO_AXIS_V1:
-	case ADS_DEV_TWO_AXIS_V2:
-		break;
-	default:
-		return ADS_ERR_DEV_ID;
-	}
-	
-	ads_hal_delay(2);
+		ads_hal_dev_t * hal = ads_hal_get_device(i);
 
-	if(ads_two_axis_set_sample_rate(ads_init->sps))
-		return ADS_ERR;
+		if(hal == NULL || hal->read_callback != ads_two_axis_parse_read_buffer)
+			continue;
 
-	ads_hal_delay(2);
+		ads_dev_t * dev = (ads_dev_t *)hal->ctx;
 
-	return ADS_OK;
+		if(dev->rate && ads_rate_apply(dev->rate, dev) != ADS_OK)
+			return ADS_ERR_IO;
+	}
+
+	return handled;
 }
 
 /**
@@ -160,13 +273,7 @@ int ads_two_axis_init(ads_init_t * ads_init)
  */
 int ads_two_axis_calibrate(ADS_CALIBRATION_STEP_T ads_calibration_step, uint8_t degrees)
 {
-	uint8_t buffer[ADS_TRANSFER_SIZE];
-	
-	buffer[0] = ADS_CALIBRATE;
-	buffer[1] = ads_calibration_step;
-	buffer[2] = degrees;
-	
-	return ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
+	return ads_two_axis_dev_calibrate(&ads_default_dev, ads_calibration_step, degrees);
 }
 
 /**
@@ -181,15 +288,7 @@ int ads_two_axis_calibrate(ADS_CALIBRATION_STEP_T ads_calibration_step, uint8_t
  */
 int ads_two_axis_enable_axis(uint8_t axes_enable)
 {
-	if(!(axes_enable & (ADS_AXIS_0_EN | ADS_AXIS_1_EN)))
-			return ADS_ERR_BAD_PARAM;
-	
-	uint8_t buffer[ADS_TRANSFER_SIZE];
-	
-	buffer[0] = ADS_AXES_ENALBED;
-	buffer[1] = axes_enable;
-	
-	return ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
+	return ads_two_axis_dev_enable_axis(&ads_default_dev, axes_enable);
 }
 
 /**
@@ -199,27 +298,82 @@ int ads_two_axis_enable_axis(uint8_t axes_enable)
  */
 int ads_two_axis_shutdown(void)
 {
-	uint8_t buffer[ADS_TRANSFER_SIZE];
-	
-	buffer[0] = ADS_SHUTDOWN;
-	
-	return ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
+	return ads_two_axis_dev_shutdown(&ads_default_dev);
 }
 
 /**
- * @brief Wakes up ADS from shutdown. Delay is necessary for ADS to reinitialize 
+ * @brief Wakes up ADS from shutdown. Delay is necessary for ADS to reinitialize,
+ *				with ADS_STARTUP_POLL it returns as soon as the ADS answers.
  *
- * @return	ADS_OK if successful ADS_ERR_IO if failed
+ * @return	ADS_OK if successful ADS_ERR_TIMEOUT if failed
  */
 int ads_two_axis_wake(void)
 {
-	// Reset ADS to wake from shutdown
-	ads_hal_reset();
-	
-	// Allow time for ADS to reinitialize 
-	ads_hal_delay(100);	
-	
-	return ADS_OK;
+	return ads_two_axis_dev_wake(&ads_default_dev);
+}
+
+/**
+ * @brief Time the ADS took from its last reset until it was ready, in
+ *				microseconds. With ADS_STARTUP_FIXED this is the time waited.
+ */
+uint32_t ads_two_axis_get_ready_time_us(void)
+{
+	return ads_default_dev.ready_us;
+}
+
+void ads_two_axis_set_timed_callback(ads_timed_callback callback)
+{
+	ads_two_axis_dev_set_timed_callback(&ads_default_dev, callback);
+}
+
+void ads_two_axis_set_sample_callback(ads_sample_ctx_callback callback, void * ctx)
+{
+	ads_two_axis_dev_set_sample_callback(&ads_default_dev, callback, ctx);
+}
+
+void ads_two_axis_set_startup(ADS_STARTUP_T startup, uint16_t ready_timeout_ms)
+{
+	ads_two_axis_dev_set_startup(&ads_default_dev, startup, ready_timeout_ms);
+}
+
+void ads_two_axis_get_sample_time(ads_sample_time_t * time)
+{
+	*time = ads_default_dev.time;
+}
+
+int32_t ads_two_axis_get_drift_ppm(void)
+{
+	return ads_clock_get_drift_ppm(&ads_default_dev.clock);
+}
+
+uint32_t ads_two_axis_get_dropped_count(void)
+{
+	return ads_default_dev.clock.dropped;
+}
+
+int ads_two_axis_set_rate_control(ads_rate_t * rate)
+{
+	return ads_two_axis_dev_set_rate_control(&ads_default_dev, rate);
+}
+
+void ads_two_axis_set_calibration(const ads_cal_t * cal)
+{
+	ads_two_axis_dev_set_calibration(&ads_default_dev, cal);
+}
+
+int ads_two_axis_apply(const ads_config_t * config)
+{
+	return ads_two_axis_dev_apply(&ads_default_dev, config);
+}
+
+void ads_two_axis_get_config(ads_config_t * config)
+{
+	ads_two_axis_dev_get_config(&ads_default_dev, config);
+}
+
+uint32_t ads_two_axis_get_elided_count(void)
+{
+	return ads_default_dev.shadow.elided;
 }
 
 /**
@@ -254,20 +408,491 @@ int ads_get_dev_id(void)
  */
 int ads_get_dev_type(ADS_DEV_TYPE_T * ads_dev_type)
 {
-	uint8_t buffer[ADS_TRANSFER_SIZE];
+	return ads_two_axis_dev_get_dev_type(&ads_default_dev, ads_dev_type);
+}
+
+/**
+ * @brief Queues an ADS_GET_DEV_ID query and returns at once. Read the type
+ *				with ads_cmd_get_dev_type() once the command is done.
+ *
+ * @param cmd		command storage, valid until done
+ * @param callback	completion callback, may be NULL
+ * @param ctx		passed to callback
+ * @return	ADS_OK or ADS_ERR_OP_IN_PROGRESS if cmd is still queued
+ */
+int ads_get_dev_type_async(ads_cmd_t * cmd, ads_cmd_callback callback, void * ctx)
+{
+	return ads_two_axis_dev_get_dev_type_async(&ads_default_dev, cmd, callback, ctx);
+}
+
+
+/************************************************************************/
+/*                         Per device functions                         */
+/************************************************************************/
+
+ads_dev_t * ads_two_axis_get_default_device(void)
+{
+	return &ads_default_dev;
+}
+
+/**
+ * @brief Initializes the hardware abstraction layer for dev and sets the
+ *				sample rate of the ADS
+ *
+ * @param	dev			zero initialized device
+ * @param	address		I2C address of the ADS
+ * @param	ads_init_t	initialization structure of the ADS
+ * @return	ADS_OK if successful ADS_ERR if failed
+ */
+int ads_two_axis_dev_init(ads_dev_t * dev, uint8_t address, ads_init_t * ads_init)
+{
+	int ret = ads_two_axis_dev_begin(dev, address, ads_init);
 	
-	buffer[0] = ADS_GET_DEV_ID;
+	if(ret != ADS_OK)
+		return ret;
+	
+	return ads_two_axis_dev_finish(dev);
+}
+
+int ads_two_axis_dev_begin(ads_dev_t * dev, uint8_t address, ads_init_t * ads_init)
+{
+#if ADS_FLOAT_SAMPLES
+	dev->sample_callback = ads_init->ads_sample_callback;
+#endif
+	dev->sps = ads_init->sps;
+	dev->axes = ADS_AXIS_0_EN | ADS_AXIS_1_EN;
+	dev->ready_us = 0;
+	dev->shadow.elided = 0;
+	ads_clock_init(&dev->clock, dev->sps);
+	
+	if(ads_hal_dev_register(&dev->hal, &ads_two_axis_parse_read_buffer, dev, address,
+							ads_init->reset_pin, ads_init->datardy_pin) != ADS_OK)
+		return ADS_ERR_IO;
+	
+	ads_two_axis_dev_invalidate_shadow(dev);
+	
+	// Single device functions and DFU act on the device set up through them
+	if(dev == &ads_default_dev)
+		ads_hal_set_default_device(&dev->hal);
+	
+	return ADS_OK;
+}
+
+int ads_two_axis_dev_finish(ads_dev_t * dev)
+{
+	int ret = ads_two_axis_dev_wait_ready(dev);
+	
+	if(ret != ADS_OK)
+		return ret;
+	
+	ads_hal_dev_pin_int_enable(&dev->hal, true);
 	
-	// Disable interrupt to prevent callback from reading out device id
-	ads_hal_pin_int_enable(false);
+	// Check that the device id matched ADS_TWO_AXIS
+	// Check that the device type is a one axis
+	ADS_DEV_TYPE_T ads_dev_type;
+	if (ads_two_axis_dev_get_dev_type(dev, &ads_dev_type) != ADS_OK)
+		return ADS_ERR_DEV_ID;
+
+	switch (ads_dev_type)
+	{
+	case ADS_DEV_TWO_AXIS_V1:
+	case ADS_DEV_TWO_AXIS_V2:
+		break;
+	default:
+		return ADS_ERR_DEV_ID;
+	}
 	
-	ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
 	ads_hal_delay(2);
-	ads_hal_read_buffer(buffer, ADS_TRANSFER_SIZE);
+
+	if(ads_two_axis_dev_set_sample_rate(dev, dev->sps))
+		return ADS_ERR;
+
+	ads_hal_delay(2);
+
+	return ADS_OK;
+}
+
+int ads_two_axis_dev_init_all(ads_dev_t * devs, const uint8_t * addresses, ads_init_t * ads_inits, uint8_t count)
+{
+	int ret = ADS_OK;
+	
+	// Reset every device before waiting for any of them
+	for(uint8_t i = 0; i < count; i++)
+	{
+		ret = ads_two_axis_dev_begin(&devs[i], addresses[i], &ads_inits[i]);
+		
+		if(ret != ADS_OK)
+			return ret;
+	}
+	
+	for(uint8_t i = 0; i < count; i++)
+	{
+		int dev_ret = ads_two_axis_dev_finish(&devs[i]);
+		
+		if(dev_ret != ADS_OK && ret == ADS_OK)
+			ret = dev_ret;
+	}
+	
+	return ret;
+}
+
+/**
+ * @brief Waits until dev answers after its last reset
+ *
+ * @param	fixed_ms	time to sleep with ADS_STARTUP_FIXED
+ */
+static int ads_two_axis_dev_await(ads_dev_t * dev, uint16_t fixed_ms)
+{
+	uint32_t elapsed_us = ads_hal_get_time_us() - dev->hal.reset_time;
+	
+	if(dev->startup != ADS_STARTUP_POLL)
+	{
+		// Time spent since the reset, e.g. booting other devices, counts
+		if(elapsed_us < (uint32_t)fixed_ms * 1000)
+			ads_hal_delay(fixed_ms - elapsed_us / 1000);
+		
+		dev->ready_us = ads_hal_get_time_us() - dev->hal.reset_time;
+		return ADS_OK;
+	}
 	
-	ads_hal_pin_int_enable(true);
+	uint32_t timeout_us = (uint32_t)(dev->ready_timeout_ms ? dev->ready_timeout_ms : ADS_BOOT_DELAY_MS) * 1000;
+	uint16_t interval_ms = ADS_READY_POLL_MIN_MS;
 	
-	if (buffer[0] == ADS_DEV_ID)
+	for(;;)
+	{
+		uint8_t buffer[ADS_TRANSFER_SIZE];
+		
+		buffer[0] = ADS_GET_DEV_ID;
+		
+		// A booting ADS does not acknowledge its address
+		if(ads_hal_dev_write_read_buffer(&dev->hal, buffer, ADS_TRANSFER_SIZE, ADS_TRANSFER_SIZE) == ADS_OK &&
+		   buffer[0] == ADS_DEV_ID)
+		{
+			dev->ready_us = ads_hal_get_time_us() - dev->hal.reset_time;
+			return ADS_OK;
+		}
+		
+		elapsed_us = ads_hal_get_time_us() - dev->hal.reset_time;
+		
+		if(elapsed_us >= timeout_us)
+			return ADS_ERR_TIMEOUT;
+		
+		uint32_t remaining_ms = (timeout_us - elapsed_us + 999) / 1000;
+		
+		ads_hal_delay(interval_ms < remaining_ms ? interval_ms : (uint16_t)remaining_ms);
+		
+		if(interval_ms < ADS_READY_POLL_MAX_MS)
+			interval_ms *= 2;
+	}
+}
+
+int ads_two_axis_dev_wait_ready(ads_dev_t * dev)
+{
+	return ads_two_axis_dev_await(dev, ADS_BOOT_DELAY_MS);
+}
+
+/**
+ * @brief true if field of the ADS is known to hold the value about to be
+ *				written, counts the skipped write
+ *
+ * @param	field	ADS_SHADOW_* field
+ * @param	same	true if the cached value equals the new one
+ */
+static bool ads_two_axis_shadow_match(ads_dev_t * dev, uint8_t field, bool same)
+{
+	// Any reset since the fields were written, also one of a device sharing the reset pin
+	if(dev->shadow.epoch != dev->hal.reset_time)
+		ads_two_axis_dev_invalidate_shadow(dev);
+	
+	if((dev->shadow.valid & field) && same)
+	{
+		dev->shadow.elided++;
+		return true;
+	}
+	
+	return false;
+}
+
+/**
+ * @brief Marks field as known after an acknowledged write, unknown after a
+ *				failed one
+ */
+static int ads_two_axis_shadow_update(ads_dev_t * dev, uint8_t field, int ret)
+{
+	if(ret == ADS_OK)
+		dev->shadow.valid |= field;
+	else
+		dev->shadow.valid &= ~field;
+	
+	return ret;
+}
+
+int ads_two_axis_dev_run(ads_dev_t * dev, bool run)
+{
+	if(ads_two_axis_shadow_match(dev, ADS_SHADOW_RUN, dev->shadow.config.run == run))
+		return ADS_OK;
+	
+	uint8_t buffer[ADS_TRANSFER_SIZE];
+		
+	buffer[0] = ADS_RUN;
+	buffer[1] = run;
+	
+	dev->shadow.config.run = run;
+	
+	// Sampling starts over with a new phase
+	ads_clock_restart(&dev->clock);
+		
+	return ads_two_axis_shadow_update(dev, ADS_SHADOW_RUN,
+									  ads_hal_dev_write_buffer(&dev->hal, buffer, ADS_TRANSFER_SIZE));
+}
+
+int ads_two_axis_dev_set_sample_rate(ads_dev_t * dev, ADS_SPS_T sps)
+{
+	if(ads_two_axis_shadow_match(dev, ADS_SHADOW_SPS, dev->shadow.config.sps == sps))
+		return ADS_OK;
+	
+	uint8_t buffer[ADS_TRANSFER_SIZE];
+	
+	buffer[0] = ADS_SPS;
+	ads_uint16_encode(sps, &buffer[1]);
+	
+	dev->shadow.config.sps = sps;
+	
+	if(ads_two_axis_shadow_update(dev, ADS_SHADOW_SPS,
+								  ads_hal_dev_write_buffer(&dev->hal, buffer, ADS_TRANSFER_SIZE)) != ADS_OK)
+		return ADS_ERR_IO;
+	
+	dev->sps = sps;
+	ads_clock_set_rate(&dev->clock, sps);
+	
+	if(dev->rec)
+		ads_rec_write_state(dev->rec, ads_hal_get_time_us(), dev->hal.address, sps, dev->axes);
+	
+	return ADS_OK;
+}
+
+int ads_two_axis_dev_enable_interrupt(ads_dev_t * dev, bool enable)
+{
+	if(ads_two_axis_shadow_match(dev, ADS_SHADOW_INT, dev->shadow.config.int_enable == enable))
+		return ADS_OK;
+	
+	uint8_t buffer[ADS_TRANSFER_SIZE];
+	
+	buffer[0] = ADS_INTERRUPT_ENABLE;
+	buffer[1] = enable;
+	
+	dev->shadow.config.int_enable = enable;
+	
+	ads_clock_restart(&dev->clock);
+	
+	return ads_two_axis_shadow_update(dev, ADS_SHADOW_INT,
+									  ads_hal_dev_write_buffer(&dev->hal, buffer, ADS_TRANSFER_SIZE));
+}
+
+int ads_two_axis_dev_update_device_address(ads_dev_t * dev, uint8_t address)
+{
+	uint8_t buffer[ADS_TRANSFER_SIZE];
+	
+	buffer[0] = ADS_SET_ADDRESS;
+	buffer[1] = address;
+	
+	if(ads_hal_dev_write_buffer(&dev->hal, buffer, ADS_TRANSFER_SIZE) != ADS_OK)
+		return ADS_ERR_IO;
+	
+	dev->hal.address = address;
+	
+	return ADS_OK;
+}
+
+int ads_two_axis_dev_set_sample_ring(ads_dev_t * dev, ads_ring_t * ring)
+{
+	dev->ring = ring;
+	
+	return ADS_OK;
+}
+
+void ads_two_axis_dev_set_recorder(ads_dev_t * dev, ads_rec_writer_t * rec)
+{
+	dev->rec = rec;
+	
+	// Start with the current configuration so the recording replays on its own
+	if(rec)
+		ads_rec_write_state(rec, ads_hal_get_time_us(), dev->hal.address, dev->sps, dev->axes);
+}
+
+void ads_two_axis_dev_set_raw_callback(ads_dev_t * dev, ads_raw_callback callback)
+{
+	dev->raw_sample_callback = callback;
+}
+
+void ads_two_axis_dev_set_timed_callback(ads_dev_t * dev, ads_timed_callback callback)
+{
+	dev->timed_sample_callback = callback;
+}
+
+void ads_two_axis_dev_set_sample_callback(ads_dev_t * dev, ads_sample_ctx_callback callback, void * ctx)
+{
+	dev->ctx_sample_callback = callback;
+	dev->callback_ctx = ctx;
+}
+
+#if ADS_FLOAT_SAMPLES
+void ads_two_axis_dev_set_dev_callback(ads_dev_t * dev, ads_dev_callback callback)
+{
+	dev->dev_sample_callback = callback;
+}
+#endif
+
+void ads_two_axis_dev_set_startup(ads_dev_t * dev, ADS_STARTUP_T startup, uint16_t ready_timeout_ms)
+{
+	dev->startup = startup;
+	dev->ready_timeout_ms = ready_timeout_ms;
+}
+
+int ads_two_axis_dev_set_rate_control(ads_dev_t * dev, ads_rate_t * rate)
+{
+	dev->rate = rate;
+	
+	if(rate == NULL)
+		return ADS_OK;
+	
+	return ads_two_axis_dev_set_sample_rate(dev, ads_rate_get_sps(rate));
+}
+
+void ads_two_axis_dev_set_calibration(ads_dev_t * dev, const ads_cal_t * cal)
+{
+	dev->cal = cal;
+}
+
+void ads_two_axis_dev_set_deferred(ads_dev_t * dev, bool deferred, void (*notify)(void))
+{
+	ads_hal_dev_set_deferred(&dev->hal, deferred, notify);
+}
+
+int ads_two_axis_dev_service(ads_dev_t * dev)
+{
+	int handled = ads_hal_dev_service(&dev->hal);
+
+	if(handled < 0)
+		return handled;
+
+	if(dev->rate && ads_rate_apply(dev->rate, dev) != ADS_OK)
+		return ADS_ERR_IO;
+
+	return handled;
+}
+
+int ads_two_axis_dev_calibrate(ads_dev_t * dev, ADS_CALIBRATION_STEP_T ads_calibration_step, uint8_t degrees)
+{
+	uint8_t buffer[ADS_TRANSFER_SIZE];
+	
+	buffer[0] = ADS_CALIBRATE;
+	buffer[1] = ads_calibration_step;
+	buffer[2] = degrees;
+	
+	return ads_hal_dev_write_buffer(&dev->hal, buffer, ADS_TRANSFER_SIZE);
+}
+
+int ads_two_axis_dev_enable_axis(ads_dev_t * dev, uint8_t axes_enable)
+{
+	if(!(axes_enable & (ADS_AXIS_0_EN | ADS_AXIS_1_EN)))
+			return ADS_ERR_BAD_PARAM;
+	
+	if(ads_two_axis_shadow_match(dev, ADS_SHADOW_AXES, dev->shadow.config.axes == axes_enable))
+		return ADS_OK;
+	
+	uint8_t buffer[ADS_TRANSFER_SIZE];
+	
+	buffer[0] = ADS_AXES_ENALBED;
+	buffer[1] = axes_enable;
+	
+	dev->shadow.config.axes = axes_enable;
+	
+	if(ads_two_axis_shadow_update(dev, ADS_SHADOW_AXES,
+								  ads_hal_dev_write_buffer(&dev->hal, buffer, ADS_TRANSFER_SIZE)) != ADS_OK)
+		return ADS_ERR_IO;
+	
+	dev->axes = axes_enable;
+	
+	if(dev->rec)
+		ads_rec_write_state(dev->rec, ads_hal_get_time_us(), dev->hal.address, dev->sps, axes_enable);
+	
+	return ADS_OK;
+}
+
+int ads_two_axis_dev_shutdown(ads_dev_t * dev)
+{
+	uint8_t buffer[ADS_TRANSFER_SIZE];
+	
+	buffer[0] = ADS_SHUTDOWN;
+	
+	ads_two_axis_dev_invalidate_shadow(dev);
+	
+	return ads_hal_dev_write_buffer(&dev->hal, buffer, ADS_TRANSFER_SIZE);
+}
+
+int ads_two_axis_dev_wake(ads_dev_t * dev)
+{
+	// Reset ADS to wake from shutdown
+	ads_hal_dev_reset(&dev->hal);
+	ads_two_axis_dev_invalidate_shadow(dev);
+	
+	// Allow time for ADS to reinitialize 
+	return ads_two_axis_dev_await(dev, ADS_WAKE_DELAY_MS);
+}
+
+int ads_two_axis_dev_apply(ads_dev_t * dev, const ads_config_t * config)
+{
+	if(!(config->axes & (ADS_AXIS_0_EN | ADS_AXIS_1_EN)))
+		return ADS_ERR_BAD_PARAM;
+	
+	int ret = ADS_OK;
+	
+	// Interrupts are masked once around all the writes
+	ads_hal_transfer_begin();
+	
+	// Stop before reconfiguring, start once configured
+	if(!config->run)
+		ret = ads_two_axis_dev_run(dev, false);
+	
+	if(ret == ADS_OK)
+		ret = ads_two_axis_dev_enable_axis(dev, config->axes);
+	
+	if(ret == ADS_OK)
+		ret = ads_two_axis_dev_set_sample_rate(dev, config->sps);
+	
+	if(ret == ADS_OK)
+		ret = ads_two_axis_dev_enable_interrupt(dev, config->int_enable);
+	
+	if(ret == ADS_OK && config->run)
+		ret = ads_two_axis_dev_run(dev, true);
+	
+	ads_hal_transfer_end();
+	
+	return ret;
+}
+
+void ads_two_axis_dev_get_config(ads_dev_t * dev, ads_config_t * config)
+{
+	*config = dev->shadow.config;
+	config->sps = dev->sps;
+	config->axes = dev->axes;
+}
+
+void ads_two_axis_dev_invalidate_shadow(ads_dev_t * dev)
+{
+	dev->shadow.valid = 0;
+	dev->shadow.epoch = dev->hal.reset_time;
+}
+
+int ads_two_axis_dev_get_dev_type(ads_dev_t * dev, ADS_DEV_TYPE_T * ads_dev_type)
+{
+	uint8_t buffer[ADS_TRANSFER_SIZE];
+	
+	buffer[0] = ADS_GET_DEV_ID;
+	
+	if (ads_hal_dev_write_read_buffer(&dev->hal, buffer, ADS_TRANSFER_SIZE, ADS_TRANSFER_SIZE) == ADS_OK &&
+		buffer[0] == ADS_DEV_ID)
 	{
 		switch (buffer[1])
 		{
@@ -283,3 +908,8 @@ int ads_get_dev_type(ADS_DEV_TYPE_T * ads_dev_type)
 	*ads_dev_type = ADS_DEV_UNKNOWN;
 	return ADS_ERR_DEV_ID;
 }
+
+int ads_two_axis_dev_get_dev_type_async(ads_dev_t * dev, ads_cmd_t * cmd, ads_cmd_callback callback, void * ctx)
+{
+	return ads_cmd_submit_query(cmd, &dev->hal, ADS_GET_DEV_ID, callback, ctx);
+}
@@ -17,10 +17,24 @@
 #include "ads_two_axis_err.h"
 #include "ads_two_axis_dfu.h"
 #include "ads_two_axis_util.h"
+#include "ads_two_axis_ring.h"
+#include "ads_two_axis_rec.h"
+#include "ads_two_axis_cmd.h"
+#include "ads_two_axis_clock.h"
+#include "ads_two_axis_stats.h"
 
 #define ADS_DFU_CHECK				(1)		// Set this to 1 to check if the newest firmware is on the ADS
+#define ADS_WAKE_DELAY_MS			(100)	// Fixed wait after a wake reset
+#define ADS_READY_POLL_MIN_MS		(1)		// First interval between readiness polls
+#define ADS_READY_POLL_MAX_MS		(32)	// Cap of the doubling poll interval
 
+#ifndef ADS_FLOAT_SAMPLES
+#define ADS_FLOAT_SAMPLES			(1)		// Set this to 0 to drop the float sample callbacks, only raw Q10.5 samples are delivered
+#endif
+
+#if ADS_FLOAT_SAMPLES
 typedef void (*ads_callback)(float*);
+#endif
 
 
 typedef enum {
@@ -42,19 +56,123 @@ typedef enum {
 	ADS_500_HZ = 32,
 } ADS_SPS_T;
 
+/* How initialization and wake wait for the ADS to boot after a reset */
+typedef enum {
+	ADS_STARTUP_FIXED = 0,				// Sleep the worst case boot time
+	ADS_STARTUP_POLL					// Poll the device id until it answers
+} ADS_STARTUP_T;
+
 /* Device IDS */
 typedef enum {
 	ADS_ONE_AXIS = 1,
 	ADS_TWO_AXIS = 2,
 } ADS_DEV_IDS_T;
 
+typedef struct ads_dev_s ads_dev_t;
+typedef struct ads_rate_s ads_rate_t;		// ads_two_axis_rate.h
+typedef struct ads_cal_s ads_cal_t;			// ads_two_axis_cal.h
+
+/* Configuration applied in one step by ads_two_axis_dev_apply() */
+typedef struct {
+	bool run;							// Free run mode
+	bool int_enable;					// ADS data ready interrupt line
+	ADS_SPS_T sps;
+	uint8_t axes;						// ADS_AXIS_0_EN | ADS_AXIS_1_EN
+} ads_config_t;
+
+/* Fields of the shadow register cache */
+#define ADS_SHADOW_RUN				(0x01)
+#define ADS_SHADOW_INT				(0x02)
+#define ADS_SHADOW_SPS				(0x04)
+#define ADS_SHADOW_AXES				(0x08)
+
+/* Last configuration the ADS acknowledged. A write of a valid field with
+ * the same value is skipped. Every field becomes unknown on reset. */
+typedef struct {
+	ads_config_t config;
+	uint8_t valid;						// ADS_SHADOW_* fields known to be in config
+	uint32_t epoch;						// hal.reset_time the fields were written after
+	uint32_t elided;					// Writes skipped since init
+} ads_shadow_t;
+
+#if ADS_FLOAT_SAMPLES
+typedef void (*ads_dev_callback)(ads_dev_t * dev, float*);
+#endif
+
+/* Receives both axes in Q10.5 fixed point, degrees = raw / 32. Runs without
+ * any float arithmetic, convert with ads_q5_to_float() where needed. */
+typedef void (*ads_raw_callback)(ads_dev_t * dev, const int16_t * raw);
+
+/* Timing of one sample, in ads_hal_get_time_us() units */
+typedef struct {
+	uint32_t edge_us;					// Data ready edge as captured by the HAL
+	uint32_t time_us;					// Drift corrected sample time
+	uint16_t gap;						// Samples lost right before this one
+} ads_sample_time_t;
+
+/* Raw samples with their timing, for aligning with other sensor streams */
+typedef void (*ads_timed_callback)(ads_dev_t * dev, const int16_t * raw, const ads_sample_time_t * time);
+
+/* Status bits of ads_sample_t */
+#define ADS_SAMPLE_GAP				(0x01)	// Samples were lost right before this one
+#define ADS_SAMPLE_CALIBRATED		(0x02)	// raw is corrected by the calibration of the device
+
+/* Everything known about one sample. Built in place of the packet in the
+ * HAL read buffer of the device, valid until the callback returns. */
+typedef struct {
+	int16_t raw[2];						// Both axes, Q10.5
+	ads_sample_time_t time;
+	uint8_t address;					// I2C address of the device
+	uint8_t axes;						// ADS_AXIS_0_EN | ADS_AXIS_1_EN as configured
+	uint8_t status;						// ADS_SAMPLE_* bits
+} ads_sample_t;
+
+/* Sample record with a context pointer of the application */
+typedef void (*ads_sample_ctx_callback)(ads_dev_t * dev, const ads_sample_t * sample, void * ctx);
+
 typedef struct {
 	ADS_SPS_T sps;
+#if ADS_FLOAT_SAMPLES
 	ads_callback ads_sample_callback;
+#else
+	void * ads_sample_callback;					// Unused without float samples, keeps the layout
+#endif
 	uint32_t reset_pin;
 	uint32_t datardy_pin;
 } ads_init_t;
 
+/* One ADS and its driver state. Every ads_two_axis_dev_*() function takes
+ * one, so any number of devices can stream at the same time. Zero
+ * initialize before first use. */
+struct ads_dev_s {
+	ads_hal_dev_t hal;
+#if ADS_FLOAT_SAMPLES
+	ads_callback sample_callback;
+	ads_dev_callback dev_sample_callback;
+#endif
+	ads_raw_callback raw_sample_callback;
+	ads_timed_callback timed_sample_callback;
+	ads_sample_ctx_callback ctx_sample_callback;
+	void * callback_ctx;
+	ads_ring_t * ring;
+	ads_rec_writer_t * rec;
+	ads_rate_t * rate;
+	const ads_cal_t * cal;				// Correction applied to every sample, see ads_two_axis_cal.h
+	ADS_SPS_T sps;
+	uint8_t axes;
+	ADS_STARTUP_T startup;
+	uint16_t ready_timeout_ms;
+	uint32_t ready_us;					// Time from the last reset until the device was ready
+	ads_shadow_t shadow;
+	ads_clock_t clock;					// Sample clock estimate, see ads_two_axis_clock.h
+	ads_sample_time_t time;				// Timing of the last sample, valid in the sample callbacks
+	void * user;						// Free for use by the application
+};
+
+
+/************************************************************************/
+/*         Single device functions, act on the default device           */
+/************************************************************************/
 
 /**
  * @brief Places ADS in free run or sleep mode
@@ -99,6 +217,56 @@ int ads_two_axis_update_device_address(uint8_t device, uint8_t address);
  */
 int ads_two_axis_init(ads_init_t * ads_init);
 
+/**
+ * @brief Routes samples into a lock-free ring instead of ads_sample_callback.
+ *				The data ready interrupt then only decodes and stores the
+ *				sample; the application drains the ring with ads_ring_pop().
+ *
+ * @param	ring	initialized ring, NULL to return to the callback
+ * @return	ADS_OK
+ */
+int ads_two_axis_set_sample_ring(ads_ring_t * ring);
+
+/**
+ * @brief Records every packet read from the ADS, and sample rate and axis
+ *				changes, to a recording. Samples are still delivered as usual.
+ *				The application writes the recording out with ads_rec_service().
+ *
+ * @param	rec		initialized writer, NULL to stop recording
+ */
+void ads_two_axis_set_recorder(ads_rec_writer_t * rec);
+
+/**
+ * @brief Delivers samples as raw Q10.5 values instead of degrees. Takes
+ *				precedence over the float callbacks, the sample ring still
+ *				takes precedence over both.
+ *
+ * @param	callback	raw sample callback, NULL to return to the float callbacks
+ */
+void ads_two_axis_set_raw_callback(ads_raw_callback callback);
+
+/**
+ * @brief Selects deferred read mode. The data ready interrupt then only
+ *				records the edge time and sets a pending flag, and the packet
+ *				is read and parsed by ads_two_axis_service() in the
+ *				application loop or an RTOS task.
+ *
+ * @param	deferred	true to defer reads, false to read in the interrupt
+ * @param	notify		called from interrupt context on each edge, e.g. to
+ *						give a semaphore to the servicing task. NULL if polled.
+ */
+void ads_two_axis_set_deferred(bool deferred, void (*notify)(void));
+
+/**
+ * @brief Reads and parses pending samples of every device in deferred mode.
+ *				Also picks up samples whose data ready edge was missed while
+ *				the interrupt was masked, and writes the rate changes picked
+ *				by rate controllers. Never call from interrupt context.
+ *
+ * @return	number of samples parsed or ADS_ERR_IO if a transfer failed
+ */
+int ads_two_axis_service(void);
+
 /**
  * @brief Calibrates two axis ADS. ADS_CALIBRATE_FIRST must be at 0 degrees on both AXES.
  *				ADS_CALIBRATE_FLAT can be at 45 - 255 degrees, recommended 90 degrees.
@@ -134,12 +302,104 @@ int ads_two_axis_enable_axis(uint8_t axes_enable);
 int ads_two_axis_shutdown(void);
 
 /**
- * @brief Wakes up ADS from shutdown. Delay is necessary for ADS to reinitialize 
+ * @brief Wakes up ADS from shutdown. Delay is necessary for ADS to reinitialize,
+ *				with ADS_STARTUP_POLL it returns as soon as the ADS answers.
  *
- * @return	ADS_OK if successful ADS_ERR_IO if failed
+ * @return	ADS_OK if successful ADS_ERR_TIMEOUT if failed
  */
 int ads_two_axis_wake(void);
 
+/**
+ * @brief Time the ADS took from its last reset until it was ready, in
+ *				microseconds. With ADS_STARTUP_FIXED this is the time waited.
+ */
+uint32_t ads_two_axis_get_ready_time_us(void);
+
+/**
+ * @brief Selects how ads_two_axis_init() and ads_two_axis_wake() wait for
+ *				the ADS to boot. Call before ads_two_axis_init(), the default
+ *				is ADS_STARTUP_FIXED.
+ *
+ * @param	startup				ADS_STARTUP_FIXED or ADS_STARTUP_POLL
+ * @param	ready_timeout_ms	ADS_STARTUP_POLL limit, 0 for ADS_BOOT_DELAY_MS
+ */
+void ads_two_axis_set_startup(ADS_STARTUP_T startup, uint16_t ready_timeout_ms);
+
+/**
+ * @brief Delivers raw samples with their edge and drift corrected time
+ *				instead of the raw and float callbacks
+ *
+ * @param	callback	timed sample callback, NULL to return to the other callbacks
+ */
+void ads_two_axis_set_timed_callback(ads_timed_callback callback);
+
+/**
+ * @brief Delivers each sample as an ads_sample_t record instead of all
+ *				other callbacks. The record lives in the read buffer of the
+ *				driver, nothing is copied or allocated for it.
+ *
+ * @param	callback	sample record callback, NULL to return to the other callbacks
+ * @param	ctx			handed to every call of callback
+ */
+void ads_two_axis_set_sample_callback(ads_sample_ctx_callback callback, void * ctx);
+
+/**
+ * @brief Timing of the last sample. Call from the sample callback for the
+ *				time of the sample being delivered.
+ */
+void ads_two_axis_get_sample_time(ads_sample_time_t * time);
+
+/**
+ * @brief Measured error of the ADS sample clock against the host clock
+ *
+ * @return	parts per million, positive if the ADS samples fast
+ */
+int32_t ads_two_axis_get_drift_ppm(void);
+
+/**
+ * @brief Samples lost in gaps of the data ready edges since init
+ */
+uint32_t ads_two_axis_get_dropped_count(void);
+
+/**
+ * @brief Lets the sample rate follow the motion, see ads_two_axis_rate.h.
+ *				Starts at the fastest level of the controller, changes are
+ *				written by ads_two_axis_service().
+ *
+ * @param	rate	initialized controller, NULL to keep the current rate from now on
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_two_axis_set_rate_control(ads_rate_t * rate);
+
+/**
+ * @brief Corrects every sample with a multi-point calibration, see
+ *				ads_two_axis_cal.h. Recordings keep the uncorrected packets.
+ *
+ * @param	cal	calibration, must stay valid while attached. NULL to remove.
+ */
+void ads_two_axis_set_calibration(const ads_cal_t * cal);
+
+/**
+ * @brief Applies a complete configuration in one bus transaction group.
+ *				Only the fields that differ from the last acknowledged
+ *				configuration are written.
+ *
+ * @param	config	configuration to apply
+ * @return	ADS_OK if successful ADS_ERR_IO or ADS_ERR_BAD_PARAM if failed
+ */
+int ads_two_axis_apply(const ads_config_t * config);
+
+/**
+ * @brief Last configuration written to the ADS. Fields not written since
+ *				the last reset hold their previous or initial values.
+ */
+void ads_two_axis_get_config(ads_config_t * config);
+
+/**
+ * @brief Number of writes skipped because the ADS already had the value
+ */
+uint32_t ads_two_axis_get_elided_count(void);
+
 /**
  * @brief Checks that the device id is ADS_TWO_AXIS. ADS should not be in free run
 					when this function is called.
@@ -157,4 +417,149 @@ int ads_get_dev_id(void);
  */
  int ads_get_dev_type(ADS_DEV_TYPE_T * ads_dev_type);
 
+/**
+ * @brief Queues an ADS_GET_DEV_ID query and returns at once. Read the type
+ *				with ads_cmd_get_dev_type() once the command is done, see
+ *				ads_two_axis_cmd.h.
+ *
+ * @param cmd		command storage, valid until done
+ * @param callback	completion callback, may be NULL
+ * @param ctx		passed to callback
+ * @return	ADS_OK or ADS_ERR_OP_IN_PROGRESS if cmd is still queued
+ */
+int ads_get_dev_type_async(ads_cmd_t * cmd, ads_cmd_callback callback, void * ctx);
+
+/************************************************************************/
+/*                         Per device functions                         */
+/************************************************************************/
+
+/**
+ * @brief Device used by the single device functions above
+ */
+ads_dev_t * ads_two_axis_get_default_device(void);
+
+/**
+ * @brief Initializes an ADS at address and its own reset and data ready
+ *				lines. Its samples go to its own callback or ring, no device
+ *				selection is needed around transfers. Devices sharing a reset
+ *				line are reset together, initialize them before configuring
+ *				any of them. The other callbacks and the startup mode are
+ *				set with the ads_two_axis_dev_set_*() functions and kept
+ *				across init.
+ *
+ * @param	dev			zero initialized device, must stay valid
+ * @param	address		I2C address of the ADS
+ * @param	ads_init	initialization structure of the ADS
+ * @return	ADS_OK if successful ADS_ERR if failed
+ */
+int ads_two_axis_dev_init(ads_dev_t * dev, uint8_t address, ads_init_t * ads_init);
+
+/**
+ * @brief First half of ads_two_axis_dev_init(). Registers and resets the
+ *				ADS and returns while it boots, so several devices can boot
+ *				at the same time. Complete with ads_two_axis_dev_finish().
+ *
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_two_axis_dev_begin(ads_dev_t * dev, uint8_t address, ads_init_t * ads_init);
+
+/**
+ * @brief Second half of ads_two_axis_dev_init(). Waits until the ADS is
+ *				ready, checks its type and sets the sample rate.
+ *
+ * @return	ADS_OK if successful ADS_ERR_TIMEOUT if the ADS did not answer
+ *				in time, ADS_ERR_DEV_ID or ADS_ERR otherwise
+ */
+int ads_two_axis_dev_finish(ads_dev_t * dev);
+
+/**
+ * @brief Initializes count devices with overlapping boot times. All are
+ *				reset first, then each is completed, so a rig boots about as
+ *				fast as its slowest device instead of the sum of all.
+ *
+ * @param	devs		count zero initialized devices
+ * @param	addresses	I2C address of each device
+ * @param	ads_inits	initialization structure of each device
+ * @return	ADS_OK if every device initialized, else the first error
+ */
+int ads_two_axis_dev_init_all(ads_dev_t * devs, const uint8_t * addresses, ads_init_t * ads_inits, uint8_t count);
+
+/**
+ * @brief Waits until the ADS is ready after its last reset. With
+ *				ADS_STARTUP_POLL the device id is polled at intervals doubling
+ *				from ADS_READY_POLL_MIN_MS to ADS_READY_POLL_MAX_MS, otherwise
+ *				the rest of ADS_BOOT_DELAY_MS is slept. Sets dev->ready_us.
+ *
+ * @return	ADS_OK if ready, ADS_ERR_TIMEOUT if it did not answer in
+ *				ready_timeout_ms
+ */
+int ads_two_axis_dev_wait_ready(ads_dev_t * dev);
+
+int ads_two_axis_dev_run(ads_dev_t * dev, bool run);
+
+int ads_two_axis_dev_set_sample_rate(ads_dev_t * dev, ADS_SPS_T sps);
+
+int ads_two_axis_dev_enable_interrupt(ads_dev_t * dev, bool enable);
+
+/**
+ * @brief Programs a new I2C address into dev and addresses it there from now on
+ */
+int ads_two_axis_dev_update_device_address(ads_dev_t * dev, uint8_t address);
+
+int ads_two_axis_dev_set_sample_ring(ads_dev_t * dev, ads_ring_t * ring);
+
+void ads_two_axis_dev_set_recorder(ads_dev_t * dev, ads_rec_writer_t * rec);
+
+void ads_two_axis_dev_set_raw_callback(ads_dev_t * dev, ads_raw_callback callback);
+
+void ads_two_axis_dev_set_timed_callback(ads_dev_t * dev, ads_timed_callback callback);
+
+void ads_two_axis_dev_set_sample_callback(ads_dev_t * dev, ads_sample_ctx_callback callback, void * ctx);
+
+#if ADS_FLOAT_SAMPLES
+/**
+ * @brief Delivers samples in degrees together with dev, instead of the
+ *				ads_sample_callback of the init structure
+ */
+void ads_two_axis_dev_set_dev_callback(ads_dev_t * dev, ads_dev_callback callback);
+#endif
+
+/**
+ * @brief Selects how dev waits for the ADS to boot, see
+ *				ads_two_axis_set_startup(). Call before ads_two_axis_dev_init()
+ *				or ads_two_axis_dev_begin().
+ */
+void ads_two_axis_dev_set_startup(ads_dev_t * dev, ADS_STARTUP_T startup, uint16_t ready_timeout_ms);
+
+int ads_two_axis_dev_set_rate_control(ads_dev_t * dev, ads_rate_t * rate);
+
+void ads_two_axis_dev_set_calibration(ads_dev_t * dev, const ads_cal_t * cal);
+
+void ads_two_axis_dev_set_deferred(ads_dev_t * dev, bool deferred, void (*notify)(void));
+
+int ads_two_axis_dev_service(ads_dev_t * dev);
+
+int ads_two_axis_dev_calibrate(ads_dev_t * dev, ADS_CALIBRATION_STEP_T ads_calibration_step, uint8_t degrees);
+
+int ads_two_axis_dev_enable_axis(ads_dev_t * dev, uint8_t axes_enable);
+
+int ads_two_axis_dev_shutdown(ads_dev_t * dev);
+
+int ads_two_axis_dev_wake(ads_dev_t * dev);
+
+int ads_two_axis_dev_apply(ads_dev_t * dev, const ads_config_t * config);
+
+void ads_two_axis_dev_get_config(ads_dev_t * dev, ads_config_t * config);
+
+/**
+ * @brief Forgets the cached configuration of dev, so the next write of each
+ *				field reaches the ADS. Needed after the ADS was reset or
+ *				reconfigured behind the driver's back.
+ */
+void ads_two_axis_dev_invalidate_shadow(ads_dev_t * dev);
+
+int ads_two_axis_dev_get_dev_type(ads_dev_t * dev, ADS_DEV_TYPE_T * ads_dev_type);
+
+int ads_two_axis_dev_get_dev_type_async(ads_dev_t * dev, ads_cmd_t * cmd, ads_cmd_callback callback, void * ctx);
+
 #endif /* ADS_TWO_AXIS_H_ */
@@ -0,0 +1,432 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#include <string.h>
+#include "ads_two_axis_cal.h"
+
+#if !defined(ARDUINO)
+#include <math.h>
+#endif
+
+#define ADS_CAL_MAX_TERMS			((ADS_CAL_MAX_ORDER + 1) * (ADS_CAL_MAX_ORDER + 2) / 2)
+
+static const uint8_t ads_cal_magic[4] = { 'A', 'D', 'S', 'C' };
+
+
+static int16_t ads_cal_clamp(int32_t value)
+{
+	if(value > 32767)
+		return 32767;
+
+	if(value < -32768)
+		return -32768;
+
+	return (int16_t)value;
+}
+
+/**
+ * @brief Interpolates one axis of the table at cell (ix, iy), fx and fy
+ *				are the position in the cell in raw units
+ */
+static int32_t ads_cal_lerp(const ads_cal_t * cal, const int16_t * table,
+							uint8_t ix, uint8_t iy, int32_t fx, int32_t fy)
+{
+	const int16_t * row0 = &table[iy * cal->nx + ix];
+	const int16_t * row1 = row0 + cal->nx;
+
+	int32_t c0 = row0[0] + ((((int32_t)row0[1] - row0[0]) * fx) >> cal->shift_x);
+	int32_t c1 = row1[0] + ((((int32_t)row1[1] - row1[0]) * fx) >> cal->shift_x);
+
+	return c0 + (((c1 - c0) * fy) >> cal->shift_y);
+}
+
+/**
+ * @brief Finds the cell of value along one axis. The last node belongs to
+ *				the cell before it, values outside the grid to its edge.
+ */
+static uint8_t ads_cal_cell(int32_t value, int16_t origin, uint8_t nodes, uint8_t shift, int32_t * frac)
+{
+	int32_t span = (int32_t)(nodes - 1) << shift;
+	int32_t d = value - origin;
+
+	if(d < 0)
+		d = 0;
+	else if(d > span)
+		d = span;
+
+	uint8_t i = (uint8_t)(d >> shift);
+
+	if(i >= nodes - 1)
+	{
+		*frac = (int32_t)1 << shift;
+		return nodes - 2;
+	}
+
+	*frac = d & (((int32_t)1 << shift) - 1);
+
+	return i;
+}
+
+void ads_cal_apply(const ads_cal_t * cal, int16_t * raw)
+{
+	int32_t fx, fy;
+	uint8_t ix = ads_cal_cell(raw[0], cal->x0, cal->nx, cal->shift_x, &fx);
+	uint8_t iy = ads_cal_cell(raw[1], cal->y0, cal->ny, cal->shift_y, &fy);
+
+	int32_t offset0 = ads_cal_lerp(cal, cal->table[0], ix, iy, fx, fy);
+	int32_t offset1 = ads_cal_lerp(cal, cal->table[1], ix, iy, fx, fy);
+
+	raw[0] = ads_cal_clamp(raw[0] + offset0);
+	raw[1] = ads_cal_clamp(raw[1] + offset1);
+}
+
+void ads_cal_identity(ads_cal_t * cal)
+{
+	memset(cal, 0, sizeof(*cal));
+
+	cal->nx = 2;
+	cal->ny = 2;
+	cal->shift_x = ADS_CAL_MAX_SHIFT;
+	cal->shift_y = ADS_CAL_MAX_SHIFT;
+	cal->x0 = -((int16_t)1 << (ADS_CAL_MAX_SHIFT - 1));
+	cal->y0 = cal->x0;
+}
+
+
+#if !defined(ARDUINO)
+
+/**
+ * @brief Evaluates the terms x^i * y^j, i + j <= order, ordered by degree
+ */
+static uint8_t ads_cal_terms(double x, double y, uint8_t order, double * terms)
+{
+	uint8_t n = 0;
+
+	for(uint8_t d = 0; d <= order; d++)
+	{
+		for(uint8_t j = 0; j <= d; j++)
+		{
+			double t = 1.0;
+
+			for(uint8_t k = 0; k < d - j; k++)
+				t *= x;
+			for(uint8_t k = 0; k < j; k++)
+				t *= y;
+
+			terms[n++] = t;
+		}
+	}
+
+	return n;
+}
+
+/**
+ * @brief Solves the normal equations a * x = b for both axes by Gaussian
+ *				elimination with partial pivoting, the solution replaces b
+ *
+ * @return	false if a is singular
+ */
+static bool ads_cal_solve(double a[][ADS_CAL_MAX_TERMS], double b[][2], uint8_t n)
+{
+	double scale = 0.0;
+
+	for(uint8_t i = 0; i < n; i++)
+	{
+		if(fabs(a[i][i]) > scale)
+			scale = fabs(a[i][i]);
+	}
+
+	for(uint8_t col = 0; col < n; col++)
+	{
+		uint8_t pivot = col;
+
+		for(uint8_t row = col + 1; row < n; row++)
+		{
+			if(fabs(a[row][col]) > fabs(a[pivot][col]))
+				pivot = row;
+		}
+
+		if(fabs(a[pivot][col]) <= scale * 1e-12)
+			return false;
+
+		if(pivot != col)
+		{
+			for(uint8_t k = 0; k < n; k++)
+			{
+				double t = a[col][k];
+				a[col][k] = a[pivot][k];
+				a[pivot][k] = t;
+			}
+
+			for(uint8_t k = 0; k < 2; k++)
+			{
+				double t = b[col][k];
+				b[col][k] = b[pivot][k];
+				b[pivot][k] = t;
+			}
+		}
+
+		for(uint8_t row = col + 1; row < n; row++)
+		{
+			double f = a[row][col] / a[col][col];
+
+			for(uint8_t k = col; k < n; k++)
+				a[row][k] -= f * a[col][k];
+
+			b[row][0] -= f * b[col][0];
+			b[row][1] -= f * b[col][1];
+		}
+	}
+
+	for(int8_t row = n - 1; row >= 0; row--)
+	{
+		for(uint8_t k = row + 1; k < n; k++)
+		{
+			b[row][0] -= a[row][k] * b[k][0];
+			b[row][1] -= a[row][k] * b[k][1];
+		}
+
+		b[row][0] /= a[row][row];
+		b[row][1] /= a[row][row];
+	}
+
+	return true;
+}
+
+/**
+ * @brief Places nodes a power of two apart over min to max
+ *
+ * @return	false if the range needs a spacing above ADS_CAL_MAX_SHIFT
+ */
+static bool ads_cal_place(int32_t min, int32_t max, uint8_t nodes, int16_t * origin, uint8_t * shift)
+{
+	int32_t range = max - min;
+	uint8_t s = 0;
+
+	while(((int32_t)(nodes - 1) << s) < range)
+	{
+		if(++s > ADS_CAL_MAX_SHIFT)
+			return false;
+	}
+
+	int32_t span = (int32_t)(nodes - 1) << s;
+	int32_t start = min - (span - range) / 2;
+
+	if(start + span > 32767)
+		start = 32767 - span;
+	if(start < -32768)
+		start = -32768;
+
+	*origin = (int16_t)start;
+	*shift = s;
+
+	return true;
+}
+
+int ads_cal_fit(ads_cal_t * cal, const ads_cal_pose_t * poses, uint16_t count,
+				uint8_t order, uint8_t grid, float * rms_deg)
+{
+	uint8_t n = (order + 1) * (order + 2) / 2;
+
+	if(poses == NULL || order < 1 || order > ADS_CAL_MAX_ORDER || grid < 2 || grid > ADS_CAL_MAX_GRID || count < n)
+		return ADS_ERR_BAD_PARAM;
+
+	int32_t min[2] = { 32767, 32767 };
+	int32_t max[2] = { -32768, -32768 };
+
+	for(uint16_t i = 0; i < count; i++)
+	{
+		for(uint8_t a = 0; a < 2; a++)
+		{
+			if(poses[i].raw[a] < min[a])
+				min[a] = poses[i].raw[a];
+			if(poses[i].raw[a] > max[a])
+				max[a] = poses[i].raw[a];
+		}
+	}
+
+	// Fit in [-1, 1] so the powers stay well conditioned
+	double center[2], half[2];
+
+	for(uint8_t a = 0; a < 2; a++)
+	{
+		center[a] = 0.5 * (min[a] + max[a]);
+		half[a] = 0.5 * (max[a] - min[a]);
+
+		if(half[a] < 0.5)
+			half[a] = 0.5;
+	}
+
+	double ata[ADS_CAL_MAX_TERMS][ADS_CAL_MAX_TERMS];
+	double atb[ADS_CAL_MAX_TERMS][2];
+	double terms[ADS_CAL_MAX_TERMS];
+
+	memset(ata, 0, sizeof(ata));
+	memset(atb, 0, sizeof(atb));
+
+	for(uint16_t i = 0; i < count; i++)
+	{
+		ads_cal_terms((poses[i].raw[0] - center[0]) / half[0],
+					  (poses[i].raw[1] - center[1]) / half[1], order, terms);
+
+		for(uint8_t r = 0; r < n; r++)
+		{
+			for(uint8_t c = 0; c < n; c++)
+				ata[r][c] += terms[r] * terms[c];
+
+			atb[r][0] += terms[r] * poses[i].angle[0];
+			atb[r][1] += terms[r] * poses[i].angle[1];
+		}
+	}
+
+	if(!ads_cal_solve(ata, atb, n))
+		return ADS_ERR_BAD_PARAM;
+
+	ads_cal_t fit;
+
+	memset(&fit, 0, sizeof(fit));
+	fit.nx = grid;
+	fit.ny = grid;
+
+	if(!ads_cal_place(min[0], max[0], grid, &fit.x0, &fit.shift_x) ||
+	   !ads_cal_place(min[1], max[1], grid, &fit.y0, &fit.shift_y))
+		return ADS_ERR_BAD_PARAM;
+
+	for(uint8_t iy = 0; iy < grid; iy++)
+	{
+		for(uint8_t ix = 0; ix < grid; ix++)
+		{
+			int32_t node[2];
+
+			node[0] = fit.x0 + ((int32_t)ix << fit.shift_x);
+			node[1] = fit.y0 + ((int32_t)iy << fit.shift_y);
+
+			ads_cal_terms((node[0] - center[0]) / half[0], (node[1] - center[1]) / half[1], order, terms);
+
+			for(uint8_t a = 0; a < 2; a++)
+			{
+				double angle = 0.0;
+
+				for(uint8_t k = 0; k < n; k++)
+					angle += atb[k][a] * terms[k];
+
+				double offset = floor(angle * 32.0 - node[a] + 0.5);
+
+				if(offset > 32767.0)
+					offset = 32767.0;
+				if(offset < -32768.0)
+					offset = -32768.0;
+
+				fit.table[a][iy * grid + ix] = (int16_t)offset;
+			}
+		}
+	}
+
+	if(rms_deg)
+	{
+		double sum = 0.0;
+
+		for(uint16_t i = 0; i < count; i++)
+		{
+			int16_t raw[2] = { poses[i].raw[0], poses[i].raw[1] };
+
+			ads_cal_apply(&fit, raw);
+
+			for(uint8_t a = 0; a < 2; a++)
+			{
+				double e = raw[a] / 32.0 - poses[i].angle[a];
+				sum += e * e;
+			}
+		}
+
+		*rms_deg = (float)sqrt(sum / (2.0 * count));
+	}
+
+	*cal = fit;
+
+	return ADS_OK;
+}
+
+#endif /* !ARDUINO */
+
+
+/************************************************************************/
+/*                             Serialization                            */
+/************************************************************************/
+
+uint16_t ads_cal_blob_size(const ads_cal_t * cal)
+{
+	return ADS_CAL_HEADER_SIZE + 4 * (uint16_t)cal->nx * cal->ny + 2;
+}
+
+int ads_cal_save(const ads_cal_t * cal, uint8_t * blob, uint16_t size)
+{
+	uint16_t len = ads_cal_blob_size(cal);
+	uint16_t nodes = (uint16_t)cal->nx * cal->ny;
+
+	if(size < len)
+		return ADS_ERR_BAD_PARAM;
+
+	memcpy(blob, ads_cal_magic, sizeof(ads_cal_magic));
+	blob[4] = ADS_CAL_VERSION;
+	blob[5] = cal->nx;
+	blob[6] = cal->ny;
+	blob[7] = cal->shift_x;
+	blob[8] = cal->shift_y;
+	blob[9] = 0;
+	ads_uint16_encode((uint16_t)cal->x0, &blob[10]);
+	ads_uint16_encode((uint16_t)cal->y0, &blob[12]);
+
+	uint8_t * p = &blob[ADS_CAL_HEADER_SIZE];
+
+	for(uint8_t a = 0; a < 2; a++)
+	{
+		for(uint16_t i = 0; i < nodes; i++)
+			p += ads_uint16_encode((uint16_t)cal->table[a][i], p);
+	}
+
+	ads_uint16_encode(ads_crc16(blob, len - 2), p);
+
+	return len;
+}
+
+int ads_cal_load(ads_cal_t * cal, const uint8_t * blob, uint16_t len)
+{
+	if(len < ADS_CAL_HEADER_SIZE + 2 || memcmp(blob, ads_cal_magic, sizeof(ads_cal_magic)) != 0)
+		return ADS_ERR_BAD_PARAM;
+
+	uint8_t nx = blob[5];
+	uint8_t ny = blob[6];
+
+	if(blob[4] != ADS_CAL_VERSION || nx < 2 || nx > ADS_CAL_MAX_GRID || ny < 2 || ny > ADS_CAL_MAX_GRID ||
+	   blob[7] > ADS_CAL_MAX_SHIFT || blob[8] > ADS_CAL_MAX_SHIFT)
+		return ADS_ERR_BAD_PARAM;
+
+	uint16_t nodes = (uint16_t)nx * ny;
+	uint16_t size = ADS_CAL_HEADER_SIZE + 4 * nodes + 2;
+
+	if(len < size || ads_crc16(blob, size - 2) != ads_uint16_decode(&blob[size - 2]))
+		return ADS_ERR_BAD_PARAM;
+
+	cal->nx = nx;
+	cal->ny = ny;
+	cal->shift_x = blob[7];
+	cal->shift_y = blob[8];
+	cal->x0 = ads_int16_decode(&blob[10]);
+	cal->y0 = ads_int16_decode(&blob[12]);
+
+	const uint8_t * p = &blob[ADS_CAL_HEADER_SIZE];
+
+	for(uint8_t a = 0; a < 2; a++)
+	{
+		for(uint16_t i = 0; i < nodes; i++, p += 2)
+			cal->table[a][i] = ads_int16_decode(p);
+	}
+
+	return ADS_OK;
+}
@@ -0,0 +1,112 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_CAL_H_
+#define ADS_TWO_AXIS_CAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ads_two_axis.h"
+
+/*
+ * Multi-point calibration of one sensor, on top of the firmware steps of
+ * ads_two_axis_calibrate(). The joint is held at a number of reference
+ * poses and the raw reading of each is recorded with the true angles.
+ * ads_cal_fit() fits a 2D polynomial per axis to them, so each corrected
+ * axis depends on both raw axes and cross-axis coupling is removed with
+ * the nonlinearity.
+ *
+ * The fit is compiled into a grid of correction offsets over the range of
+ * the poses. Attached to a device with ads_two_axis_dev_set_calibration(),
+ * every sample is corrected by bilinear interpolation between the four
+ * nearest nodes: a few int32 multiplies and shifts, the same for every
+ * sample, no float. The node spacing is a power of two so the cell and the
+ * position in it come from a shift and a mask. Samples outside the grid
+ * take the offset of its edge.
+ *
+ * ads_cal_save() and ads_cal_load() store a calibration as a little endian
+ * blob with a CRC, for flash or a file. Loading is a copy and a check.
+ *
+ * Fitting uses double arithmetic and is only built for hosts.
+ */
+
+#define ADS_CAL_MAX_GRID			(17)			// Nodes per axis
+#define ADS_CAL_MAX_ORDER			(3)				// Highest total degree of the polynomial
+#define ADS_CAL_MAX_SHIFT			(14)			// Largest node spacing, 2^14 Q10.5 = 512 degrees
+#define ADS_CAL_VERSION				(1)				// Blob format version
+#define ADS_CAL_HEADER_SIZE			(14)			// Blob bytes before the table
+
+/* One reference pose */
+typedef struct {
+	int16_t raw[2];						// Reading of both axes, Q10.5
+	float angle[2];						// True angle of both axes, degrees
+} ads_cal_pose_t;
+
+struct ads_cal_s {
+	uint8_t nx;							// Nodes along axis 0
+	uint8_t ny;							// Nodes along axis 1
+	uint8_t shift_x;					// Node spacing along axis 0 is 1 << shift_x
+	uint8_t shift_y;
+	int16_t x0;							// Raw axis 0 of the first node
+	int16_t y0;
+	int16_t table[2][ADS_CAL_MAX_GRID * ADS_CAL_MAX_GRID];	// Offset per axis, Q10.5, row y holds nx nodes
+};
+
+
+#if !defined(ARDUINO)
+/**
+ * @brief Fits a correction to reference poses and compiles it into a grid
+ *
+ * @param poses		reference poses, spread over the range the joint moves in
+ * @param count		number of poses, at least (order + 1) * (order + 2) / 2
+ * @param order		total degree of the polynomial, 1 to ADS_CAL_MAX_ORDER
+ * @param grid		nodes per axis, 2 to ADS_CAL_MAX_GRID
+ * @param rms_deg	receives the RMS error of the corrected poses, may be NULL
+ * @return	ADS_OK or ADS_ERR_BAD_PARAM if the poses do not determine a fit
+ */
+int ads_cal_fit(ads_cal_t * cal, const ads_cal_pose_t * poses, uint16_t count,
+				uint8_t order, uint8_t grid, float * rms_deg);
+#endif
+
+/**
+ * @brief Sets a calibration that leaves samples unchanged
+ */
+void ads_cal_identity(ads_cal_t * cal);
+
+/**
+ * @brief Corrects one sample in place. Called by the driver for an
+ *				attached calibration.
+ *
+ * @param raw	both axes, Q10.5
+ */
+void ads_cal_apply(const ads_cal_t * cal, int16_t * raw);
+
+/**
+ * @brief Size of the blob of cal
+ */
+uint16_t ads_cal_blob_size(const ads_cal_t * cal);
+
+/**
+ * @brief Serializes cal
+ *
+ * @param blob	receives ads_cal_blob_size() bytes
+ * @param size	size of blob
+ * @return	bytes written or ADS_ERR_BAD_PARAM if blob is too small
+ */
+int ads_cal_save(const ads_cal_t * cal, uint8_t * blob, uint16_t size);
+
+/**
+ * @brief Restores a calibration saved by ads_cal_save()
+ *
+ * @param len	bytes in blob, may be more than the blob
+ * @return	ADS_OK or ADS_ERR_BAD_PARAM if the blob is damaged or of
+ *				another version, cal is then unchanged
+ */
+int ads_cal_load(ads_cal_t * cal, const uint8_t * blob, uint16_t len);
+
+#endif /* ADS_TWO_AXIS_CAL_H_ */
@@ -0,0 +1,158 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#include <stddef.h>
+#include "ads_two_axis_clock.h"
+
+/* 1e6 * 256 / ADS_CLOCK_TICK_HZ, one tick in 1/256 us */
+#define ADS_CLOCK_TICK_Q8			(15625)
+
+/* Longest interval between two samples that is tracked, longer ones resync */
+#define ADS_CLOCK_MAX_ELAPSED_US	(0x7FFFFFFFL >> 9)
+
+
+/**
+ * @brief value * gain, gain in Q16
+ */
+static int32_t ads_clock_scale(int32_t value, int32_t gain_q16)
+{
+	return (int32_t)(((int64_t)value * gain_q16) / 65536);
+}
+
+static uint32_t ads_clock_sync(ads_clock_t * clock, uint32_t edge_us)
+{
+	clock->time_us = edge_us;
+	clock->frac_q8 = 0;
+	clock->error_q8 = 0;
+	clock->synced = true;
+
+	return edge_us;
+}
+
+void ads_clock_init(ads_clock_t * clock, uint16_t ticks)
+{
+	clock->nominal_q8 = (uint32_t)ticks * ADS_CLOCK_TICK_Q8;
+	clock->period_q8 = clock->nominal_q8;
+	clock->time_us = 0;
+	clock->frac_q8 = 0;
+	clock->synced = false;
+	clock->lock = 0;
+	clock->error_q8 = 0;
+	clock->gap = 0;
+	clock->samples = 0;
+	clock->dropped = 0;
+}
+
+void ads_clock_set_rate(ads_clock_t * clock, uint16_t ticks)
+{
+	uint32_t nominal_q8 = (uint32_t)ticks * ADS_CLOCK_TICK_Q8;
+
+	if(clock->nominal_q8)
+		clock->period_q8 = (uint32_t)(((uint64_t)clock->period_q8 * nominal_q8 + clock->nominal_q8 / 2) / clock->nominal_q8);
+	else
+		clock->period_q8 = nominal_q8;
+
+	clock->nominal_q8 = nominal_q8;
+	clock->synced = false;
+}
+
+void ads_clock_restart(ads_clock_t * clock)
+{
+	clock->synced = false;
+}
+
+uint32_t ads_clock_update(ads_clock_t * clock, uint32_t edge_us)
+{
+	clock->samples++;
+	clock->gap = 0;
+
+	if(!clock->synced || clock->nominal_q8 == 0)
+		return ads_clock_sync(clock, edge_us);
+
+	int32_t elapsed_us = (int32_t)(edge_us - clock->time_us);
+
+	if(elapsed_us <= 0 || elapsed_us > ADS_CLOCK_MAX_ELAPSED_US)
+		return ads_clock_sync(clock, edge_us);
+
+	uint32_t period = clock->period_q8;
+	int32_t elapsed = (elapsed_us << 8) - clock->frac_q8;
+
+	// Whole periods since the last sample, more than one if samples were lost
+	uint32_t n = 1;
+
+	if(elapsed > (int32_t)(period + period / 2))
+	{
+		n = ((uint32_t)elapsed + period / 2) / period;
+
+		uint32_t lost = n - 1;
+
+		clock->gap = lost > 0xFFFF ? 0xFFFF : (uint16_t)lost;
+		clock->dropped += lost;
+	}
+
+	int32_t predicted = (int32_t)(n * period);
+	int32_t error = elapsed - predicted;
+	int32_t limit = (int32_t)(period >> 3);
+
+	// Late reads only pull by an eighth of a period
+	if(error > limit)
+		error = limit;
+	else if(error < -limit)
+		error = -limit;
+
+	clock->error_q8 = error;
+
+	int32_t alpha = ADS_CLOCK_PHASE_GAIN;
+	int32_t beta = ADS_CLOCK_PERIOD_GAIN;
+
+	if(clock->lock < ADS_CLOCK_LOCK_SAMPLES)
+	{
+		// Least squares line fit gains of the k-th sample, the sync sample is k = 1
+		uint32_t k = ++clock->lock + 1;
+		int32_t a = (int32_t)(((2 * (2 * k - 1)) << 16) / (k * (k + 1)));
+		int32_t b = (int32_t)((6UL << 16) / (k * (k + 1)));
+
+		if(a > alpha)
+			alpha = a;
+
+		if(b > beta)
+			beta = b;
+	}
+
+	// Phase, then period with the error per sample
+	uint32_t advance = (uint32_t)(predicted + ads_clock_scale(error, alpha)) + clock->frac_q8;
+
+	clock->time_us += advance >> 8;
+	clock->frac_q8 = (uint8_t)(advance & 0xFF);
+
+	int32_t max_drift = (int32_t)(clock->nominal_q8 >> ADS_CLOCK_MAX_DRIFT_SHIFT);
+	int32_t drift = (int32_t)(period - clock->nominal_q8) + ads_clock_scale(error / (int32_t)n, beta);
+
+	if(drift > max_drift)
+		drift = max_drift;
+	else if(drift < -max_drift)
+		drift = -max_drift;
+
+	clock->period_q8 = clock->nominal_q8 + drift;
+
+	return clock->time_us;
+}
+
+int32_t ads_clock_get_drift_ppm(const ads_clock_t * clock)
+{
+	if(clock->period_q8 == 0)
+		return 0;
+
+	// Frequency error, nominal / period - 1
+	return (int32_t)(((int64_t)clock->nominal_q8 - clock->period_q8) * 1000000 / clock->period_q8);
+}
+
+uint32_t ads_clock_get_period_ns(const ads_clock_t * clock)
+{
+	return (uint32_t)(((uint64_t)clock->period_q8 * 1000 + 128) / 256);
+}
@@ -0,0 +1,95 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_CLOCK_H_
+#define ADS_TWO_AXIS_CLOCK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Sample clock of one ADS, tracked from the data ready edge times the HAL
+ * captures. The ADS samples on its own oscillator, so the real period
+ * differs from the ADS_SPS_T setting by the oscillator error, and the edge
+ * times carry the interrupt latency of the host.
+ *
+ * An alpha-beta tracker follows the phase (the host time of the sample)
+ * and the period of the stream. It starts with least squares gains, which
+ * lock on within a few samples, and settles at ADS_CLOCK_PHASE_GAIN and
+ * ADS_CLOCK_PERIOD_GAIN. Edge times that deviate by more than an eighth of
+ * a period, e.g. a packet recovered late after the bus was busy, only
+ * count with that eighth. An edge further than half a period past the
+ * prediction means samples were lost, they are counted as a gap. After
+ * more than ~4 s without a sample the next edge starts a new phase.
+ *
+ * Integer arithmetic only, times in 1/256 us. Runs in the read path, no
+ * bus access.
+ */
+
+#define ADS_CLOCK_TICK_HZ			(16384)			// ADS_SPS_T is in ticks of this clock
+#define ADS_CLOCK_PHASE_GAIN		(65536 / 16)	// Settled alpha, Q16
+#define ADS_CLOCK_PERIOD_GAIN		(65536 / 512)	// Settled beta, Q16
+#define ADS_CLOCK_LOCK_SAMPLES		(64)			// Samples with least squares gains
+#define ADS_CLOCK_MAX_DRIFT_SHIFT	(4)				// Period stays within 1/16 of nominal
+
+typedef struct {
+	uint32_t nominal_q8;		// Period set by ADS_SPS_T, 1/256 us
+	uint32_t period_q8;			// Estimated period
+	uint32_t time_us;			// Corrected time of the last sample
+	uint8_t frac_q8;			// Fraction of time_us
+	bool synced;				// time_us is valid
+	uint16_t lock;				// Samples tracked since init, up to ADS_CLOCK_LOCK_SAMPLES
+	int32_t error_q8;			// Last edge time minus its prediction
+	uint16_t gap;				// Samples lost right before the last one
+	uint32_t samples;			// Samples tracked
+	uint32_t dropped;			// Samples lost in gaps
+} ads_clock_t;
+
+/**
+ * @brief Starts tracking a stream with a nominal period of ticks
+ *
+ * @param ticks		ADS_SPS_T sample period in ADS_CLOCK_TICK_HZ ticks
+ */
+void ads_clock_init(ads_clock_t * clock, uint16_t ticks);
+
+/**
+ * @brief Switches to a new nominal period. The measured oscillator error
+ *				carries over to it, the next edge starts a new phase.
+ *
+ * @param ticks		ADS_SPS_T sample period in ADS_CLOCK_TICK_HZ ticks
+ */
+void ads_clock_set_rate(ads_clock_t * clock, uint16_t ticks);
+
+/**
+ * @brief Keeps the period estimate but takes the next edge as new phase,
+ *				e.g. after the stream was stopped and started again
+ */
+void ads_clock_restart(ads_clock_t * clock);
+
+/**
+ * @brief Tracks the sample with data ready edge at edge_us
+ *
+ * @return	drift corrected sample time, in the units of edge_us
+ */
+uint32_t ads_clock_update(ads_clock_t * clock, uint32_t edge_us);
+
+/**
+ * @brief Oscillator error of the ADS, positive if it samples fast
+ *
+ * @return	parts per million
+ */
+int32_t ads_clock_get_drift_ppm(const ads_clock_t * clock);
+
+/**
+ * @brief Estimated sample period
+ *
+ * @return	nanoseconds
+ */
+uint32_t ads_clock_get_period_ns(const ads_clock_t * clock);
+
+#endif /* ADS_TWO_AXIS_CLOCK_H_ */
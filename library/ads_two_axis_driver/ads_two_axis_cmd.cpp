@@ -0,0 +1,299 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "ads_two_axis_cmd.h"
+#include "ads_two_axis_stats.h"
+
+/* Commands in submission order */
+static ads_cmd_t * ads_cmd_head = NULL;
+static ads_cmd_t * ads_cmd_tail = NULL;
+
+
+static int ads_cmd_enqueue(ads_cmd_t * cmd, ads_hal_dev_t * dev, uint8_t read_len,
+						   ads_cmd_callback callback, void * ctx)
+{
+	if(cmd->state == ADS_CMD_QUEUED || cmd->state == ADS_CMD_WAITING)
+		return ADS_ERR_OP_IN_PROGRESS;
+
+	cmd->dev = dev;
+	cmd->read_len = read_len;
+	cmd->retries = 0;
+	cmd->callback = callback;
+	cmd->ctx = ctx;
+	cmd->result = ADS_ERR_OP_IN_PROGRESS;
+	cmd->next = NULL;
+	cmd->state = ADS_CMD_QUEUED;
+
+	if(ads_cmd_tail)
+		ads_cmd_tail->next = cmd;
+	else
+		ads_cmd_head = cmd;
+
+	ads_cmd_tail = cmd;
+
+	return ADS_OK;
+}
+
+/**
+ * @brief true if a command submitted before cmd still uses its device
+ */
+static bool ads_cmd_dev_busy(const ads_cmd_t * cmd)
+{
+	for(const ads_cmd_t * other = ads_cmd_head; other != cmd; other = other->next)
+	{
+		if(other->dev == cmd->dev)
+			return true;
+	}
+
+	return false;
+}
+
+static void ads_cmd_restore_int(ads_cmd_t * cmd)
+{
+	if(!cmd->int_enabled)
+		return;
+
+	ads_hal_dev_hold(cmd->dev, false);
+
+	// Read out a packet whose edge came while the response was pending
+	if(ads_hal_pin_asserted(cmd->dev) && ads_hal_dev_interrupt(cmd->dev, cmd->dev->drdy_time))
+		ADS_STATS_INC(missed_recovered);
+}
+
+/**
+ * @brief Writes the command of cmd
+ */
+static void ads_cmd_start(ads_cmd_t * cmd)
+{
+	ads_hal_dev_t * dev = cmd->dev;
+
+	cmd->int_enabled = false;
+
+	if(cmd->read_len)
+	{
+		// Keep the sample path from consuming the response
+		cmd->int_enabled = dev->int_enabled;
+		if(cmd->int_enabled)
+			ads_hal_dev_hold(dev, true);
+	}
+
+	if(ads_hal_dev_write_buffer(dev, cmd->buffer, ADS_TRANSFER_SIZE) != ADS_OK)
+	{
+		ads_cmd_restore_int(cmd);
+		cmd->result = ADS_ERR_IO;
+		cmd->state = ADS_CMD_DONE;
+		return;
+	}
+
+	if(cmd->read_len == 0)
+	{
+		cmd->result = ADS_OK;
+		cmd->state = ADS_CMD_DONE;
+		return;
+	}
+
+	cmd->ready_time = ads_hal_get_time_us() + ADS_QUERY_DELAY_MS * 1000UL;
+	cmd->state = ADS_CMD_WAITING;
+}
+
+/**
+ * @brief Reads the response of cmd
+ */
+static void ads_cmd_finish(ads_cmd_t * cmd)
+{
+	ads_hal_dev_t * dev = cmd->dev;
+	uint8_t command = cmd->command;
+
+	cmd->result = ads_hal_dev_read_buffer(dev, cmd->buffer, cmd->read_len);
+
+	if(cmd->result == ADS_OK && cmd->buffer[0] == ADS_SAMPLE)
+	{
+		// A new sample replaced the response. Keep the sample with the
+		// time of its edge, stamped while the response was pending.
+		if(cmd->int_enabled && cmd->read_len == ADS_TRANSFER_SIZE)
+		{
+			memcpy(dev->read_buffer, cmd->buffer, ADS_TRANSFER_SIZE);
+			dev->sample_time = dev->drdy_time;
+			dev->read_callback(dev, dev->read_buffer);
+		}
+
+		if(cmd->retries < ADS_CMD_RETRIES)
+		{
+			// Ask again
+			cmd->retries++;
+
+			memset(cmd->buffer, 0, sizeof(cmd->buffer));
+			cmd->buffer[0] = command;
+
+			if(ads_hal_dev_write_buffer(dev, cmd->buffer, ADS_TRANSFER_SIZE) == ADS_OK)
+			{
+				cmd->ready_time = ads_hal_get_time_us() + ADS_QUERY_DELAY_MS * 1000UL;
+				return;
+			}
+
+			cmd->result = ADS_ERR_IO;
+		}
+		else
+		{
+			// Every response was replaced, there is none to report
+			cmd->result = ADS_ERR_DEV_ID;
+		}
+	}
+
+	ads_cmd_restore_int(cmd);
+
+	cmd->state = ADS_CMD_DONE;
+}
+
+int ads_cmd_submit_query(ads_cmd_t * cmd, ads_hal_dev_t * dev, uint8_t command,
+						 ads_cmd_callback callback, void * ctx)
+{
+	if(cmd->state == ADS_CMD_QUEUED || cmd->state == ADS_CMD_WAITING)
+		return ADS_ERR_OP_IN_PROGRESS;
+
+	memset(cmd->buffer, 0, sizeof(cmd->buffer));
+	cmd->buffer[0] = command;
+	cmd->command = command;
+
+	return ads_cmd_enqueue(cmd, dev, ADS_TRANSFER_SIZE, callback, ctx);
+}
+
+int ads_cmd_submit_write(ads_cmd_t * cmd, ads_hal_dev_t * dev, const uint8_t * packet,
+						 ads_cmd_callback callback, void * ctx)
+{
+	if(cmd->state == ADS_CMD_QUEUED || cmd->state == ADS_CMD_WAITING)
+		return ADS_ERR_OP_IN_PROGRESS;
+
+	memcpy(cmd->buffer, packet, ADS_TRANSFER_SIZE);
+	cmd->command = packet[0];
+
+	return ads_cmd_enqueue(cmd, dev, 0, callback, ctx);
+}
+
+int ads_cmd_poll(void)
+{
+	int completed = 0;
+	ads_cmd_t * prev = NULL;
+	ads_cmd_t * cmd = ads_cmd_head;
+
+	while(cmd)
+	{
+		ads_cmd_t * next = cmd->next;
+
+		if(cmd->state == ADS_CMD_QUEUED && !ads_cmd_dev_busy(cmd))
+			ads_cmd_start(cmd);
+
+		if(cmd->state == ADS_CMD_WAITING && (int32_t)(ads_hal_get_time_us() - cmd->ready_time) >= 0)
+			ads_cmd_finish(cmd);
+
+		if(cmd->state != ADS_CMD_DONE)
+		{
+			prev = cmd;
+			cmd = next;
+			continue;
+		}
+
+		// Unlink before the callback, which may submit again
+		if(prev)
+			prev->next = next;
+		else
+			ads_cmd_head = next;
+
+		if(ads_cmd_tail == cmd)
+			ads_cmd_tail = prev;
+
+		cmd->next = NULL;
+		completed++;
+
+		if(cmd->callback)
+			cmd->callback(cmd, cmd->ctx);
+
+		// A command submitted by the callback may have been appended after prev
+		cmd = prev ? prev->next : ads_cmd_head;
+	}
+
+	return completed;
+}
+
+bool ads_cmd_done(const ads_cmd_t * cmd)
+{
+	return cmd->state == ADS_CMD_DONE;
+}
+
+uint8_t ads_cmd_pending(void)
+{
+	uint8_t count = 0;
+
+	for(const ads_cmd_t * cmd = ads_cmd_head; cmd; cmd = cmd->next)
+		count++;
+
+	return count;
+}
+
+uint32_t ads_cmd_next_us(void)
+{
+	uint32_t next = UINT32_MAX;
+	uint32_t now = ads_hal_get_time_us();
+
+	for(const ads_cmd_t * cmd = ads_cmd_head; cmd; cmd = cmd->next)
+	{
+		if(cmd->state == ADS_CMD_QUEUED && !ads_cmd_dev_busy(cmd))
+			return 0;
+
+		if(cmd->state == ADS_CMD_WAITING)
+		{
+			int32_t left = (int32_t)(cmd->ready_time - now);
+
+			if(left <= 0)
+				return 0;
+
+			if((uint32_t)left < next)
+				next = (uint32_t)left;
+		}
+	}
+
+	return next;
+}
+
+int ads_cmd_get_dev_type(const ads_cmd_t * cmd, ADS_DEV_TYPE_T * dev_type)
+{
+	*dev_type = ADS_DEV_UNKNOWN;
+
+	if(cmd->result != ADS_OK)
+		return cmd->result;
+
+	if(cmd->buffer[0] != ADS_DEV_ID)
+		return ADS_ERR_DEV_ID;
+
+	switch (cmd->buffer[1])
+	{
+	case ADS_DEV_ONE_AXIS_V1:
+	case ADS_DEV_ONE_AXIS_V2:
+	case ADS_DEV_TWO_AXIS_V1:
+	case ADS_DEV_TWO_AXIS_V2:
+		*dev_type = static_cast<ADS_DEV_TYPE_T>(cmd->buffer[1]);
+		return ADS_OK;
+	}
+
+	return ADS_ERR_DEV_ID;
+}
+
+int ads_cmd_get_fw_ver(const ads_cmd_t * cmd, uint16_t * fw_ver)
+{
+	if(cmd->result != ADS_OK)
+		return cmd->result;
+
+	if(cmd->buffer[0] != ADS_FW_VER)
+		return ADS_ERR;
+
+	*fw_ver = ads_uint16_decode(&cmd->buffer[1]);
+
+	return ADS_OK;
+}
@@ -0,0 +1,136 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_CMD_H_
+#define ADS_TWO_AXIS_CMD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ads_two_axis_err.h"
+#include "ads_two_axis_hal.h"
+#include "ads_two_axis_util.h"
+
+/*
+ * Non-blocking commands. A query is split into its write and its read, and
+ * the ADS_QUERY_DELAY_MS the ADS needs in between is left to the caller
+ * instead of being slept: ads_cmd_poll() advances every queued command as
+ * far as the clock allows and returns at once. Call it from the main loop
+ * or a timer task, never from the data ready interrupt.
+ *
+ * Each device has at most one command on the bus at a time, later ones to
+ * it wait in submission order. Commands to different devices overlap. The
+ * sample path keeps away from a device while its query response is pending,
+ * as for a blocking query, but data ready edges are still timestamped, and
+ * a packet that arrived meanwhile is read once the response is in. A
+ * streaming ADS may replace the response with a new sample before it is
+ * read. That sample is handed to the sample path with the time of its edge
+ * and the query is asked again, up to ADS_CMD_RETRIES times. If the last
+ * one is replaced too, the command fails with ADS_ERR_DEV_ID.
+ *
+ * Command storage belongs to the caller and must stay valid until the
+ * command is done. Completion is reported by the callback, from inside
+ * ads_cmd_poll(), or can be polled with ads_cmd_done(). Blocking commands
+ * issued to a device while one of its queries is pending may replace the
+ * response.
+ */
+
+#define ADS_CMD_RETRIES				(3)		// Repeats of a query whose response a sample replaced
+
+typedef enum {
+	ADS_CMD_IDLE = 0,			// Never submitted
+	ADS_CMD_QUEUED,				// Waiting for its device
+	ADS_CMD_WAITING,			// Written, response not ready yet
+	ADS_CMD_DONE				// result is valid
+} ADS_CMD_STATE_T;
+
+typedef struct ads_cmd_s ads_cmd_t;
+
+/* Completion of cmd. cmd may be submitted again from the callback. */
+typedef void (*ads_cmd_callback)(ads_cmd_t * cmd, void * ctx);
+
+struct ads_cmd_s {
+	ads_hal_dev_t * dev;
+	uint8_t command;
+	uint8_t buffer[ADS_TRANSFER_SIZE];	// Command on submission, response once done
+	uint8_t read_len;					// 0 for commands without response
+	uint8_t retries;
+	ads_cmd_callback callback;
+	void * ctx;
+	volatile ADS_CMD_STATE_T state;
+	int result;							// ADS_OK, ADS_ERR_IO or ADS_ERR_DEV_ID once done
+	bool int_enabled;					// Samples were delivered, the device is held meanwhile
+	uint32_t ready_time;				// Time the response can be read
+	ads_cmd_t * next;
+};
+
+
+/**
+ * @brief Queues a query command, e.g. ADS_GET_DEV_ID or ADS_GET_FW_VER.
+ *				The response is read ADS_QUERY_DELAY_MS after the write.
+ *
+ * @param cmd		command storage, not queued
+ * @param dev		device to query
+ * @param command	query command byte
+ * @param callback	called on completion, may be NULL
+ * @param ctx		passed to callback
+ * @return	ADS_OK or ADS_ERR_OP_IN_PROGRESS if cmd is still queued
+ */
+int ads_cmd_submit_query(ads_cmd_t * cmd, ads_hal_dev_t * dev, uint8_t command,
+						 ads_cmd_callback callback, void * ctx);
+
+/**
+ * @brief Queues a command without response, ordered with the queries to
+ *				the same device
+ *
+ * @param packet	ADS_TRANSFER_SIZE command bytes
+ * @return	ADS_OK or ADS_ERR_OP_IN_PROGRESS if cmd is still queued
+ */
+int ads_cmd_submit_write(ads_cmd_t * cmd, ads_hal_dev_t * dev, const uint8_t * packet,
+						 ads_cmd_callback callback, void * ctx);
+
+/**
+ * @brief Advances every queued command without waiting
+ *
+ * @return	number of commands completed
+ */
+int ads_cmd_poll(void);
+
+/**
+ * @brief true once cmd has completed, its result and response are valid
+ */
+bool ads_cmd_done(const ads_cmd_t * cmd);
+
+/**
+ * @brief Number of commands queued or waiting for a response
+ */
+uint8_t ads_cmd_pending(void);
+
+/**
+ * @brief Time until the next waiting response is ready, for sleeping until
+ *				the next ads_cmd_poll()
+ *
+ * @return	microseconds, 0 if a command can make progress now, UINT32_MAX
+ *				if nothing is queued
+ */
+uint32_t ads_cmd_next_us(void);
+
+/**
+ * @brief Device type from a completed ADS_GET_DEV_ID query
+ *
+ * @return	ADS_OK, the command result or ADS_ERR_DEV_ID
+ */
+int ads_cmd_get_dev_type(const ads_cmd_t * cmd, ADS_DEV_TYPE_T * dev_type);
+
+/**
+ * @brief Firmware version from a completed ADS_GET_FW_VER query
+ *
+ * @return	ADS_OK, the command result or ADS_ERR if it is no version
+ */
+int ads_cmd_get_fw_ver(const ads_cmd_t * cmd, uint16_t * fw_ver);
+
+#endif /* ADS_TWO_AXIS_CMD_H_ */
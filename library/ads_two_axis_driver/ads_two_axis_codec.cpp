@@ -0,0 +1,326 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#include <stddef.h>
+#include "ads_two_axis_codec.h"
+#include "ads_two_axis_util.h"
+
+#define ADS_CODEC_MAX_WIDTH			(16)
+
+
+static uint16_t ads_codec_zigzag(uint16_t d)
+{
+	return (uint16_t)((d << 1) ^ (uint16_t)-(uint16_t)(d >> 15));
+}
+
+static uint16_t ads_codec_unzigzag(uint16_t z)
+{
+	return (uint16_t)((z >> 1) ^ (uint16_t)-(uint16_t)(z & 1));
+}
+
+/**
+ * @brief Prediction of the next value from the history of one axis
+ */
+static uint16_t ads_codec_predict(const int16_t * prev, uint8_t history)
+{
+	if(history < 2)
+		return (uint16_t)prev[0];
+
+	return (uint16_t)(2 * (uint16_t)prev[0] - (uint16_t)prev[1]);
+}
+
+static uint8_t ads_codec_width(uint16_t value)
+{
+	uint8_t w = 0;
+
+	while(value)
+	{
+		value >>= 1;
+		w++;
+	}
+
+	return w;
+}
+
+/**
+ * @brief Parses the header of the block at data
+ *
+ * @return	block size, 0 if data ends inside the block, ADS_ERR_BAD_PARAM
+ *				if the block is malformed
+ */
+static int32_t ads_codec_parse(const uint8_t * data, uint32_t len, ads_codec_block_t * info, const uint8_t ** widths)
+{
+	if(len < 1)
+		return 0;
+
+	info->key = (data[0] & ADS_CODEC_KEY_FLAG) != 0;
+	info->count = (data[0] & 0x1F) + 1;
+	info->time_us = 0;
+
+	if(data[0] & 0x60)
+		return ADS_ERR_BAD_PARAM;
+
+	uint32_t offset = 1 + (info->key ? ADS_CODEC_KEY_SIZE : 0);
+
+	if(len < offset + 2)
+		return 0;
+
+	uint8_t w0 = data[offset];
+	uint8_t w1 = data[offset + 1];
+
+	if(w0 > ADS_CODEC_MAX_WIDTH || w1 > ADS_CODEC_MAX_WIDTH)
+		return ADS_ERR_BAD_PARAM;
+
+	uint32_t residuals = info->count - (info->key ? 1 : 0);
+	uint32_t size = offset + 2 + (residuals * (w0 + w1) + 7) / 8;
+
+	if(len < size)
+		return 0;
+
+	if(info->key)
+		info->time_us = (uint32_t)ads_uint16_decode(&data[5]) | ((uint32_t)ads_uint16_decode(&data[7]) << 16);
+
+	info->size = (uint16_t)size;
+	*widths = &data[offset];
+
+	return (int32_t)size;
+}
+
+
+/************************************************************************/
+/*                                Encoder                               */
+/************************************************************************/
+
+void ads_codec_enc_init(ads_codec_enc_t * enc, uint8_t key_interval)
+{
+	enc->key_interval = key_interval;
+	enc->blocks = 0;
+	enc->key = false;
+	enc->key_pending = true;
+	enc->count = 0;
+	enc->history = 0;
+	enc->samples = 0;
+	enc->bytes = 0;
+}
+
+void ads_codec_enc_key(ads_codec_enc_t * enc)
+{
+	enc->key_pending = true;
+}
+
+uint8_t ads_codec_encode(ads_codec_enc_t * enc, const int16_t * raw, uint32_t time_us, uint8_t * out)
+{
+	if(enc->count == 0)
+	{
+		enc->time_us = time_us;
+		enc->key = enc->key_pending || (enc->key_interval && enc->blocks >= enc->key_interval);
+
+		if(enc->key)
+		{
+			enc->key_pending = false;
+			enc->blocks = 0;
+			enc->history = 0;
+		}
+	}
+
+	for(uint8_t a = 0; a < 2; a++)
+	{
+		if(enc->history == 0)
+			enc->first[a] = raw[a];
+		else
+			enc->residual[a][enc->count] = ads_codec_zigzag((uint16_t)raw[a] - ads_codec_predict(enc->prev[a], enc->history));
+
+		enc->prev[a][1] = enc->prev[a][0];
+		enc->prev[a][0] = raw[a];
+	}
+
+	if(enc->history < 2)
+		enc->history++;
+
+	enc->count++;
+	enc->samples++;
+
+	if(enc->count < ADS_CODEC_BLOCK)
+		return 0;
+
+	return ads_codec_flush(enc, out);
+}
+
+uint8_t ads_codec_flush(ads_codec_enc_t * enc, uint8_t * out)
+{
+	if(enc->count == 0)
+		return 0;
+
+	uint8_t * p = out;
+	uint8_t start = enc->key ? 1 : 0;
+
+	*p++ = (enc->key ? ADS_CODEC_KEY_FLAG : 0) | (uint8_t)(enc->count - 1);
+
+	if(enc->key)
+	{
+		p += ads_uint16_encode((uint16_t)enc->first[0], p);
+		p += ads_uint16_encode((uint16_t)enc->first[1], p);
+		p += ads_uint16_encode((uint16_t)enc->time_us, p);
+		p += ads_uint16_encode((uint16_t)(enc->time_us >> 16), p);
+	}
+
+	uint8_t width[2];
+
+	for(uint8_t a = 0; a < 2; a++)
+	{
+		uint16_t bits = 0;
+
+		for(uint8_t i = start; i < enc->count; i++)
+			bits |= enc->residual[a][i];
+
+		width[a] = ads_codec_width(bits);
+		*p++ = width[a];
+	}
+
+	uint32_t acc = 0;
+	uint8_t fill = 0;
+
+	for(uint8_t a = 0; a < 2; a++)
+	{
+		for(uint8_t i = start; i < enc->count; i++)
+		{
+			acc |= (uint32_t)enc->residual[a][i] << fill;
+			fill += width[a];
+
+			while(fill >= 8)
+			{
+				*p++ = (uint8_t)acc;
+				acc >>= 8;
+				fill -= 8;
+			}
+		}
+	}
+
+	if(fill)
+		*p++ = (uint8_t)acc;
+
+	enc->count = 0;
+	enc->blocks++;
+
+	uint8_t size = (uint8_t)(p - out);
+	enc->bytes += size;
+
+	return size;
+}
+
+
+/************************************************************************/
+/*                                Decoder                               */
+/************************************************************************/
+
+void ads_codec_dec_init(ads_codec_dec_t * dec)
+{
+	dec->history = 0;
+	dec->synced = false;
+	dec->key_time_us = 0;
+	dec->skipped = 0;
+}
+
+int ads_codec_block_info(const uint8_t * data, uint32_t len, ads_codec_block_t * info)
+{
+	const uint8_t * widths;
+
+	return ads_codec_parse(data, len, info, &widths) > 0 ? ADS_OK : ADS_ERR_BAD_PARAM;
+}
+
+int32_t ads_codec_decode(ads_codec_dec_t * dec, const uint8_t * data, uint32_t len,
+						 int16_t * raw, uint32_t max, uint32_t * used)
+{
+	uint32_t pos = 0;
+	uint32_t samples = 0;
+
+	while(pos < len)
+	{
+		ads_codec_block_t info;
+		const uint8_t * widths;
+		int32_t size = ads_codec_parse(&data[pos], len - pos, &info, &widths);
+
+		if(size < 0)
+			return ADS_ERR_BAD_PARAM;
+
+		if(size == 0 || samples + info.count > max)
+			break;
+
+		if(!info.key && !dec->synced)
+		{
+			dec->skipped++;
+			pos += (uint32_t)size;
+			continue;
+		}
+
+		uint8_t start = 0;
+		uint8_t history = dec->history;
+		int16_t * out = &raw[2 * samples];
+
+		if(info.key)
+		{
+			out[0] = ads_int16_decode(&data[pos + 1]);
+			out[1] = ads_int16_decode(&data[pos + 3]);
+			dec->prev[0][0] = out[0];
+			dec->prev[1][0] = out[1];
+			dec->synced = true;
+			dec->key_time_us = info.time_us;
+			history = 1;
+			start = 1;
+		}
+
+		const uint8_t * p = widths + 2;
+		const uint8_t * end = &data[pos + (uint32_t)size];
+		uint64_t acc = 0;
+		uint8_t fill = 0;
+
+		for(uint8_t a = 0; a < 2; a++)
+		{
+			uint8_t w = widths[a];
+			uint16_t mask = (uint16_t)((1UL << w) - 1);
+			int16_t p0 = dec->prev[a][0];
+			int16_t p1 = dec->prev[a][1];
+			uint8_t h = history;
+
+			for(uint8_t i = start; i < info.count; i++)
+			{
+				while(fill < w && p < end)
+				{
+					acc |= (uint64_t)*p++ << fill;
+					fill += 8;
+				}
+
+				uint16_t z = (uint16_t)acc & mask;
+				acc >>= w;
+				fill -= w;
+
+				uint16_t pred = h < 2 ? (uint16_t)p0 : (uint16_t)(2 * (uint16_t)p0 - (uint16_t)p1);
+				int16_t value = (int16_t)(uint16_t)(pred + ads_codec_unzigzag(z));
+
+				out[2 * i + a] = value;
+				p1 = p0;
+				p0 = value;
+
+				if(h < 2)
+					h++;
+			}
+
+			dec->prev[a][0] = p0;
+			dec->prev[a][1] = p1;
+		}
+
+		dec->history = (uint8_t)(history + info.count - start) < 2 ? (uint8_t)(history + info.count - start) : 2;
+		samples += info.count;
+		pos += (uint32_t)size;
+	}
+
+	if(used)
+		*used = pos;
+
+	return (int32_t)samples;
+}
@@ -0,0 +1,134 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_CODEC_H_
+#define ADS_TWO_AXIS_CODEC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ads_two_axis_err.h"
+
+/*
+ * Lossless compression of Q10.5 sample streams for serial links, radio
+ * links and captures. Each sample is predicted from the two before it,
+ * 2 * x[n-1] - x[n-2], and the zigzag coded residual is stored. Bend
+ * angles are smooth, so residuals of a few units are typical. They are
+ * bit packed per block of up to ADS_CODEC_BLOCK samples, each axis with
+ * the width of its largest residual in the block.
+ *
+ * Block, little endian:
+ *
+ *   u8  header			Bit 7 set for a keyframe, bits 0-4 count - 1
+ *   keyframes only:
+ *     i16 raw[2]		First sample as is, it has no residual
+ *     u32 time_us		Time of the first sample
+ *   u8  width[2]		Bits per residual of each axis, 0 to 16
+ *   residuals			Axis 0, then axis 1, LSB first, padded to a byte
+ *
+ * A keyframe starts a new prediction, decoding may begin at any of them.
+ * The encoder emits one every key_interval blocks, and on request, e.g.
+ * after a gap in the samples or at the start of each radio packet.
+ *
+ * The encoder works in place on ~90 bytes of state and hands out whole
+ * blocks, no allocation. Decoding is a loop of shifts and masks, a few ns
+ * per sample on a host.
+ */
+
+#define ADS_CODEC_BLOCK				(16)	// Samples per block, at most 32
+#define ADS_CODEC_KEY_SIZE			(8)		// Keyframe fields after the header
+#define ADS_CODEC_MAX_BLOCK_SIZE	(1 + ADS_CODEC_KEY_SIZE + 2 + 2 * 2 * ADS_CODEC_BLOCK)
+#define ADS_CODEC_KEY_FLAG			(0x80)
+
+typedef struct {
+	uint8_t key_interval;				// Blocks from one keyframe to the next, 0 for the first only
+	uint8_t blocks;						// Blocks since the last keyframe
+	bool key;							// Current block is a keyframe
+	bool key_pending;					// Next block is a keyframe
+	uint8_t count;						// Samples in the current block
+	uint8_t history;					// Samples in prev, 0 to 2
+	int16_t prev[2][2];					// Last and second to last sample of each axis
+	int16_t first[2];					// Keyframe sample
+	uint32_t time_us;					// Time of the first sample of the block
+	uint16_t residual[2][ADS_CODEC_BLOCK];	// Zigzag coded
+	uint32_t samples;					// Samples encoded
+	uint32_t bytes;						// Bytes emitted
+} ads_codec_enc_t;
+
+typedef struct {
+	uint8_t history;
+	int16_t prev[2][2];
+	bool synced;						// A keyframe was decoded
+	uint32_t key_time_us;				// Time of the last keyframe
+	uint32_t skipped;					// Blocks skipped before the first keyframe
+} ads_codec_dec_t;
+
+typedef struct {
+	uint16_t size;						// Bytes in the block
+	uint8_t count;						// Samples in the block
+	bool key;
+	uint32_t time_us;					// Keyframes only
+} ads_codec_block_t;
+
+
+/**
+ * @brief Initializes an encoder, the first block is a keyframe
+ *
+ * @param key_interval	blocks from one keyframe to the next, 0 for the first only
+ */
+void ads_codec_enc_init(ads_codec_enc_t * enc, uint8_t key_interval);
+
+/**
+ * @brief Encodes one sample. Emits the block once it holds ADS_CODEC_BLOCK.
+ *
+ * @param raw		both axes, Q10.5
+ * @param time_us	sample time, stored in keyframes
+ * @param out		room for ADS_CODEC_MAX_BLOCK_SIZE bytes
+ * @return	bytes written to out, 0 while the block fills
+ */
+uint8_t ads_codec_encode(ads_codec_enc_t * enc, const int16_t * raw, uint32_t time_us, uint8_t * out);
+
+/**
+ * @brief Emits the samples of an incomplete block, e.g. before a link
+ *				goes idle
+ *
+ * @param out	room for ADS_CODEC_MAX_BLOCK_SIZE bytes
+ * @return	bytes written to out, 0 if the block was empty
+ */
+uint8_t ads_codec_flush(ads_codec_enc_t * enc, uint8_t * out);
+
+/**
+ * @brief Makes the next block a keyframe. Flush first for the current one.
+ */
+void ads_codec_enc_key(ads_codec_enc_t * enc);
+
+/**
+ * @brief Initializes a decoder, blocks before the first keyframe are skipped
+ */
+void ads_codec_dec_init(ads_codec_dec_t * dec);
+
+/**
+ * @brief Decodes the complete blocks at the start of data
+ *
+ * @param raw	receives both axes of every sample, interleaved
+ * @param max	room in raw, in samples
+ * @param used	receives the bytes consumed, the start of the next block
+ * @return	samples decoded or ADS_ERR_BAD_PARAM if a block is malformed
+ */
+int32_t ads_codec_decode(ads_codec_dec_t * dec, const uint8_t * data, uint32_t len,
+						 int16_t * raw, uint32_t max, uint32_t * used);
+
+/**
+ * @brief Reads the header of the block at data without decoding it, for
+ *				indexing keyframes
+ *
+ * @return	ADS_OK or ADS_ERR_BAD_PARAM if data does not hold a complete,
+ *				valid block
+ */
+int ads_codec_block_info(const uint8_t * data, uint32_t len, ads_codec_block_t * info);
+
+#endif /* ADS_TWO_AXIS_CODEC_H_ */
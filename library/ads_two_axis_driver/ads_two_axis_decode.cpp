@@ -0,0 +1,385 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#include "ads_two_axis_decode.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(ARDUINO)
+#define ADS_DECODE_X86				(1)
+#include <immintrin.h>
+#else
+#define ADS_DECODE_X86				(0)
+#endif
+
+typedef size_t (*ads_decode_raw_fn)(const uint8_t *, size_t, int16_t *, int16_t *, uint8_t *);
+typedef size_t (*ads_decode_float_fn)(const uint8_t *, size_t, float *, float *, uint8_t *);
+
+static ADS_DECODE_IMPL_T ads_decode_impl = ADS_DECODE_AUTO;
+static ads_decode_raw_fn ads_decode_raw_impl;
+static ads_decode_float_fn ads_decode_float_impl;
+
+
+/************************************************************************/
+/*                              Scalar                                  */
+/************************************************************************/
+
+static size_t ads_decode_raw_scalar(const uint8_t * packets, size_t n, int16_t * axis0, int16_t * axis1, uint8_t * valid)
+{
+	size_t count = 0;
+
+	for(size_t i = 0; i < n; i++, packets += ADS_TRANSFER_SIZE)
+	{
+		bool sample = (packets[0] == ADS_SAMPLE);
+
+		axis0[i] = sample ? ads_int16_decode(&packets[1]) : 0;
+		axis1[i] = sample ? ads_int16_decode(&packets[3]) : 0;
+
+		if(valid)
+			valid[i] = sample;
+
+		count += sample;
+	}
+
+	return count;
+}
+
+static size_t ads_decode_float_scalar(const uint8_t * packets, size_t n, float * axis0, float * axis1, uint8_t * valid)
+{
+	size_t count = 0;
+
+	for(size_t i = 0; i < n; i++, packets += ADS_TRANSFER_SIZE)
+	{
+		bool sample = (packets[0] == ADS_SAMPLE);
+
+		axis0[i] = sample ? ads_q5_to_float(ads_int16_decode(&packets[1])) : 0.0f;
+		axis1[i] = sample ? ads_q5_to_float(ads_int16_decode(&packets[3])) : 0.0f;
+
+		if(valid)
+			valid[i] = sample;
+
+		count += sample;
+	}
+
+	return count;
+}
+
+
+#if ADS_DECODE_X86
+/************************************************************************/
+/*                           SSE4.1 / AVX2                              */
+/************************************************************************/
+
+/*
+ * A block is 8 packets, 40 bytes. Three overlapping 16 byte loads at
+ * offsets 0, 15 and 24 hold packets 0-2, 3-5 and 6-7, and one byte shuffle
+ * per load and column moves each packet's field into its 16 bit lane. The
+ * loads never reach past the block. AVX2 runs two blocks, one per 128 bit
+ * lane, as its byte shuffle does not cross lanes.
+ */
+#define ADS_DECODE_BLOCK			(8)
+#define ADS_DECODE_BLOCK_BYTES		(ADS_DECODE_BLOCK * ADS_TRANSFER_SIZE)
+#define ADS_DECODE_LOAD_B			(15)
+#define ADS_DECODE_LOAD_C			(24)
+
+#define Z							(-128)		// Shuffle index that writes zero
+
+/* Field at byte f of each packet, for loads A, B and C */
+#define ADS_DECODE_SHUF_A(f)		_mm_setr_epi8(f, f + 1, f + 5, f + 6, f + 10, f + 11, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z)
+#define ADS_DECODE_SHUF_B(f)		_mm_setr_epi8(Z, Z, Z, Z, Z, Z, f, f + 1, f + 5, f + 6, f + 10, f + 11, Z, Z, Z, Z)
+#define ADS_DECODE_SHUF_C(f)		_mm_setr_epi8(Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, f + 6, f + 7, f + 11, f + 12)
+
+/* Tag byte of each packet, zero extended to 16 bits */
+#define ADS_DECODE_TAG_A			_mm_setr_epi8(0, Z, 5, Z, 10, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z)
+#define ADS_DECODE_TAG_B			_mm_setr_epi8(Z, Z, Z, Z, Z, Z, 0, Z, 5, Z, 10, Z, Z, Z, Z, Z)
+#define ADS_DECODE_TAG_C			_mm_setr_epi8(Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, 6, Z, 11, Z)
+
+typedef struct {
+	__m128i axis0;
+	__m128i axis1;
+	__m128i mask;				// 0xFFFF in the lanes of sample packets
+} ads_decode_block128_t;
+
+__attribute__((target("sse4.1")))
+static inline ads_decode_block128_t ads_decode_block_sse41(const uint8_t * p)
+{
+	__m128i a = _mm_loadu_si128((const __m128i *)p);
+	__m128i b = _mm_loadu_si128((const __m128i *)(p + ADS_DECODE_LOAD_B));
+	__m128i c = _mm_loadu_si128((const __m128i *)(p + ADS_DECODE_LOAD_C));
+	ads_decode_block128_t blk;
+
+	__m128i tag = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, ADS_DECODE_TAG_A),
+											_mm_shuffle_epi8(b, ADS_DECODE_TAG_B)),
+								_mm_shuffle_epi8(c, ADS_DECODE_TAG_C));
+	blk.mask = _mm_cmpeq_epi16(tag, _mm_set1_epi16(ADS_SAMPLE));
+
+	blk.axis0 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, ADS_DECODE_SHUF_A(1)),
+										  _mm_shuffle_epi8(b, ADS_DECODE_SHUF_B(1))),
+							 _mm_shuffle_epi8(c, ADS_DECODE_SHUF_C(1)));
+	blk.axis1 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, ADS_DECODE_SHUF_A(3)),
+										  _mm_shuffle_epi8(b, ADS_DECODE_SHUF_B(3))),
+							 _mm_shuffle_epi8(c, ADS_DECODE_SHUF_C(3)));
+
+	blk.axis0 = _mm_and_si128(blk.axis0, blk.mask);
+	blk.axis1 = _mm_and_si128(blk.axis1, blk.mask);
+
+	return blk;
+}
+
+/**
+ * @brief Stores the valid flags of a block and returns its sample count
+ */
+__attribute__((target("sse4.1")))
+static inline size_t ads_decode_valid_sse41(__m128i mask, uint8_t * valid)
+{
+	__m128i flags = _mm_packs_epi16(mask, _mm_setzero_si128());
+
+	if(valid)
+		_mm_storel_epi64((__m128i *)valid, _mm_and_si128(flags, _mm_set1_epi8(1)));
+
+	return (size_t)__builtin_popcount(_mm_movemask_epi8(flags));
+}
+
+__attribute__((target("sse4.1")))
+static size_t ads_decode_raw_sse41(const uint8_t * packets, size_t n, int16_t * axis0, int16_t * axis1, uint8_t * valid)
+{
+	size_t count = 0;
+	size_t i = 0;
+
+	for(; i + ADS_DECODE_BLOCK <= n; i += ADS_DECODE_BLOCK, packets += ADS_DECODE_BLOCK_BYTES)
+	{
+		ads_decode_block128_t blk = ads_decode_block_sse41(packets);
+
+		_mm_storeu_si128((__m128i *)&axis0[i], blk.axis0);
+		_mm_storeu_si128((__m128i *)&axis1[i], blk.axis1);
+
+		count += ads_decode_valid_sse41(blk.mask, valid ? &valid[i] : NULL);
+	}
+
+	return count + ads_decode_raw_scalar(packets, n - i, &axis0[i], &axis1[i], valid ? &valid[i] : NULL);
+}
+
+__attribute__((target("sse4.1")))
+static inline void ads_decode_store_float_sse41(float * dst, __m128i raw)
+{
+	const __m128 scale = _mm_set1_ps(1.0f / 32.0f);
+
+	_mm_storeu_ps(dst, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(raw)), scale));
+	_mm_storeu_ps(dst + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(raw, raw))), scale));
+}
+
+__attribute__((target("sse4.1")))
+static size_t ads_decode_float_sse41(const uint8_t * packets, size_t n, float * axis0, float * axis1, uint8_t * valid)
+{
+	size_t count = 0;
+	size_t i = 0;
+
+	for(; i + ADS_DECODE_BLOCK <= n; i += ADS_DECODE_BLOCK, packets += ADS_DECODE_BLOCK_BYTES)
+	{
+		ads_decode_block128_t blk = ads_decode_block_sse41(packets);
+
+		ads_decode_store_float_sse41(&axis0[i], blk.axis0);
+		ads_decode_store_float_sse41(&axis1[i], blk.axis1);
+
+		count += ads_decode_valid_sse41(blk.mask, valid ? &valid[i] : NULL);
+	}
+
+	return count + ads_decode_float_scalar(packets, n - i, &axis0[i], &axis1[i], valid ? &valid[i] : NULL);
+}
+
+typedef struct {
+	__m256i axis0;
+	__m256i axis1;
+	__m256i mask;
+} ads_decode_block256_t;
+
+__attribute__((target("avx2")))
+static inline __m256i ads_decode_load2_avx2(const uint8_t * p)
+{
+	return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)p)),
+								   _mm_loadu_si128((const __m128i *)(p + ADS_DECODE_BLOCK_BYTES)), 1);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i ads_decode_shuffle3_avx2(__m256i a, __m256i b, __m256i c, __m128i sa, __m128i sb, __m128i sc)
+{
+	return _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(a, _mm256_broadcastsi128_si256(sa)),
+										   _mm256_shuffle_epi8(b, _mm256_broadcastsi128_si256(sb))),
+						   _mm256_shuffle_epi8(c, _mm256_broadcastsi128_si256(sc)));
+}
+
+/* Two blocks, 16 packets */
+__attribute__((target("avx2")))
+static inline ads_decode_block256_t ads_decode_block_avx2(const uint8_t * p)
+{
+	__m256i a = ads_decode_load2_avx2(p);
+	__m256i b = ads_decode_load2_avx2(p + ADS_DECODE_LOAD_B);
+	__m256i c = ads_decode_load2_avx2(p + ADS_DECODE_LOAD_C);
+	ads_decode_block256_t blk;
+
+	__m256i tag = ads_decode_shuffle3_avx2(a, b, c, ADS_DECODE_TAG_A, ADS_DECODE_TAG_B, ADS_DECODE_TAG_C);
+	blk.mask = _mm256_cmpeq_epi16(tag, _mm256_set1_epi16(ADS_SAMPLE));
+
+	blk.axis0 = ads_decode_shuffle3_avx2(a, b, c, ADS_DECODE_SHUF_A(1), ADS_DECODE_SHUF_B(1), ADS_DECODE_SHUF_C(1));
+	blk.axis1 = ads_decode_shuffle3_avx2(a, b, c, ADS_DECODE_SHUF_A(3), ADS_DECODE_SHUF_B(3), ADS_DECODE_SHUF_C(3));
+
+	blk.axis0 = _mm256_and_si256(blk.axis0, blk.mask);
+	blk.axis1 = _mm256_and_si256(blk.axis1, blk.mask);
+
+	return blk;
+}
+
+__attribute__((target("avx2")))
+static inline size_t ads_decode_valid_avx2(__m256i mask, uint8_t * valid)
+{
+	// packs works per lane, flags of packets 0-7 land in bytes 0-7 and of 8-15 in bytes 16-23
+	__m256i flags = _mm256_packs_epi16(mask, _mm256_setzero_si256());
+
+	if(valid)
+	{
+		__m256i ones = _mm256_and_si256(flags, _mm256_set1_epi8(1));
+
+		_mm_storel_epi64((__m128i *)valid, _mm256_castsi256_si128(ones));
+		_mm_storel_epi64((__m128i *)(valid + ADS_DECODE_BLOCK), _mm256_extracti128_si256(ones, 1));
+	}
+
+	return (size_t)__builtin_popcount((uint32_t)_mm256_movemask_epi8(flags));
+}
+
+__attribute__((target("avx2")))
+static size_t ads_decode_raw_avx2(const uint8_t * packets, size_t n, int16_t * axis0, int16_t * axis1, uint8_t * valid)
+{
+	size_t count = 0;
+	size_t i = 0;
+
+	for(; i + 2 * ADS_DECODE_BLOCK <= n; i += 2 * ADS_DECODE_BLOCK, packets += 2 * ADS_DECODE_BLOCK_BYTES)
+	{
+		ads_decode_block256_t blk = ads_decode_block_avx2(packets);
+
+		_mm256_storeu_si256((__m256i *)&axis0[i], blk.axis0);
+		_mm256_storeu_si256((__m256i *)&axis1[i], blk.axis1);
+
+		count += ads_decode_valid_avx2(blk.mask, valid ? &valid[i] : NULL);
+	}
+
+	return count + ads_decode_raw_sse41(packets, n - i, &axis0[i], &axis1[i], valid ? &valid[i] : NULL);
+}
+
+__attribute__((target("avx2")))
+static inline void ads_decode_store_float_avx2(float * dst, __m256i raw)
+{
+	const __m256 scale = _mm256_set1_ps(1.0f / 32.0f);
+
+	_mm256_storeu_ps(dst, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(raw))), scale));
+	_mm256_storeu_ps(dst + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(raw, 1))), scale));
+}
+
+__attribute__((target("avx2")))
+static size_t ads_decode_float_avx2(const uint8_t * packets, size_t n, float * axis0, float * axis1, uint8_t * valid)
+{
+	size_t count = 0;
+	size_t i = 0;
+
+	for(; i + 2 * ADS_DECODE_BLOCK <= n; i += 2 * ADS_DECODE_BLOCK, packets += 2 * ADS_DECODE_BLOCK_BYTES)
+	{
+		ads_decode_block256_t blk = ads_decode_block_avx2(packets);
+
+		ads_decode_store_float_avx2(&axis0[i], blk.axis0);
+		ads_decode_store_float_avx2(&axis1[i], blk.axis1);
+
+		count += ads_decode_valid_avx2(blk.mask, valid ? &valid[i] : NULL);
+	}
+
+	return count + ads_decode_float_sse41(packets, n - i, &axis0[i], &axis1[i], valid ? &valid[i] : NULL);
+}
+
+#undef Z
+#endif /* ADS_DECODE_X86 */
+
+
+/************************************************************************/
+/*                             Dispatch                                 */
+/************************************************************************/
+
+static bool ads_decode_supported(ADS_DECODE_IMPL_T impl)
+{
+	switch(impl)
+	{
+	case ADS_DECODE_SCALAR:
+		return true;
+#if ADS_DECODE_X86
+	case ADS_DECODE_SSE41:
+		return __builtin_cpu_supports("sse4.1");
+	case ADS_DECODE_AVX2:
+		return __builtin_cpu_supports("avx2");
+#endif
+	default:
+		return false;
+	}
+}
+
+ADS_DECODE_IMPL_T ads_decode_set_impl(ADS_DECODE_IMPL_T impl)
+{
+	if(impl == ADS_DECODE_AUTO)
+	{
+		if(ads_decode_supported(ADS_DECODE_AVX2))
+			impl = ADS_DECODE_AVX2;
+		else if(ads_decode_supported(ADS_DECODE_SSE41))
+			impl = ADS_DECODE_SSE41;
+		else
+			impl = ADS_DECODE_SCALAR;
+	}
+	else if(!ads_decode_supported(impl))
+	{
+		impl = ADS_DECODE_SCALAR;
+	}
+
+	switch(impl)
+	{
+#if ADS_DECODE_X86
+	case ADS_DECODE_AVX2:
+		ads_decode_raw_impl = ads_decode_raw_avx2;
+		ads_decode_float_impl = ads_decode_float_avx2;
+		break;
+	case ADS_DECODE_SSE41:
+		ads_decode_raw_impl = ads_decode_raw_sse41;
+		ads_decode_float_impl = ads_decode_float_sse41;
+		break;
+#endif
+	default:
+		ads_decode_raw_impl = ads_decode_raw_scalar;
+		ads_decode_float_impl = ads_decode_float_scalar;
+		break;
+	}
+
+	ads_decode_impl = impl;
+
+	return impl;
+}
+
+ADS_DECODE_IMPL_T ads_decode_get_impl(void)
+{
+	if(ads_decode_impl == ADS_DECODE_AUTO)
+		ads_decode_set_impl(ADS_DECODE_AUTO);
+
+	return ads_decode_impl;
+}
+
+size_t ads_decode_raw(const uint8_t * packets, size_t n, int16_t * axis0, int16_t * axis1, uint8_t * valid)
+{
+	if(ads_decode_impl == ADS_DECODE_AUTO)
+		ads_decode_set_impl(ADS_DECODE_AUTO);
+
+	return ads_decode_raw_impl(packets, n, axis0, axis1, valid);
+}
+
+size_t ads_decode_float(const uint8_t * packets, size_t n, float * axis0, float * axis1, uint8_t * valid)
+{
+	if(ads_decode_impl == ADS_DECODE_AUTO)
+		ads_decode_set_impl(ADS_DECODE_AUTO);
+
+	return ads_decode_float_impl(packets, n, axis0, axis1, valid);
+}
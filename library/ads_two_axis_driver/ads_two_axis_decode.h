@@ -0,0 +1,74 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_DECODE_H_
+#define ADS_TWO_AXIS_DECODE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ads_two_axis_hal.h"
+#include "ads_two_axis_util.h"
+
+/*
+ * Batch decoding of raw packets as read from the ADS, ADS_TRANSFER_SIZE
+ * bytes each and packed back to back. The axes are written as separate
+ * columns. Packets that are not ADS_SAMPLE are written as 0 and flagged in
+ * the optional valid column, so every column keeps one entry per packet.
+ *
+ * x86 builds pick an SSE4.1 or AVX2 implementation at run time when the
+ * CPU has it, everything else uses the portable scalar loop. All
+ * implementations give identical results.
+ */
+
+typedef enum {
+	ADS_DECODE_AUTO = 0,		// Fastest implementation the CPU supports
+	ADS_DECODE_SCALAR,
+	ADS_DECODE_SSE41,
+	ADS_DECODE_AVX2
+} ADS_DECODE_IMPL_T;
+
+
+/**
+ * @brief Selects the implementation used by the decode functions
+ *
+ * @param impl	requested implementation
+ * @return	implementation now in use, ADS_DECODE_SCALAR if impl is not
+ *			supported by this build or CPU
+ */
+ADS_DECODE_IMPL_T ads_decode_set_impl(ADS_DECODE_IMPL_T impl);
+
+/**
+ * @brief Implementation currently in use, never ADS_DECODE_AUTO
+ */
+ADS_DECODE_IMPL_T ads_decode_get_impl(void);
+
+/**
+ * @brief Decodes n packets into Q10.5 columns, degrees = raw / 32
+ *
+ * @param packets		n * ADS_TRANSFER_SIZE bytes
+ * @param n				number of packets
+ * @param axis0[out]	n values of axis 0
+ * @param axis1[out]	n values of axis 1
+ * @param valid[out]	n flags, 1 for a sample packet. NULL if not needed
+ * @return	number of sample packets
+ */
+size_t ads_decode_raw(const uint8_t * packets, size_t n, int16_t * axis0, int16_t * axis1, uint8_t * valid);
+
+/**
+ * @brief Decodes n packets into columns of degrees
+ *
+ * @param packets		n * ADS_TRANSFER_SIZE bytes
+ * @param n				number of packets
+ * @param axis0[out]	n angles of axis 0
+ * @param axis1[out]	n angles of axis 1
+ * @param valid[out]	n flags, 1 for a sample packet. NULL if not needed
+ * @return	number of sample packets
+ */
+size_t ads_decode_float(const uint8_t * packets, size_t n, float * axis0, float * axis1, uint8_t * valid);
+
+#endif /* ADS_TWO_AXIS_DECODE_H_ */
@@ -21,9 +21,72 @@
 
 #include "ads_two_axis_fw_v2.h"
 
+/* The images above stay for their revisions, the arrays are not linked
+ * unless ADS_FW_COMPRESSED is 0 */
+#ifndef ADS_FW_COMPRESSED
+#define ADS_FW_COMPRESSED		(1)		// Embed the LZ compressed images, see ads_two_axis_lz.h
+#endif
+
+#if ADS_FW_COMPRESSED == 1
+#include "ads_two_axis_lz.h"
+
+#if ADS_FW_INCLUDE_ADS_V1 == 1
+#include "ads_two_axis_fw_lz.h"
+#endif
+
+#include "ads_two_axis_fw_v2_lz.h"
+#endif
+
 #define ADS_BOOTLOADER_ADDRESS (0x12)
 
-static inline int ads_two_axis_dfu_get_ack(void);
+#define ADS_DFU_START_MS		(50)		// Time from ADS_DFU until the bootloader answers
+#define ADS_DFU_POLL_MS			(5)			// Interval of the version query while the application boots
+
+#define ADS_DFU_PAGE_SIZE		(64)		// Bootloader flash page, acknowledged as a whole
+#define ADS_DFU_ACK_POLL_US		(50)		// Interval of the acknowledgment reads around the expected time
+#define ADS_DFU_ACK_POLL_MAX_US	(1000)		// Backoff limit of the acknowledgment reads
+#define ADS_DFU_ERASE_TIMEOUT_MS	(1000)		// Longest wait for the length acknowledgment
+#define ADS_DFU_PAGE_TIMEOUT_MS	(100)		// Longest wait for a page acknowledgment
+
+#define ADS_DFU_RECORD_VERSION	(1)
+
+static const uint8_t ads_dfu_record_magic[4] = { 'A', 'D', 'S', 'D' };
+
+/* Firmware image in the driver */
+typedef struct {
+	const uint8_t * data;
+	uint32_t size;					// Bytes in data
+	uint32_t len;					// Bytes of the image
+	uint16_t crc;					// ads_crc16() of the image, compressed images only
+	uint16_t rev;					// Firmware version of the image
+} ads_dfu_image_t;
+
+#if ADS_FW_COMPRESSED == 1
+static ads_lz_dec_t ads_dfu_lz;		// Decoder of the image being sent
+#endif
+
+/* Devices a transfer on the bootloader address reaches */
+typedef struct {
+	ads_dfu_target_t * targets;
+	uint8_t count;
+	ads_dfu_progress progress;
+	void * ctx;
+} ads_dfu_group_t;
+
+static bool ads_two_axis_dfu_image(ads_dfu_image_t * image);
+
+/**
+ * @brief true if the image in the driver is newer than fw_ver
+ */
+static bool ads_two_axis_dfu_newer(uint16_t fw_ver)
+{
+	ads_dfu_image_t image;
+	
+	if(!ads_two_axis_dfu_image(&image))
+		return false;
+	
+	return fw_ver < image.rev;
+}
 
 /**
  * @brief Checks if the firmware image in the driver is newer than 
@@ -34,18 +97,11 @@ static inline int ads_two_axis_dfu_get_ack(void);
  */
 bool ads_two_axis_dfu_check(uint8_t ads_get_fw_ver)
 {
-	uint8_t buffer[] = {ADS_GET_FW_VER, 0, 0};
+	uint8_t buffer[ADS_TRANSFER_SIZE] = {ADS_GET_FW_VER, 0, 0};
 	uint16_t fw_ver;
 	
-	ads_hal_pin_int_enable(false);
-	
-	ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
-	ads_hal_delay(2);
-	ads_hal_read_buffer(buffer, ADS_TRANSFER_SIZE);
-	
-	ads_hal_pin_int_enable(true);
-	
-	if(buffer[0] == ADS_FW_VER)
+	if(ads_hal_write_read_buffer(buffer, ADS_TRANSFER_SIZE, ADS_TRANSFER_SIZE) == ADS_OK &&
+	   buffer[0] == ADS_FW_VER)
 	{
 		fw_ver = ads_uint16_decode(&buffer[1]);
 	}
@@ -54,36 +110,85 @@ bool ads_two_axis_dfu_check(uint8_t ads_get_fw_ver)
 		return false;
 	}
 
-#if ADS_FW_INCLUDE_ADS_V1 == 1
-    return fw_ver < ads_fw_rev;
-#endif
+	return ads_two_axis_dfu_newer(fw_ver);
+}
+
+/**
+ * @brief Queues the version query of ads_two_axis_dfu_check() and returns
+ *			at once
+ *
+ * @return	ADS_OK or ADS_ERR_OP_IN_PROGRESS if cmd is still queued
+ */
+int ads_two_axis_dfu_check_async(ads_cmd_t * cmd, ads_cmd_callback callback, void * ctx)
+{
+	return ads_cmd_submit_query(cmd, ads_hal_get_default_device(), ADS_GET_FW_VER, callback, ctx);
+}
+
+/**
+ * @brief Result of a completed ads_two_axis_dfu_check_async()
+ *
+ * @return	TRUE if update needed. FALSE if no updated needed
+ */
+bool ads_two_axis_dfu_check_result(const ads_cmd_t * cmd)
+{
+	uint16_t fw_ver;
 	
-#if ADS_FW_INCLUDE_ADS_V2 == 1
-		return fw_ver < ads_fw_v2_rev;
-#endif
-		
-	return false;
+	if(ads_cmd_get_fw_ver(cmd, &fw_ver) != ADS_OK)
+		return false;
+	
+	return ads_two_axis_dfu_newer(fw_ver);
 }
 
 /**
- * @brief Reads acknowledgment byte from the ADS bootloader
+ * @brief Waits for the acknowledgment byte of the ADS bootloader. Sleeps
+ *				through most of the expected time, then reads every
+ *				ADS_DFU_ACK_POLL_US until the acknowledgment is late, so
+ *				the number of reads does not grow with the bus clock. From
+ *				then on the interval doubles up to ADS_DFU_ACK_POLL_MAX_US,
+ *				so a long erase does not flood the bus.
  *
+ * @param start			time of the write being acknowledged
+ * @param expect_us		expected time to the acknowledgment, 0 if unknown
+ * @param timeout_ms	longest wait from start
  * @return	ADS_OK if successful ADS_ERR_TIMEOUT if failed
  */
-static inline int ads_two_axis_dfu_get_ack(void)
+static int ads_two_axis_dfu_get_ack(ads_hal_dev_t * boot, uint32_t start, uint32_t expect_us,
+									uint32_t timeout_ms, ads_dfu_timing_t * timing)
 {
-	uint8_t timeout = 250;
-	uint8_t ack = 0;
+	uint32_t interval = 0;
 	
-	do
-	{
-		ads_hal_read_buffer(&ack, 1);
-	} while(--timeout && ack != 's');
+	if(expect_us)
+		ads_hal_delay_us(expect_us - expect_us / 16);
 	
-	if(timeout)
-		return ADS_OK;
-	else
-		return ADS_ERR_TIMEOUT;
+	for(;;)
+	{
+		uint8_t ack = 0;
+		
+		ads_hal_dev_read_buffer(boot, &ack, 1);
+		timing->polls++;
+		
+		if(ack == 's')
+			return ADS_OK;
+		
+		uint32_t elapsed = ads_hal_get_time_us() - start;
+		
+		if(elapsed >= timeout_ms * 1000)
+			return ADS_ERR_TIMEOUT;
+		
+		if(elapsed > expect_us + expect_us / 8)
+		{
+			interval = interval ? 2 * interval : ADS_DFU_ACK_POLL_US;
+			
+			if(interval > ADS_DFU_ACK_POLL_MAX_US)
+				interval = ADS_DFU_ACK_POLL_MAX_US;
+			
+			ads_hal_delay_us(interval);
+		}
+		else
+		{
+			ads_hal_delay_us(ADS_DFU_ACK_POLL_US);
+		}
+	}
 }
 
 /**
@@ -103,41 +208,194 @@ static inline int ads_two_axis_dfu_get_ack(void)
  }
 
 /**
- * @brief Writes firmware image to ADS contained in ads_fw.h
+ * @brief Resets dev into bootloader mode
  *
- * @return	ADS_OK if successful ADS_ERR_TIMEOUT if failed
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_two_axis_dfu_update(void)
+int ads_two_axis_dfu_dev_reset(ads_hal_dev_t * dev)
 {
-  const uint8_t * fw = NULL;
-	uint32_t len = 0;
+	uint8_t packet[ADS_TRANSFER_SIZE];
+	
+	packet[0] = ADS_DFU;
+	packet[1] = packet[2] = 0;
+	
+	return ads_hal_dev_write_buffer(dev, packet, ADS_TRANSFER_SIZE);
+}
+
+/**
+ * @brief Firmware image in the driver
+ *
+ * @return	false if none is included
+ */
+static bool ads_two_axis_dfu_image(ads_dfu_image_t * image)
+{
+	memset(image, 0, sizeof(*image));
+	
+#if ADS_FW_COMPRESSED == 1
+	
+#if ADS_FW_INCLUDE_ADS_V1 == 1
+	image->data = ads_fw_lz;
+	image->size = sizeof(ads_fw_lz);
+	image->len = ads_fw_lz_len;
+	image->crc = ads_fw_lz_crc;
+	image->rev = ads_fw_lz_rev;
+#endif
+	
+	image->data = ads_two_axis_fw_v2_lz;
+	image->size = sizeof(ads_two_axis_fw_v2_lz);
+	image->len = ads_two_axis_fw_v2_lz_len;
+	image->crc = ads_two_axis_fw_v2_lz_crc;
+	image->rev = ads_two_axis_fw_v2_lz_rev;
+	
+#else
 	
 #if ADS_FW_INCLUDE_ADS_V1 == 1
-  fw = ads_fw;
-  len = sizeof(ads_fw);
+  image->data = ads_fw;
+  image->size = sizeof(ads_fw);
+  image->rev = ads_fw_rev;
 #endif
 
 #if ADS_FW_INCLUDE_ADS_V2 == 1
-  fw = ads_two_axis_fw_v2;
-  len = sizeof(ads_two_axis_fw_v2);
+  image->data = ads_two_axis_fw_v2;
+  image->size = sizeof(ads_two_axis_fw_v2);
+  image->rev = ads_two_axis_fw_v2_rev;
 #endif
 
-fw = ads_two_axis_fw_v2;
-  len = sizeof(ads_two_axis_fw_v2);
+image->data = ads_two_axis_fw_v2;
+  image->size = sizeof(ads_two_axis_fw_v2);
+	image->len = image->size;
+	image->rev = ads_two_axis_fw_v2_rev;
+	
+#endif
 
-	if (fw == NULL || len == 0)
-		return ADS_ERR_DEV_ID;
+	return image->data != NULL && image->len != 0;
+}
+
+/**
+ * @brief Starts reading image from its first byte
+ */
+static void ads_two_axis_dfu_image_open(const ads_dfu_image_t * image)
+{
+#if ADS_FW_COMPRESSED == 1
+	ads_lz_dec_init(&ads_dfu_lz, image->data, image->size);
+#else
+	(void)image;
+#endif
+}
+
+/**
+ * @brief Reads the next len bytes of image, at offset, into page. A
+ *				compressed image is decoded on the way, only its window is
+ *				held in RAM.
+ *
+ * @return	false if the image ends early
+ */
+static bool ads_two_axis_dfu_image_read(const ads_dfu_image_t * image, uint32_t offset, uint8_t * page, uint32_t len)
+{
+#if ADS_FW_COMPRESSED == 1
+	(void)image;
+	(void)offset;
+	
+	return ads_lz_read(&ads_dfu_lz, page, len) == len;
+#else
+	if(offset + len > image->len)
+		return false;
+	
+	memcpy(page, &image->data[offset], len);
+	
+	return true;
+#endif
+}
+
+/**
+ * @brief Decodes a compressed image once and checks its CRC, so a damaged
+ *				image is found before the application is erased
+ *
+ * @return	ADS_OK or ADS_ERR_BAD_PARAM
+ */
+static int ads_two_axis_dfu_image_check(const ads_dfu_image_t * image)
+{
+#if ADS_FW_COMPRESSED == 1
+	uint8_t page[ADS_DFU_PAGE_SIZE];
+	uint16_t crc = 0xFFFF;
+	uint32_t total = 0;
+	uint32_t n;
+	
+	ads_two_axis_dfu_image_open(image);
+	
+	while((n = ads_lz_read(&ads_dfu_lz, page, sizeof(page))) > 0)
+	{
+		crc = ads_crc16_update(crc, page, n);
+		total += n;
+	}
+	
+	if(total != image->len || crc != image->crc)
+		return ADS_ERR_BAD_PARAM;
+#else
+	(void)image;
+#endif
+	
+	return ADS_OK;
+}
 
-	uint8_t page_size   = 64;
-	uint8_t block_len   = page_size;
+/**
+ * @brief ads_crc16() of image, computed once for an image embedded as is
+ */
+static uint16_t ads_two_axis_dfu_image_crc(ads_dfu_image_t * image)
+{
+#if ADS_FW_COMPRESSED != 1
+	static uint16_t crc;
+	static bool known = false;
 	
-	uint8_t packet[page_size];
+	if(!known)
+	{
+		crc = ads_crc16(image->data, image->len);
+		known = true;
+	}
 	
-	// Store a local copy of the current i2c address
-	uint8_t address = ads_hal_get_address();
+	image->crc = crc;
+#endif
 	
-	// Set the i2c address to the booloader address
-	ads_hal_set_address(ADS_BOOTLOADER_ADDRESS);
+	return image->crc;
+}
+
+/**
+ * @brief Handle for the bootloader address. Every device in bootloader
+ *				mode answers on it, so a transfer reaches all of them.
+ */
+static void ads_two_axis_dfu_boot_device(ads_hal_dev_t * boot)
+{
+	memset(boot, 0, sizeof(*boot));
+	boot->address = ADS_BOOTLOADER_ADDRESS;
+}
+
+/**
+ * @brief Writes an image to the bootloaders listening on boot. Each page
+ *				goes out in writes as large as the HAL takes. The wait for
+ *				its acknowledgment learns the page program time from the
+ *				pages before.
+ *
+ * @param timing	receives progress and timing, reset here
+ * @param page_done	called after the length and every acknowledged page, may be NULL
+ * @return	ADS_OK if successful ADS_ERR_IO if a write was not taken
+ *				ADS_ERR_TIMEOUT if an acknowledgment is missing
+ *				ADS_ERR_BAD_PARAM if the image ends early
+ */
+static int ads_two_axis_dfu_transfer(ads_hal_dev_t * boot, const ads_dfu_image_t * image,
+									 ads_dfu_timing_t * timing, ads_dfu_timing_callback page_done, void * ctx)
+{
+	uint32_t len = image->len;
+	uint8_t packet[ADS_DFU_PAGE_SIZE];
+	uint8_t chunk = ads_hal_bus_max_write();
+	
+	if(chunk > ADS_DFU_PAGE_SIZE)
+		chunk = ADS_DFU_PAGE_SIZE;
+	
+	memset(timing, 0, sizeof(*timing));
+	timing->len = len;
+	timing->chunk = chunk;
+	
+	ads_two_axis_dfu_image_open(image);
 	
 	// Transmit the length of the new firmware to the bootloader
 	packet[0] = (uint8_t)(len & 0xff);
@@ -145,60 +403,393 @@ fw = ads_two_axis_fw_v2;
 	packet[2] = (uint8_t)((len>>16) & 0xff);
 	packet[3] = (uint8_t)((len>>24) & 0xff); 
 	
-	ads_hal_write_buffer(packet, 4);
+	uint32_t start = ads_hal_get_time_us();
 	
-	// Get acknowledgement of the fw length
-	if(ads_two_axis_dfu_get_ack() != ADS_OK)
-	{
-		// restore i2c address
-		ads_hal_set_address(address);
+	if(ads_hal_dev_write_buffer(boot, packet, 4) != ADS_OK)
+		return ADS_ERR_IO;
+	
+	// Get acknowledgement of the fw length, the bootloader erases first
+	if(ads_two_axis_dfu_get_ack(boot, ads_hal_get_time_us(), 0, ADS_DFU_ERASE_TIMEOUT_MS, timing) != ADS_OK)
 		return ADS_ERR_TIMEOUT;
-	}
 	
-	// Transfer the new firmware image
-	uint32_t nb_blocks = len/block_len;
-	uint32_t rem_data  = len % block_len;
+	timing->handshake_us = ads_hal_get_time_us() - start;
+	
+	if(page_done)
+		page_done(timing, ctx);
 	
-	for(uint32_t i = 0; i < nb_blocks; i++)
+	// Transfer the new firmware image
+	while(timing->sent < len)
 	{
+		uint32_t page_len = len - timing->sent;
+		
+		if(page_len > ADS_DFU_PAGE_SIZE)
+			page_len = ADS_DFU_PAGE_SIZE;
+		
 		// Copy the next page
-		memcpy(packet, &fw[i*page_size], page_size);
+		if(!ads_two_axis_dfu_image_read(image, timing->sent, packet, page_len))
+			return ADS_ERR_BAD_PARAM;
 		
 		// Send the page
-		ads_hal_write_buffer(packet, page_size/2);
+		start = ads_hal_get_time_us();
 		
-		ads_hal_write_buffer(&packet[page_size/2], page_size/2);
+		for(uint32_t offset = 0; offset < page_len; offset += chunk)
+		{
+			uint32_t n = page_len - offset;
+			
+			if(ads_hal_dev_write_buffer(boot, &packet[offset], (uint8_t)(n > chunk ? chunk : n)) != ADS_OK)
+				return ADS_ERR_IO;
+		}
+		
+		uint32_t written = ads_hal_get_time_us();
+		timing->transfer_us += written - start;
 		
 		// Get acknowledgement of the recieved page
-		if(ads_two_axis_dfu_get_ack() != ADS_OK)
-		{
-			// restore i2c address
-			ads_hal_set_address(address);
+		if(ads_two_axis_dfu_get_ack(boot, written, timing->program_us, ADS_DFU_PAGE_TIMEOUT_MS, timing) != ADS_OK)
 			return ADS_ERR_TIMEOUT;
-		}
+		
+		uint32_t wait = ads_hal_get_time_us() - written;
+		timing->ack_us += wait;
+		
+		if(timing->program_us == 0 || wait < timing->program_us)
+			timing->program_us = wait;
+		
+		timing->sent += page_len;
+		timing->pages++;
+		
+		if(page_done)
+			page_done(timing, ctx);
 	}
 	
-	// Transfer the remainder and get acknowledgement
-	memcpy(packet, &fw[nb_blocks*block_len], rem_data);
+	return ADS_OK;
+}
+
+/**
+ * @brief Writes firmware image to ADS contained in ads_fw.h
+ *
+ * @return	ADS_OK if successful ADS_ERR_IO if a write was not taken
+ *				ADS_ERR_TIMEOUT if failed
+ */
+int ads_two_axis_dfu_update(void)
+{
+	return ads_two_axis_dfu_update_timed(NULL, NULL);
+}
+
+int ads_two_axis_dfu_update_timed(ads_dfu_timing_callback callback, void * ctx)
+{
+	ads_dfu_image_t image;
+
+	if (!ads_two_axis_dfu_image(&image))
+		return ADS_ERR_DEV_ID;
 	
-	if(rem_data > page_size/2)
+	if(ads_two_axis_dfu_image_check(&image) != ADS_OK)
+		return ADS_ERR_BAD_PARAM;
+	
+	ads_hal_dev_t boot;
+	ads_dfu_timing_t timing;
+	
+	ads_two_axis_dfu_boot_device(&boot);
+	
+	return ads_two_axis_dfu_transfer(&boot, &image, &timing, callback, ctx);
+}
+
+
+/************************************************************************/
+/*                            Group update                              */
+/************************************************************************/
+
+static void ads_two_axis_dfu_set_state(ads_dfu_group_t * group, ads_dfu_target_t * target,
+									   ADS_DFU_STATE_T state, int result)
+{
+	target->state = state;
+	target->result = result;
+	
+	if(group->progress)
+		group->progress(target, group->ctx);
+}
+
+/**
+ * @brief Progress of every staged device of the group, they all receive
+ *				the same pages
+ */
+static void ads_two_axis_dfu_group_page(const ads_dfu_timing_t * timing, void * ctx)
+{
+	ads_dfu_group_t * group = (ads_dfu_group_t *)ctx;
+	
+	for(uint8_t i = 0; i < group->count; i++)
 	{
-		ads_hal_write_buffer(packet, page_size/2);
-		ads_hal_write_buffer(&packet[page_size/2], rem_data - page_size/2);
+		ads_dfu_target_t * target = &group->targets[i];
+		
+		if(target->state != ADS_DFU_STAGED)
+			continue;
+		
+		target->timing = *timing;
+		
+		if(group->progress)
+			group->progress(target, group->ctx);
 	}
-	else
-		ads_hal_write_buffer(packet, rem_data);
+}
+
+/**
+ * @brief Polls the firmware version of dev until its application answers
+ *
+ * @return	ADS_OK or ADS_ERR_TIMEOUT after ADS_BOOT_DELAY_MS
+ */
+static int ads_two_axis_dfu_wait_app(ads_hal_dev_t * dev, uint16_t * fw_ver)
+{
+	uint32_t start = ads_hal_get_time_us();
 	
-	if(ads_two_axis_dfu_get_ack() != ADS_OK)
+	do
 	{
-		// restore i2c address
-		ads_hal_set_address(address);
+		uint8_t buffer[ADS_TRANSFER_SIZE] = {ADS_GET_FW_VER, 0, 0};
+		
+		if(ads_hal_dev_write_read_buffer(dev, buffer, ADS_TRANSFER_SIZE, ADS_TRANSFER_SIZE) == ADS_OK &&
+		   buffer[0] == ADS_FW_VER)
+		{
+			*fw_ver = ads_uint16_decode(&buffer[1]);
+			return ADS_OK;
+		}
+		
+		ads_hal_delay(ADS_DFU_POLL_MS);
+		
+	} while(ads_hal_get_time_us() - start < (uint32_t)ADS_BOOT_DELAY_MS * 1000);
+	
+	return ADS_ERR_TIMEOUT;
+}
+
+/**
+ * @brief Polls the firmware version of dev until its application answers
+ *				and checks that it runs image
+ *
+ * @return	ADS_OK, ADS_ERR_TIMEOUT after ADS_BOOT_DELAY_MS or ADS_ERR_DEV_ID
+ *				if the application is older than image
+ */
+static int ads_two_axis_dfu_wait_current(ads_hal_dev_t * dev, const ads_dfu_image_t * image, uint16_t * fw_ver)
+{
+	if(ads_two_axis_dfu_wait_app(dev, fw_ver) != ADS_OK)
 		return ADS_ERR_TIMEOUT;
+	
+	if(*fw_ver < image->rev)
+		return ADS_ERR_DEV_ID;
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Updates target on its own, the other devices are in their
+ *				applications and ignore the bootloader address
+ */
+static void ads_two_axis_dfu_update_alone(ads_dfu_group_t * group, ads_dfu_target_t * target,
+										  ads_hal_dev_t * boot, const ads_dfu_image_t * image)
+{
+	ads_dfu_group_t alone = { target, 1, group->progress, group->ctx };
+	ads_dfu_timing_t timing;
+	uint16_t fw_ver;
+	
+	target->retried = true;
+	memset(&target->timing, 0, sizeof(target->timing));
+	target->timing.len = image->len;
+	
+	if(ads_two_axis_dfu_wait_app(target->dev, &fw_ver) == ADS_OK)
+	{
+		if(ads_two_axis_dfu_dev_reset(target->dev) != ADS_OK)
+		{
+			ads_two_axis_dfu_set_state(group, target, ADS_DFU_FAILED, ADS_ERR_IO);
+			return;
+		}
+		
+		ads_hal_delay(ADS_DFU_START_MS);
+	}
+	else
+	{
+		// An interrupted transfer leaves no application to ask, only the
+		// data ready line gets it into the bootloader
+		int ret = ads_hal_dev_reset_bootloader(target->dev);
+		
+		if(ret != ADS_OK)
+		{
+			ads_two_axis_dfu_set_state(group, target, ADS_DFU_FAILED, ret == ADS_ERR_BAD_PARAM ? ret : ADS_ERR_IO);
+			return;
+		}
+	}
+	
+	int ret = ads_two_axis_dfu_transfer(boot, image, &timing, &ads_two_axis_dfu_group_page, &alone);
+	
+	if(ret == ADS_OK)
+		ret = ads_two_axis_dfu_wait_current(target->dev, image, &target->fw_ver);
+	
+	if(ret != ADS_OK)
+	{
+		// Out of the bootloader, it must not hear the next device's image
+		ads_hal_dev_reset(target->dev);
+		ads_two_axis_dfu_set_state(group, target, ADS_DFU_FAILED, ret);
+		return;
+	}
+	
+	ads_two_axis_dfu_set_state(group, target, ADS_DFU_DONE, ADS_OK);
+}
+
+int ads_two_axis_dfu_update_group(ads_dfu_target_t * targets, uint8_t count, ads_dfu_progress progress, void * ctx)
+{
+	ads_dfu_image_t image;
+	
+	if(!ads_two_axis_dfu_image(&image))
+		return ADS_ERR_DEV_ID;
+	
+	if(ads_two_axis_dfu_image_check(&image) != ADS_OK)
+		return ADS_ERR_BAD_PARAM;
+	
+	ads_dfu_group_t group = { targets, count, progress, ctx };
+	ads_dfu_timing_t timing;
+	ads_hal_dev_t boot;
+	uint8_t staged = 0;
+	
+	ads_two_axis_dfu_boot_device(&boot);
+	
+	// Every device enters its bootloader, from then on they all take the
+	// pages written to the one bootloader address
+	for(uint8_t i = 0; i < count; i++)
+	{
+		ads_dfu_target_t * target = &targets[i];
+		
+		memset(&target->timing, 0, sizeof(target->timing));
+		target->timing.len = image.len;
+		target->fw_ver = 0;
+		target->retried = false;
+		
+		ads_hal_dev_pin_int_enable(target->dev, false);
+		
+		if(ads_two_axis_dfu_dev_reset(target->dev) != ADS_OK)
+		{
+			ads_two_axis_dfu_set_state(&group, target, ADS_DFU_FAILED, ADS_ERR_IO);
+			continue;
+		}
+		
+		ads_two_axis_dfu_set_state(&group, target, ADS_DFU_STAGED, ADS_OK);
+		staged++;
+	}
+	
+	int shared = ADS_ERR_IO;
+	
+	if(staged)
+	{
+		ads_hal_delay(ADS_DFU_START_MS);
+		shared = ads_two_axis_dfu_transfer(&boot, &image, &timing, &ads_two_axis_dfu_group_page, &group);
+	}
+	
+	// A device that stopped acknowledging holds up the others, take them
+	// all out of the bootloader before updating one at a time
+	if(shared != ADS_OK)
+	{
+		for(uint8_t i = 0; i < count; i++)
+		{
+			if(targets[i].state == ADS_DFU_STAGED)
+				ads_hal_dev_reset(targets[i].dev);
+		}
 	}
 	
-	// restore i2c address
-	ads_hal_set_address(address);
+	int ret = ADS_OK;
+	
+	for(uint8_t i = 0; i < count; i++)
+	{
+		ads_dfu_target_t * target = &targets[i];
+		
+		if(target->state == ADS_DFU_STAGED)
+		{
+			// A device that missed pages, e.g. on a bus that does not AND
+			// the acknowledgments, comes back with its old version
+			if(shared == ADS_OK && ads_two_axis_dfu_wait_current(target->dev, &image, &target->fw_ver) == ADS_OK)
+			{
+				ads_two_axis_dfu_set_state(&group, target, ADS_DFU_DONE, ADS_OK);
+			}
+			else
+			{
+				if(shared == ADS_OK)
+					ads_hal_dev_reset(target->dev);
+				
+				ads_two_axis_dfu_update_alone(&group, target, &boot, &image);
+			}
+		}
+		
+		if(target->result != ADS_OK && ret == ADS_OK)
+			ret = target->result;
+	}
+	
+	return ret;
+}
+
+
+/************************************************************************/
+/*                          Update records                              */
+/************************************************************************/
+
+bool ads_two_axis_dfu_record_current(const ads_dfu_record_t * record, uint8_t address, ADS_DEV_TYPE_T dev_type)
+{
+	ads_dfu_image_t image;
+	
+	if(!ads_two_axis_dfu_image(&image))
+		return false;
+	
+	return record->address == address && record->dev_type == (uint8_t)dev_type &&
+		   record->fw_ver >= image.rev && record->image_len == image.len &&
+		   record->image_crc == ads_two_axis_dfu_image_crc(&image);
+}
+
+int ads_two_axis_dfu_verify(ads_hal_dev_t * dev, ADS_DEV_TYPE_T dev_type, ads_dfu_record_t * record)
+{
+	ads_dfu_image_t image;
+	uint16_t fw_ver;
+	
+	if(!ads_two_axis_dfu_image(&image))
+		return ADS_ERR_DEV_ID;
+	
+	int ret = ads_two_axis_dfu_wait_current(dev, &image, &fw_ver);
+	
+	if(ret != ADS_OK)
+		return ret;
+	
+	if(record)
+	{
+		record->address = dev->address;
+		record->dev_type = (uint8_t)dev_type;
+		record->fw_ver = fw_ver;
+		record->image_len = image.len;
+		record->image_crc = ads_two_axis_dfu_image_crc(&image);
+	}
 	
 	return ADS_OK;
 }
 
+int ads_two_axis_dfu_record_save(const ads_dfu_record_t * record, uint8_t * blob, uint16_t size)
+{
+	if(size < ADS_DFU_RECORD_SIZE)
+		return ADS_ERR_BAD_PARAM;
+	
+	memcpy(blob, ads_dfu_record_magic, sizeof(ads_dfu_record_magic));
+	blob[4] = ADS_DFU_RECORD_VERSION;
+	blob[5] = record->address;
+	blob[6] = record->dev_type;
+	blob[7] = 0;
+	ads_uint16_encode(record->fw_ver, &blob[8]);
+	ads_uint16_encode((uint16_t)record->image_len, &blob[10]);
+	ads_uint16_encode((uint16_t)(record->image_len >> 16), &blob[12]);
+	ads_uint16_encode(record->image_crc, &blob[14]);
+	ads_uint16_encode(ads_crc16(blob, ADS_DFU_RECORD_SIZE - 2), &blob[16]);
+	
+	return ADS_DFU_RECORD_SIZE;
+}
+
+int ads_two_axis_dfu_record_load(ads_dfu_record_t * record, const uint8_t * blob, uint16_t len)
+{
+	if(len < ADS_DFU_RECORD_SIZE || memcmp(blob, ads_dfu_record_magic, sizeof(ads_dfu_record_magic)) != 0 ||
+	   blob[4] != ADS_DFU_RECORD_VERSION ||
+	   ads_crc16(blob, ADS_DFU_RECORD_SIZE - 2) != ads_uint16_decode(&blob[16]))
+		return ADS_ERR_BAD_PARAM;
+	
+	record->address = blob[5];
+	record->dev_type = blob[6];
+	record->fw_ver = ads_uint16_decode(&blob[8]);
+	record->image_len = (uint32_t)ads_uint16_decode(&blob[10]) | ((uint32_t)ads_uint16_decode(&blob[12]) << 16);
+	record->image_crc = ads_uint16_decode(&blob[14]);
+	
+	return ADS_OK;
+}
@@ -16,6 +16,56 @@
 #include "ads_two_axis_err.h"
 #include "ads_two_axis_hal.h"
 #include "ads_two_axis_util.h"
+#include "ads_two_axis_cmd.h"
+
+/* Progress and timing of a firmware transfer */
+typedef struct {
+	uint32_t sent;					// Image bytes acknowledged
+	uint32_t len;					// Image size
+	uint32_t handshake_us;			// Image length write until its acknowledgment
+	uint32_t transfer_us;			// Page writes, all pages
+	uint32_t ack_us;				// Waits for page acknowledgments, all pages
+	uint32_t program_us;			// Shortest page acknowledgment seen, the learned page program time
+	uint16_t pages;					// Pages acknowledged
+	uint16_t polls;					// Acknowledgment reads
+	uint8_t chunk;					// Bytes per write
+} ads_dfu_timing_t;
+
+/* Called once the length is acknowledged and after every page */
+typedef void (*ads_dfu_timing_callback)(const ads_dfu_timing_t * timing, void * ctx);
+
+/* State of one device in ads_two_axis_dfu_update_group() */
+typedef enum {
+	ADS_DFU_PENDING = 0,
+	ADS_DFU_STAGED,					// In bootloader mode, receiving the image
+	ADS_DFU_DONE,					// Application answers after the update
+	ADS_DFU_FAILED
+} ADS_DFU_STATE_T;
+
+typedef struct {
+	ads_hal_dev_t * dev;			// Device at its application address
+	ADS_DFU_STATE_T state;
+	int result;						// ADS_OK or the reason of ADS_DFU_FAILED
+	ads_dfu_timing_t timing;		// Transfer that reached the device last
+	uint16_t fw_ver;				// Version the application reports after the update
+	bool retried;					// Updated on its own after the shared transfer failed for it
+} ads_dfu_target_t;
+
+/* Called on every state change and acknowledged page of a device */
+typedef void (*ads_dfu_progress)(const ads_dfu_target_t * target, void * ctx);
+
+#define ADS_DFU_RECORD_SIZE		(18)	// Bytes of a saved ads_dfu_record_t
+
+/* Last verified update of one device. Kept by the application in non
+ * volatile memory, it skips the version query while the device and the
+ * embedded image stay the same. */
+typedef struct {
+	uint8_t address;				// I2C address of the device
+	uint8_t dev_type;				// ADS_DEV_TYPE_T
+	uint16_t fw_ver;				// Version the application reported after the update
+	uint32_t image_len;				// Identifies the embedded image the update wrote, its size
+	uint16_t image_crc;				// and its ads_crc16(), computed on the host, never read from the device
+} ads_dfu_record_t;
 
 
 /**
@@ -27,6 +77,24 @@
  */
 bool ads_two_axis_dfu_check(uint8_t ads_get_fw_ver);
 
+/**
+ * @brief Queues the version query of ads_two_axis_dfu_check() and returns
+ *			at once, see ads_two_axis_cmd.h
+ *
+ * @param cmd		command storage, valid until done
+ * @param callback	completion callback, may be NULL
+ * @param ctx		passed to callback
+ * @return	ADS_OK or ADS_ERR_OP_IN_PROGRESS if cmd is still queued
+ */
+int ads_two_axis_dfu_check_async(ads_cmd_t * cmd, ads_cmd_callback callback, void * ctx);
+
+/**
+ * @brief Result of a completed ads_two_axis_dfu_check_async()
+ *
+ * @return	TRUE if update needed. FALSE if no updated needed or the query failed
+ */
+bool ads_two_axis_dfu_check_result(const ads_cmd_t * cmd);
+
 
 /**
  * @brief Resets the ADS into bootloader mode
@@ -46,10 +114,108 @@ int ads_two_axis_dfu_reset(void);
 /**
  * @brief Writes firmware image, contained in ads_two_axis_fw.h, to the ADS bootloader 
  *			  The ADS needs to be reset into bootloader mode prior to calling
- *				this function
+ *				this function. The image is embedded LZ compressed unless
+ *				ADS_FW_COMPRESSED is 0 and is decoded page by page.
  *
- * @return	ADS_OK if successful ADS_ERR_TIMEOUT if failed
+ * @return	ADS_OK if successful ADS_ERR_IO if a write was not taken
+ *				ADS_ERR_TIMEOUT if failed ADS_ERR_BAD_PARAM if the embedded
+ *				image is damaged
  */
 int ads_two_axis_dfu_update(void);
 
+/**
+ * @brief ads_two_axis_dfu_update() reporting progress and the time spent
+ *				in each phase of the transfer
+ *
+ * @param callback	called once the length is acknowledged and after every
+ *					page, may be NULL
+ * @param ctx		passed to callback
+ * @return	ADS_OK if successful ADS_ERR_TIMEOUT if failed
+ */
+int ads_two_axis_dfu_update_timed(ads_dfu_timing_callback callback, void * ctx);
+
+/**
+ * @brief Resets dev into bootloader mode
+ *
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_two_axis_dfu_dev_reset(ads_hal_dev_t * dev);
+
+/**
+ * @brief Updates several ADS on one bus at once. Every bootloader answers
+ *				on the same address, so all devices are reset into their
+ *				bootloaders together and receive each page from one
+ *				write. The whole group takes the time of a single device.
+ *
+ *				A page completes when the slowest device has programmed
+ *				it only if a busy bootloader pulls the acknowledgment bits
+ *				it reads low, so the open drain bus ANDs them. Nothing on
+ *				the bus tells whether it does, so afterwards every device
+ *				must answer with at least the image version, as
+ *				ads_two_axis_dfu_verify() checks, or it is updated again
+ *				on its own. If the shared transfer stalls,
+ *				every device is reset out of its bootloader and updated
+ *				one at a time, so one faulty device does not fail the
+ *				others. A device whose application was erased by the
+ *				stalled transfer no longer answers and enters its
+ *				bootloader through ads_hal_dev_reset_bootloader(), which
+ *				needs a data ready line the backend can drive and no other
+ *				device on both its lines. Initialize the devices again
+ *				afterwards.
+ *
+ * @param targets	devices at their application addresses, dev set
+ * @param count		number of targets
+ * @param progress	called on every state change and page, may be NULL
+ * @param ctx		passed to progress
+ * @return	ADS_OK if every device was updated, else the result of the
+ *				first failed target
+ */
+int ads_two_axis_dfu_update_group(ads_dfu_target_t * targets, uint8_t count, ads_dfu_progress progress, void * ctx);
+
+/**
+ * @brief Checks record against the image in the driver without any bus
+ *				traffic. A device recorded at address with dev_type and the
+ *				size and CRC of this image needs neither the version query
+ *				nor an update. Clear the record when a sensor is replaced.
+ *
+ * @param record	record loaded with ads_two_axis_dfu_record_load()
+ * @return	TRUE if the device runs the image in the driver
+ */
+bool ads_two_axis_dfu_record_current(const ads_dfu_record_t * record, uint8_t address, ADS_DEV_TYPE_T dev_type);
+
+/**
+ * @brief Verifies that the application of dev runs the image in the
+ *				driver, after an update or before a recovery. Waits up to
+ *				ADS_BOOT_DELAY_MS for the application to answer.
+ *
+ *				The check is by version only. The ADS can't report a
+ *				digest of its flash, so an application answering with at
+ *				least the image version counts as verified; a corrupt page
+ *				that still boots is not detected. The size and CRC stored
+ *				in record describe the embedded image, so a later driver
+ *				with another image no longer matches the record.
+ *
+ * @param dev_type	type of dev, stored in record
+ * @param record	receives the record of dev on success, may be NULL
+ * @return	ADS_OK, ADS_ERR_TIMEOUT if the application does not answer or
+ *				ADS_ERR_DEV_ID if it is older than the image
+ */
+int ads_two_axis_dfu_verify(ads_hal_dev_t * dev, ADS_DEV_TYPE_T dev_type, ads_dfu_record_t * record);
+
+/**
+ * @brief Serializes record, with a CRC, for non volatile memory
+ *
+ * @param size	room in blob, at least ADS_DFU_RECORD_SIZE
+ * @return	bytes written or ADS_ERR_BAD_PARAM if blob is too small
+ */
+int ads_two_axis_dfu_record_save(const ads_dfu_record_t * record, uint8_t * blob, uint16_t size);
+
+/**
+ * @brief Restores a record written by ads_two_axis_dfu_record_save()
+ *
+ * @return	ADS_OK or ADS_ERR_BAD_PARAM if blob is not a valid record,
+ *				e.g. erased memory
+ */
+int ads_two_axis_dfu_record_load(ads_dfu_record_t * record, const uint8_t * blob, uint16_t len);
+
 #endif /* ADS_TWO_AXIS_DFU_ */
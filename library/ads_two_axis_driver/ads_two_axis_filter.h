@@ -0,0 +1,325 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_FILTER_H_
+#define ADS_TWO_AXIS_FILTER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include "ads_two_axis.h"
+
+/*
+ * Sample filters with per instance state. A chain applies its stages in
+ * order to N channels at once:
+ *
+ *   static ads_filter_chain<ads_lowpass_filter<20>, ads_deadzone_filter<50>> filters[2];
+ *
+ *   void ads_data_callback(ads_dev_t * dev, float * sample)
+ *   {
+ *       filters[dev == &ads_a ? 0 : 1].process(dev, sample);
+ *   }
+ *
+ * Low pass coefficients are designed at compile time for every ADS_SPS_T,
+ * so a rate change only selects another row. process(dev, sample) follows
+ * the rate set with ads_two_axis_dev_set_sample_rate() on its own. State is
+ * kept channel major so the channel loops vectorize for larger N.
+ */
+
+typedef struct {
+	float b0, b1, b2;			// Feed forward
+	float a1, a2;				// Feedback, a0 normalized to 1
+} ads_biquad_coeffs_t;
+
+#define ADS_FILTER_TICK_HZ			(16384.0)		// ADS_SPS_T is in ticks of this clock
+#define ADS_FILTER_PI				(3.14159265358979323846)
+#define ADS_FILTER_SQRT2			(1.41421356237309504880)
+#define ADS_FILTER_MAX_CUTOFF		(0.45)			// Highest usable cutoff as a fraction of the rate
+
+/* Rates with precomputed coefficients, other ADS_SPS_T values are designed on set_rate() */
+#define ADS_FILTER_RATES			(8)
+
+
+/************************************************************************/
+/*                   Compile time coefficient design                    */
+/************************************************************************/
+
+/* Taylor series tail, o = 0 for sin (term = x), o = -1 for cos (term = 1) */
+constexpr double ads_filter_series(double x2, double term, int k, int o)
+{
+	return k > 16 ? term : term + ads_filter_series(x2, -term * x2 / ((2 * k + o) * (2 * k + 1 + o)), k + 1, o);
+}
+
+constexpr double ads_filter_tan(double x)
+{
+	return ads_filter_series(x * x, x, 1, 0) / ads_filter_series(x * x, 1.0, 1, -1);
+}
+
+constexpr double ads_filter_rate_hz(ADS_SPS_T sps)
+{
+	return ADS_FILTER_TICK_HZ / (double)sps;
+}
+
+constexpr double ads_filter_cutoff(double fs, double fc)
+{
+	return fc < fs * ADS_FILTER_MAX_CUTOFF ? fc : fs * ADS_FILTER_MAX_CUTOFF;
+}
+
+constexpr ads_biquad_coeffs_t ads_filter_butterworth_kn(double k2, double k, double norm)
+{
+	return ads_biquad_coeffs_t{ (float)(k2 * norm), (float)(2 * k2 * norm), (float)(k2 * norm),
+								(float)(2 * (k2 - 1) * norm), (float)((1 - ADS_FILTER_SQRT2 * k + k2) * norm) };
+}
+
+constexpr ads_biquad_coeffs_t ads_filter_butterworth_k(double k)
+{
+	return ads_filter_butterworth_kn(k * k, k, 1.0 / (1 + ADS_FILTER_SQRT2 * k + k * k));
+}
+
+/**
+ * @brief Second order Butterworth low pass by the bilinear transform.
+ *				The cutoff is capped at ADS_FILTER_MAX_CUTOFF of the rate.
+ *
+ * @param fs	sample rate in Hz
+ * @param fc	cutoff in Hz
+ */
+constexpr ads_biquad_coeffs_t ads_filter_butterworth_lowpass(double fs, double fc)
+{
+	return ads_filter_butterworth_k(ads_filter_tan(ADS_FILTER_PI * ads_filter_cutoff(fs, fc) / fs));
+}
+
+/**
+ * @brief Row of sps in the coefficient tables, ADS_FILTER_RATES if it has none
+ */
+constexpr uint8_t ads_filter_rate_index(ADS_SPS_T sps)
+{
+	return sps == ADS_1_HZ   ? 0 : sps == ADS_10_HZ  ? 1 : sps == ADS_20_HZ  ? 2 : sps == ADS_50_HZ  ? 3 :
+		   sps == ADS_100_HZ ? 4 : sps == ADS_200_HZ ? 5 : sps == ADS_333_HZ ? 6 : sps == ADS_500_HZ ? 7 :
+		   ADS_FILTER_RATES;
+}
+
+template<uint16_t CUTOFF_HZ>
+struct ads_butterworth_table {
+	static constexpr ads_biquad_coeffs_t coeffs[ADS_FILTER_RATES] = {
+		ads_filter_butterworth_lowpass(ads_filter_rate_hz(ADS_1_HZ),   CUTOFF_HZ),
+		ads_filter_butterworth_lowpass(ads_filter_rate_hz(ADS_10_HZ),  CUTOFF_HZ),
+		ads_filter_butterworth_lowpass(ads_filter_rate_hz(ADS_20_HZ),  CUTOFF_HZ),
+		ads_filter_butterworth_lowpass(ads_filter_rate_hz(ADS_50_HZ),  CUTOFF_HZ),
+		ads_filter_butterworth_lowpass(ads_filter_rate_hz(ADS_100_HZ), CUTOFF_HZ),
+		ads_filter_butterworth_lowpass(ads_filter_rate_hz(ADS_200_HZ), CUTOFF_HZ),
+		ads_filter_butterworth_lowpass(ads_filter_rate_hz(ADS_333_HZ), CUTOFF_HZ),
+		ads_filter_butterworth_lowpass(ads_filter_rate_hz(ADS_500_HZ), CUTOFF_HZ),
+	};
+};
+
+template<uint16_t CUTOFF_HZ>
+constexpr ads_biquad_coeffs_t ads_butterworth_table<CUTOFF_HZ>::coeffs[ADS_FILTER_RATES];
+
+
+/************************************************************************/
+/*                               Stages                                 */
+/************************************************************************/
+
+/**
+ * @brief Butterworth low pass, CUTOFF_HZ at every sample rate. The first
+ *				sample after a reset settles the state, so there is no
+ *				ramp up from zero.
+ */
+template<uint16_t CUTOFF_HZ, uint8_t N = 2>
+class ads_lowpass_filter {
+public:
+	static const uint8_t channels = N;
+
+	ads_lowpass_filter() : c(ads_butterworth_table<CUTOFF_HZ>::coeffs[ads_filter_rate_index(ADS_100_HZ)]), primed(false) {}
+
+	void set_rate(ADS_SPS_T sps)
+	{
+		uint8_t index = ads_filter_rate_index(sps);
+
+		if(index < ADS_FILTER_RATES)
+			c = ads_butterworth_table<CUTOFF_HZ>::coeffs[index];
+		else
+			c = ads_filter_butterworth_lowpass(ads_filter_rate_hz(sps), CUTOFF_HZ);
+
+		// Output of the old design is a valid start, only the response changes
+	}
+
+	void reset(void)
+	{
+		primed = false;
+	}
+
+	void process(float * sample)
+	{
+		if(!primed)
+		{
+			for(uint8_t i = 0; i < N; i++)
+				x1[i] = x2[i] = y1[i] = y2[i] = sample[i];
+
+			primed = true;
+		}
+
+		for(uint8_t i = 0; i < N; i++)
+		{
+			float x = sample[i];
+			float y = c.b0 * x + c.b1 * x1[i] + c.b2 * x2[i] - c.a1 * y1[i] - c.a2 * y2[i];
+
+			x2[i] = x1[i];
+			x1[i] = x;
+			y2[i] = y1[i];
+			y1[i] = y;
+
+			sample[i] = y;
+		}
+	}
+
+private:
+	ads_biquad_coeffs_t c;
+	bool primed;
+	float x1[N], x2[N];
+	float y1[N], y2[N];
+};
+
+/**
+ * @brief Holds the output until the input moves by more than
+ *				ZONE_CENTIDEG / 100 degrees
+ */
+template<uint16_t ZONE_CENTIDEG, uint8_t N = 2>
+class ads_deadzone_filter {
+public:
+	static const uint8_t channels = N;
+
+	ads_deadzone_filter() : primed(false) {}
+
+	void set_rate(ADS_SPS_T sps)
+	{
+		(void)sps;
+	}
+
+	void reset(void)
+	{
+		primed = false;
+	}
+
+	void process(float * sample)
+	{
+		const float zone = ZONE_CENTIDEG / 100.0f;
+
+		if(!primed)
+		{
+			for(uint8_t i = 0; i < N; i++)
+				prev[i] = sample[i];
+
+			primed = true;
+		}
+
+		for(uint8_t i = 0; i < N; i++)
+		{
+			float held = prev[i];
+			float moved = fabsf(sample[i] - held) > zone ? sample[i] : held;
+
+			prev[i] = moved;
+			sample[i] = moved;
+		}
+	}
+
+private:
+	bool primed;
+	float prev[N];
+};
+
+
+/************************************************************************/
+/*                                Chain                                 */
+/************************************************************************/
+
+template<typename... Stages>
+struct ads_filter_stages;
+
+template<>
+struct ads_filter_stages<> {
+	void set_rate(ADS_SPS_T) {}
+	void reset(void) {}
+	void process(float *) {}
+};
+
+template<typename First, typename... Rest>
+struct ads_filter_stages<First, Rest...> {
+	First first;
+	ads_filter_stages<Rest...> rest;
+
+	void set_rate(ADS_SPS_T sps)
+	{
+		first.set_rate(sps);
+		rest.set_rate(sps);
+	}
+
+	void reset(void)
+	{
+		first.reset();
+		rest.reset();
+	}
+
+	void process(float * sample)
+	{
+		first.process(sample);
+		rest.process(sample);
+	}
+};
+
+/**
+ * @brief Stages applied in order. One chain per sensor, all stages must
+ *				have the same channel count.
+ */
+template<typename First, typename... Rest>
+class ads_filter_chain {
+public:
+	static const uint8_t channels = First::channels;
+
+	ads_filter_chain() : sps(ADS_100_HZ) {}
+
+	/**
+	 * @brief Switches every stage to the coefficients of sps
+	 */
+	void set_rate(ADS_SPS_T rate)
+	{
+		sps = rate;
+		stages.set_rate(rate);
+	}
+
+	void reset(void)
+	{
+		stages.reset();
+	}
+
+	/**
+	 * @brief Filters one sample of every channel in place
+	 */
+	void process(float * sample)
+	{
+		stages.process(sample);
+	}
+
+	/**
+	 * @brief Filters one sample of dev in place, following its sample rate
+	 */
+	void process(ads_dev_t * dev, float * sample)
+	{
+		if(dev->sps != sps)
+			set_rate(dev->sps);
+
+		stages.process(sample);
+	}
+
+	ads_filter_stages<First, Rest...> stages;		// stages.first, stages.rest.first, ...
+
+private:
+	ADS_SPS_T sps;
+};
+
+#endif /* ADS_TWO_AXIS_FILTER_H_ */
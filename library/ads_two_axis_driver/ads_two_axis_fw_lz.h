@@ -0,0 +1,22 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+/* Generated by tools/ads_fw_lz, do not edit */
+
+#ifndef ADS_FW_LZ_H_
+#define ADS_FW_LZ_H_
+
+#include <stdint.h>
+
+const uint8_t ads_fw_lz_rev = 16;
+const uint32_t ads_fw_lz_len = 17192;		// Bytes of the image
+const uint16_t ads_fw_lz_crc = 0x918c;		// ads_crc16() of the image
+
+const uint8_t ads_fw_lz[] = {0xff, 0xd8, 0x31, 0x00, 0x20, 0x7d, 0x52, 0x00, 0x00, 0xb1, 0x79, 0x03, 0x10, 0x00, 0x64, 0x1f, 0x24, 0x79, 0x52, 0x03, 0x2c, 0x51, 0xf9, 0x2e, 0x13, 0x3c, 0x03, 0x04, 0xa5, 0x49, 0x00, 0x00, 0xb5, 0xaa, 0x03, 0x00, 0xc5, 0x03, 0x00, 0xd5, 0x03, 0x00, 0xe5, 0x03, 0x00, 0xf5, 0xd9, 0x49, 0x2b, 0x4c, 0x5b, 0x24, 0x21, 0x25, 0x23, 0x5c, 0x10, 0xb5, 0xff, 0x06, 0x4c, 0x23, 0x78, 0x00, 0x2b, 0x07, 0xd1, 0xff, 0x05, 0x4b, 0x00, 0x2b, 0x02, 0xd0, 0x04, 0x48, 0xff, 0x00, 0xe0, 0x00, 0xbf, 0x01, 0x23, 0x23, 0x70, 0xbf, 0x10, 0xbd, 0x10, 0x00, 0x00, 0x20, 0x23, 0x04, 0x18, 0xff, 0x63, 0x00, 0x00, 0x08, 0x4b, 0x10, 0xb5, 0x00, 0xbf, 0x2b, 0x03, 0xd0, 0x07, 0x49, 0x08, 0x21, 0x08, 0x07, 0xff, 0x48, 0x03, 0x68, 0x00, 0x2b, 0x00, 0xd1, 0x10, 0xfb, 0xbd, 0x06, 0x37, 0x00, 0xfb, 0xd0, 0x98, 0x47, 0xf9, 0x85, 0xe7, 0x2b, 0x04, 0x14, 0x33, 0x00, 0x2f, 0x04, 0x03, 0x04, 0x00, 0x04, 0x01, 0xff, 0x21, 0x01, 0x71, 0xc0, 0x21, 0x49, 0x01, 0x00, 0xff, 0x23, 0x00, 0x22, 0xc1, 0x80, 0x2a, 0x21, 0x02, 0xff, 0x70, 0x42, 0x70, 0x82, 0x70, 0xc2, 0x70, 0x02, 0xff, 0x83, 0x02, 0x62, 0xc2, 0x61, 0x03, 0x72, 0x43, 0xff, 0x72, 0x83, 0x72, 0xc3, 0x72, 0x03, 0x73, 0x43, 0xff, 0x54, 0x06, 0x39, 0x43, 0x73, 0x83, 0x73, 0xc3, 0xff, 0x73, 0x02, 0x61, 0x03, 0x75, 0x43, 0x54, 0xc2, 0xff, 0x84, 0x02, 0x85, 0x43, 0x75, 0x70, 0x47, 0xf0, 0xff, 0xb5, 0x57, 0x46, 0x45, 0x46, 0xde, 0x46, 0x4e, 0xff, 0x46, 0xe0, 0xb5, 0x01, 0x60, 0x05, 0x00, 0x08, 0xff, 0x20, 0x17, 0x00, 0xbc, 0x4a, 0x9d, 0xb0, 0x13, 0xff, 0x6a, 0x03, 0x43, 0x13, 0x62, 0x0b, 0x78, 0x03, 0xff, 0x38, 0xdb, 0x07, 0x06, 0xd5, 0x1d, 0xb0, 0x3c, 0xff, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xab, 0xff, 0x46, 0xf0, 0xbd, 0x2a, 0x68, 0x13, 0x8c, 0x00, 0xff, 0x2b, 0xfc, 0xd1, 0x0b, 0x78, 0x1c, 0x20, 0x9b, 0xff, 0x07, 0xf0, 0xd4, 0x7b, 0x78, 0x2b, 0x71, 0x00, 0xff, 0x2b, 0x04, 0xd1, 0x04, 0x21, 0xaf, 0x4a, 0xd3, 0xff, 0x69, 0x0b, 0x43, 0xd3, 0x61, 0x00, 0x23, 0x2b, 0xff, 0x83, 0xab, 0x60, 0xeb, 0x60, 0x2b, 0x61, 0xab, 0xff, 0x76, 0xeb, 0x76, 0x2b, 0x77, 0xaa, 0x4b, 0x1d, 0xdf, 0x60, 0x2a, 0x23, 0xfa, 0x5c, 0xa5, 0x00, 0x2a, 0x02, 0xff, 0xd1, 0x3b, 0x7b, 0x01, 0x32, 0x53, 0x40, 0x6b, 0xff, 0x77, 0x2b, 0x68, 0x02, 0xaa, 0x01, 0x93, 0x3b, 0xff, 0x78, 0x11, 0x00, 0x13, 0x70, 0x1e, 0x20, 0xa2, 0xbf, 0x4b, 0x98, 0x47, 0x1e, 0x20, 0xa1, 0x05, 0x00, 0xa1, 0xff, 0x4b, 0x3c, 0x79, 0x9a, 0x46, 0x19, 0x00, 0xa0, 0xff, 0x4b, 0x60, 0x22, 0x04, 0xa8, 0x9b, 0x46, 0x98, 0xff, 0x47, 0x13, 0x2c, 0x0e, 0xd8, 0x08, 0x22, 0x02, 0xff, 0xab, 0x9b, 0x18, 0xa4, 0x00, 0x18, 0x59, 0x00, 0xff, 0x23, 0x03, 0xa9, 0x4b, 0x70, 0xcb, 0x70, 0x8b, 0xff, 0x70, 0x01, 0x33, 0x0b, 0x70, 0xc0, 0xb2, 0x97, 0xfe, 0x33, 0x00, 0xfc, 0x88, 0x60, 0x22, 0x51, 0x46, 0x04, 0xeb, 0xa8, 0xd8, 0x2b, 0x70, 0x8c, 0x2b, 0x00, 0x01, 0x23, 0x99, 0xff, 0x46, 0x8a, 0x4b, 0x00, 0x24, 0x03, 0xae, 0x98, 0xff, 0x46, 0x02, 0xe0, 0x01, 0x34, 0x14, 0x2c, 0x17, 0xff, 0xd0, 0x4b, 0x46, 0xa3, 0x40, 0x3a, 0x69, 0x1a, 0xdf, 0x42, 0xf7, 0xd0, 0x51, 0x46, 0x75, 0x04, 0xd8, 0x47, 0xff, 0x08, 0x21, 0x02, 0xaa, 0xa3, 0x00, 0x52, 0x18, 0xff, 0xd0, 0x58, 0x00, 0x23, 0x73, 0x70, 0xf3, 0x70, 0xff, 0xb3, 0x70, 0x4b, 0x46, 0xc0, 0xb2, 0x31, 0x00, 0xff, 0x33, 0x70, 0xc0, 0x47, 0xe4, 0xe7, 0x7b, 0x7b, 0xff, 0xba, 0x7b, 0x9b, 0x01, 0xd2, 0x01, 0x13, 0x43, 0xff, 0x01, 0x99, 0xdb, 0xb2, 0x0b, 0x70, 0x3b, 0x7d, 0xf7, 0x7a, 0x78, 0xdb, 0x0d, 0x00, 0xdb, 0xb2, 0x8b, 0x70, 0xff, 0xfb, 0x78, 0x34, 0x2b, 0x0f, 0xd8, 0x73, 0x4a, 0xff, 0x9b, 0x00, 0xd3, 0x58, 0x9f, 0x46, 0x10, 0x20, 0xff, 0x24, 0x23, 0x10, 0x21, 0x01, 0x9a, 0x13, 0x73, 0xfe, 0x37, 0x15, 0x7b, 0x7d, 0x3f, 0x2b, 0x22, 0xd9, 0x17, 0xbf, 0x20, 0x53, 0xe7, 0x10, 0x20, 0x12, 0x1b, 0x00, 0xf0, 0xff, 0xe7, 0x30, 0x20, 0x00, 0x23, 0x30, 0x21, 0xec, 0xfd, 0xe7, 0x0f, 0x02, 0x23, 0x00, 0x21, 0xe8, 0xe7, 0x20, 0xae, 0x07, 0x00, 0x20, 0x21, 0xe4, 0x1f, 0x00, 0x08, 0x1f, 0x00, 0xe0, 0xdf, 0xe7, 0x70, 0x23, 0x7a, 0x7a, 0x2b, 0x00, 0x01, 0x13, 0xff, 0x40, 0x3a, 0x7a, 0x10, 0x21, 0x13, 0x43, 0xd7, 0x7a, 0x19, 0x00, 0x16, 0x19, 0x00, 0xd3, 0xe7, 0xfa, 0x7b, 0x83, 0x08, 0xef, 0x9a, 0xdb, 0xb2, 0x53, 0x5f, 0x18, 0xbb, 0x78, 0x01, 0xff, 0x9c, 0x63, 0x70, 0x24, 0x23, 0x3a, 0x7b, 0xfb, 0xff, 0x5c, 0x92, 0x00, 0xdb, 0x00, 0x1a, 0x43, 0xfb, 0xff, 0x7a, 0x13, 0x43, 0xba, 0x7a, 0x52, 0x00, 0x13, 0xdf, 0x43, 0x18, 0x43, 0x60, 0x81, 0x27, 0x14, 0x3a, 0x8b, 0xff, 0x00, 0x2a, 0x10, 0xd0, 0x10, 0x29, 0x5c, 0xd0, 0xff, 0x43, 0xd9, 0x20, 0x29, 0x50, 0xd0, 0x30, 0x29, 0xef, 0x09, 0xd1, 0xfb, 0x7a, 0x75, 0x02, 0xd0, 0x91, 0xe0, 0xff, 0xfb, 0x69, 0xff, 0x2b, 0xad, 0xdc, 0x3b, 0x6a, 0xff, 0xff, 0x2b, 0xaa, 0xdc, 0x01, 0x99, 0x4b, 0x89, 0xff, 0x1a, 0x43, 0x4a, 0x81, 0x2b, 0x68, 0x1a, 0x8c, 0x7b, 0x00, 0x2a, 0x5f, 0x00, 0x8b, 0x01, 0x9a, 0xd3, 0x0d, 0x18, 0xeb, 0x3b, 0x8c, 0xdb, 0x00, 0x82, 0x0d, 0x14, 0xfa, 0x88, 0x3b, 0xf5, 0x79, 0x8f, 0x04, 0x13, 0x1f, 0x18, 0x2a, 0x23, 0x01, 0x9a, 0xff, 0xfb, 0x5c, 0xd3, 0x70, 0x07, 0x23, 0x13, 0x71, 0xff, 0x1d, 0x33, 0xfb, 0x5c, 0x00, 0x2b, 0x2d, 0xd1, 0xff, 0xe0, 0x21, 0x2c, 0x4b, 0xc9, 0x00, 0x1b, 0x68, 0xff, 0x00, 0x20, 0x1a, 0x02, 0x9b, 0x06, 0x0a, 0x40, 0xfb, 0x5b, 0x0f, 0x33, 0x04, 0x93, 0x85, 0xca, 0xe6, 0x00, 0xfb, 0x29, 0xc7, 0x83, 0x08, 0x5d, 0xd1, 0xfb, 0x69, 0x24, 0xff, 0x49, 0x8b, 0x42, 0x00, 0xdd, 0x6a, 0xe7, 0x3b, 0xff, 0x6a, 0x8b, 0x42, 0xbc, 0xdd, 0x17, 0x20, 0xbb, 0x55, 0xe6, 0x19, 0x04, 0x61, 0x19, 0x00, 0x1f, 0x19, 0x00, 0xf3, 0x11, 0x00, 0x55, 0xb2, 0x11, 0x08, 0x69, 0x11, 0x00, 0x1b, 0x11, 0x00, 0xea, 0x11, 0x00, 0xff, 0xa9, 0xe6, 0xfb, 0x8c, 0x16, 0x4a, 0x93, 0x42, 0x7f, 0x00, 0xd9, 0x4e, 0xe7, 0x01, 0x9a, 0x53, 0x97, 0x18, 0xff, 0x80, 0x23, 0x3a, 0x8d, 0x1b, 0x01, 0xd3, 0x18, 0xef, 0x0f, 0x49, 0x9b, 0xb2, 0x55, 0x00, 0xd9, 0x3f, 0xe7, 0xf7, 0x01, 0x9b, 0x9a, 0x1d, 0x18, 0xb6, 0xe7, 0x00, 0x04, 0xfb, 0x00, 0x40, 0x5c, 0x03, 0x40, 0x78, 0x01, 0x00, 0x20, 0xdf, 0x7d, 0x50, 0x00, 0x00, 0xbd, 0x03, 0x00, 0x4c, 0x60, 0xef, 0x00, 0x00, 0x55, 0x5f, 0xcb, 0x03, 0x51, 0x00, 0x00, 0xfd, 0x78, 0x07, 0x00, 0x20, 0x60, 0x80, 0x00, 0xff, 0x0f, 0xef, 0x00, 0x00, 0xff, 0x03, 0x03, 0x00, 0xff, 0x00, 0x00, 0xff, 0xfb, 0x69, 0x19, 0x00, 0x80, 0x31, 0xff, 0x29, 0xbf, 0x00, 0xd9, 0x18, 0xe7, 0x39, 0x6a, 0x09, 0x08, 0xd8, 0xff, 0x63, 0xe7, 0x17, 0x20, 0x67, 0xe6, 0x80, 0x21, 0xff, 0xfb, 0x69, 0x09, 0x01, 0x18, 0x48, 0x59, 0x18, 0xfd, 0x81, 0x6b, 0x00, 0x09, 0xe7, 0x80, 0x24, 0x24, 0x01, 0xff, 0xa4, 0x46, 0x39, 0x6a, 0x61, 0x44, 0x81, 0x42, 0x75, 0x93, 0xf9, 0x01, 0x56, 0x21, 0x08, 0x89, 0x00, 0x11, 0x21, 0x10, 0xbf, 0xf8, 0xe6, 0x80, 0x24, 0xa4, 0x00, 0x21, 0x14, 0x8f, 0x5a, 0x21, 0x00, 0x45, 0x43, 0x0c, 0x02, 0x09, 0x21, 0x10, 0xe7, 0x21, 0x00, 0xbb, 0x24, 0x02, 0x21, 0x14, 0x00, 0xd8, 0x86, 0x67, 0x00, 0x33, 0xf7, 0xe6, 0xc0, 0x46, 0x8f, 0x24, 0x70, 0xb5, 0x2d, 0x4b, 0xff, 0x1c, 0x68, 0x01, 0x23, 0x22, 0x68, 0x95, 0x79, 0xff, 0xed, 0xb2, 0x2b, 0x42, 0x02, 0xd0, 0xe1, 0x7e, 0xff, 0x0b, 0x42, 0x1c, 0xd1, 0x04, 0x23, 0x2b, 0x42, 0xff, 0x05, 0xd0, 0x22, 0x68, 0x93, 0x71, 0xe2, 0x7e, 0x7f, 0x02, 0x3b, 0x13, 0x42, 0x0c, 0xd1, 0x02, 0x11, 0x00, 0xed, 0x08, 0x11, 0x14, 0x33, 0x13, 0x29, 0x00, 0xa2, 0x7e, 0x13, 0xdf, 0x42, 0x2c, 0xd1, 0x70, 0xbd, 0x07, 0x04, 0xef, 0xd0, 0xff, 0x20, 0x00, 0xe3, 0x68, 0x98, 0x47, 0xeb, 0xe7, 0xfd, 0xa1, 0x3f, 0x00, 0xdf, 0xd0, 0x93, 0x71, 0x61, 0x69, 0xff, 0x8a, 0x1c, 0x62, 0x61, 0x22, 0x68, 0x92, 0x8c, 0xff, 0x92, 0xb2, 0x0a, 0x80, 0x22, 0x8b, 0x01, 0x3a, 0xff, 0x92, 0xb2, 0x22, 0x83, 0x00, 0x2a, 0x17, 0xd0, 0xdf, 0x63, 0x7f, 0x00, 0x2b, 0xce, 0x49, 0x00, 0xd3, 0x79, 0xbf, 0x5b, 0xb2, 0x00, 0x2b, 0xc9, 0xdb, 0x59, 0x0e, 0x02, 0xff, 0x21, 0x13, 0x7e, 0x0b, 0x43, 0x13, 0x76, 0x22, 0xfe, 0x69, 0x12, 0xbd, 0xe7, 0x23, 0x69, 0x20, 0x00, 0x98, 0xff, 0x47, 0xce, 0xe7, 0x21, 0x7f, 0x05, 0x29, 0xb6, 0xff, 0xd1, 0x22, 0x77, 0x22, 0x68, 0x20, 0x00, 0x13, 0xdb, 0x71, 0xa3, 0x65, 0x00, 0xaf, 0xe7, 0x73, 0x05, 0x93, 0x1c, 0xff, 0x9b, 0x00, 0x19, 0x50, 0x01, 0x23, 0x93, 0x40, 0xff, 0x1a, 0x00, 0x83, 0x7e, 0x13, 0x43, 0x83, 0x76, 0xff, 0x70, 0x47, 0x10, 0xb5, 0x04, 0x8b, 0x03, 0x00, 0xff, 0x05, 0x20, 0x00, 0x2c, 0x00, 0xd0, 0x10, 0xbd, 0xff, 0x1c, 0x7f, 0x05, 0x2c, 0xfb, 0xd0, 0x18, 0x77, 0xff, 0x1a, 0x83, 0x01, 0x22, 0x59, 0x61, 0x19, 0x68, 0xff, 0x4a, 0x71, 0x5a, 0x7f, 0x00, 0x2a, 0x01, 0xd1, 0xff, 0x00, 0x20, 0xf0, 0xe7, 0x1a, 0x68, 0x11, 0x8c, 0xfb, 0x00, 0x29, 0x77, 0x00, 0x20, 0x11, 0x7e, 0x01, 0x43, 0xf7, 0x11, 0x76, 0x1a, 0x77, 0x10, 0x00, 0x20, 0xe2, 0xe7, 0xff, 0xc0, 0x46, 0x00, 0x23, 0x06, 0x22, 0x03, 0x70, 0xff, 0x42, 0x70, 0x83, 0x70, 0x70, 0x47, 0x80, 0x23, 0xff, 0x70, 0xb5, 0x15, 0x00, 0x13, 0x4a, 0x01, 0x60, 0xff, 0x04, 0x00, 0xd0, 0x69, 0x5b, 0x01, 0x03, 0x43, 0xff, 0xd3, 0x61, 0x0b, 0x78, 0x82, 0xb0, 0x1c, 0x20, 0xff, 0x9b, 0x07, 0x01, 0xd5, 0x02, 0xb0, 0x70, 0xbd, 0xff, 0x01, 0x26, 0x0b, 0x78, 0x17, 0x38, 0x1e, 0x40, 0xff, 0xf8, 0xd1, 0xab, 0x78, 0x01, 0xa9, 0x0b, 0x70, 0xff, 0x1b, 0x30, 0x08, 0x4b, 0x98, 0x47, 0x20, 0x20, 0xfe, 0x05, 0x04, 0x66, 0x71, 0xa6, 0x71, 0x2a, 0x78, 0x6b, 0xff, 0x78, 0x00, 0x20, 0x13, 0x43, 0x22, 0x68, 0x53, 0x3f, 0x70, 0x6b, 0x78, 0x23, 0x71, 0xe4, 0x3b, 0x0a, 0x33, 0x16, 0xef, 0x03, 0x68, 0x9a, 0x68, 0x51, 0x06, 0x01, 0x21, 0x1a, 0x6f, 0x78, 0x0a, 0x43, 0x1a, 0x71, 0x00, 0xc0, 0x46, 0x13, 0x14, 0xdd, 0x02, 0x13, 0x10, 0x02, 0x79, 0x06, 0x77, 0x03, 0x02, 0x22, 0xff, 0x99, 0x89, 0x0a, 0x42, 0x04, 0xd0, 0x01, 0x21, 0xff, 0xda, 0x79, 0x11, 0x42, 0xfc, 0xd0, 0x70, 0x47, 0xdd, 0xd9, 0x0f, 0x00, 0xfb, 0xd0, 0x02, 0x0f, 0x10, 0xf6, 0xe7, 0xff, 0x04, 0x20, 0x02, 0x49, 0xca, 0x69, 0x02, 0x43, 0xef, 0xca, 0x61, 0xe8, 0xe7, 0x9b, 0x06, 0x00, 0x23, 0x08, 0xfe, 0xc7, 0x00, 0x83, 0x70, 0xc3, 0x70, 0x02, 0x33, 0x42, 0xd7, 0x70, 0x03, 0x71, 0x5b, 0x04, 0x00, 0xcf, 0x00, 0x82, 0xb0, 0xff, 0x0c, 0x00, 0x01, 0xa9, 0x06, 0x00, 0x15, 0x00, 0xff, 0x4b, 0x70, 0xcb, 0x70, 0x8b, 0x70, 0x00, 0x2c, 0xff, 0x1c, 0xd0, 0x01, 0x2c, 0x20, 0xd0, 0x6b, 0x78, 0xff, 0x2a, 0x78, 0x31, 0x68, 0x1a, 0x43, 0xab, 0x78, 0xff, 0x00, 0x2b, 0x01, 0xd0, 0x40, 0x23, 0x1a, 0x43, 0xf5, 0xeb, 0x09, 0x08, 0x80, 0x09, 0x00, 0xf0, 0x20, 0x2b, 0x79, 0xff, 0x00, 0x01, 0x1b, 0x02, 0x03, 0x40, 0x04, 0x34, 0xff, 0x13, 0x43, 0x64, 0x00, 0x9b, 0xb2, 0x0c, 0x19, 0xfb, 0xa3, 0x80, 0xff, 0x08, 0x33, 0x0b, 0x70, 0x02, 0x20, 0xfd, 0x03, 0xed, 0x00, 0xde, 0xe7, 0x05, 0x20, 0x01, 0x4b, 0xbf, 0x0c, 0x70, 0x98, 0x47, 0xd9, 0xe7, 0x03, 0x07, 0x02, 0xff, 0x22, 0x4b, 0x00, 0x01, 0x68, 0xc9, 0x18, 0x8b, 0xdf, 0x89, 0x13, 0x43, 0x8b, 0x81, 0x9f, 0x05, 0x03, 0x68, 0xff, 0x9c, 0x68, 0x00, 0x2c, 0xfc, 0xd1, 0x40, 0x18, 0xff, 0x40, 0x79, 0x08, 0x31, 0x49, 0x00, 0x00, 0x28, 0xff, 0x02, 0xd1, 0xca, 0x52, 0x00, 0x20, 0x10, 0xbd, 0xdf, 0x59, 0x18, 0x8a, 0x80, 0xfa, 0x7b, 0x01, 0x01, 0x00, 0xff, 0x04, 0x20, 0x10, 0xb5, 0x1b, 0x4a, 0x93, 0x69, 0xff, 0x03, 0x43, 0x93, 0x61, 0x20, 0x23, 0x19, 0x4a, 0xff, 0xff, 0x33, 0x13, 0x83, 0x13, 0x7d, 0x01, 0x30, 0xff, 0xdb, 0x07, 0x00, 0xd4, 0x10, 0xbd, 0xc0, 0x20, 0xef, 0x0b, 0x78, 0x80, 0x00, 0x87, 0x04, 0x1e, 0x20, 0x8c, 0xff, 0x78, 0x64, 0x00, 0x20, 0x40, 0x80, 0x24, 0x03, 0xbf, 0x43, 0x48, 0x78, 0xe4, 0x02, 0xc0, 0x9b, 0x01, 0xc8, 0xbf, 0x78, 0x80, 0x04, 0x20, 0x40, 0xc0, 0x11, 0x00, 0x08, 0xb7, 0x79, 0xa4, 0x02, 0x4a, 0x00, 0x40, 0x08, 0x0b, 0x00, 0x53, 0xff, 0x60, 0x93, 0x68, 0x08, 0x48, 0x5b, 0x03, 0x5b, 0xff, 0x0f, 0x9c, 0x40, 0x04, 0x80, 0x93, 0x68, 0x43, 0xff, 0x80, 0x4b, 0x78, 0x03, 0x71, 0x10, 0x8b, 0xc0, 0xbf, 0x05, 0xc0, 0x0f, 0x00, 0x01, 0xd4, 0xcb, 0x0f, 0x40, 0xf7, 0x00, 0x41, 0x2c, 0xb2, 0x03, 0x10, 0xb5, 0x24, 0x4a, 0xff, 0x14, 0x88, 0x53, 0x88, 0x63, 0x43, 0x8b, 0x42, 0xff, 0x05, 0xd2, 0x80, 0x22, 0x21, 0x4b, 0x92, 0x01, 0xff, 0xcb, 0x18, 0x93, 0x42, 0x0f, 0xd8, 0x80, 0x22, 0xff, 0x1f, 0x4b, 0xd2, 0x02, 0x5c, 0x68, 0x22, 0x43, 0xff, 0x5a, 0x60, 0x20, 0x22, 0xff, 0x32, 0x1a, 0x83, 0xff, 0x1a, 0x7d, 0xd2, 0x07, 0x0a, 0xd4, 0x5c, 0x60, 0xff, 0x05, 0x23, 0x18, 0x00, 0x10, 0xbd, 0x19, 0x4a, 0xff, 0x19, 0x4c, 0x8a, 0x18, 0x18, 0x23, 0xa2, 0x42, 0xff, 0xf7, 0xd8, 0xe8, 0xe7, 0x45, 0x28, 0x1b, 0xd8, 0xff, 0x16, 0x4a, 0x83, 0x00, 0xd3, 0x58, 0x9f, 0x46, 0xff, 0x11, 0x4b, 0x1a, 0x8b, 0xd2, 0x05, 0x17, 0xd4, 0xff, 0x89, 0x08, 0x49, 0x00, 0xd9, 0x61, 0xa5, 0x23, 0xff, 0x01, 0x21, 0x1b, 0x02, 0x0c, 0x4a, 0x18, 0x43, 0xdf, 0x10, 0x80, 0x13, 0x7d, 0x19, 0xb9, 0x01, 0x54, 0x60, 0xff, 0x00, 0x23, 0xdd, 0xe7, 0x89, 0x08, 0x07, 0x4b, 0xfe, 0x1f, 0x04, 0xee, 0xe7, 0x05, 0x4b, 0x5c, 0x60, 0x17, 0xff, 0x23, 0xd4, 0xe7, 0x5c, 0x60, 0x10, 0x23, 0xd1, 0xbc, 0x13, 0x01, 0x97, 0x04, 0x00, 0xc0, 0x7f, 0xff, 0xa3, 0x04, 0x00, 0xf7, 0x00, 0xc0, 0xff, 0xc3, 0x07, 0xac, 0x60, 0x00, 0x00, 0xff, 0xf0, 0xb5, 0xd6, 0x46, 0x4f, 0x46, 0x46, 0x46, 0xff, 0xc0, 0xb5, 0x54, 0x4c, 0x82, 0xb0, 0x25, 0x88, 0xff, 0x63, 0x88, 0x6b, 0x43, 0x83, 0x42, 0x0c, 0xd2, 0xff, 0x51, 0x4b, 0x52, 0x4e, 0xc3, 0x18, 0xb3, 0x42, 0xf7, 0x3d, 0xd9, 0x18, 0x99, 0x00, 0x02, 0xb0, 0x1c, 0xbc, 0xff, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xf0, 0xbd, 0xff, 0x00, 0x27, 0x6b, 0x1e, 0x18, 0x42, 0xf3, 0xd1, 0xff, 0x17, 0x23, 0x95, 0x42, 0xf1, 0xd3, 0x49, 0x4d, 0xff, 0x12, 0x3b, 0x2e, 0x7d, 0xf6, 0x07, 0xec, 0xd5, 0xff, 0x01, 0x26, 0x47, 0x4b, 0x2b, 0x80, 0x2b, 0x7d, 0xfd, 0x1e, 0x8d, 0x00, 0x20, 0x23, 0xff, 0x33, 0x2b, 0x83, 0xff, 0x45, 0x08, 0x00, 0x2a, 0x6b, 0xd0, 0x53, 0x1e, 0xdf, 0x98, 0x46, 0x6b, 0x00, 0x9a, 0x35, 0x02, 0x0c, 0xe0, 0xff, 0x35, 0x1c, 0x6e, 0x46, 0xf5, 0x80, 0xf6, 0x88, 0xff, 0x55, 0x46, 0x2e, 0x80, 0x02, 0x25, 0xac, 0x46, 0xff, 0x02, 0x33, 0x9b, 0xb2, 0xe2, 0x44, 0x9a, 0x42, 0xff, 0x0c, 0xd9, 0xce, 0x5c, 0xb1, 0x46, 0x43, 0x45, 0xff, 0xee, 0xda, 0x4d, 0x46, 0xce, 0x18, 0x76, 0x78, 0xff, 0x36, 0x02, 0x35, 0x43, 0x2e, 0x00, 0xeb, 0xe7, 0xff, 0x01, 0x27, 0xc8, 0xe7, 0x23, 0x79, 0x00, 0x2b, 0x7f, 0x46, 0xd1, 0x3f, 0x2a, 0x44, 0xd8, 0x22, 0x9d, 0x00, 0xff, 0x53, 0x43, 0x00, 0x2f, 0x1b, 0xd1, 0x98, 0x42, 0x5f, 0x0a, 0xd9, 0x80, 0x22, 0x2c, 0x57, 0x01, 0xc3, 0x57, 0x01, 0xbf, 0x04, 0xd9, 0x26, 0x4b, 0x26, 0x4a, 0x09, 0x04, 0xa8, 0xea, 0x61, 0x01, 0x25, 0x61, 0x41, 0x2d, 0x61, 0x09, 0x9a, 0xe7, 0x98, 0xeb, 0x42, 0x0b, 0x37, 0x00, 0x1e, 0x37, 0x10, 0x05, 0xd9, 0x18, 0xfb, 0x4b, 0x18, 0x37, 0x08, 0x00, 0xd9, 0x8b, 0xe7, 0x80, 0xfb, 0x22, 0x16, 0x39, 0x40, 0xe2, 0xd5, 0x01, 0x21, 0x80, 0xff, 0x08, 0x13, 0x4a, 0x40, 0x00, 0xd8, 0x61, 0x1a, 0x57, 0x80, 0x1a, 0x7d, 0x25, 0x07, 0x5c, 0x6b, 0x01, 0x74, 0x97, 0x08, 0xbf, 0xb5, 0xd0, 0x00, 0x23, 0x6f, 0xe7, 0x21, 0x04, 0x0b, 0xe2, 0x21, 0x30, 0xed, 0x73, 0x15, 0x6b, 0x11, 0x77, 0x05, 0x44, 0xa5, 0xff, 0xd5, 0xff, 0x83, 0x05, 0x1c, 0x07, 0x00, 0x04, 0x03, 0x00, 0x70, 0xb5, 0xdf, 0x19, 0x4b, 0x1c, 0x88, 0x5b, 0x27, 0x02, 0x83, 0x42, 0xdf, 0x07, 0xd2, 0x17, 0x4b, 0x17, 0x71, 0x01, 0x18, 0x25, 0xff, 0xb3, 0x42, 0x01, 0xd9, 0x28, 0x00, 0x70, 0xbd, 0xff, 0x63, 0x1e, 0x18, 0x25, 0x18, 0x42, 0xf9, 0xd1, 0xff, 0x01, 0x3d, 0x94, 0x42, 0xf6, 0xd3, 0x11, 0x4b, 0xff, 0x12, 0x3d, 0x1c, 0x7d, 0xe4, 0x07, 0xf1, 0xd5, 0x7f, 0x20, 0x24, 0xff, 0x34, 0x1c, 0x83, 0x40, 0x5b, 0x01, 0xfd, 0x0f, 0x7d, 0x00, 0x56, 0x1e, 0x40, 0x00, 0x04, 0x88, 0xff, 0xa4, 0xb2, 0xcc, 0x54, 0xb3, 0x42, 0x02, 0xda, 0xbf, 0xcd, 0x18, 0x24, 0x0a, 0x6c, 0x70, 0x55, 0x05, 0x02, 0xff, 0x30, 0x9a, 0x42, 0xf2, 0xd8, 0x00, 0x25, 0xd9, 0xfe, 0x87, 0x40, 0x10, 0xb5, 0x19, 0x4a, 0x01, 0x00, 0x13, 0xff, 0x88, 0x52, 0x88, 0x5a, 0x43, 0x82, 0x42, 0x06, 0xef, 0xd2, 0x16, 0x4a, 0x17, 0x75, 0x06, 0x20, 0xa2, 0x42, 0xff, 0x21, 0xd9, 0x10, 0xbd, 0x00, 0x22, 0x9b, 0x00, 0xff, 0x01, 0x3b, 0x18, 0x20, 0x19, 0x42, 0xf8, 0xd1, 0xef, 0x12, 0x4b, 0x13, 0x38, 0x75, 0x04, 0xf3, 0xd5, 0x20, 0xff, 0x20, 0x89, 0x08, 0xff, 0x30, 0x49, 0x00, 0x18, 0xf7, 0x83, 0xd9, 0x61, 0x79, 0x00, 0xd1, 0x0c, 0x4b, 0x01, 0xef, 0x21, 0x0a, 0x4a, 0x13, 0x7d, 0x12, 0x1c, 0x20, 0x13, 0xff, 0x8b, 0x18, 0x40, 0x43, 0x1e, 0x98, 0x41, 0x80, 0xbf, 0x00, 0xdd, 0xe7, 0x01, 0x22, 0xdd, 0x7f, 0x02, 0xee, 0x7d, 0xe7, 0x77, 0x34, 0x02, 0xa5, 0x00, 0x00, 0x1a, 0x03, 0x00, 0xff, 0x20, 0x22, 0x08, 0x21, 0x10, 0xb5, 0x16, 0x4b, 0xfe, 0x63, 0x05, 0x9b, 0x68, 0x19, 0x3a, 0x1c, 0x0c, 0xff, 0xff, 0x3a, 0x14, 0x40, 0xa1, 0x40, 0x43, 0x80, 0x1b, 0xff, 0x0d, 0x83, 0x81, 0x11, 0x4b, 0x01, 0x70, 0x1b, 0xbf, 0x88, 0x1b, 0x09, 0x1a, 0x40, 0x07, 0xe1, 0x00, 0x06, 0xff, 0x23, 0x9a, 0x1a, 0x02, 0x3b, 0x93, 0x40, 0x07, 0xff, 0x22, 0x43, 0x60, 0x0a, 0x4b, 0x1b, 0x88, 0x13, 0xff, 0x40, 0x07, 0x2b, 0x0c, 0xd0, 0xd3, 0x1a, 0x03, 0x5f, 0x3a, 0x9a, 0x40, 0x82, 0x60, 0xad, 0x00, 0x23, 0x19, 0x04, 0xfd, 0x04, 0x19, 0x10, 0xf2, 0xd1, 0x00, 0x22, 0xf3, 0xe7, 0xfe, 0xe3, 0x0a, 0x40, 0x80, 0x00, 0x04, 0x21, 0x08, 0x4b, 0xff, 0x02, 0x68, 0x19, 0x60, 0x01, 0x68, 0x0b, 0x69, 0xff, 0x00, 0x2b, 0xfc, 0xd1, 0x02, 0x21, 0x13, 0x88, 0x7f, 0x0b, 0x43, 0x13, 0x80, 0x02, 0x68, 0x13, 0x0f, 0x08, 0xff, 0x70, 0x47, 0xc0, 0x46, 0x00, 0xe1, 0x00, 0xe0, 0xff, 0x10, 0xb5, 0x80, 0x22, 0x04, 0x24, 0x09, 0x49, 0xff, 0x03, 0x68, 0x8c, 0x50, 0x01, 0x68, 0x0a, 0x69, 0xfb, 0x00, 0x2a, 0x2b, 0x04, 0x06, 0x4a, 0x1a, 0x81, 0x9a, 0x3f, 0x81, 0x1a, 0x88, 0x8a, 0x43, 0x1a, 0x31, 0x18, 0x6f, 0x00, 0xf6, 0x2f, 0x00, 0xff, 0x81, 0xbb, 0x05, 0x01, 0x60, 0x80, 0x21, 0xff, 0x03, 0x00, 0x43, 0x48, 0x49, 0x00, 0x44, 0x69, 0xff, 0x04, 0x25, 0x21, 0x43, 0x41, 0x61, 0x01, 0x20, 0xff, 0x41, 0x49, 0x41, 0x4c, 0x08, 0x61, 0x80, 0x21, 0xff, 0x18, 0x68, 0x65, 0x50, 0x1c, 0x68, 0x21, 0x69, 0xfb, 0x00, 0x29, 0x49, 0x00, 0x24, 0x3d, 0x49, 0x01, 0x81, 0xff, 0x81, 0x81, 0x01, 0x88, 0xa1, 0x43, 0x01, 0x80, 0xde, 0x15, 0x14, 0x99, 0x86, 0xd9, 0x86, 0x09, 0x0c, 0x01, 0x24, 0x77, 0x01, 0x88, 0x21, 0x19, 0x00, 0x18, 0x68, 0x01, 0x0f, 0x08, 0xff, 0x91, 0x78, 0x19, 0x71, 0x32, 0x49, 0x0b, 0x60, 0xff, 0x11, 0x79, 0x14, 0x88, 0xc9, 0x03, 0x18, 0x68, 0xff, 0x21, 0x43, 0x89, 0xb2, 0x01, 0x80, 0x91, 0x78, 0xff, 0x00, 0x29, 0x20, 0xd0, 0x01, 0x29, 0x01, 0xd0, 0xbf, 0x17, 0x20, 0x70, 0xbd, 0x01, 0x88, 0x13, 0x04, 0xd1, 0xbe, 0x13, 0x00, 0x39, 0xd1, 0x90, 0x68, 0x19, 0xb3, 0x10, 0x1a, 0xff, 0x79, 0x00, 0x2a, 0x08, 0xd0, 0x01, 0x2a, 0x04, 0xef, 0xd1, 0x08, 0x62, 0x1a, 0xb1, 0x10, 0x00, 0x20, 0xe7, 0xff, 0xe7, 0x1f, 0x4a, 0x90, 0x42, 0xfa, 0xd8, 0x80, 0xbf, 0xb2, 0x08, 0x84, 0xf3, 0xe7, 0x04, 0x6d, 0x10, 0xd1, 0xbf, 0x78, 0x17, 0x20, 0x00, 0x29, 0xd9, 0x1f, 0x00, 0x1c, 0xbf, 0x68, 0x17, 0x4e, 0x08, 0x32, 0x15, 0x97, 0x10, 0x19, 0xef, 0x79, 0x00, 0x29, 0x14, 0x67, 0x00, 0x07, 0xd1, 0x01, 0x7f, 0x00, 0x08, 0x31, 0x89, 0x00, 0x0d, 0x51, 0xb1, 0x14, 0x7f, 0x01, 0x30, 0x04, 0x32, 0x02, 0x28, 0xea, 0x31, 0x00, 0x77, 0xbe, 0xe7, 0x80, 0x45, 0x10, 0xc0, 0xe7, 0xb5, 0x65, 0x02, 0xff, 0x01, 0x00, 0x10, 0x31, 0xad, 0xb2, 0x49, 0x00, 0xbf, 0x0d, 0x53, 0xe8, 0xe7, 0x00, 0x04, 0x7d, 0x01, 0x10, 0xbc, 0x03, 0x00, 0x27, 0x11, 0x7c, 0x01, 0x00, 0x20, 0xf5, 0x02, 0x00, 0xeb, 0x10, 0xb5, 0x43, 0x15, 0x03, 0x37, 0x03, 0x0a, 0xd0, 0x01, 0xff, 0x2b, 0x02, 0xd0, 0x17, 0x23, 0x18, 0x00, 0x10, 0xf7, 0xbd, 0x91, 0x61, 0x19, 0x14, 0xf7, 0xe7, 0x03, 0x4c, 0xff, 0x17, 0x23, 0xa1, 0x42, 0xf3, 0xd8, 0x89, 0xb2, 0xef, 0x11, 0x83, 0xf3, 0xe7, 0x37, 0x04, 0x30, 0xb5, 0x04, 0xab, 0x68, 0x23, 0x37, 0x18, 0x0f, 0x37, 0x08, 0x1a, 0x37, 0x00, 0x30, 0xff, 0xbd, 0x16, 0x33, 0x01, 0x2a, 0xfa, 0xd8, 0x08, 0xdf, 0x32, 0x92, 0x00, 0x11, 0x51, 0x41, 0x14, 0xf2, 0xe7, 0xff, 0x17, 0x23, 0x02, 0x2a, 0xef, 0xd8, 0x04, 0x4d, 0xff, 0xa9, 0x42, 0xec, 0xd8, 0x10, 0x32, 0x89, 0xb2, 0x9f, 0x52, 0x00, 0x11, 0x53, 0xef, 0x03, 0x03, 0x4b, 0x04, 0x0a, 0xff, 0x2a, 0x01, 0xd0, 0x07, 0x2a, 0x0b, 0xd8, 0x93, 0xff, 0x1c, 0x9b, 0x00, 0x19, 0x50, 0x01, 0x23, 0x93, 0xff, 0x40, 0x81, 0x8e, 0x0b, 0x43, 0x9b, 0xb2, 0x83, 0x5b, 0x86, 0x00, 0x51, 0x00, 0x70, 0x47, 0x61, 0x04, 0x05, 0x61, 0x00, 0xff, 0x05, 0xd1, 0x16, 0x33, 0x09, 0x2a, 0xf5, 0xd8, 0xff, 0xea, 0xe7, 0x0a, 0x2a, 0xe8, 0xd9, 0x17, 0x23, 0xf9, 0xf0, 0x3f, 0x00, 0x87, 0x04, 0x0a, 0x29, 0x17, 0xd0, 0x07, 0xff, 0x29, 0x10, 0xd9, 0x01, 0x23, 0x0a, 0x00, 0x1d, 0xff, 0x00, 0x08, 0x3a, 0x95, 0x40, 0x2a, 0x02, 0xc0, 0xff, 0x25, 0x8b, 0x40, 0xad, 0x00, 0x2a, 0x40, 0x62, 0xbf, 0x81, 0x1a, 0x00, 0xc3, 0x8e, 0x13, 0x4d, 0x00, 0xc3, 0xff, 0x86, 0x30, 0xbd, 0x01, 0x22, 0x8a, 0x40, 0x93, 0xff, 0xb2, 0x63, 0x81, 0xf5, 0xe7, 0x80, 0x22, 0x02, 0xdf, 0x4b, 0xd2, 0x00, 0x63, 0x81, 0x43, 0x04, 0x00, 0x80, 0xff, 0xff, 0xff, 0xf8, 0xb5, 0x3a, 0x4b, 0x1f, 0x68, 0xff, 0xfb, 0x8e, 0x3d, 0x68, 0xbe, 0x8e, 0x1e, 0x40, 0xff, 0xab, 0x89, 0x6c, 0x89, 0x1c, 0x40, 0x23, 0xb2, 0xff, 0x00, 0x2b, 0x51, 0xdb, 0xff, 0x23, 0x23, 0x42, 0xff, 0x42, 0xd0, 0xfe, 0x3b, 0x23, 0x42, 0x03, 0xd0, 0xff, 0x33, 0x42, 0x01, 0xd0, 0xbb, 0x68, 0x98, 0x47, 0xff, 0x01, 0x23, 0xab, 0x81, 0xa2, 0x07, 0x04, 0xd5, 0x57, 0x72, 0x10, 0x13, 0x11, 0x00, 0xfb, 0x11, 0x00, 0x02, 0x11, 0x00, 0xff, 0x63, 0x07, 0x03, 0xd5, 0x73, 0x07, 0x01, 0xd5, 0x5f, 0x3b, 0x69, 0x98, 0x47, 0x04, 0x0f, 0x00, 0x23, 0x0f, 0x00, 0xd5, 0x33, 0x0f, 0x00, 0x7b, 0x0f, 0x00, 0x08, 0x0f, 0x00, 0xe3, 0x06, 0x7f, 0x03, 0xd5, 0xf3, 0x06, 0x01, 0xd5, 0xbb, 0x0f, 0x00, 0x55, 0x10, 0x0f, 0x00, 0xa3, 0x0f, 0x00, 0xb3, 0x0f, 0x00, 0xfb, 0x0f, 0x00, 0xe9, 0x20, 0x3f, 0x04, 0x0f, 0x00, 0x73, 0x0f, 0x00, 0x3b, 0x6a, 0x98, 0x53, 0x47, 0x40, 0x3f, 0x04, 0x0f, 0x00, 0x33, 0x0f, 0x00, 0x7b, 0x0f, 0x00, 0xfd, 0x80, 0x0f, 0x00, 0xf8, 0xbd, 0x80, 0x23, 0x5b, 0x00, 0x9f, 0x1c, 0x42, 0x0c, 0xd0, 0x1e, 0x87, 0x04, 0x15, 0x08, 0x5b, 0xff, 0x00, 0xab, 0x81, 0xf2, 0xe7, 0x73, 0x05, 0x0c, 0xff, 0xd4, 0x0b, 0x4b, 0xab, 0x81, 0xed, 0xe7, 0x80, 0x6b, 0x23, 0x9b, 0x21, 0x00, 0xe9, 0x21, 0x00, 0x08, 0xd1, 0x0b, 0x04, 0x7e, 0x75, 0x00, 0xe7, 0x3b, 0x6b, 0x98, 0x47, 0x03, 0x1d, 0x00, 0x37, 0xde, 0xe7, 0xfb, 0x33, 0x00, 0xf3, 0xe7, 0xfb, 0x05, 0xf3, 0x04, 0xff, 0xf0, 0xb5, 0x47, 0x46, 0xce, 0x46, 0x05, 0x00, 0xff, 0x02, 0x26, 0x80, 0xb5, 0x29, 0x60, 0x0b, 0x68, 0xff, 0x83, 0xb0, 0x0c, 0x00, 0x17, 0x00, 0x1c, 0x20, 0xff, 0x1e, 0x42, 0x04, 0xd0, 0x03, 0xb0, 0x0c, 0xbc, 0xdf, 0x90, 0x46, 0x99, 0x46, 0xf0, 0x33, 0x01, 0x0b, 0x68, 0xff, 0x90, 0x46, 0x17, 0x38, 0x1a, 0x42, 0xf4, 0xd1, 0xff, 0x4e, 0x4b, 0x08, 0x00, 0x99, 0x46, 0x98, 0x47, 0xff, 0x4d, 0x4a, 0x05, 0x28, 0x00, 0xd1, 0x80, 0xe0, 0xff, 0x43, 0x46, 0x83, 0x40, 0xd1, 0x69, 0x12, 0x30, 0xff, 0x0b, 0x43, 0xd3, 0x61, 0xc6, 0xb2, 0x6a, 0x46, 0xff, 0x7b, 0x7e, 0x69, 0x46, 0x13, 0x70, 0x30, 0x00, 0x7f, 0x46, 0x4b, 0x98, 0x47, 0x30, 0x00, 0x45, 0x05, 0x00, 0xff, 0x00, 0x21, 0x45, 0x4b, 0x78, 0x7e, 0x98, 0x47, 0xff, 0x28, 0x68, 0xc8, 0x47, 0x06, 0x00, 0x43, 0x4b, 0xff, 0x43, 0x49, 0x98, 0x47, 0x43, 0x4b, 0xb6, 0x00, 0xff, 0xf5, 0x50, 0x24, 0x22, 0x00, 0x23, 0xab, 0x54, 0xff, 0x01, 0x32, 0xab, 0x54, 0xeb, 0x84, 0x3b, 0x7e, 0xff, 0x00, 0x22, 0x6b, 0x72, 0x10, 0x23, 0x23, 0x60, 0xff, 0x3b, 0x89, 0x2c, 0x68, 0xeb, 0x80, 0x3b, 0x7c, 0xff, 0x2b, 0x72, 0x80, 0x23, 0x01, 0xad, 0xf8, 0x69, 0xff, 0x2b, 0x70, 0x7f, 0x3b, 0x6a, 0x70, 0xab, 0x70, 0xff, 0xea, 0x70, 0x3e, 0x6a, 0x00, 0x28, 0x4f, 0xd0, 0xff, 0x02, 0x23, 0x28, 0x70, 0x6b, 0x70, 0x00, 0x0c, 0x7f, 0x33, 0x4b, 0xc0, 0xb2, 0x29, 0x00, 0x98, 0x8b, 0x00, 0xf7, 0x00, 0x2e, 0x49, 0x15, 0x00, 0x2e, 0x70, 0x36, 0x0c, 0xfd, 0xf0, 0x11, 0x00, 0x99, 0x46, 0x6b, 0x70, 0xc0, 0x47, 0xff, 0xbb, 0x7e, 0x00, 0x2b, 0x36, 0xd1, 0x4a, 0x46, 0xff, 0x2b, 0x4b, 0x9b, 0x78, 0x1a, 0x42, 0x31, 0xd1, 0xff, 0x80, 0x20, 0x00, 0x22, 0x00, 0x05, 0x25, 0x23, 0xd7, 0xfb, 0x5c, 0x79, 0x8f, 0x02, 0x04, 0x19, 0x05, 0x04, 0x99, 0xff, 0x42, 0x00, 0xd0, 0x10, 0x00, 0x24, 0x23, 0x26, 0xff, 0x22, 0xfb, 0x5c, 0xba, 0x5c, 0x9b, 0x07, 0xd2, 0xff, 0x05, 0x13, 0x43, 0x7a, 0x68, 0x25, 0x68, 0x13, 0xff, 0x43, 0x2b, 0x43, 0x03, 0x43, 0x0b, 0x43, 0x23, 0xff, 0x60, 0x80, 0x23, 0x7a, 0x89, 0x5b, 0x00, 0x13, 0xbf, 0x43, 0x63, 0x60, 0xbb, 0x89, 0xfa, 0x09, 0x00, 0x52, 0xfd, 0x04, 0x21, 0x00, 0x7c, 0x00, 0x20, 0x13, 0x43, 0x3a, 0xf7, 0x7c, 0xd2, 0x03, 0x17, 0x00, 0x62, 0x6b, 0xe7, 0x13, 0xff, 0x6a, 0x1e, 0x43, 0x16, 0x62, 0x18, 0x26, 0x80, 0xff, 0xe7, 0x11, 0x48, 0x80, 0x22, 0xcd, 0xe7, 0x00, 0xef, 0x21, 0x20, 0x00, 0x0f, 0xf7, 0x00, 0xaa, 0xe7, 0x01, 0xba, 0x09, 0x00, 0x0d, 0x09, 0x00, 0x06, 0x00, 0xaf, 0x63, 0x02, 0xc5, 0xf7, 0x48, 0x00, 0x00, 0x83, 0x07, 0x7d, 0x50, 0x00, 0x00, 0xfd, 0xbd, 0x03, 0x00, 0x21, 0x47, 0x00, 0x00, 0x2d, 0x49, 0xff, 0x00, 0x00, 0x4d, 0x31, 0x00, 0x00, 0xb4, 0x11, 0xef, 0x00, 0x20, 0x79, 0x51, 0x1f, 0x00, 0x20, 0x00, 0x41, 0x9f, 0x80, 0x00, 0x00, 0x08, 0x69, 0x1b, 0x00, 0x0b, 0x07, 0xc3, 0xff, 0x18, 0x10, 0xb5, 0x59, 0x60, 0x01, 0x23, 0x24, 0xff, 0x21, 0x93, 0x40, 0x44, 0x5c, 0x23, 0x43, 0xdb, 0xff, 0xb2, 0x43, 0x54, 0x10, 0xbd, 0xc0, 0x46, 0x02, 0xff, 0x8d, 0x03, 0x00, 0x05, 0x20, 0x00, 0x2a, 0x00, 0xff, 0xd0, 0x70, 0x47, 0x4a, 0x68, 0xda, 0x62, 0x0a, 0xff, 0x88, 0x1a, 0x85, 0x0a, 0x88, 0xda, 0x84, 0x31, 0xff, 0x22, 0x98, 0x54, 0x1b, 0x68, 0x2a, 0x3a, 0x9a, 0xdf, 0x75, 0x00, 0x20, 0xf1, 0xe7, 0x27, 0x9c, 0xf0, 0xb5, 0xff, 0xc6, 0x46, 0x00, 0xb5, 0x92, 0x4b, 0x80, 0x00, 0xff, 0xc4, 0x58, 0x24, 0x21, 0x25, 0x23, 0xe2, 0x5c, 0xff, 0x66, 0x5c, 0x25, 0x68, 0x16, 0x40, 0x02, 0x22, 0xff, 0x29, 0x7e, 0x0a, 0x42, 0x4a, 0xd0, 0xe3, 0x8c, 0xff, 0x21, 0x8d, 0x8b, 0x42, 0x00, 0xd1, 0x8d, 0xe0, 0xdf, 0x30, 0x23, 0xe3, 0x5c, 0xdb, 0x15, 0x03, 0x00, 0xd0, 0xff, 0x87, 0xe0, 0x31, 0x21, 0x63, 0x54, 0xe3, 0x84, 0xff, 0x23, 0x85, 0x32, 0x42, 0x02, 0xd0, 0x23, 0x69, 0xfb, 0x20, 0x00, 0xd7, 0x01, 0x22, 0x6b, 0x8b, 0x1a, 0x42, 0xff, 0x05, 0xd0, 0x31, 0x23, 0x33, 0x3a, 0xe2, 0x54, 0xff, 0xb3, 0x06, 0x00, 0xd5, 0x94, 0xe0, 0x63, 0x7a, 0xee, 0x2d, 0x04, 0x9d, 0xe0, 0x08, 0x1b, 0x00, 0x13, 0x40, 0x00, 0xaf, 0xd0, 0x81, 0xe0, 0x30, 0x37, 0x00, 0x32, 0x7b, 0x01, 0xc4, 0xff, 0xe0, 0xe5, 0x8c, 0xad, 0xb2, 0x00, 0x2d, 0x00, 0xff, 0xd0, 0x85, 0xe0, 0x74, 0x4e, 0x27, 0x68, 0xb0, 0xfe, 0xcd, 0x02, 0xdb, 0x02, 0x7d, 0x83, 0x7b, 0x60, 0x71, 0xff, 0x4d, 0xa8, 0x47, 0x23, 0x68, 0x1a, 0x7e, 0xd2, 0xbe, 0x3b, 0x03, 0x01, 0x22, 0x1a, 0x76, 0x02, 0x03, 0x00, 0x24, 0xfe, 0x1f, 0x00, 0x00, 0x23, 0x63, 0x83, 0x63, 0x60, 0xa8, 0xf3, 0x47, 0x04, 0x99, 0x02, 0x97, 0x02, 0x21, 0x28, 0x7e, 0x01, 0xff, 0x42, 0x25, 0xd0, 0x29, 0x76, 0x04, 0x31, 0x29, 0xff, 0x75, 0xe1, 0x5c, 0x49, 0x07, 0x03, 0xd4, 0xe3, 0xff, 0x5c, 0x1b, 0x07, 0x00, 0xd4, 0x2a, 0x75, 0x31, 0xfe, 0xc3, 0x00, 0x1e, 0x2a, 0xea, 0xd0, 0xe2, 0x5c, 0x10, 0xff, 0x2a, 0xe7, 0xd0, 0x00, 0x22, 0xe2, 0x54, 0xe2, 0x8f, 0x84, 0x22, 0x85, 0xb3, 0xb1, 0x03, 0xc1, 0x04, 0x91, 0x00, 0xd1, 0xdf, 0xa7, 0xe0, 0xf3, 0x07, 0xda, 0x0d, 0x08, 0x01, 0x2b, 0xef, 0xd6, 0xd1, 0xe3, 0x68, 0xbf, 0x04, 0xd2, 0xe7, 0x04, 0xff, 0x23, 0x2a, 0x7e, 0x13, 0x42, 0xce, 0xd0, 0x22, 0xff, 0x8d, 0x00, 0x2a, 0x54, 0xd0, 0x30, 0x21, 0x61, 0xf7, 0x5c, 0x01, 0x29, 0xff, 0x04, 0x00, 0x2b, 0xc4, 0xd0, 0xfe, 0x39, 0x14, 0x7f, 0xe0, 0xe3, 0x6a, 0x5a, 0x1c, 0xe2, 0xff, 0x62, 0x28, 0x22, 0x1b, 0x78, 0xdb, 0xb2, 0xab, 0xff, 0x54, 0x23, 0x8d, 0x01, 0x3b, 0x23, 0x85, 0xb4, 0x77, 0xe7, 0xe3, 0x8c, 0x51, 0x02, 0xd1, 0x7c, 0xe7, 0x23, 0x0d, 0xfd, 0x01, 0xf5, 0x00, 0x76, 0xe7, 0x00, 0x22, 0x31, 0x21, 0xb5, 0x62, 0x7b, 0x08, 0x33, 0x1b, 0x00, 0x6e, 0xe7, 0x67, 0x0c, 0x6a, 0xea, 0x23, 0x00, 0x07, 0x21, 0x01, 0x73, 0xab, 0x00, 0x7c, 0xe7, 0x63, 0xde, 0x3b, 0x09, 0x78, 0xe7, 0x23, 0x6a, 0x07, 0x04, 0x66, 0xe7, 0xf7, 0x31, 0x4e, 0x25, 0xeb, 0x08, 0x6b, 0x83, 0x6b, 0x60, 0x9d, 0x2f, 0x09, 0x01, 0x79, 0xe7, 0x2c, 0x11, 0x18, 0x21, 0x05, 0x6b, 0xfb, 0x60, 0x29, 0x15, 0x00, 0x6e, 0xe7, 0xe1, 0x8c, 0x8a, 0xff, 0x42, 0xb1, 0xd2, 0x6a, 0x8b, 0x13, 0x42, 0xae, 0xff, 0xd0, 0x00, 0x23, 0x23, 0x85, 0xe3, 0x84, 0x98, 0xff, 0x46, 0x30, 0x23, 0xe7, 0x5c, 0x21, 0x4b, 0xff, 0xbf, 0xb2, 0x00, 0x2f, 0x19, 0xd1, 0x98, 0x4f, 0x09, 0x6f, 0xf6, 0x45, 0x00, 0x1d, 0x4b, 0x0b, 0x04, 0x6a, 0x68, 0x9b, 0x02, 0xbf, 0x13, 0x43, 0x6b, 0x60, 0x1e, 0x22, 0x1d, 0x01, 0x54, 0x7f, 0xf3, 0x06, 0x00, 0xd4, 0x5a, 0xe7, 0xe3, 0x7b, 0x08, 0xb7, 0x56, 0xe7, 0xa3, 0x07, 0x08, 0x36, 0xe7, 0xc3, 0x01, 0x46, 0xea, 0x65, 0x14, 0x10, 0x35, 0x28, 0x00, 0x35, 0x08, 0x2d, 0x3b, 0x2b, 0xff, 0x75, 0x3f, 0xe7, 0xe2, 0x6a, 0x53, 0x1c, 0xe3, 0x6f, 0x62, 0x28, 0x23, 0xeb, 0xe7, 0x00, 0x13, 0x70, 0xff, 0x0c, 0xcb, 0x34, 0xe7, 0x03, 0x0e, 0x30, 0x4f, 0x02, 0xcf, 0x06, 0x71, 0x4c, 0xf7, 0x00, 0x00, 0xad, 0x03, 0x00, 0xf0, 0xb5, 0x45, 0x46, 0xff, 0xde, 0x46, 0x57, 0x46, 0x4e, 0x46, 0xe0, 0xb5, 0xbf, 0x5e, 0x4d, 0x83, 0xb0, 0x2b, 0x89, 0x43, 0x05, 0xb2, 0xff, 0xe0, 0x04, 0x22, 0x90, 0x46, 0x5b, 0x4a, 0x93, 0xff, 0x46, 0x42, 0x46, 0x16, 0x1f, 0xb6, 0xb2, 0xb2, 0xff, 0x01, 0x92, 0x46, 0x51, 0x46, 0x6a, 0x68, 0x57, 0xff, 0x5c, 0xff, 0x2f, 0x19, 0xd0, 0x43, 0x45, 0x3c, 0xff, 0xd9, 0x80, 0x22, 0x52, 0x44, 0x00, 0x92, 0x40, 0xff, 0x22, 0x44, 0x46, 0xb6, 0x08, 0x52, 0x44, 0xf6, 0xfe, 0x20, 0x00, 0x36, 0x02, 0x5a, 0x1e, 0x94, 0x42, 0x06, 0xff, 0xd0, 0x68, 0x68, 0xa2, 0x01, 0x82, 0x5c, 0xff, 0xff, 0x2a, 0x01, 0xd0, 0x97, 0x42, 0x0a, 0xd0, 0x04, 0xff, 0x34, 0xa4, 0xb2, 0x9c, 0x42, 0xf1, 0xd3, 0x42, 0xff, 0x46, 0x04, 0x32, 0x92, 0xb2, 0x98, 0x45, 0x1f, 0xff, 0xd2, 0x90, 0x46, 0xd4, 0xe7, 0x52, 0x46, 0x00, 0xff, 0x9b, 0x82, 0x5c, 0xc3, 0x5c, 0x9a, 0x42, 0x11, 0xef, 0xd0, 0x01, 0x9a, 0x82, 0x07, 0x00, 0x0d, 0xd0, 0xa3, 0xff, 0x08, 0xdb, 0xb2, 0x1b, 0x02, 0x99, 0x46, 0x00, 0xbf, 0xe0, 0x68, 0x68, 0x48, 0x44, 0x3c, 0xdd, 0x00, 0x05, 0xff, 0x28, 0xf9, 0xd0, 0x2b, 0x89, 0xdd, 0xe7, 0x68, 0xaf, 0x68, 0x80, 0x19, 0xd8, 0x0d, 0x00, 0xfa, 0x0d, 0x00, 0xd6, 0xef, 0xe7, 0x00, 0x2b, 0x63, 0x31, 0x02, 0xaf, 0x7a, 0x69, 0xff, 0x68, 0x5c, 0x1e, 0xa2, 0x42, 0x07, 0xd0, 0x08, 0xff, 0x78, 0x86, 0xb2, 0xff, 0x2e, 0x03, 0xd0, 0xbe, 0xff, 0x42, 0x01, 0xd2, 0x28, 0x18, 0xc2, 0x72, 0x01, 0xff, 0x32, 0x90, 0xb2, 0x40, 0x31, 0x83, 0x42, 0xf0, 0xff, 0xd8, 0x9b, 0x08, 0x9c, 0x46, 0x3f, 0x22, 0x87, 0xff, 0x23, 0xea, 0x54, 0x63, 0x46, 0x00, 0x2b, 0x41, 0xff, 0xd0, 0x6b, 0x68, 0x02, 0x22, 0x98, 0x46, 0x47, 0xff, 0x46, 0xc0, 0x33, 0x9b, 0x46, 0x40, 0x37, 0x46, 0xff, 0x46, 0x00, 0x20, 0x21, 0xe0, 0x31, 0x78, 0xff, 0xff, 0x39, 0x4b, 0x42, 0x4b, 0x41, 0xdb, 0xb2, 0x9a, 0xff, 0x46, 0x53, 0x1e, 0xa3, 0x42, 0x20, 0xd0, 0x3b, 0xff, 0x78, 0xff, 0x2b, 0x1d, 0xd0, 0x94, 0x42, 0x08, 0xfe, 0xb5, 0x01, 0x9a, 0x46, 0x93, 0x01, 0x99, 0x46, 0x43, 0xff, 0x46, 0x49, 0x46, 0xcb, 0x5c, 0xff, 0x2b, 0x14, 0xff, 0xd0, 0x80, 0x23, 0x5b, 0x00, 0x99, 0x46, 0x01, 0xff, 0x30, 0x80, 0xb2, 0x04, 0x32, 0xcb, 0x44, 0xff, 0xff, 0x18, 0xf6, 0x18, 0x60, 0x45, 0x15, 0xd0, 0x91, 0x7f, 0x1e, 0x8c, 0x42, 0xda, 0xd1, 0x01, 0x23, 0x41, 0x0c, 0xff, 0xde, 0xd1, 0xa2, 0x42, 0xe3, 0xd1, 0x53, 0x1c, 0x7f, 0xa3, 0x42, 0x03, 0xd0, 0x5b, 0x46, 0x1b, 0x4d, 0x00, 0xfc, 0x0d, 0x00, 0x7f, 0x00, 0xe0, 0xd0, 0x87, 0x23, 0xe8, 0x54, 0xf7, 0x03, 0xb0, 0x3c, 0x1d, 0x03, 0x99, 0x46, 0xa2, 0x46, 0xe9, 0xab, 0x23, 0x03, 0x9d, 0x0c, 0xf4, 0x93, 0x01, 0x34, 0x00, 0x00, 0xf7, 0x20, 0xd5, 0x2a, 0x8f, 0x25, 0xc8, 0x23, 0xe0, 0xb5, 0xff, 0x95, 0x4d, 0x89, 0xb0, 0x01, 0x90, 0x02, 0x91, 0x5d, 0xeb, 0xd9, 0x02, 0x11, 0xd0, 0x88, 0xd1, 0x01, 0x83, 0x29, 0x01, 0xff, 0xeb, 0x18, 0xdc, 0x7a, 0x8f, 0x4e, 0xa4, 0x01, 0xff, 0x6b, 0x68, 0x00, 0x22, 0x19, 0x19, 0x04, 0x20, 0xd5, 0xb0, 0x1b, 0x01, 0xf8, 0x13, 0x01, 0xc8, 0x4b, 0x00, 0x01, 0x9b, 0xff, 0x6c, 0x68, 0xeb, 0x18, 0xdb, 0x7a, 0x99, 0x46, 0xff, 0x03, 0x23, 0x49, 0x46, 0x4a, 0x46, 0x19, 0x40, 0xff, 0x9a, 0x43, 0x4b, 0x46, 0x9b, 0x01, 0x98, 0x46, 0xfd, 0xe3, 0xc1, 0x00, 0x00, 0xd1, 0x91, 0xe0, 0x4b, 0x1c, 0xff, 0x04, 0x2b, 0x1a, 0xd0, 0x9b, 0x18, 0xdb, 0xb2, 0xff, 0x98, 0x01, 0x80, 0x46, 0x20, 0x5c, 0xff, 0x28, 0x5f, 0x00, 0xd1, 0x85, 0xe0, 0x8b, 0x15, 0x00, 0x0f, 0x15, 0x28, 0xff, 0x7b, 0xd0, 0x01, 0x29, 0x06, 0xd0, 0xd3, 0x1c, 0xff, 0xdb, 0xb2, 0x99, 0x01, 0x88, 0x46, 0x61, 0x5c, 0xef, 0xff, 0x29, 0x72, 0xd0, 0x49, 0x00, 0x08, 0x05, 0x93, 0xff, 0x1b, 0x02, 0x9a, 0x46, 0xe3, 0x18, 0x19, 0x78, 0xff, 0x06, 0xa8, 0x01, 0x71, 0x42, 0x71, 0x40, 0x20, 0xff, 0x18, 0x5c, 0x06, 0xae, 0x06, 0xaf, 0xb0, 0x71, 0xff, 0x56, 0x1c, 0xfe, 0x71, 0x80, 0x26, 0xc0, 0x27, 0x7f, 0x9e, 0x5d, 0xdb, 0x5d, 0x98, 0x46, 0xb1, 0x51, 0x03, 0xff, 0xb1, 0xe0, 0x41, 0x45, 0x00, 0xd1, 0xb6, 0xe0, 0xdd, 0xb0, 0x0b, 0x00, 0xb9, 0xe0, 0x40, 0x0b, 0x00, 0xbc, 0xe0, 0x7e, 0xa5, 0x00, 0x5c, 0x00, 0x23, 0x9b, 0x46, 0x87, 0xcd, 0x00, 0xff, 0x5f, 0x4e, 0x9b, 0x00, 0x5b, 0x44, 0x5e, 0x4f, 0xff, 0xb1, 0x46, 0x03, 0x93, 0x00, 0x2a, 0x00, 0xd0, 0xff, 0x72, 0xe0, 0x5b, 0x46, 0x07, 0xaa, 0x5b, 0x00, 0xff, 0xd2, 0x5c, 0x01, 0x99, 0x04, 0x92, 0x91, 0x42, 0xfe, 0x99, 0x04, 0x07, 0xaa, 0x94, 0x46, 0x63, 0x44, 0x5e, 0xff, 0x78, 0x88, 0x23, 0x98, 0x46, 0xb6, 0x01, 0xa8, 0xf7, 0x44, 0x20, 0x00, 0x21, 0x06, 0x80, 0x19, 0x40, 0x22, 0xf7, 0x41, 0x46, 0xb8, 0xf9, 0x08, 0x6c, 0x68, 0x2e, 0x00, 0xff, 0x03, 0x9b, 0x20, 0x00, 0x9b, 0x01, 0x88, 0x36, 0x75, 0x1c, 0x1d, 0x08, 0x00, 0x1d, 0x00, 0x31, 0x00, 0xc8, 0x1d, 0x08, 0xff, 0x6a, 0x46, 0x04, 0x9b, 0x12, 0x7b, 0xeb, 0x18, 0xff, 0xda, 0x72, 0x01, 0x23, 0x9c, 0x46, 0xc8, 0x22, 0xff, 0xe3, 0x44, 0xab, 0x54, 0x5b, 0x46, 0x02, 0x2b, 0xff, 0x32, 0xd1, 0x56, 0x46, 0x41, 0x4c, 0x6b, 0x68, 0xd7, 0x98, 0x19, 0xa0, 0x5b, 0x0a, 0x6a, 0x91, 0x00, 0x12, 0x7d, 0xff, 0xea, 0x54, 0x1e, 0xe0, 0x99, 0x46, 0x6a, 0x46, 0xff, 0x88, 0x23, 0x28, 0x00, 0x2f, 0x00, 0x12, 0x79, 0xff, 0x8c, 0x30, 0xea, 0x54, 0x02, 0x99, 0x3c, 0x22, 0xfd, 0x37, 0x8f, 0x02, 0x88, 0x37, 0x20, 0x00, 0x32, 0x4e, 0xdb, 0x44, 0x46, 0x61, 0x14, 0x39, 0x00, 0x79, 0x0d, 0x01, 0x9b, 0x7f, 0xef, 0x18, 0x4b, 0x46, 0xfb, 0x72, 0x01, 0x81, 0x09, 0xf7, 0x00, 0x20, 0x09, 0xe3, 0x29, 0x87, 0x23, 0x01, 0x22, 0xcf, 0xeb, 0x5c, 0x6c, 0x68, 0xe9, 0x04, 0xe5, 0x08, 0xd1, 0x8c, 0xfd, 0xe7, 0xc9, 0x05, 0x21, 0x00, 0xeb, 0x18, 0xde, 0x7a, 0xff, 0xb6, 0x01, 0x00, 0xe0, 0x69, 0x68, 0x89, 0x19, 0x5f, 0x00, 0x22, 0x04, 0x20, 0x1a, 0xf3, 0x0a, 0xf7, 0x77, 0x02, 0xb3, 0xc8, 0x22, 0xa3, 0x04, 0x09, 0x15, 0x6c, 0x68, 0x0b, 0x09, 0xd0, 0xfb, 0x79, 0xe7, 0x97, 0x0c, 0x12, 0x79, 0x02, 0x99, 0xea, 0xbf, 0x54, 0x8c, 0x30, 0x3c, 0x22, 0x12, 0x31, 0x00, 0x80, 0xff, 0xe7, 0x97, 0x1c, 0xbc, 0x46, 0x63, 0x46, 0x06, 0xf7, 0xaf, 0x7b, 0x71, 0x6d, 0x01, 0xd0, 0x48, 0xe7, 0xd1, 0xdf, 0x1c, 0x06, 0xab, 0x59, 0x71, 0x73, 0x01, 0xd0, 0x45, 0x7f, 0xe7, 0x91, 0x1c, 0x06, 0xae, 0xf1, 0x71, 0x79, 0x01, 0xff, 0xd0, 0x42, 0xe7, 0x03, 0x32, 0x06, 0xab, 0xda, 0xf7, 0x71, 0x3e, 0xe7, 0x6b, 0x06, 0x35, 0x28, 0x00, 0x00, 0xe5, 0xe1, 0x03, 0x00, 0x5d, 0x73, 0x02, 0x77, 0x06, 0x55, 0x5f, 0x00, 0xff, 0x00, 0x01, 0x23, 0x00, 0x22, 0xf0, 0xb5, 0x9d, 0xff, 0xb0, 0x03, 0xac, 0x63, 0x70, 0x33, 0x4b, 0x22, 0xff, 0x70, 0x5b, 0x68, 0x33, 0x4d, 0xdb, 0x06, 0x1b, 0xff, 0x0f, 0xa3, 0x70, 0xe2, 0x70, 0x22, 0x71, 0x20, 0xfb, 0x00, 0xa8, 0x9d, 0x00, 0xfb, 0xd0, 0x08, 0xa8, 0x2e, 0xfe, 0x75, 0x00, 0x09, 0x9b, 0x16, 0x20, 0x0b, 0x2b, 0x01, 0xff, 0xd8, 0x1d, 0xb0, 0xf0, 0xbd, 0x1a, 0x00, 0x2b, 0xff, 0x4c, 0x08, 0x3a, 0x52, 0x08, 0xa2, 0x72, 0x80, 0xff, 0x22, 0x92, 0x02, 0x94, 0x46, 0x23, 0x81, 0x1b, 0xff, 0x04, 0x9b, 0x0a, 0x5b, 0x42, 0x63, 0x44, 0x63, 0xdd, 0x60, 0x95, 0x06, 0xe2, 0x54, 0x24, 0x31, 0x00, 0x87, 0x23, 0xff, 0xe3, 0x5c, 0x1a, 0x20, 0x3f, 0x2b, 0xe5, 0xd0, 0xff, 0x05, 0xae, 0x32, 0x00, 0x20, 0x4b, 0x21, 0x4f, 0xff, 0x23, 0xcb, 0x23, 0xc2, 0x25, 0x89, 0x01, 0x3d, 0xff, 0xad, 0xb2, 0xad, 0x01, 0x63, 0x68, 0x40, 0x22, 0xef, 0x58, 0x19, 0x0c, 0xa9, 0xd1, 0x0d, 0x0c, 0x9b, 0x05, 0xff, 0x9a, 0x01, 0x93, 0x93, 0x42, 0x20, 0xd1, 0x0d, 0xf7, 0x9b, 0x72, 0x68, 0x09, 0x04, 0x1b, 0xd1, 0x0e, 0x9b, 0xff, 0x01, 0x93, 0x01, 0x9a, 0xb3, 0x68, 0x9a, 0x42, 0xff, 0x15, 0xd1, 0x37, 0x22, 0x02, 0xab, 0x9b, 0x18, 0xff, 0x1b, 0x78, 0x10, 0x20, 0x01, 0x2b, 0xbd, 0xd1, 0xef, 0x02, 0xab, 0x03, 0x3a, 0x0d, 0x04, 0x01, 0x2b, 0xb7, 0xff, 0xd1, 0x35, 0x21, 0x02, 0xaa, 0x52, 0x18, 0x12, 0xff, 0x78, 0x00, 0x2a, 0xb1, 0xd1, 0x23, 0x70, 0x00, 0xbf, 0x20, 0xae, 0xe7, 0x1a, 0x20, 0xac, 0x5f, 0x03, 0x00, 0xdf, 0x40, 0x00, 0x41, 0xb5, 0x27, 0xe7, 0x00, 0x2b, 0x00, 0xfd, 0x00, 0xff, 0x04, 0xa9, 0x33, 0x00, 0x00, 0xc4, 0x61, 0xee, 0xff, 0x0c, 0xf0, 0xb5, 0x4e, 0x73, 0x0b, 0x45, 0x46, 0x00, 0xfe, 0x8f, 0x03, 0xe0, 0xb5, 0x4d, 0x4c, 0x4e, 0x4e, 0x93, 0xbf, 0xb0, 0xe2, 0x54, 0x60, 0x68, 0xb0, 0xf1, 0x08, 0x22, 0xff, 0x89, 0x04, 0x2a, 0x00, 0xd8, 0x85, 0xe0, 0x00, 0xff, 0x23, 0x00, 0x93, 0x02, 0xab, 0x98, 0x46, 0x47, 0xff, 0x4b, 0x04, 0x25, 0x01, 0x93, 0x47, 0x4b, 0x57, 0xdf, 0x1e, 0x9a, 0x46, 0x46, 0x4b, 0x69, 0x07, 0x9b, 0x46, 0xf7, 0xbd, 0x42, 0x32, 0xed, 0x03, 0x2b, 0x40, 0x00, 0xd0, 0xff, 0x6e, 0xe0, 0xaf, 0x08, 0xff, 0xb2, 0x3f, 0x02, 0xdf, 0x63, 0x68, 0xd8, 0x19, 0xb0, 0x59, 0x0a, 0x40, 0x22, 0xff, 0x40, 0x46, 0x01, 0x9b, 0xff, 0x21, 0x98, 0x47, 0xfd, 0x43, 0x59, 0x02, 0xaf, 0x01, 0xa8, 0x46, 0x1d, 0x00, 0xef, 0x12, 0x78, 0x1a, 0x70, 0xf3, 0x04, 0xd8, 0x19, 0x29, 0x7b, 0x00, 0xd0, 0xf3, 0x08, 0x4b, 0x46, 0xc1, 0x46, 0x19, 0x04, 0xd5, 0x63, 0xd5, 0x03, 0xd9, 0xd5, 0x03, 0xa8, 0x15, 0x08, 0x2b, 0x00, 0xf9, 0x4d, 0x49, 0x02, 0xda, 0x02, 0x33, 0x9b, 0xb2, 0x00, 0x93, 0xff, 0x22, 0x89, 0x57, 0x1e, 0x01, 0x35, 0xad, 0xb2, 0xbf, 0x95, 0x42, 0xc6, 0xd3, 0x40, 0x22, 0x53, 0x04, 0x40, 0xff, 0x46, 0x98, 0x47, 0x42, 0x46, 0x26, 0x4b, 0x02, 0xff, 0x93, 0x26, 0x4b, 0x53, 0x60, 0x26, 0x4b, 0x93, 0xfe, 0x03, 0x00, 0xfa, 0x17, 0x05, 0x93, 0x03, 0x23, 0x13, 0x7f, 0x40, 0xdf, 0x19, 0xbf, 0x05, 0x3f, 0x0e, 0x89, 0x24, 0x59, 0x46, 0xe5, 0x00, 0x71, 0x2d, 0x31, 0x00, 0x71, 0x0d, 0x4e, 0x17, 0x20, 0xa7, 0x00, 0x22, 0x59, 0x7f, 0x00, 0xdb, 0x0e, 0x13, 0xb9, 0x01, 0x13, 0xac, 0xcf, 0x2a, 0x71, 0x05, 0x95, 0xe7, 0x07, 0x05, 0x05, 0x01, 0x01, 0x01, 0xef, 0x93, 0x05, 0x4b, 0x9a, 0x09, 0x00, 0x99, 0x46, 0xb6, 0xcc, 0x57, 0x0a, 0x4b, 0x06, 0x67, 0x5f, 0x5b, 0x0e, 0x63, 0x06, 0x45, 0x45, 0xff, 0x74, 0x41, 0x4d, 0x4f, 0x52, 0x50, 0x2e, 0x75, 0xe7, 0x6d, 0x45, 0x01, 0x62, 0x02, 0x77, 0x05, 0x10, 0xb5, 0x07, 0xff, 0x4a, 0x1f, 0x23, 0x14, 0x78, 0x00, 0x2c, 0x01, 0xff, 0xd1, 0x18, 0x00, 0x10, 0xbd, 0x92, 0x7a, 0x07, 0xbf, 0x3b, 0x82, 0x42, 0xf9, 0xd9, 0x02, 0x6b, 0x00, 0x03, 0xdb, 0x00, 0xf5, 0x47, 0x08, 0x39, 0x35, 0x97, 0x05, 0x18, 0x4c, 0xff, 0x91, 0xb0, 0x22, 0x78, 0x0d, 0x00, 0x1f, 0x23, 0x57, 0x00, 0x2a, 0x02, 0x2b, 0x00, 0x11, 0x6d, 0x02, 0xa2, 0x2d, 0x08, 0xff, 0xf8, 0xd9, 0xb0, 0x33, 0xe3, 0x5c, 0x00, 0x2b, 0xf7, 0x03, 0xd0, 0x88, 0x57, 0x02, 0x83, 0x42, 0x11, 0xd0, 0x7f, 0x20, 0x18, 0xc6, 0x7a, 0x0d, 0x4f, 0xb6, 0xd7, 0x08, 0xef, 0x98, 0x19, 0x69, 0x46, 0xd7, 0x0c, 0x09, 0x4b, 0x3c, 0xff, 0x22, 0x01, 0xa9, 0x28, 0x00, 0x98, 0x47, 0x00, 0xff, 0x23, 0xde, 0xe7, 0x21, 0x00, 0x05, 0x4b, 0x8c, 0x97, 0x31, 0x3c, 0x22, 0x0f, 0x0c, 0xd6, 0x17, 0x02, 0x6b, 0x04, 0x5d, 0x7e, 0xff, 0x12, 0xc8, 0x23, 0x70, 0xb5, 0x0b, 0x4c, 0x55, 0x04, 0xbf, 0x01, 0xd1, 0x00, 0x20, 0x70, 0xbd, 0x59, 0x04, 0x08, 0x9f, 0x4e, 0xe3, 0x18, 0xdd, 0x7a, 0x15, 0x35, 0xd5, 0x0e, 0xec, 0xfc, 0x3f, 0x10, 0xe7, 0x04, 0x01, 0x22, 0x01, 0x4b, 0x1a, 0x70, 0xbf, 0x70, 0x47, 0x01, 0x01, 0x00, 0x20, 0x0b, 0x14, 0x1c, 0xfe, 0x0b, 0x00, 0xf0, 0xb5, 0xce, 0x46, 0x47, 0x46, 0x80, 0xff, 0xb5, 0x91, 0xb0, 0x01, 0xaf, 0x34, 0x4b, 0x06, 0xff, 0xae, 0x98, 0x47, 0x38, 0x00, 0x33, 0x4b, 0x0b, 0xbf, 0xad, 0x98, 0x47, 0x30, 0x00, 0x32, 0xef, 0x00, 0x28, 0xfe, 0x05, 0x08, 0x80, 0x23, 0x9b, 0x03, 0x01, 0x93, 0x06, 0xff, 0x93, 0x80, 0x23, 0x5b, 0x03, 0x0b, 0x93, 0xc0, 0xdf, 0x23, 0xdb, 0x02, 0x6b, 0x60, 0x0b, 0x00, 0x01, 0x03, 0xfe, 0x0b, 0x00, 0x5b, 0x01, 0x08, 0x93, 0x2a, 0x4b, 0x00, 0xff, 0x24, 0x0d, 0x93, 0x01, 0x23, 0x98, 0x46, 0xab, 0xff, 0x73, 0x42, 0x46, 0x2b, 0x73, 0xab, 0x74, 0xbb, 0xff, 0x73, 0x3b, 0x73, 0x6b, 0x46, 0x5c, 0x70, 0x9a, 0xff, 0x70, 0xdc, 0x70, 0x1a, 0x70, 0x23, 0x4b, 0x69, 0xff, 0x46, 0x06, 0x20, 0x6c, 0x73, 0x99, 0x46, 0x7c, 0xff, 0x60, 0x74, 0x60, 0x7c, 0x73, 0x74, 0x73, 0xb4, 0xf7, 0x73, 0x34, 0x73, 0x19, 0x06, 0x6b, 0x46, 0x69, 0x46, 0xdf, 0x29, 0x20, 0x1a, 0x70, 0xc8, 0x77, 0x00, 0x1a, 0x4b, 0xbf, 0x6c, 0x74, 0x7c, 0x74, 0x74, 0x74, 0x7b, 0x04, 0x18, 0xfc, 0x7b, 0x08, 0x05, 0x04, 0x00, 0x20, 0x17, 0x4d, 0xa8, 0x47, 0x7f, 0x17, 0x4c, 0x00, 0x20, 0xa0, 0x47, 0x00, 0xed, 0x02, 0x55, 0x01, 0x79, 0x02, 0x01, 0x0b, 0x10, 0x02, 0x0b, 0x00, 0x02, 0x0b, 0x10, 0xff, 0x80, 0x21, 0x0f, 0x4a, 0x13, 0x78, 0x0b, 0x43, 0xdf, 0x13, 0x70, 0x11, 0xb0, 0x0c, 0x0f, 0x0a, 0xf0, 0xbd, 0x7f, 0xc0, 0x46, 0x05, 0x4a, 0x00, 0x00, 0x41, 0x03, 0x00, 0xf5, 0x65, 0x03, 0x00, 0x89, 0x03, 0x00, 0x00, 0x10, 0x00, 0xc0, 0xdf, 0x79, 0x51, 0x00, 0x00, 0xad, 0x0b, 0x00, 0x15, 0x4b, 0xd7, 0x00, 0x00, 0x7d, 0x03, 0x00, 0xe5, 0x03, 0x00, 0x19, 0x4c, 0xfe, 0x1b, 0x00, 0x18, 0x00, 0x43, 0x70, 0xb5, 0x01, 0x23, 0xff, 0x00, 0x25, 0x8e, 0xb0, 0x01, 0xac, 0x21, 0x00, 0xff, 0x08, 0x20, 0x34, 0x4e, 0x63, 0x70, 0x23, 0x70, 0x7f, 0xa5, 0x70, 0xb0, 0x47, 0x21, 0x00, 0x15, 0x5b, 0x01, 0xff, 0x80, 0x22, 0x30, 0x4b, 0x52, 0x00, 0x5a, 0x61, 0xff, 0x80, 0x22, 0x92, 0x03, 0x02, 0xac, 0x9a, 0x61, 0xdd, 0x2e, 0x9f, 0x00, 0x20, 0x00, 0x2d, 0x05, 0x00, 0x1f, 0x23, 0xdf, 0x23, 0x71, 0x1a, 0x3b, 0x25, 0x2b, 0x00, 0x63, 0x70, 0xff, 0x65, 0x73, 0x2f, 0x33, 0x65, 0x72, 0x29, 0x4d, 0xff, 0xe3, 0x70, 0x2d, 0x3b, 0x23, 0x72, 0x22, 0x00, 0xef, 0x27, 0x4b, 0x28, 0x49, 0xd1, 0x05, 0x2b, 0x68, 0x1a, 0xff, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x80, 0x21, 0x25, 0xff, 0x4a, 0xc9, 0x03, 0x11, 0x60, 0x07, 0x22, 0x02, 0xff, 0x21, 0x1a, 0x71, 0x9a, 0x71, 0x1a, 0x78, 0x0a, 0xff, 0x43, 0x1a, 0x70, 0x2a, 0x68, 0x13, 0x8c, 0x00, 0xf7, 0x2b, 0xfc, 0xd1, 0xac, 0x01, 0x22, 0x1e, 0x49, 0x1e, 0xfe, 0x53, 0x00, 0x01, 0x22, 0xeb, 0x7e, 0x1d, 0x49, 0x13, 0xbf, 0x43, 0xeb, 0x76, 0x1d, 0x48, 0x1d, 0x0f, 0x04, 0x26, 0xff, 0x00, 0x22, 0x00, 0x23, 0xa6, 0x70, 0x26, 0x71, 0xf7, 0x04, 0x92, 0x05, 0x8b, 0x01, 0x19, 0x4d, 0x5b, 0x00, 0xbf, 0x23, 0x80, 0x22, 0x00, 0x18, 0x49, 0x29, 0x05, 0xe6, 0xbf, 0x70, 0x98, 0x47, 0x08, 0x22, 0x17, 0x0b, 0x00, 0x17, 0xee, 0x3b, 0x09, 0x08, 0x21, 0x16, 0x07, 0x00, 0x16, 0x4b, 0x00, 0xef, 0x22, 0x19, 0x88, 0x28, 0xeb, 0x00, 0x98, 0x47, 0x0e, 0xef, 0xb0, 0x70, 0xbd, 0x49, 0xe7, 0x04, 0x28, 0x00, 0x40, 0xfb, 0x09, 0x3b, 0xff, 0x00, 0x21, 0x00, 0x00, 0x60, 0x11, 0xf7, 0x00, 0x20, 0x55, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x43, 0xff, 0x00, 0xe1, 0x00, 0xe0, 0xf1, 0x3a, 0x00, 0x00, 0x5f, 0xdd, 0x25, 0x00, 0x00, 0x04, 0x1b, 0x02, 0x04, 0x3b, 0x02, 0x9f, 0xa5, 0x42, 0x00, 0x00, 0x80, 0x0b, 0x00, 0x01, 0x00, 0x40, 0xdf, 0x19, 0x2c, 0x00, 0x00, 0xfd, 0x1f, 0x00, 0xcd, 0x2d, 0xef, 0x00, 0x00, 0x09, 0x2e, 0x32, 0x04, 0x00, 0x20, 0x81, 0xfe, 0x0b, 0x00, 0xf8, 0xb5, 0x0d, 0x00, 0x02, 0x28, 0x3b, 0xff, 0xd0, 0x1e, 0xd8, 0x00, 0x28, 0x25, 0xd0, 0x01, 0xff, 0x28, 0x19, 0xd1, 0x2e, 0x4b, 0x1b, 0x78, 0x18, 0xff, 0x42, 0x54, 0xd0, 0x2d, 0x4b, 0x2d, 0x4e, 0x18, 0xfd, 0x68, 0x1f, 0x05, 0x2d, 0x4c, 0x2e, 0x4b, 0x21, 0x68, 0xee, 0x07, 0x00, 0x4b, 0x07, 0x1c, 0x0b, 0x05, 0x2c, 0x4b, 0x01, 0xf7, 0x1c, 0x38, 0x1c, 0xe9, 0x01, 0x60, 0x21, 0x00, 0x30, 0xfb, 0x00, 0x2a, 0x21, 0x00, 0xf8, 0xbd, 0x03, 0x28, 0x30, 0xff, 0xd0, 0x55, 0x28, 0xfa, 0xd1, 0x22, 0x49, 0x20, 0xfb, 0x48, 0x26, 0x11, 0x00, 0xf5, 0xe7, 0x1c, 0x4b, 0x1f, 0xff, 0x4c, 0x1d, 0x78, 0xeb, 0x07, 0x04, 0xd5, 0x1a, 0x6f, 0x4b, 0x18, 0x68, 0x1b, 0x6d, 0x05, 0x60, 0xab, 0x0d, 0x00, 0xef, 0x17, 0x4b, 0x58, 0x68, 0x1b, 0x06, 0x60, 0x60, 0x15, 0xef, 0x4e, 0xde, 0xe7, 0x12, 0x6d, 0x08, 0x1d, 0xd0, 0x11, 0xbf, 0x4b, 0x12, 0x4e, 0x58, 0x68, 0x12, 0x17, 0x00, 0x12, 0xaf, 0x4c, 0x12, 0x4b, 0x61, 0x6d, 0x00, 0x12, 0x6d, 0x10, 0x11, 0xfe, 0x6d, 0x10, 0x70, 0x60, 0xc7, 0xe7, 0x0b, 0x4d, 0x08, 0x4b, 0x4c, 0x29, 0xce, 0x00, 0x0f, 0x27, 0x00, 0x07, 0x04, 0x0b, 0x07, 0x00, 0x7f, 0xc0, 0xe7, 0x05, 0x4c, 0x03, 0x4e, 0xb9, 0x2f, 0x03, 0xd6, 0x09, 0x01, 0x20, 0x14, 0xfb, 0x14, 0x5d, 0x07, 0x0d, 0x2d, 0x5a, 0xff, 0x00, 0x00, 0x45, 0x5e, 0x00, 0x00, 0x5d, 0x55, 0xff, 0x00, 0x00, 0x35, 0x43, 0x00, 0x00, 0x49, 0x44, 0x7c, 0x4f, 0x03, 0x03, 0x00, 0x00, 0x48, 0x70, 0x47, 0x0c, 0x1f, 0x00, 0xff, 0x10, 0xb5, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0xfe, 0x59, 0x03, 0x21, 0x10, 0x24, 0x08, 0x4b, 0x08, 0x4a, 0xff, 0x19, 0x70, 0x10, 0x70, 0x5c, 0x70, 0x98, 0x70, 0xbf, 0xd8, 0x70, 0x18, 0x71, 0x11, 0x70, 0x1b, 0x04, 0x62, 0xff, 0xb6, 0x80, 0x22, 0x03, 0x4b, 0x92, 0x03, 0x5a, 0x17, 0x61, 0x10, 0xbd, 0x33, 0x04, 0x0e, 0x5f, 0x00, 0x87, 0x05, 0x39, 0x10, 0xff, 0x21, 0x02, 0x20, 0x09, 0x4b, 0x09, 0x4a, 0x18, 0xff, 0x70, 0x58, 0x70, 0x99, 0x70, 0xd9, 0x70, 0x19, 0xbf, 0x71, 0x01, 0x23, 0x11, 0x70, 0x13, 0x39, 0x18, 0x04, 0xde, 0x39, 0x08, 0x70, 0x47, 0xc0, 0x46, 0x3b, 0x24, 0x00, 0x28, 0x3f, 0x01, 0xd0, 0x01, 0x4b, 0x18, 0x70, 0x17, 0x04, 0xb7, 0x04, 0xdf, 0x70, 0xb5, 0x07, 0x4b, 0x07, 0xdd, 0x00, 0x28, 0x80, 0x7f, 0x18, 0x80, 0x00, 0x21, 0x20, 0x00, 0x06, 0xe1, 0x04, 0xbf, 0x88, 0x00, 0x22, 0x20, 0x00, 0x05, 0x09, 0x00, 0x70, 0x23, 0xbd, 0x02, 0x23, 0x00, 0xb3, 0x05, 0xcf, 0x05, 0x49, 0xb7, 0x01, 0xbb, 0x05, 0xff, 0x30, 0xb5, 0x21, 0x4b, 0x83, 0xb0, 0x1a, 0x78, 0xff, 0x82, 0x42, 0x0b, 0xd0, 0x18, 0x70, 0x00, 0x28, 0xff, 0x0a, 0xd1, 0x01, 0x22, 0x1d, 0x4b, 0x1e, 0x48, 0xdb, 0x1a, 0x70, 0x81, 0x06, 0x1e, 0x48, 0x05, 0x04, 0x03, 0xb0, 0xff, 0x30, 0xbd, 0x01, 0x25, 0x19, 0x4c, 0x17, 0x4b, 0x1f, 0x08, 0x21, 0x1d, 0x70, 0x20, 0xa7, 0x03, 0xf5, 0x06, 0x05, 0x04, 0xf7, 0x68, 0x46, 0x19, 0x05, 0x00, 0x6a, 0x46, 0x02, 0x23, 0xff, 0x13, 0x4c, 0x53, 0x70, 0x93, 0x70, 0x17, 0x49, 0xdd, 0x20, 0x7d, 0x0a, 0x68, 0x46, 0x16, 0x17, 0x08, 0x00, 0x23, 0xff, 0x20, 0x00, 0x53, 0x70, 0x00, 0x21, 0x14, 0x4b, 0x49, 0x95, 0x9d, 0x02, 0x93, 0x04, 0x12, 0x3b, 0x08, 0xa3, 0x09, 0x4a, 0x0f, 0x04, 0x65, 0x11, 0x09, 0x00, 0xce, 0x77, 0x05, 0x93, 0x00, 0x1c, 0x01, 0x9b, 0x0c, 0xdf, 0xe5, 0x2b, 0x00, 0x00, 0xb8, 0x07, 0x00, 0xa5, 0x26, 0xca, 0x67, 0x0e, 0xbd, 0x0f, 0x00, 0x39, 0x0b, 0x00, 0x28, 0x02, 0x42, 0x45, 0xa6, 0x07, 0x00, 0x01, 0x27, 0xbb, 0x02, 0x03, 0x00, 0x81, 0x03, 0x00, 0xb9, 0xbe, 0x0f, 0x00, 0xff, 0x07, 0x00, 0x00, 0x91, 0x0b, 0x00, 0xf0, 0xff, 0xb5, 0x57, 0x46, 0xde, 0x46, 0x4e, 0x46, 0x45, 0xfe, 0x77, 0x00, 0xe0, 0xb5, 0x83, 0xb0, 0x01, 0x93, 0x9b, 0xff, 0x46, 0x93, 0x4b, 0x04, 0x26, 0x9a, 0x46, 0x93, 0xbf, 0x4f, 0x93, 0x4c, 0x94, 0x4d, 0x94, 0x27, 0x02, 0xdb, 0x7f, 0xb2, 0x00, 0x2b, 0x00, 0xd1, 0xb2, 0xe0, 0xc1, 0x03, 0xfe, 0x53, 0x01, 0x9a, 0x61, 0x91, 0x4a, 0x12, 0x78, 0xd2, 0xef, 0x07, 0x00, 0xd4, 0xdd, 0x11, 0x00, 0x52, 0x00, 0x9a, 0xff, 0x61, 0x8e, 0x49, 0x8f, 0x4b, 0xff, 0x3a, 0x8f, 0xff, 0x48, 0x98, 0x47, 0x3b, 0x78, 0x00, 0x2b, 0x18, 0xdd, 0xd1, 0x60, 0x07, 0x9c, 0x46, 0x02, 0xd9, 0x01, 0xd2, 0x05, 0xfe, 0xab, 0x0d, 0x63, 0x46, 0x23, 0x70, 0x50, 0x70, 0x53, 0xeb, 0x78, 0x02, 0xab, 0x03, 0x21, 0xa1, 0x11, 0xbf, 0xf3, 0x4f, 0xf7, 0x8f, 0x30, 0xbf, 0x31, 0x04, 0xec, 0xd0, 0x00, 0x22, 0xff, 0x3a, 0x70, 0x80, 0x4a, 0x7c, 0x4b, 0x93, 0x46, 0xdf, 0x1b, 0x88, 0x9b, 0x44, 0x2b, 0x13, 0x00, 0x15, 0xd1, 0x5c, 0xa4, 0x03, 0x41, 0x20, 0x20, 0x70, 0x56, 0x3f, 0x00, 0x04, 0x3f, 0x38, 0xfe, 0x2b, 0x04, 0xed, 0xd0, 0x00, 0x23, 0x02, 0x22, 0x2b, 0xfb, 0x70, 0x6b, 0xab, 0x00, 0x1a, 0x40, 0x90, 0x46, 0x00, 0xff, 0xd0, 0x94, 0xe0, 0x80, 0x21, 0x67, 0x4a, 0x49, 0xff, 0x00, 0x51, 0x61, 0x00, 0x22, 0x51, 0x46, 0x0a, 0xff, 0x70, 0x01, 0x32, 0x1a, 0x40, 0x91, 0x46, 0x65, 0xff, 0xd0, 0x5a, 0x46, 0x67, 0x4b, 0x58, 0x46, 0x1a, 0x7b, 0x60, 0x67, 0x41, 0x01, 0x67, 0x4b, 0x19, 0x68, 0x07, 0x04, 0xff, 0x84, 0x21, 0x66, 0x4b, 0xc9, 0x05, 0x98, 0x47, 0xcd, 0x66, 0x0f, 0x00, 0x66, 0x4b, 0x07, 0x04, 0x85, 0x05, 0x10, 0x70, 0xff, 0x13, 0x78, 0x83, 0x46, 0x99, 0x46, 0x03, 0x04, 0xff, 0x1b, 0x0e, 0x00, 0x93, 0x43, 0x46, 0x00, 0x2b, 0xff, 0x4c, 0xd1, 0x00, 0x22, 0x00, 0x23, 0x01, 0x92, 0xff, 0x52, 0x46, 0x49, 0x46, 0x51, 0x70, 0x69, 0x46, 0xff, 0x09, 0x78, 0x13, 0x71, 0x91, 0x70, 0x41, 0x46, 0xdf, 0xd1, 0x70, 0x80, 0x22, 0x4c, 0x6b, 0x0a, 0x00, 0x23, 0xbb, 0x3b, 0x70, 0xbb, 0xc4, 0x2b, 0x70, 0x3b, 0x65, 0x15, 0xd0, 0xfb, 0x4c, 0xe7, 0x33, 0x0c, 0x80, 0x22, 0x23, 0x70, 0x04, 0xef, 0x23, 0xd2, 0x05, 0x53, 0x39, 0x10, 0x03, 0x3b, 0x23, 0x3e, 0x3b, 0x28, 0x32, 0xe7, 0x00, 0x23, 0x00, 0xab, 0x01, 0x99, 0x04, 0xff, 0xb2, 0xd0, 0x32, 0x4a, 0x01, 0x9b, 0x53, 0x60, 0xf7, 0x18, 0x00, 0x31, 0xbb, 0x00, 0x31, 0x4b, 0x59, 0x68, 0xd5, 0x31, 0xd7, 0x08, 0x30, 0xd7, 0x08, 0x30, 0x0f, 0x00, 0x30, 0x4b, 0xbe, 0x07, 0x04, 0x98, 0x47, 0xc3, 0xb2, 0x98, 0xd1, 0x00, 0x01, 0x5f, 0x90, 0x1b, 0x0e, 0x9b, 0xe7, 0xbb, 0x0d, 0x48, 0x07, 0x00, 0xff, 0x1c, 0x4b, 0x52, 0x00, 0x5a, 0x61, 0x1d, 0x49, 0xf5, 0x1d, 0xc5, 0x01, 0x1d, 0xc5, 0xe1, 0x02, 0x21, 0x0c, 0x4b, 0xf7, 0x1a, 0x88, 0x0a, 0xcb, 0x00, 0x19, 0x40, 0x88, 0x46, 0xff, 0x0c, 0x49, 0x8c, 0x46, 0x62, 0x44, 0x01, 0x92, 0x0b, 0x3d, 0xe7, 0x7f, 0x07, 0x01, 0x83, 0x13, 0xaf, 0x06, 0xb7, 0x06, 0x8b, 0x0b, 0xfa, 0x0f, 0x00, 0xc0, 0x0b, 0x00, 0xf1, 0x25, 0x00, 0x00, 0x60, 0xbd, 0x11, 0x13, 0x00, 0xc0, 0xff, 0xff, 0x14, 0xc3, 0x06, 0x5d, 0xf7, 0x00, 0x00, 0x04, 0x07, 0x00, 0x2d, 0x5a, 0x00, 0x00, 0xf3, 0xed, 0x57, 0x0b, 0x00, 0x27, 0x00, 0x5d, 0x55, 0x00, 0x00, 0xff, 0xf1, 0x53, 0x00, 0x00, 0x10, 0xb5, 0x05, 0x4c, 0xff, 0xa0, 0x47, 0x16, 0x28, 0x05, 0xd0, 0x00, 0x28, 0xf7, 0x02, 0xd0, 0x03, 0xd3, 0x00, 0xa0, 0x47, 0x10, 0xbd, 0xff, 0xfe, 0xe7, 0xb5, 0x37, 0x00, 0x00, 0xad, 0x38, 0xff, 0x00, 0x00, 0x70, 0xb5, 0x04, 0x00, 0x90, 0xb0, 0xfb, 0x1d, 0x4b, 0x6b, 0x04, 0x01, 0xa9, 0x98, 0x47, 0x04, 0xf7, 0x22, 0x01, 0xa9, 0x77, 0x03, 0x4d, 0xa8, 0x47, 0x20, 0xfd, 0x68, 0x77, 0x07, 0x00, 0x28, 0x0d, 0xd1, 0x04, 0x22, 0xdf, 0x02, 0xa9, 0x30, 0x00, 0xa8, 0x1b, 0x00, 0x03, 0xa9, 0xff, 0x20, 0x1d, 0xa8, 0x47, 0x30, 0x1d, 0x04, 0x22, 0xff, 0x04, 0xa9, 0xa8, 0x47, 0x10, 0xb0, 0x70, 0xbd, 0xff, 0xfe, 0x23, 0x9b, 0x05, 0x23, 0x60, 0x63, 0x60, 0xbf, 0x00, 0x23, 0x21, 0x00, 0x33, 0x60, 0x3d, 0x00, 0xa8, 0x4f, 0xa8, 0x47, 0x31, 0x00, 0x31, 0x00, 0x07, 0x00, 0x21, 0x27, 0x00, 0xf1, 0x03, 0x0f, 0x04, 0x2f, 0x04, 0x07, 0x00, 0x01, 0xa9, 0x06, 0x4b, 0x5f, 0x00, 0x20, 0x98, 0x47, 0x05, 0x57, 0x00, 0xe0, 0x8f, 0x03, 0xff, 0x45, 0x3a, 0x00, 0x00, 0x55, 0x5f, 0x00, 0x00, 0xb5, 0xdd, 0xa7, 0x00, 0x1d, 0x0b, 0x00, 0xb5, 0x3a, 0x8f, 0x04, 0x06, 0x7b, 0x00, 0x0d, 0x91, 0x00, 0x0e, 0x4b, 0x01, 0xa9, 0x2b, 0x04, 0xfb, 0x0d, 0x4c, 0x4d, 0x04, 0x01, 0xa8, 0xa0, 0x47, 0x29, 0xea, 0x55, 0x08, 0xa0, 0x4d, 0x08, 0x03, 0x07, 0x00, 0x04, 0x22, 0x29, 0x3b, 0x1d, 0x04, 0x07, 0x00, 0x01, 0xa9, 0x05, 0x55, 0x18, 0x91, 0x04, 0xfc, 0x57, 0x1c, 0x53, 0x14, 0x10, 0xb5, 0x90, 0xb0, 0x01, 0xac, 0xbb, 0x21, 0x00, 0x7d, 0x0c, 0x01, 0x22, 0x3b, 0xab, 0x00, 0xe2, 0xd7, 0x54, 0x00, 0x20, 0x0d, 0x05, 0x03, 0x35, 0x08, 0x10, 0xbd, 0x7c, 0x33, 0x04, 0x2f, 0x14, 0x30, 0xb5, 0x05, 0x00, 0x91, 0x31, 0x20, 0x9b, 0x21, 0x00, 0x61, 0x04, 0x25, 0x74, 0x1d, 0x01, 0x2d, 0x00, 0x11, 0xd3, 0xb0, 0x30, 0x63, 0x10, 0x5f, 0x34, 0x02, 0x2d, 0x08, 0x20, 0x7c, 0xc6, 0x4f, 0x14, 0x70, 0xb5, 0xc7, 0x04, 0xcf, 0x04, 0x5b, 0x0d, 0x15, 0x21, 0xff, 0x0c, 0x4c, 0x69, 0x44, 0x04, 0x22, 0x30, 0x00, 0xff, 0xa0, 0x47, 0x19, 0x21, 0x04, 0x22, 0x69, 0x44, 0xbd, 0x28, 0x09, 0x00, 0x1d, 0x21, 0x30, 0x1d, 0x15, 0x04, 0xa0, 0x5f, 0x47, 0x21, 0x21, 0x28, 0x1d, 0x15, 0x04, 0xa0, 0xc7, 0x30, 0x5a, 0x47, 0x04, 0x11, 0x47, 0x24, 0x20, 0x0f, 0x15, 0x09, 0x68, 0x29, 0x00, 0x37, 0x19, 0x20, 0x29, 0x09, 0x10, 0x1d, 0x20, 0x19, 0x05, 0x09, 0x04, 0xc3, 0x21, 0x20, 0x1b, 0x05, 0x09, 0x04, 0x1b, 0x7d, 0x8f, 0x06, 0x02, 0x4a, 0xef, 0x03, 0x4b, 0xda, 0x60, 0x09, 0x04, 0xfe, 0xe7, 0x04, 0xff, 0x00, 0xfa, 0x05, 0x00, 0xed, 0x00, 0xe0, 0x80, 0xfb, 0x22, 0x02, 0xa3, 0x03, 0x9a, 0x61, 0x70, 0x47, 0xc0, 0xfd, 0x46, 0x7b, 0x06, 0x70, 0xb5, 0x08, 0x4b, 0x08, 0x4c, 0xff, 0x05, 0x00, 0x19, 0x68, 0x05, 0x22, 0x20, 0x00, 0xfd, 0x07, 0x4f, 0x00, 0x05, 0x23, 0x06, 0x49, 0x28, 0x00, 0xff, 0x0b, 0x80, 0x06, 0x4b, 0x4c, 0x60, 0x98, 0x47, 0x4a, 0x5b, 0x04, 0x20, 0x83, 0x02, 0x34, 0x03, 0x00, 0x5f, 0x04, 0x24, 0x07, 0x00, 0xff, 0x25, 0x31, 0x00, 0x00, 0x05, 0x23, 0x10, 0xb5, 0xff, 0x03, 0x49, 0x0b, 0x80, 0x03, 0x4b, 0x4b, 0x60, 0x68, 0x6b, 0x09, 0x27, 0x00, 0x1b, 0x04, 0x2c, 0x03, 0x00, 0xfd, 0x30, 0x3b, 0x05, 0xff, 0x23, 0x4b, 0x5a, 0x68, 0x13, 0x78, 0x0a, 0x2b, 0xff, 0x05, 0xd8, 0x21, 0x49, 0x9b, 0x00, 0xcb, 0x58, 0xc7, 0x9f, 0x46, 0x20, 0x27, 0x08, 0x05, 0x04, 0x03, 0x04, 0x50, 0x78, 0x5d, 0x43, 0xe9, 0x03, 0xf6, 0xdd, 0x1e, 0x0b, 0x00, 0x1c, 0x03, 0x00, 0xfd, 0x1d, 0x03, 0x00, 0xef, 0xe7, 0x91, 0x78, 0x50, 0x78, 0x7d, 0x1b, 0x09, 0x00, 0xea, 0xe7, 0x50, 0x78, 0x1a, 0x07, 0x00, 0xf3, 0xe6, 0xe7, 0x73, 0x0f, 0x85, 0x07, 0x17, 0x49, 0xd2, 0x05, 0x5f, 0x0b, 0x70, 0x06, 0x33, 0x53, 0x7b, 0x03, 0x06, 0x7b, 0x03, 0x57, 0x05, 0x3b, 0x0b, 0x7d, 0x2b, 0xd0, 0x33, 0x00, 0x0f, 0x33, 0x00, 0xf7, 0xcc, 0xe7, 0x93, 0x45, 0x04, 0x02, 0x18, 0x43, 0xc7, 0xdb, 0xd0, 0x0c, 0x0f, 0x00, 0xc4, 0xe7, 0x9b, 0x0c, 0xd0, 0x61, 0xef, 0x00, 0x00, 0x89, 0x3e, 0x03, 0x00, 0x43, 0x00, 0x00, 0x5f, 0xa5, 0x44, 0x00, 0x00, 0xb9, 0x07, 0x00, 0x4d, 0x0f, 0x00, 0x9f, 0x4d, 0x3d, 0x00, 0x00, 0xc5, 0x07, 0x00, 0x2b, 0x07, 0x09, 0xdf, 0x3f, 0x00, 0x00, 0xd5, 0x3e, 0x9b, 0x05, 0x8a, 0xb0, 0xff, 0x00, 0x23, 0x6a, 0x46, 0x13, 0x70, 0x80, 0x22, 0xff, 0x92, 0x03, 0x01, 0x92, 0x23, 0x4a, 0x69, 0x46, 0xfb, 0x02, 0x92, 0x0f, 0x00, 0x74, 0x53, 0x74, 0x13, 0x76, 0xff, 0x53, 0x76, 0x93, 0x76, 0x24, 0x22, 0x8b, 0x54, 0xfb, 0x01, 0x32, 0x03, 0x04, 0x03, 0x93, 0x05, 0x93, 0x07, 0x9f, 0x93, 0x08, 0x93, 0x8b, 0x54, 0xb9, 0x04, 0xd5, 0x04, 0x2a, 0xff, 0xdd, 0x80, 0xb2, 0x6b, 0x46, 0x6a, 0x46, 0x98, 0xff, 0x81, 0x00, 0x23, 0x53, 0x81, 0x16, 0x4b, 0x01, 0xff, 0x24, 0x07, 0x93, 0x16, 0x4b, 0x16, 0x4e, 0x08, 0xff, 0x93, 0x02, 0x23, 0x16, 0x49, 0x53, 0x76, 0x30, 0xff, 0x00, 0x15, 0x4b, 0x94, 0x76, 0x98, 0x47, 0x35, 0xff, 0x68, 0x14, 0x4b, 0x28, 0x00, 0x98, 0x47, 0x1f, 0xff, 0x23, 0x18, 0x40, 0x84, 0x40, 0x03, 0x22, 0x12, 0xff, 0x4b, 0x1c, 0x60, 0x31, 0x68, 0xcb, 0x69, 0x1a, 0xff, 0x42, 0xfc, 0xd1, 0x02, 0x22, 0x2b, 0x68, 0x13, 0xef, 0x43, 0x2b, 0x60, 0x0e, 0x53, 0x00, 0x0e, 0x4b, 0x18, 0xdb, 0x60, 0x0a, 0xe7, 0x01, 0x13, 0x20, 0xcf, 0x04, 0x13, 0x20, 0x7f, 0xd0, 0xe7, 0xff, 0xff, 0x00, 0x00, 0xe9, 0xbf, 0x00, 0xf7, 0x03, 0x00, 0x16, 0x03, 0x00, 0x17, 0x00, 0x80, 0x11, 0xff, 0x00, 0x20, 0x00, 0x04, 0x00, 0x43, 0x45, 0x2f, 0xff, 0x00, 0x00, 0x75, 0x49, 0x00, 0x00, 0x00, 0xe1, 0x6f, 0x00, 0xe0, 0x45, 0x3e, 0x58, 0x06, 0x00, 0x20, 0xe7, 0x04, 0xff, 0xf8, 0xb5, 0x14, 0x4c, 0x25, 0x25, 0x14, 0x4e, 0x7f, 0x20, 0x00, 0x02, 0x22, 0x13, 0x49, 0xb0, 0x65, 0x03, 0xff, 0x02, 0x27, 0x63, 0x5d, 0x20, 0x00, 0x13, 0x43, 0xff, 0x63, 0x55, 0x23, 0x68, 0x01, 0x3a, 0x9f, 0x75, 0xad, 0x0f, 0x15, 0x00, 0x08, 0x22, 0x13, 0x1c, 0x07, 0x13, 0x00, 0x0b, 0xfa, 0x13, 0x00, 0x02, 0x13, 0x00, 0x0a, 0x49, 0x13, 0x43, 0x20, 0xbf, 0x00, 0x00, 0x22, 0x63, 0x55, 0xb0, 0x67, 0x03, 0x63, 0xad, 0x5d, 0x21, 0x04, 0xf8, 0xbd, 0x73, 0x04, 0xe1, 0xeb, 0x01, 0xcd, 0xbe, 0x4b, 0x01, 0x05, 0x45, 0x00, 0x00, 0x25, 0x03, 0x00, 0xbd, 0xfd, 0x44, 0x67, 0x07, 0x0e, 0x4c, 0x83, 0xb0, 0x23, 0x78, 0xff, 0x05, 0x00, 0x00, 0x2b, 0x06, 0xd0, 0x00, 0x29, 0xff, 0x04, 0xd1, 0x63, 0x78, 0x83, 0x42, 0x0f, 0xd0, 0xff, 0x1d, 0x20, 0x0b, 0xe0, 0x01, 0xa9, 0x11, 0x20, 0x6f, 0x07, 0x4b, 0x0d, 0x70, 0x6f, 0x03, 0x20, 0x06, 0xcb, 0x00, 0xff, 0x01, 0x23, 0x00, 0x20, 0x65, 0x70, 0x23, 0x70, 0x7d, 0x03, 0x7d, 0x03, 0x00, 0x20, 0xfb, 0xe7, 0x3c, 0xaf, 0x00, 0xf3, 0x7d, 0x50, 0x47, 0x00, 0x03, 0x00, 0x3a, 0x4b, 0x98, 0x42, 0xdf, 0x44, 0xd0, 0x0a, 0xd9, 0x39, 0x07, 0x00, 0x18, 0xd0, 0xee, 0x05, 0x04, 0x33, 0xd0, 0x38, 0x05, 0x00, 0x1c, 0xd0, 0x00, 0xff, 0x20, 0x70, 0x47, 0x84, 0x23, 0xdb, 0x05, 0x98, 0xef, 0x42, 0x20, 0xd0, 0x35, 0x11, 0x00, 0xf6, 0xd1, 0x01, 0xfb, 0x29, 0x43, 0x69, 0x00, 0x3f, 0xd0, 0x02, 0x29, 0x3b, 0xff, 0xd0, 0x03, 0x29, 0xee, 0xd1, 0x30, 0x48, 0xed, 0xaf, 0xe7, 0x01, 0x29, 0x31, 0x13, 0x00, 0x2d, 0x13, 0x00, 0x2f, 0xbe, 0x13, 0x00, 0xe4, 0xd1, 0x2c, 0x48, 0xe3, 0x13, 0x00, 0x3f, 0xea, 0x13, 0x00, 0x3b, 0x13, 0x00, 0x37, 0x13, 0x00, 0xda, 0xd1, 0x28, 0xab, 0x48, 0xd9, 0x13, 0x00, 0x3d, 0x13, 0x00, 0x39, 0x13, 0x00, 0x2b, 0xbe, 0x13, 0x00, 0xd0, 0xd1, 0x24, 0x48, 0xcf, 0x13, 0x00, 0x23, 0xea, 0x13, 0x00, 0x1f, 0x13, 0x00, 0x1b, 0x13, 0x00, 0xc6, 0xd1, 0x20, 0xab, 0x48, 0xc5, 0x13, 0x00, 0x25, 0x13, 0x00, 0x21, 0x13, 0x00, 0x0f, 0xfe, 0x13, 0x00, 0xbc, 0xd1, 0x1c, 0x48, 0xbb, 0xe7, 0x1c, 0xab, 0x48, 0xb9, 0x03, 0x00, 0xb7, 0x03, 0x00, 0xb5, 0x03, 0x00, 0xb3, 0xff, 0xe7, 0x03, 0x20, 0xb1, 0xe7, 0x1b, 0x48, 0xaf, 0xaa, 0x03, 0x00, 0xad, 0x03, 0x00, 0xab, 0x03, 0x00, 0xa9, 0x03, 0x00, 0xa7, 0xaa, 0x03, 0x00, 0xa5, 0x03, 0x00, 0xa3, 0x03, 0x00, 0xa1, 0x03, 0x00, 0x9f, 0xaa, 0x03, 0x00, 0x9d, 0x03, 0x00, 0x9b, 0x03, 0x00, 0x99, 0x03, 0x00, 0x97, 0x7f, 0xe7, 0x00, 0x08, 0x00, 0x42, 0x00, 0x10, 0x03, 0x00, 0xf6, 0xc3, 0x01, 0x00, 0x0c, 0x07, 0x08, 0x42, 0x03, 0x00, 0x1f, 0xaa, 0xdb, 0x01, 0x0f, 0x03, 0x00, 0x13, 0x03, 0x00, 0x07, 0x03, 0x00, 0x19, 0xaa, 0x03, 0x00, 0x0b, 0x03, 0x00, 0x0c, 0x03, 0x00, 0x0d, 0x03, 0x00, 0x0e, 0xaa, 0x03, 0x00, 0x1e, 0x03, 0x00, 0x01, 0x03, 0x00, 0x0a, 0x03, 0x00, 0x18, 0xae, 0x0f, 0x1a, 0x03, 0x00, 0x06, 0x03, 0x00, 0x12, 0x03, 0x00, 0x10, 0xaa, 0x03, 0x00, 0x11, 0x03, 0x00, 0x08, 0x03, 0x00, 0x09, 0x03, 0x00, 0x04, 0xfa, 0x03, 0x00, 0x05, 0xdf, 0x02, 0x86, 0xb0, 0x01, 0x00, 0x68, 0x7f, 0x46, 0x15, 0x4b, 0x70, 0xcb, 0x70, 0xc0, 0x03, 0x04, 0x7f, 0x00, 0x9b, 0x8b, 0x42, 0x11, 0xd0, 0x01, 0x05, 0x08, 0xd5, 0x02, 0x05, 0x08, 0x03, 0x05, 0x08, 0x04, 0x05, 0x08, 0x05, 0x9b, 0x7f, 0x00, 0x20, 0x8b, 0x42, 0x10, 0xd0, 0x06, 0x85, 0x02, 0x7f, 0x00, 0x20, 0xc0, 0xb2, 0xfa, 0xe7, 0x01, 0x05, 0x00, 0xd7, 0xf7, 0xe7, 0x02, 0x05, 0x00, 0xf4, 0xf5, 0x00, 0xc0, 0xb2, 0xf7, 0xf1, 0xe7, 0x04, 0x05, 0x00, 0xee, 0xe7, 0x05, 0x30, 0xdf, 0xc0, 0xb2, 0xeb, 0xe7, 0xfc, 0x6b, 0x03, 0x70, 0x47, 0xff, 0xc0, 0x46, 0xf8, 0xb5, 0x0c, 0x4e, 0x05, 0x00, 0xff, 0x33, 0x78, 0x0f, 0x00, 0x0b, 0x4c, 0x00, 0x2b, 0xff, 0x0d, 0xd1, 0x0a, 0x4b, 0x18, 0x22, 0x23, 0x60, 0xff, 0x63, 0x60, 0xa3, 0x60, 0xe3, 0x60, 0x23, 0x61, 0xff, 0x63, 0x61, 0x00, 0x21, 0x07, 0x4b, 0x07, 0x48, 0xfe, 0x07, 0x06, 0x33, 0x70, 0xad, 0x00, 0x67, 0x51, 0xf8, 0xaf, 0xbd, 0xc0, 0x46, 0x3e, 0x03, 0x02, 0x40, 0x03, 0x00, 0x29, 0xbe, 0xc7, 0x02, 0x67, 0x5f, 0x00, 0x00, 0xb4, 0xdb, 0x06, 0xb5, 0xff, 0x83, 0xb0, 0x6a, 0x46, 0x08, 0x23, 0x13, 0x70, 0x5d, 0x01, 0xff, 0x03, 0x01, 0x33, 0x93, 0x03, 0x00, 0xd3, 0x03, 0x00, 0xdb, 0x13, 0x71, 0x0f, 0x00, 0x71, 0x03, 0x49, 0x02, 0x6b, 0x46, 0xdf, 0x18, 0x56, 0x03, 0xb0, 0x00, 0x3f, 0x00, 0xc5, 0x48, 0xff, 0x00, 0x00, 0x10, 0xb5, 0x02, 0x4b, 0x00, 0x20, 0x3f, 0x1b, 0x68, 0x98, 0x47, 0x10, 0xbd, 0x4b, 0x04, 0x0f, 0x04, 0x77, 0x01, 0x20, 0x5b, 0x0f, 0x28, 0x02, 0x20, 0x9b, 0x0f, 0x28, 0xf7, 0x03, 0x20, 0xdb, 0x0f, 0x28, 0x04, 0x20, 0x1b, 0x69, 0x6e, 0x0f, 0x24, 0x05, 0x20, 0x5b, 0x0f, 0x18, 0x00, 0x23, 0x91, 0x04, 0xdf, 0x01, 0xa8, 0x03, 0x70, 0x09, 0x7b, 0x00, 0x40, 0x21, 0xff, 0x08, 0x4a, 0x13, 0x6a, 0x0b, 0x43, 0x13, 0x62, 0xff, 0x07, 0x4b, 0x3f, 0x39, 0x1a, 0x78, 0x0a, 0x43, 0x3f, 0x1a, 0x70, 0x1a, 0x78, 0x01, 0x31, 0x07, 0x04, 0x93, 0x0c, 0xbb, 0x6d, 0x4d, 0x93, 0x03, 0x04, 0x00, 0x40, 0xa2, 0x01, 0x43, 0xff, 0x00, 0x23, 0x80, 0x22, 0x03, 0x73, 0x43, 0x73, 0xff, 0x83, 0x73, 0xc3, 0x73, 0x03, 0x74, 0x43, 0x74, 0xff, 0x83, 0x74, 0x43, 0x60, 0x02, 0x4b, 0x92, 0x03, 0x4f, 0x02, 0x60, 0x83, 0x60, 0x33, 0x05, 0x23, 0x00, 0x40, 0x23, 0xfc, 0xfe, 0x23, 0x0c, 0x03, 0x7b, 0x00, 0x2b, 0x28, 0xd1, 0x80, 0xbf, 0x22, 0x00, 0x21, 0x92, 0x00, 0x43, 0x0b, 0x00, 0x00, 0xef, 0xd1, 0x0a, 0x00, 0x83, 0x07, 0x00, 0x02, 0xd0, 0x80, 0xbf, 0x23, 0x5b, 0x00, 0x1a, 0x43, 0xc3, 0x0b, 0x00, 0x01, 0x5e, 0x0b, 0x00, 0x1a, 0x43, 0x03, 0x7c, 0x09, 0x04, 0x40, 0x09, 0x00, 0xf5, 0x83, 0x09, 0x08, 0x04, 0x09, 0x00, 0x41, 0x68, 0x03, 0x68, 0xef, 0x0b, 0x43, 0x41, 0x89, 0x03, 0x00, 0x7c, 0x0b, 0x43, 0x7d, 0x01, 0x07, 0x00, 0x13, 0x43, 0x04, 0x4a, 0x53, 0x5d, 0x04, 0xff, 0x22, 0x80, 0x21, 0xd2, 0x00, 0xc9, 0x00, 0xd4, 0x25, 0xe7, 0x67, 0x08, 0x43, 0x67, 0xfc, 0x67, 0x3c, 0x93, 0x67, 0xfc, 0x67, 0x88, 0xfd, 0xd3, 0x67, 0x40, 0x00, 0x28, 0x08, 0xd0, 0x01, 0x28, 0xff, 0x0c, 0xd0, 0x02, 0x28, 0x03, 0xd1, 0x08, 0x4a, 0xdf, 0xd3, 0x68, 0x18, 0x43, 0xd0, 0x25, 0x00, 0x02, 0x21, 0xf7, 0x05, 0x4a, 0x53, 0x41, 0x00, 0x53, 0x60, 0xf8, 0xe7, 0xdf, 0x02, 0x21, 0x02, 0x4a, 0x93, 0x0b, 0x00, 0x93, 0x60, 0xed, 0xf2, 0x9b, 0x14, 0x1e, 0x09, 0x33, 0x08, 0x00, 0x20, 0x02, 0xff, 0x2b, 0x03, 0xd1, 0x07, 0x4b, 0x98, 0x78, 0x40, 0xbf, 0x07, 0xc0, 0x0f, 0x70, 0x47, 0x04, 0x09, 0x00, 0xc0, 0xae, 0x09, 0x00, 0xf9, 0xe7, 0x02, 0x09, 0x00, 0x80, 0x09, 0x00, 0xf4, 0xf1, 0xe7, 0x2f, 0x04, 0xc5, 0x00, 0x43, 0x06, 0xab, 0x1a, 0x70, 0x0a, 0xff, 0x78, 0x5a, 0x70, 0x4a, 0x78, 0x9a, 0x70, 0x8a, 0x3f, 0x78, 0x19, 0x00, 0xda, 0x70, 0x01, 0x51, 0x02, 0x35, 0x06, 0xfb, 0x79, 0x51, 0x43, 0x0f, 0x0b, 0x4b, 0x1a, 0x68, 0x00, 0xff, 0x2a, 0x05, 0xd1, 0xef, 0xf3, 0x10, 0x81, 0x00, 0xff, 0x29, 0x05, 0xd0, 0x08, 0x49, 0x0a, 0x70, 0x1a, 0xef, 0x68, 0x01, 0x32, 0x1a, 0x91, 0x00, 0x72, 0xb6, 0xbf, 0xff, 0xf3, 0x5f, 0x8f, 0x05, 0x4a, 0x11, 0x70, 0x03, 0x5f, 0x4a, 0x01, 0x31, 0x11, 0x70, 0x8b, 0x04, 0x58, 0x9f, 0x02, 0x7d, 0x5c, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x20, 0x08, 0x3b, 0x00, 0xff, 0x01, 0x3a, 0x1a, 0x60, 0x1b, 0x68, 0x00, 0x2b, 0xff, 0x09, 0xd1, 0x06, 0x4b, 0x1b, 0x78, 0x00, 0x2b, 0xff, 0x05, 0xd0, 0x01, 0x22, 0x04, 0x4b, 0x1a, 0x70, 0xde, 0x39, 0x04, 0x62, 0xb6, 0x70, 0x47, 0x2f, 0x24, 0x10, 0xb5, 0xff, 0x08, 0x28, 0x2d, 0xd8, 0x1c, 0x4b, 0x80, 0x00, 0xff, 0x1b, 0x58, 0x9f, 0x46, 0x80, 0x20, 0x00, 0x02, 0xff, 0x10, 0xbd, 0x19, 0x4b, 0x58, 0x69, 0xfb, 0xe7, 0xff, 0x19, 0x4b, 0x18, 0x7d, 0x00, 0x07, 0x80, 0x0f, 0xff, 0x43, 0x1c, 0x17, 0x48, 0x58, 0x43, 0xf3, 0xe7, 0xff, 0x14, 0x4c, 0x00, 0x20, 0x23, 0x68, 0x9b, 0x07, 0xff, 0xee, 0xd5, 0x80, 0x22, 0x12, 0x49, 0x52, 0x00, 0xff, 0xcb, 0x68, 0x13, 0x42, 0xfc, 0xd0, 0x23, 0x68, 0xff, 0x5b, 0x07, 0x0f, 0xd4, 0x10, 0x48, 0xe3, 0xe7, 0xff, 0x0c, 0x4b, 0x18, 0x69, 0xe0, 0xe7, 0x28, 0x23, 0xff, 0x0b, 0x4a, 0x00, 0x20, 0xd3, 0x5c, 0x9b, 0x07, 0xff, 0xda, 0xd5, 0x07, 0x4b, 0xd8, 0x68, 0xd7, 0xe7, 0xdf, 0x00, 0x20, 0xd5, 0xe7, 0x09, 0x9b, 0x03, 0x98, 0x47, 0xff, 0xa3, 0x68, 0x1b, 0x04, 0x1b, 0x0c, 0x58, 0x43, 0x7d, 0xcd, 0xb3, 0x00, 0x14, 0x62, 0x00, 0x00, 0x60, 0x57, 0x07, 0xfd, 0x0c, 0xd7, 0x02, 0x09, 0x3d, 0x00, 0x00, 0x6c, 0xdc, 0xff, 0x02, 0xf5, 0x50, 0x00, 0x00, 0x01, 0x22, 0x00, 0xff, 0x78, 0x04, 0x49, 0x02, 0x40, 0xcb, 0x69, 0x04, 0xff, 0x48, 0xd2, 0x03, 0x03, 0x40, 0x13, 0x43, 0xcb, 0xfd, 0x61, 0xdb, 0x0a, 0x10, 0x00, 0x40, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0xb5, 0x80, 0x22, 0xd6, 0x46, 0x4f, 0xff, 0x46, 0x46, 0x46, 0x1e, 0x21, 0x4d, 0x4b, 0xc0, 0xff, 0xb5, 0x52, 0x00, 0x9a, 0x60, 0x4c, 0x4b, 0xfd, 0xfd, 0x3a, 0x05, 0x00, 0x4a, 0x84, 0xb0, 0x53, 0x68, 0x8b, 0xf7, 0x43, 0x1a, 0x39, 0xaf, 0x05, 0x80, 0x23, 0xdb, 0x05, 0xff, 0x9a, 0x78, 0x02, 0x2a, 0x0a, 0xd0, 0x9a, 0x78, 0xff, 0x52, 0xb2, 0x00, 0x2a, 0x06, 0xdb, 0x01, 0x22, 0xff, 0x9a, 0x71, 0x01, 0x32, 0x9a, 0x70, 0x9a, 0x79, 0xff, 0x00, 0x2a, 0xfc, 0xd0, 0x04, 0x21, 0x41, 0x4a, 0xff, 0x02, 0x26, 0x93, 0x69, 0x01, 0xac, 0x0b, 0x43, 0xff, 0x04, 0x31, 0x8b, 0x43, 0xf8, 0x21, 0xc9, 0x00, 0xff, 0x0b, 0x43, 0x3d, 0x49, 0x00, 0x20, 0x0b, 0x40, 0xff, 0x93, 0x61, 0x93, 0x69, 0x21, 0x00, 0x33, 0x43, 0xff, 0x93, 0x61, 0x01, 0x23, 0x63, 0x60, 0x00, 0x23, 0xff, 0x63, 0x70, 0x23, 0x72, 0x63, 0x72, 0x03, 0x33, 0xff, 0x23, 0x70, 0x36, 0x4b, 0x30, 0x4d, 0x98, 0x46, 0xff, 0x98, 0x47, 0x0c, 0x22, 0x2b, 0x7d, 0xb3, 0x43, 0xff, 0x2b, 0x75, 0x2b, 0x7d, 0x13, 0x43, 0x40, 0x22, 0xbf, 0x13, 0x43, 0x7f, 0x22, 0x13, 0x40, 0x0d, 0x04, 0x7d, 0xfb, 0x3a, 0x13, 0x15, 0x00, 0x0e, 0x32, 0xeb, 0x68, 0x1a, 0xfe, 0x1b, 0x01, 0x00, 0x26, 0x01, 0x27, 0x06, 0x23, 0x21, 0xfe, 0x65, 0x01, 0x99, 0x46, 0x23, 0x70, 0x67, 0x60, 0x66, 0xff, 0x70, 0x26, 0x72, 0x66, 0x72, 0xc0, 0x47, 0x80, 0xdd, 0x22, 0x37, 0x04, 0x2b, 0x75, 0x23, 0xf7, 0x01, 0x4b, 0x46, 0xef, 0x21, 0x00, 0x02, 0x20, 0x1d, 0x0c, 0x66, 0x72, 0x27, 0x7e, 0x1d, 0x00, 0x1f, 0x4b, 0x02, 0x20, 0x9a, 0x46, 0x19, 0x04, 0xff, 0x1d, 0x4d, 0x21, 0x00, 0xaf, 0x71, 0x00, 0x20, 0xef, 0x6f, 0x71, 0x2f, 0x71, 0x3f, 0x24, 0x00, 0x20, 0xd0, 0xfb, 0x47, 0x17, 0x51, 0x09, 0x29, 0x79, 0x16, 0x4b, 0xc9, 0xff, 0xb2, 0x98, 0x47, 0x16, 0x4b, 0x98, 0x42, 0x0d, 0xbf, 0xd8, 0x80, 0x22, 0xd2, 0x05, 0x93, 0xef, 0x01, 0x08, 0xff, 0xd0, 0x93, 0x78, 0x5b, 0xb2, 0x00, 0x2b, 0x04, 0xff, 0xdb, 0x97, 0x71, 0x96, 0x70, 0x93, 0x79, 0x00, 0xfd, 0x2b, 0xef, 0x00, 0xb0, 0x1c, 0xbc, 0x90, 0x46, 0x99, 0x5f, 0x46, 0xa2, 0x46, 0xf0, 0xbd, 0x73, 0x09, 0x14, 0x03, 0x00, 0xf7, 0x40, 0x00, 0x41, 0x57, 0x09, 0xef, 0xff, 0xff, 0x25, 0xe9, 0x4f, 0x7b, 0x01, 0x03, 0x00, 0xd1, 0x03, 0x00, 0x00, 0x04, 0x00, 0xdb, 0x40, 0x11, 0x8b, 0x01, 0x45, 0x54, 0x0b, 0x00, 0x1b, 0xb7, 0x7f, 0x00, 0x40, 0x21, 0x06, 0x4a, 0x53, 0x69, 0x55, 0x01, 0xfe, 0x0f, 0x01, 0x04, 0x4a, 0x3f, 0x39, 0x13, 0x70, 0x13, 0x1f, 0x78, 0x19, 0x42, 0xfc, 0xd1, 0x97, 0x09, 0x2b, 0x00, 0xdb, 0x02, 0xff, 0x40, 0x70, 0xb5, 0x4b, 0x78, 0x04, 0x00, 0x0d, 0xfd, 0x78, 0x99, 0x0f, 0xdb, 0x00, 0x1d, 0x43, 0x4b, 0x7a, 0xfe, 0x0b, 0x0c, 0x1b, 0x01, 0x1d, 0x43, 0x48, 0x68, 0x01, 0xff, 0x28, 0x0f, 0xd9, 0x43, 0x1e, 0x18, 0x42, 0x2f, 0xff, 0xd1, 0x02, 0x28, 0x33, 0xd0, 0x02, 0x23, 0x00, 0xff, 0x22, 0x01, 0x32, 0x5b, 0x00, 0x98, 0x42, 0xfb, 0xe7, 0xd8, 0x12, 0x04, 0xc9, 0x03, 0x23, 0x00, 0x15, 0x43, 0x0b, 0xfa, 0x31, 0x10, 0x9b, 0x0d, 0x00, 0x04, 0x26, 0xa6, 0x40, 0x11, 0xff, 0x49, 0x12, 0x4a, 0x4b, 0x68, 0x13, 0x40, 0x1e, 0xef, 0x42, 0xfb, 0xd1, 0x10, 0x2b, 0x01, 0x0d, 0x4b, 0x80, 0xff, 0x22, 0x9c, 0x46, 0x61, 0x46, 0xa4, 0x00, 0x64, 0xff, 0x44, 0x23, 0x6a, 0x52, 0x00, 0x13, 0x40, 0x1d, 0x5f, 0x43, 0x09, 0x4a, 0x25, 0x62, 0x23, 0x14, 0x08, 0x23, 0x00, 0xff, 0x70, 0xbd, 0x80, 0x23, 0x00, 0x04, 0x9b, 0x00, 0xff, 0x18, 0x43, 0x05, 0x43, 0xd6, 0xe7, 0x00, 0x22, 0xfd, 0xd0, 0xab, 0x0f, 0x40, 0xfc, 0x07, 0x00, 0x00, 0x71, 0xef, 0x4c, 0x00, 0x00, 0xad, 0x03, 0x00, 0x04, 0x22, 0x10, 0xff, 0xb5, 0x82, 0x40, 0x04, 0x00, 0x09, 0x49, 0x0a, 0xbf, 0x48, 0x43, 0x68, 0x0b, 0x40, 0x1a, 0x3b, 0x10, 0x06, 0xff, 0x4b, 0xa0, 0x00, 0x9c, 0x46, 0x80, 0x23, 0x60, 0xff, 0x44, 0x02, 0x6a, 0x5b, 0x00, 0x13, 0x43, 0x03, 0x1d, 0x62, 0xc9, 0x03, 0x47, 0x10, 0xbd, 0x3b, 0x04, 0x43, 0x04, 0x3f, 0x1c, 0x7d, 0xf8, 0x3f, 0x08, 0x12, 0x4e, 0x13, 0x49, 0x73, 0x3f, 0x14, 0xf7, 0x34, 0xa4, 0x00, 0xa3, 0x04, 0xa0, 0x59, 0x10, 0x4b, 0xff, 0x00, 0x07, 0x00, 0x0f, 0x98, 0x47, 0xa5, 0x59, 0xff, 0xa4, 0x59, 0xed, 0x04, 0x0d, 0x4b, 0xed, 0x0f, 0xff, 0x07, 0x00, 0x24, 0x0c, 0x98, 0x47, 0x00, 0x2d, 0xff, 0x03, 0xd0, 0x01, 0x34, 0xe7, 0x40, 0x38, 0x00, 0xff, 0xf8, 0xbd, 0x01, 0x2c, 0xfb, 0xd9, 0x38, 0x00, 0x77, 0x21, 0x00, 0x07, 0x31, 0x00, 0x07, 0x00, 0xf5, 0xa3, 0x30, 0xf9, 0xdd, 0x67, 0x10, 0x7f, 0x05, 0x70, 0xb5, 0x0c, 0x4b, 0x04, 0xbf, 0x00, 0x0e, 0x00, 0x98, 0x47, 0x0b, 0xfd, 0x08, 0x40, 0xf7, 0x21, 0x80, 0x25, 0xff, 0x04, 0xa3, 0x58, 0x8b, 0x43, 0xbf, 0xa3, 0x50, 0x40, 0x3a, 0x63, 0x59, 0x69, 0x02, 0xd1, 0xfd, 0x05, 0x47, 0x00, 0x0f, 0x23, 0x32, 0x78, 0x13, 0x40, 0x8f, 0x63, 0x51, 0x70, 0xbd, 0x43, 0x04, 0x4f, 0x04, 0x43, 0x04, 0x10, 0xbb, 0xb5, 0x0a, 0x3f, 0x00, 0x98, 0x47, 0x09, 0x3d, 0x10, 0xa0, 0xff, 0x00, 0x60, 0x44, 0x83, 0x58, 0x0b, 0x43, 0x83, 0x7f, 0x50, 0x40, 0x31, 0x40, 0x3a, 0x43, 0x58, 0xa7, 0x06, 0xed, 0x03, 0xe5, 0x08, 0xc0, 0x46, 0x37, 0x24, 0xf0, 0xb5, 0xc6, 0xff, 0x46, 0x04, 0x00, 0x00, 0xb5, 0x18, 0x4e, 0x19, 0xff, 0x4d, 0x20, 0x34, 0xb0, 0x47, 0xa4, 0x00, 0x18, 0xff, 0x4f, 0x64, 0x59, 0xb8, 0x47, 0x04, 0x22, 0x24, 0xff, 0x07, 0x24, 0x0f, 0xa2, 0x40, 0x15, 0x49, 0x6b, 0xbe, 0xf9, 0x20, 0xb0, 0x47, 0x60, 0x59, 0x12, 0xf7, 0x10, 0x66, 0xff, 0x59, 0x64, 0x59, 0xf6, 0x04, 0xf6, 0x0f, 0x80, 0xff, 0x46, 0x24, 0x0c, 0xb8, 0x47, 0x00, 0x2e, 0x07, 0xff, 0xd0, 0x43, 0x46, 0x01, 0x34, 0xe3, 0x40, 0x98, 0xaf, 0x46, 0x40, 0x46, 0x04, 0x83, 0x02, 0xf0, 0xfd, 0x00, 0xf9, 0xeb, 0xd9, 0x40, 0xf7, 0x02, 0x06, 0x77, 0x00, 0x80, 0x46, 0xf3, 0xe9, 0xe7, 0x77, 0x24, 0x03, 0x05, 0xdd, 0xfb, 0x18, 0xc2, 0x09, 0x00, 0xff, 0x23, 0x00, 0x2a, 0x04, 0xd1, 0x2f, 0x4a, 0x43, 0xff, 0x09, 0x94, 0x46, 0xdb, 0x01, 0x63, 0x44, 0x1f, 0xff, 0x22, 0x10, 0x40, 0x1e, 0x3a, 0x82, 0x40, 0xc8, 0xff, 0x78, 0x00, 0x28, 0x31, 0xd1, 0x08, 0x78, 0x80, 0xff, 0x28, 0x47, 0xd0, 0x80, 0x24, 0x00, 0x06, 0x64, 0xff, 0x02, 0x20, 0x43, 0x4c, 0x78, 0x02, 0x25, 0x26, 0xff, 0x00, 0xae, 0x43, 0x07, 0xd1, 0x8c, 0x78, 0x00, 0xbf, 0x2c, 0x37, 0xd1, 0x80, 0x24, 0xa4, 0x15, 0x00, 0x5a, 0xff, 0x60, 0x4c, 0x78, 0x01, 0x3c, 0x01, 0x2c, 0x35, 0xff, 0xd9, 0xa0, 0x24, 0x15, 0x04, 0x2d, 0x0c, 0xe4, 0xff, 0x05, 0x2c, 0x43, 0x04, 0x43, 0x9c, 0x62, 0xd0, 0x5f, 0x24, 0x15, 0x0c, 0x24, 0x06, 0x0b, 0x0c, 0xcc, 0x2f, 0x00, 0xff, 0x09, 0xd1, 0x40, 0x03, 0x03, 0xd5, 0x88, 0x78, 0xff, 0x01, 0x28, 0x23, 0xd0, 0x5a, 0x61, 0x49, 0x78, 0xff, 0x01, 0x39, 0x01, 0x29, 0x13, 0xd9, 0x70, 0xbd, 0xff, 0xa0, 0x20, 0x14, 0x04, 0x24, 0x0c, 0xc0, 0x05, 0xfe, 0x49, 0x04, 0x98, 0x62, 0xd0, 0x20, 0x14, 0x0c, 0x00, 0xdf, 0x06, 0x20, 0x43, 0x98, 0x62, 0x81, 0x04, 0xef, 0xd1, 0xfe, 0x27, 0x0c, 0xeb, 0xd8, 0x9a, 0x60, 0xe9, 0xe7, 0xc0, 0xfb, 0x24, 0xe4, 0x6f, 0x00, 0xc6, 0xe7, 0x00, 0x20, 0xb9, 0xff, 0xe7, 0x03, 0x4c, 0x20, 0x40, 0xc6, 0xe7, 0x9a, 0xeb, 0x61, 0xda, 0xdb, 0x05, 0x28, 0x63, 0x03, 0xff, 0xfb, 0xff, 0xe6, 0x2f, 0x07, 0x10, 0xb5, 0xab, 0x05, 0x03, 0x34, 0x10, 0xbd, 0x8d, 0x6f, 0x4d, 0x00, 0x00, 0x6d, 0xf7, 0x00, 0x49, 0x52, 0x03, 0x1c, 0xfd, 0xfe, 0x3b, 0x00, 0x14, 0x49, 0x15, 0x48, 0x10, 0xb5, 0xdf, 0x81, 0x42, 0x09, 0xd0, 0x14, 0xe3, 0x03, 0x06, 0xd2, 0xff, 0xc2, 0x43, 0xd2, 0x18, 0x92, 0x08, 0x01, 0x32, 0xb7, 0x92, 0x00, 0x11, 0x37, 0x00, 0x11, 0x48, 0x05, 0x00, 0x42, 0xdd, 0x07, 0x15, 0x20, 0x00, 0x21, 0x0e, 0x17, 0x00, 0xff, 0x21, 0xff, 0x0d, 0x4b, 0x0e, 0x4a, 0x8b, 0x43, 0x93, 0x60, 0xbf, 0x0d, 0x4a, 0x7f, 0x39, 0x53, 0x68, 0xbb, 0x03, 0x60, 0xf9, 0x0c, 0x17, 0x00, 0x03, 0x04, 0xfe, 0xe7, 0x18, 0x63, 0x00, 0x36, 0x00, 0x04, 0x20, 0x10, 0x03, 0x00, 0x55, 0x5f, 0x23, 0x02, 0x07, 0x00, 0x3f, 0xd4, 0x11, 0x00, 0x20, 0x67, 0x5f, 0x15, 0x04, 0x03, 0x00, 0xb7, 0xed, 0x00, 0xe0, 0xd5, 0x03, 0x41, 0x0d, 0x0f, 0x00, 0x01, 0xdf, 0x53, 0x00, 0x00, 0x30, 0xb5, 0x61, 0x01, 0x25, 0xe4, 0xff, 0x05, 0x2b, 0x4b, 0x83, 0xb0, 0x25, 0x70, 0x98, 0xff, 0x47, 0x02, 0x21, 0x2a, 0x4a, 0x13, 0x69, 0x8b, 0xff, 0x43, 0x13, 0x61, 0xb1, 0x23, 0x23, 0x81, 0xa3, 0xfe, 0xf3, 0x03, 0x3e, 0xd1, 0x01, 0x21, 0x26, 0x4c, 0x21, 0xff, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0x00, 0xff, 0x22, 0x24, 0x4b, 0x1a, 0x70, 0x5a, 0x70, 0x9a, 0xff, 0x70, 0xda, 0x70, 0x19, 0x71, 0xef, 0xf3, 0x10, 0xff, 0x80, 0x45, 0x42, 0x68, 0x41, 0x01, 0x90, 0x72, 0xfd, 0xb6, 0x1f, 0x04, 0x22, 0x70, 0x1a, 0x79, 0x01, 0x98, 0xff, 0x01, 0x32, 0x1a, 0x71, 0x00, 0x28, 0x03, 0xd0, 0xf2, 0x33, 0x14, 0x18, 0x99, 0x00, 0x03, 0x34, 0x80, 0x22, 0x00, 0x25, 0xbf, 0x04, 0x20, 0x01, 0x21, 0xd2, 0x05, 0x39, 0x0c, 0x25, 0xff, 0x70, 0x50, 0x70, 0x53, 0x78, 0x04, 0x2b, 0xfc, 0xfd, 0xd1, 0x35, 0x14, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0xff, 0xef, 0xe7, 0xa3, 0x78, 0x5b, 0xb2, 0x00, 0x2b, 0xff, 0xbc, 0xdb, 0x01, 0x23, 0xa3, 0x71, 0xa5, 0x70, 0xff, 0xa3, 0x79, 0x00, 0x2b, 0xfc, 0xd0, 0xb5, 0xe7, 0x7d, 0x4d, 0x43, 0x01, 0x00, 0x14, 0x00, 0x40, 0x0e, 0xd5, 0x00, 0xfd, 0xcc, 0xdf, 0x00, 0x85, 0x42, 0x00, 0x00, 0xe5, 0x45, 0xfe, 0xd4, 0x02, 0x46, 0x00, 0x00, 0x19, 0x3c, 0x00, 0x00, 0xff, 0xd5, 0x3f, 0x00, 0x00, 0xff, 0x22, 0x43, 0x00, 0xff, 0x5b, 0x08, 0x01, 0x20, 0xd2, 0x05, 0x93, 0x42, 0xef, 0x00, 0xdc, 0x00, 0x20, 0xa3, 0x05, 0x42, 0x00, 0x12, 0xfb, 0x0e, 0x11, 0x39, 0x03, 0x01, 0x24, 0xc3, 0x17, 0x7f, 0xff, 0x39, 0x23, 0x43, 0x1e, 0x29, 0x0e, 0xdc, 0x00, 0xff, 0x29, 0x18, 0xdb, 0x80, 0x24, 0x40, 0x02, 0x40, 0xff, 0x0a, 0x24, 0x04, 0x04, 0x43, 0x16, 0x29, 0x09, 0xff, 0xdd, 0x20, 0x00, 0x96, 0x3a, 0x90, 0x40, 0x43, 0xff, 0x43, 0x18, 0x00, 0x10, 0xbd, 0x00, 0xf0, 0x9f, 0xff, 0xfc, 0x03, 0x00, 0xf9, 0xe7, 0x80, 0x20, 0xc0, 0xff, 0x03, 0x08, 0x41, 0x17, 0x22, 0x00, 0x19, 0x51, 0xff, 0x1a, 0xc8, 0x40, 0xf0, 0xe7, 0x4a, 0x1c, 0xef, 0xef, 0xd0, 0x00, 0x23, 0xed, 0x03, 0x06, 0x22, 0x43, 0x08, 0xff, 0x8b, 0x42, 0x74, 0xd3, 0x03, 0x09, 0x8b, 0x42, 0xff, 0x5f, 0xd3, 0x03, 0x0a, 0x8b, 0x42, 0x44, 0xd3, 0xff, 0x03, 0x0b, 0x8b, 0x42, 0x28, 0xd3, 0x03, 0x0c, 0xff, 0x8b, 0x42, 0x0d, 0xd3, 0xff, 0x22, 0x09, 0x02, 0xfb, 0x12, 0xba, 0x0b, 0x04, 0x02, 0xd3, 0x12, 0x12, 0x09, 0xf7, 0x02, 0x65, 0xd0, 0x1d, 0x04, 0x19, 0xd3, 0x00, 0xe0, 0xf7, 0x09, 0x0a, 0xc3, 0x09, 0x00, 0x01, 0xd3, 0xcb, 0x03, 0x5f, 0xc0, 0x1a, 0x52, 0x41, 0x83, 0x0b, 0x08, 0x8b, 0x0b, 0x08, 0x55, 0x43, 0x0b, 0x08, 0x4b, 0x0b, 0x08, 0x03, 0x0b, 0x08, 0x0b, 0x0b, 0x08, 0x4b, 0xc3, 0x0a, 0x2f, 0x08, 0x02, 0x2f, 0x08, 0x0b, 0x08, 0x8b, 0x0b, 0x08, 0x55, 0x43, 0x0b, 0x08, 0x4b, 0x0b, 0x08, 0x03, 0x0b, 0x08, 0x0b, 0x0b, 0x08, 0x2f, 0xcd, 0xd2, 0xc3, 0x09, 0x31, 0x08, 0x01, 0x31, 0x08, 0x0b, 0x08, 0x55, 0x8b, 0x0b, 0x08, 0x43, 0x0b, 0x08, 0x4b, 0x0b, 0x08, 0x03, 0x0b, 0x08, 0x2d, 0x0b, 0x0b, 0x08, 0xc3, 0x08, 0x2f, 0x08, 0x00, 0x2f, 0x08, 0x0b, 0x08, 0xd5, 0x8b, 0x0b, 0x08, 0x43, 0x0b, 0x08, 0x4b, 0x0b, 0x08, 0x41, 0x1a, 0xff, 0x00, 0xd2, 0x01, 0x46, 0x52, 0x41, 0x10, 0x46, 0xbf, 0x70, 0x47, 0xff, 0xe7, 0x01, 0xb5, 0x59, 0x02, 0xf0, 0xef, 0x06, 0xf8, 0x02, 0xbd, 0x0b, 0x01, 0x29, 0xf7, 0xd0, 0xef, 0x76, 0xe7, 0x70, 0x47, 0x6b, 0x05, 0xf0, 0xb5, 0x57, 0xff, 0x46, 0x4e, 0x46, 0xde, 0x46, 0x45, 0x46, 0xe0, 0xff, 0xb5, 0x44, 0x02, 0x43, 0x00, 0xc6, 0x0f, 0x83, 0xff, 0xb0, 0x0f, 0x1c, 0x64, 0x0a, 0x1b, 0x0e, 0xb2, 0xff, 0x46, 0x53, 0xd0, 0xff, 0x2b, 0x27, 0xd0, 0x80, 0xff, 0x22, 0xe4, 0x00, 0xd2, 0x04, 0x14, 0x43, 0x7f, 0xff, 0x22, 0x52, 0x42, 0x90, 0x46, 0x98, 0x44, 0x00, 0xff, 0x23, 0x99, 0x46, 0x9b, 0x46, 0x7d, 0x02, 0x78, 0xff, 0x00, 0xfb, 0x0f, 0x6d, 0x0a, 0x00, 0x0e, 0x00, 0xff, 0x93, 0x24, 0xd0, 0xff, 0x28, 0x46, 0xd0, 0x80, 0xff, 0x23, 0x00, 0x21, 0xed, 0x00, 0xdb, 0x04, 0x1d, 0xff, 0x43, 0x7f, 0x38, 0x47, 0x46, 0x38, 0x1a, 0x4f, 0xff, 0x46, 0x0f, 0x43, 0xbf, 0x00, 0xb9, 0x46, 0x33, 0xff, 0x00, 0x00, 0x9a, 0x87, 0x4f, 0x53, 0x40, 0x4a, 0xff, 0x46, 0xba, 0x58, 0x01, 0x93, 0x97, 0x46, 0x00, 0xef, 0x2c, 0x4e, 0xd1, 0x08, 0x43, 0x00, 0xf7, 0x33, 0x98, 0xf7, 0x46, 0xfd, 0x3b, 0x49, 0x2c, 0xda, 0xd1, 0x00, 0x2d, 0xa7, 0x26, 0xd1, 0x00, 0x73, 0x02, 0x35, 0x04, 0x7a, 0x35, 0x00, 0x42, 0xff, 0x46, 0x10, 0x1a, 0x4a, 0x46, 0x0a, 0x43, 0x92, 0xdf, 0x00, 0xba, 0x58, 0x1d, 0x00, 0x3d, 0x00, 0x9b, 0x2c, 0xff, 0x00, 0x9a, 0x46, 0x8b, 0x46, 0x5b, 0x46, 0x02, 0xff, 0x2b, 0x31, 0xd1, 0x53, 0x46, 0xff, 0x21, 0x00, 0xff, 0x24, 0x38, 0xe0, 0x00, 0x2c, 0x17, 0xd1, 0x04, 0xfe, 0x53, 0x00, 0x00, 0x23, 0x98, 0x46, 0x01, 0x33, 0x9b, 0xff, 0x46, 0xaf, 0xe7, 0xff, 0x20, 0x00, 0x2d, 0x0b, 0xff, 0xd1, 0x02, 0x21, 0xda, 0xe7, 0x28, 0x00, 0x00, 0xff, 0xf0, 0x46, 0xfc, 0x43, 0x1f, 0x9d, 0x40, 0x76, 0xff, 0x23, 0x5b, 0x42, 0x18, 0x1a, 0x00, 0x21, 0xaf, 0xdf, 0xe7, 0x03, 0x21, 0xad, 0xe7, 0x68, 0x03, 0xf0, 0x3a, 0x7a, 0x17, 0x00, 0x9c, 0x17, 0x08, 0x1b, 0x1a, 0x98, 0x46, 0xd9, 0x0c, 0x57, 0x91, 0xe7, 0x0c, 0x07, 0x00, 0xf3, 0x9d, 0x00, 0xfc, 0x9d, 0x00, 0xff, 0x8a, 0xe7, 0x03, 0x2b, 0x00, 0xd1, 0xa5, 0xe0, 0xff, 0x55, 0x46, 0x01, 0x2b, 0x00, 0xd0, 0x81, 0xe0, 0xfd, 0x01, 0xe5, 0x00, 0x00, 0x24, 0x2b, 0x40, 0x64, 0x02, 0xff, 0xc9, 0x05, 0x60, 0x0a, 0xdb, 0x07, 0x08, 0x43, 0xff, 0x18, 0x43, 0x03, 0xb0, 0x3c, 0xbc, 0x90, 0x46, 0xff, 0x99, 0x46, 0xa2, 0x46, 0xab, 0x46, 0xf0, 0xbd, 0xfe, 0xab, 0x03, 0x23, 0xe4, 0x03, 0xff, 0x21, 0xed, 0xe7, 0xfe, 0x9b, 0x04, 0xea, 0xe7, 0x01, 0x23, 0x59, 0x1a, 0x1b, 0x7f, 0x29, 0x66, 0xdd, 0x01, 0x9a, 0x13, 0x40, 0x3b, 0x04, 0xff, 0xe1, 0xe7, 0x80, 0x23, 0xdb, 0x03, 0x1c, 0x42, 0xff, 0x38, 0xd0, 0x1d, 0x42, 0x51, 0xd0, 0x1c, 0x43, 0xff, 0x64, 0x02, 0x64, 0x0a, 0x33, 0x00, 0xff, 0x21, 0xff, 0xd5, 0xe7, 0x63, 0x01, 0x6c, 0x01, 0xa3, 0x42, 0xff, 0x3b, 0xd2, 0x1b, 0x26, 0x00, 0x21, 0x01, 0x38, 0xff, 0x01, 0x25, 0x1f, 0x00, 0x49, 0x00, 0x5b, 0x00, 0xff, 0x00, 0x2f, 0x01, 0xdb, 0x9c, 0x42, 0x01, 0xd8, 0xff, 0x1b, 0x1b, 0x29, 0x43, 0x01, 0x3e, 0x00, 0x2e, 0xff, 0xf3, 0xd1, 0x1c, 0x00, 0x63, 0x1e, 0x9c, 0x41, 0xff, 0x0c, 0x43, 0x01, 0x00, 0x7f, 0x31, 0x00, 0x29, 0xff, 0xce, 0xdd, 0x63, 0x07, 0x04, 0xd0, 0x0f, 0x23, 0xf7, 0x23, 0x40, 0x04, 0xa1, 0x00, 0x04, 0x34, 0x23, 0x01, 0xff, 0x03, 0xd5, 0x01, 0x00, 0x2c, 0x4b, 0x80, 0x31, 0xff, 0x1c, 0x40, 0xfe, 0x29, 0x0d, 0xdd, 0x01, 0x23, 0x6f, 0x01, 0x9a, 0xff, 0x21, 0x7b, 0x00, 0x24, 0xa4, 0x79, 0x0c, 0xf6, 0x71, 0x18, 0x9c, 0xe7, 0x1b, 0x04, 0xa4, 0x01, 0x64, 0x0a, 0xff, 0xc9, 0xb2, 0x13, 0x40, 0x95, 0xe7, 0x1b, 0x1b, 0xff, 0x1a, 0x26, 0x01, 0x21, 0xc2, 0xe7, 0x00, 0x9b, 0xff, 0x8b, 0x46, 0x9a, 0x46, 0x00, 0x24, 0x4c, 0xe7, 0xff, 0x63, 0x02, 0xe5, 0xd5, 0x00, 0x25, 0x80, 0x24, 0xf7, 0xe4, 0x03, 0x2c, 0x35, 0x08, 0x00, 0x9b, 0xff, 0x21, 0xff, 0x81, 0xe7, 0x01, 0x95, 0xc1, 0xe7, 0x23, 0x00, 0xff, 0x20, 0x20, 0xcb, 0x40, 0x41, 0x1a, 0x8c, 0x40, 0xbf, 0x61, 0x1e, 0x8c, 0x41, 0x1c, 0x43, 0x83, 0x2c, 0x63, 0x57, 0x01, 0x05, 0xd5, 0x5b, 0x04, 0x01, 0x77, 0x08, 0x68, 0x67, 0x18, 0xf2, 0x01, 0x05, 0x61, 0x85, 0x20, 0xbf, 0x05, 0x59, 0xe7, 0x38, 0x62, 0xf7, 0x00, 0x00, 0x78, 0x03, 0x00, 0xff, 0xff, 0xff, 0xf7, 0xf5, 0xf8, 0x8f, 0x0a, 0x45, 0x91, 0x02, 0xe0, 0xb5, 0x47, 0x02, 0xff, 0x46, 0x00, 0x88, 0x46, 0x7f, 0x0a, 0x36, 0x0e, 0xff, 0xc4, 0x0f, 0x00, 0x2e, 0x47, 0xd0, 0xff, 0x2e, 0xff, 0x24, 0xd0, 0xfb, 0x00, 0x80, 0x27, 0xff, 0x04, 0xfb, 0x1f, 0x43, 0xab, 0x05, 0x9a, 0x46, 0x7f, 0x3e, 0x43, 0xbf, 0x46, 0x5d, 0x02, 0x58, 0x00, 0xdb, 0x3f, 0x0a, 0x98, 0xfb, 0x46, 0x43, 0x89, 0x02, 0x3b, 0xd0, 0xeb, 0x00, 0x80, 0xef, 0x25, 0x00, 0x22, 0xed, 0x89, 0x0a, 0x36, 0x18, 0x73, 0xfb, 0x1c, 0x41, 0xd5, 0x01, 0x4b, 0x46, 0x61, 0x40, 0x13, 0xff, 0x43, 0x0f, 0x2b, 0x64, 0xd8, 0x75, 0x48, 0x9b, 0xff, 0x00, 0xc3, 0x58, 0x9f, 0x46, 0x00, 0x2f, 0x42, 0xfe, 0x87, 0x0a, 0x06, 0x3b, 0xff, 0x26, 0x9a, 0x46, 0xda, 0xff, 0xe7, 0x41, 0x46, 0x02, 0x2a, 0x28, 0xd0, 0x03, 0xff, 0x2a, 0x00, 0xd1, 0xce, 0xe0, 0x01, 0x2a, 0x00, 0xdf, 0xd0, 0xac, 0xe0, 0x11, 0x40, 0x33, 0x03, 0x22, 0xcc, 0xff, 0xb2, 0x40, 0x02, 0xd2, 0x05, 0x40, 0x0a, 0xe4, 0xdf, 0x07, 0x10, 0x43, 0x20, 0x43, 0xe9, 0x1d, 0xf8, 0xbd, 0x77, 0x00, 0x2f, 0x15, 0x75, 0x0a, 0x03, 0x3b, 0x00, 0x41, 0x00, 0xfd, 0xb9, 0x73, 0x02, 0x02, 0x22, 0x00, 0x2d, 0xc5, 0xd0, 0x7f, 0x03, 0x22, 0xc3, 0xe7, 0x00, 0x2d, 0x19, 0xc7, 0x06, 0xff, 0x22, 0xbe, 0xe7, 0x01, 0x24, 0xff, 0x22, 0x0c, 0xee, 0x49, 0x00, 0xdb, 0xe7, 0x38, 0x71, 0x02, 0x01, 0xfb, 0x76, 0xff, 0x26, 0x43, 0x1f, 0x9f, 0x40, 0x00, 0x23, 0x76, 0x57, 0x42, 0x36, 0x1a, 0xc3, 0x04, 0x9d, 0x6f, 0x0a, 0x09, 0x85, 0x08, 0xed, 0x97, 0xad, 0x0a, 0xef, 0xfa, 0xad, 0x22, 0x22, 0x9d, 0xe7, 0xff, 0x80, 0x20, 0x00, 0x24, 0xc0, 0x03, 0xff, 0x22, 0x7f, 0xba, 0xe7, 0x3d, 0x00, 0x52, 0x46, 0xab, 0x05, 0x00, 0xfd, 0x21, 0x07, 0x00, 0xa7, 0xe7, 0x3b, 0x0c, 0x9c, 0x46, 0xff, 0x2a, 0x04, 0x12, 0x0c, 0x2b, 0x0c, 0x14, 0x00, 0xff, 0x60, 0x46, 0x65, 0x46, 0x3f, 0x04, 0x3f, 0x0c, 0xff, 0x7c, 0x43, 0x42, 0x43, 0x5d, 0x43, 0x7b, 0x43, 0xff, 0x27, 0x0c, 0x9b, 0x18, 0xff, 0x18, 0xba, 0x42, 0xff, 0x03, 0xd9, 0x80, 0x23, 0x5b, 0x02, 0x9c, 0x46, 0xff, 0x65, 0x44, 0x24, 0x04, 0x3a, 0x04, 0x24, 0x0c, 0xff, 0x12, 0x19, 0x93, 0x01, 0x5c, 0x1e, 0xa3, 0x41, 0xff, 0x3f, 0x0c, 0x92, 0x0e, 0x7d, 0x19, 0x1a, 0x43, 0x7f, 0xad, 0x01, 0x15, 0x43, 0x2b, 0x01, 0x04, 0xad, 0x01, 0xff, 0x5e, 0x46, 0x6a, 0x08, 0x1d, 0x40, 0x15, 0x43, 0xff, 0x32, 0x00, 0x7f, 0x32, 0x00, 0x2a, 0x25, 0xdd, 0xb5, 0x6b, 0xd1, 0x09, 0x2b, 0xd1, 0x0d, 0x35, 0x2b, 0x55, 0x02, 0x32, 0xff, 0x00, 0x27, 0x4b, 0x80, 0x32, 0x1d, 0x40, 0xfe, 0xff, 0x2a, 0x94, 0xdc, 0x01, 0x24, 0xa8, 0x01, 0x40, 0xbf, 0x0a, 0xd2, 0xb2, 0x0c, 0x40, 0x6f, 0x9f, 0x00, 0xc0, 0xff, 0x03, 0x07, 0x42, 0x07, 0xd0, 0x05, 0x42, 0x05, 0xff, 0xd1, 0x28, 0x43, 0x40, 0x02, 0x40, 0x0a, 0x44, 0xbf, 0x46, 0xff, 0x22, 0x63, 0xe7, 0x38, 0x0b, 0x08, 0xff, 0xfb, 0x22, 0x5e, 0x03, 0x01, 0xa3, 0x1a, 0x1b, 0x2b, 0x05, 0xfd, 0xdd, 0x07, 0x01, 0x22, 0x00, 0x20, 0x56, 0xe7, 0x5e, 0xef, 0x46, 0xcb, 0xe7, 0x2a, 0x41, 0x02, 0xda, 0x40, 0xc3, 0xff, 0x1a, 0x9d, 0x40, 0x2b, 0x00, 0x5d, 0x1e, 0xab, 0xef, 0x41, 0x13, 0x43, 0x5a, 0x71, 0x04, 0x22, 0x1a, 0x40, 0xdd, 0x04, 0x7d, 0x01, 0x04, 0x33, 0x5a, 0x95, 0x04, 0x24, 0x01, 0x7a, 0x3b, 0x09, 0x3d, 0x41, 0x00, 0x9b, 0x01, 0x58, 0x0a, 0x3f, 0x04, 0xe5, 0x37, 0x6f, 0x00, 0x01, 0x0f, 0x01, 0x69, 0x0c, 0x0c, 0x40, 0xff, 0xbf, 0x22, 0x2e, 0xe7, 0xc0, 0x46, 0xb8, 0x3f, 0x12, 0xf0, 0xff, 0xb5, 0x4f, 0x46, 0xd6, 0x46, 0x46, 0x46, 0x44, 0xff, 0x00, 0xc0, 0xb5, 0xc2, 0x0f, 0x47, 0x02, 0x48, 0xfe, 0x23, 0x00, 0x84, 0x46, 0x66, 0x46, 0x7b, 0x0a, 0x48, 0xff, 0x00, 0xc9, 0x0f, 0x9a, 0x46, 0x24, 0x0e, 0x15, 0xff, 0x00, 0xdb, 0x00, 0x00, 0x0e, 0x89, 0x46, 0xf6, 0xff, 0x00, 0xff, 0x28, 0x00, 0xd1, 0x8f, 0xe0, 0x01, 0xff, 0x21, 0x4f, 0x46, 0x4f, 0x40, 0x39, 0x00, 0x91, 0xff, 0x42, 0x66, 0xd0, 0x22, 0x1a, 0x00, 0x2a, 0x00, 0xff, 0xdc, 0x9d, 0xe0, 0x00, 0x28, 0x3d, 0xd1, 0x00, 0xff, 0x2e, 0x00, 0xd1, 0x8b, 0xe0, 0x51, 0x1e, 0x00, 0xdf, 0x29, 0x00, 0xd0, 0xb5, 0xe0, 0x7f, 0x00, 0x1b, 0x5a, 0x7f, 0x01, 0x44, 0xd5, 0x9b, 0x01, 0x9f, 0x09, 0xc7, 0x05, 0xff, 0x1d, 0xfa, 0x05, 0x38, 0x87, 0x40, 0x84, 0x42, 0x7f, 0x00, 0xdd, 0x96, 0xe0, 0x04, 0x1b, 0x3a, 0xcb, 0x00, 0xff, 0x01, 0x34, 0xe2, 0x40, 0x04, 0x1b, 0xa7, 0x40, 0xff, 0x3b, 0x00, 0x5f, 0x1e, 0xbb, 0x41, 0x00, 0x24, 0xfe, 0xcf, 0x3c, 0x27, 0xd5, 0x01, 0x34, 0xff, 0x2c, 0x00, 0xff, 0xd1, 0x79, 0xe0, 0x01, 0x22, 0x9b, 0x01, 0x5b, 0xff, 0x0a, 0xe4, 0xb2, 0x2a, 0x40, 0x5b, 0x02, 0xe4, 0xff, 0x05, 0x58, 0x0a, 0xd2, 0x07, 0x20, 0x43, 0x10, 0xfb, 0x43, 0x1c, 0x5b, 0x12, 0xf0, 0xbd, 0xff, 0x2c, 0xe0, 0xff, 0xd0, 0x80, 0x21, 0xc9, 0x04, 0x0e, 0x43, 0x1b, 0xef, 0x2a, 0x7b, 0xdc, 0x31, 0x5d, 0x00, 0xd1, 0x40, 0x82, 0xff, 0x1a, 0x96, 0x40, 0x72, 0x1e, 0x96, 0x41, 0x0e, 0xfd, 0x43, 0x89, 0x04, 0xba, 0xd4, 0x5a, 0x07, 0xd0, 0xd1, 0xff, 0x01, 0x22, 0xdf, 0x08, 0x2a, 0x40, 0xff, 0x2c, 0xff, 0x33, 0xd1, 0x00, 0x2f, 0x00, 0xd1, 0xa8, 0xe0, 0xfe, 0x59, 0x07, 0x3b, 0x43, 0x5b, 0x02, 0x5b, 0x0a, 0xff, 0xff, 0x24, 0xd1, 0xe7, 0x21, 0x1a, 0x00, 0x29, 0x4c, 0xff, 0xdd, 0x00, 0x28, 0x2a, 0xd0, 0xff, 0x2c, 0xb8, 0xfd, 0xd0, 0xa5, 0x01, 0x04, 0x06, 0x43, 0x1b, 0x29, 0x00, 0xff, 0xdd, 0xaf, 0xe0, 0x30, 0x00, 0x20, 0x27, 0xc8, 0xff, 0x40, 0x79, 0x1a, 0x8e, 0x40, 0x71, 0x1e, 0x8e, 0xff, 0x41, 0x06, 0x43, 0x9b, 0x19, 0x59, 0x01, 0xd6, 0xfa, 0x9d, 0x10, 0x85, 0x9d, 0x00, 0x7a, 0x49, 0x1a, 0x40, 0x5b, 0xdb, 0x08, 0x0b, 0x31, 0x03, 0x9c, 0xe7, 0x07, 0x01, 0xd0, 0x70, 0xff, 0xe7, 0x6b, 0xe7, 0x3b, 0x1e, 0xc5, 0xd1, 0x00, 0xf7, 0x22, 0x7b, 0x02, 0xb7, 0x04, 0xa3, 0xe7, 0x14, 0x00, 0xfd, 0x8f, 0x19, 0x00, 0x4d, 0xd0, 0x48, 0x1e, 0x00, 0x28, 0xff, 0x57, 0xd1, 0x9b, 0x19, 0x01, 0x24, 0x5a, 0x01, 0xbf, 0xb5, 0xd5, 0x02, 0x24, 0xe0, 0xe7, 0x3b, 0x02, 0xd1, 0xff, 0x62, 0x1c, 0xd2, 0xb2, 0x01, 0x2a, 0x72, 0xdd, 0xff, 0x9f, 0x1b, 0x7a, 0x01, 0x35, 0xd5, 0xf7, 0x1a, 0xff, 0x0d, 0x00, 0x64, 0xe7, 0x01, 0x22, 0x00, 0x23, 0xff, 0x2a, 0x40, 0x86, 0xe7, 0x3b, 0x00, 0x63, 0x4a, 0xf7, 0x24, 0x1a, 0x13, 0x37, 0x02, 0x00, 0x29, 0x6c, 0xd1, 0xff, 0x61, 0x1c, 0xc8, 0xb2, 0x01, 0x28, 0x4e, 0xdd, 0xff, 0xff, 0x29, 0x49, 0xd0, 0x9b, 0x19, 0x5b, 0x08, 0xff, 0x0c, 0x00, 0x63, 0xe7, 0xff, 0x2a, 0x41, 0xd0, 0xff, 0x0a, 0x00, 0x81, 0xe7, 0x01, 0x26, 0x9b, 0x1b, 0xdf, 0x89, 0xe7, 0x00, 0x2c, 0x1c, 0xd5, 0x03, 0x21, 0xd0, 0x7f, 0x80, 0x24, 0xe4, 0x04, 0x52, 0x42, 0x23, 0x11, 0x01, 0xfe, 0x73, 0x05, 0x1c, 0x00, 0x20, 0x25, 0xd4, 0x40, 0xaa, 0xff, 0x1a, 0x93, 0x40, 0x5a, 0x1e, 0x93, 0x41, 0x23, 0xff, 0x43, 0xf3, 0x1a, 0x04, 0x00, 0x0d, 0x00, 0x2d, 0xdd, 0xe7, 0x07, 0x01, 0xd0, 0x2e, 0xe7, 0x65, 0x02, 0x24, 0xa9, 0xff, 0xe7, 0x0c, 0x00, 0x3d, 0xe7, 0x00, 0x2b, 0x58, 0xbf, 0xd0, 0xd2, 0x43, 0x00, 0x2a, 0xee, 0x43, 0x00, 0xe1, 0xff, 0xd1, 0x33, 0x00, 0xff, 0x24, 0x0d, 0x00, 0x32, 0xff, 0xe7, 0xff, 0x29, 0x10, 0xd0, 0x01, 0x00, 0x78, 0xde, 0x1d, 0x00, 0x6e, 0xd0, 0xff, 0x24, 0xe9, 0x05, 0x28, 0xe7, 0xff, 0x80, 0x22, 0x51, 0x46, 0xd2, 0x03, 0x11, 0x42, 0x7f, 0x03, 0xd0, 0x61, 0x46, 0x11, 0x42, 0x00, 0x2b, 0x08, 0xdb, 0x1d, 0xe7, 0x1d, 0x00, 0x23, 0x2c, 0x83, 0x00, 0xe9, 0xd1, 0xef, 0x00, 0x2b, 0x63, 0xd0, 0x29, 0x04, 0x13, 0xe7, 0x9b, 0xff, 0x19, 0x5a, 0x01, 0x00, 0xd4, 0x3e, 0xe7, 0x31, 0xbf, 0x4a, 0x0c, 0x00, 0x13, 0x40, 0x0b, 0x1d, 0x00, 0x1e, 0xba, 0x1d, 0x00, 0x2f, 0x31, 0x02, 0x4f, 0xd0, 0x33, 0x85, 0x00, 0x02, 0xea, 0xb9, 0x00, 0x55, 0x15, 0x00, 0x1f, 0x15, 0x00, 0x43, 0xd0, 0xc9, 0xef, 0x43, 0x00, 0x29, 0x0b, 0x7d, 0x00, 0x39, 0xd0, 0x1b, 0xb7, 0x29, 0x44, 0xdc, 0xb7, 0x00, 0x27, 0xcc, 0x79, 0x01, 0x8b, 0xef, 0x40, 0x59, 0x1e, 0x8b, 0xb7, 0x00, 0x9b, 0x19, 0x04, 0xeb, 0x00, 0x40, 0x87, 0x00, 0x1a, 0x3d, 0x00, 0x24, 0xd1, 0x80, 0xff, 0x27, 0x00, 0x22, 0xff, 0x03, 0x1b, 0xe7, 0x33, 0x7d, 0x00, 0xcd, 0x04, 0xde, 0xe6, 0xff, 0x28, 0x1e, 0xf7, 0x08, 0x75, 0x49, 0xf7, 0x00, 0xdf, 0x89, 0x05, 0xd1, 0xd4, 0xe6, 0x53, 0x05, 0xdf, 0x00, 0xd4, 0x37, 0xe7, 0xf3, 0x55, 0x01, 0xcd, 0xe6, 0xbe, 0xbd, 0x0c, 0xc9, 0xe6, 0x80, 0x22, 0x50, 0xbd, 0x00, 0x10, 0xff, 0x42, 0xa4, 0xd0, 0x60, 0x46, 0x10, 0x42, 0xa1, 0xbd, 0xd1, 0x87, 0x04, 0xff, 0x24, 0xbd, 0xe6, 0xc5, 0x04, 0xba, 0xef, 0xe6, 0x01, 0x23, 0x6e, 0x53, 0x08, 0xb5, 0xe6, 0x00, 0x2a, 0x61, 0x00, 0x1c, 0x0b, 0x00, 0xb0, 0x13, 0x00, 0xc0, 0x37, 0x03, 0x33, 0x03, 0xfd, 0x7d, 0x03, 0x00, 0xfb, 0x41, 0x02, 0x43, 0x00, 0xc2, 0xff, 0x0f, 0x49, 0x0a, 0x1b, 0x0e, 0x00, 0x20, 0x7e, 0xff, 0x2b, 0x0d, 0xdd, 0x9d, 0x2b, 0x0c, 0xdc, 0x80, 0xff, 0x20, 0x00, 0x04, 0x01, 0x43, 0x95, 0x2b, 0x0a, 0xff, 0xdc, 0x96, 0x20, 0xc3, 0x1a, 0xd9, 0x40, 0x48, 0xfd, 0x42, 0x1d, 0x03, 0xd1, 0x08, 0x00, 0x70, 0x47, 0x03, 0xff, 0x4b, 0xd0, 0x18, 0xfb, 0xe7, 0x96, 0x3b, 0x99, 0xfb, 0x40, 0xf4, 0x43, 0x0c, 0x7f, 0x70, 0xb5, 0x00, 0x28, 0xff, 0x30, 0xd0, 0xc3, 0x17, 0xc4, 0x18, 0x5c, 0x40, 0xf7, 0xc5, 0x0f, 0x20, 0x21, 0x03, 0x8c, 0xf8, 0x9e, 0x23, 0xff, 0x1b, 0x1a, 0x96, 0x2b, 0x0d, 0xdc, 0x96, 0x22, 0xff, 0xd2, 0x1a, 0x94, 0x40, 0x2a, 0x00, 0x64, 0x02, 0xff, 0x64, 0x0a, 0xdb, 0xb2, 0x64, 0x02, 0xdb, 0x05, 0xf5, 0x60, 0xf1, 0x02, 0x18, 0xf1, 0x02, 0x70, 0xbd, 0x99, 0x2b, 0xf7, 0x19, 0xdc, 0x99, 0x1f, 0x00, 0x00, 0x2a, 0x29, 0xdd, 0xff, 0x94, 0x40, 0x22, 0x00, 0x14, 0x4c, 0x14, 0x40, 0xed, 0x51, 0x37, 0x07, 0x21, 0x0a, 0x37, 0x0f, 0x34, 0x62, 0x01, 0xef, 0x13, 0xd4, 0xa4, 0x01, 0x39, 0x04, 0x2a, 0x00, 0xe0, 0xfe, 0xd9, 0x05, 0x23, 0x00, 0x24, 0xdc, 0xe7, 0x05, 0x22, 0x7f, 0x21, 0x00, 0x12, 0x1a, 0xd1, 0x40, 0xb9, 0x5b, 0x08, 0xff, 0x62, 0x1e, 0x94, 0x41, 0x0c, 0x43, 0xda, 0xe7, 0xff, 0x05, 0x4b, 0x2a, 0x00, 0x1c, 0x40, 0x9f, 0x23, 0xef, 0xa4, 0x01, 0x1b, 0x1a, 0x31, 0x04, 0xc8, 0xe7, 0x22, 0xf7, 0x00, 0xd5, 0xe7, 0xdf, 0x04, 0x10, 0xb5, 0x04, 0x1e, 0x5f, 0x27, 0xd0, 0x00, 0xf0, 0x41, 0x95, 0x10, 0x0a, 0x95, 0x10, 0xa8, 0x93, 0x24, 0x91, 0x00, 0x8f, 0x00, 0x17, 0x8f, 0x10, 0x27, 0x8f, 0x08, 0x13, 0xda, 0x8f, 0x40, 0x12, 0x8f, 0x10, 0xe3, 0xe7, 0x8b, 0x04, 0xe0, 0xe7, 0xfd, 0xb9, 0x8b, 0x00, 0xd2, 0x1a, 0x91, 0x40, 0x0a, 0x00, 0xff, 0x51, 0x1e, 0x8a, 0x41, 0x05, 0x21, 0x09, 0x1a, 0xff, 0xcc, 0x40, 0x14, 0x43, 0xdb, 0xe7, 0x04, 0x4b, 0xea, 0x8b, 0x24, 0xcc, 0x8b, 0x00, 0xd7, 0x8b, 0x08, 0x1c, 0x21, 0x01, 0xff, 0x23, 0x1b, 0x04, 0x98, 0x42, 0x01, 0xd3, 0x00, 0xdf, 0x0c, 0x10, 0x39, 0x1b, 0x0a, 0x09, 0x08, 0x0a, 0x08, 0xf7, 0x39, 0x1b, 0x09, 0x09, 0x08, 0x09, 0x04, 0x39, 0x02, 0xff, 0xa2, 0x10, 0x5c, 0x40, 0x18, 0x70, 0x47, 0xc0, 0xbf, 0x46, 0x04, 0x03, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x10, 0x67, 0x01, 0x26, 0x0c, 0x4d, 0x0d, 0x4c, 0x64, 0xff, 0x1b, 0xa4, 0x10, 0xa6, 0x42, 0x09, 0xd1, 0x00, 0xff, 0x26, 0x00, 0xf0, 0xeb, 0xf9, 0x0a, 0x4d, 0x0a, 0xfe, 0x11, 0x10, 0x05, 0xd1, 0x70, 0xbd, 0xb3, 0x00, 0xeb, 0x7f, 0x58, 0x98, 0x47, 0x01, 0x36, 0xee, 0xe7, 0x09, 0x14, 0xbf, 0xf2, 0xe7, 0x04, 0x63, 0x00, 0x00, 0x03, 0x14, 0x08, 0xbe, 0x03, 0x00, 0x00, 0x23, 0x10, 0xb5, 0x9a, 0xe5, 0x02, 0x10, 0xff, 0xbd, 0xcc, 0x5c, 0xc4, 0x54, 0x01, 0x33, 0xf8, 0xbf, 0xe7, 0x03, 0x00, 0x82, 0x18, 0x93, 0x11, 0x00, 0x70, 0xff, 0x47, 0x19, 0x70, 0x01, 0x33, 0xf9, 0xe7, 0x00, 0xbf, 0x00, 0xe2, 0x22, 0x00, 0x00, 0xce, 0x03, 0xe0, 0xf2, 0xaa, 0x3f, 0xf0, 0xea, 0x3f, 0xf0, 0xda, 0x03, 0x00, 0xd2, 0x03, 0x00, 0xb6, 0xbe, 0x03, 0x00, 0x0c, 0x23, 0x00, 0x00, 0xfa, 0x07, 0x00, 0x02, 0xaa, 0xfa, 0x00, 0x03, 0x03, 0x00, 0x28, 0x03, 0x00, 0x29, 0x03, 0x00, 0x04, 0xaa, 0x03, 0x00, 0x05, 0x03, 0x00, 0x06, 0x03, 0x00, 0x07, 0x03, 0x00, 0xff, 0x45, 0xff, 0x03, 0x0c, 0x22, 0x22, 0x05, 0x0f, 0x20, 0x03, 0x14, 0x08, 0x13, 0x00, 0xd5, 0x09, 0x03, 0x00, 0x0a, 0x03, 0x00, 0x0b, 0x1f, 0x40, 0xb8, 0x28, 0x2a, 0x03, 0x0c, 0xae, 0x07, 0x20, 0x88, 0x03, 0x10, 0xb8, 0x03, 0xfc, 0x5f, 0x48, 0xd0, 0x4f, 0xfc, 0x03, 0xfc, 0x97, 0x24, 0x03, 0x04, 0x96, 0x03, 0x30, 0x45, 0x45, 0xff, 0x74, 0x41, 0x4d, 0x4f, 0x52, 0x50, 0x2e, 0x75, 0x7f, 0x6d, 0x45, 0x9a, 0x45, 0x00, 0x00, 0xa2, 0x03, 0x00, 0x55, 0x42, 0x03, 0x00, 0x3e, 0x03, 0x00, 0x46, 0x03, 0x00, 0x3c, 0x03, 0x00, 0x55, 0x56, 0x03, 0x00, 0x5c, 0x03, 0x00, 0x66, 0x03, 0x00, 0x6e, 0x03, 0x00, 0xab, 0x38, 0x45, 0xf2, 0x0a, 0x42, 0xa4, 0x01, 0x42, 0x78, 0x01, 0x42, 0xeb, 0x00, 0x0c, 0x03, 0x00, 0x10, 0x0f, 0x08, 0x43, 0x26, 0x4d, 0xac, 0x3b, 0x00, 0x03, 0x10, 0xea, 0x4c, 0x03, 0x0c, 0xf0, 0x03, 0x00, 0xf6, 0x6a, 0x03, 0x00, 0x06, 0x13, 0x00, 0x2c, 0x03, 0x00, 0xe8, 0x56, 0x93, 0x00, 0xaa, 0x03, 0x00, 0xca, 0x03, 0x00, 0x0c, 0x07, 0x10, 0xae, 0x0f, 0x20, 0xb8, 0xaa, 0x03, 0x10, 0xae, 0x0f, 0x10, 0x14, 0x03, 0x20, 0xd0, 0x1f, 0x20, 0x8c, 0x16, 0x03, 0x00, 0x70, 0x57, 0x07, 0x0c, 0xae, 0x0f, 0x20, 0x3f, 0x24, 0x0f, 0x04, 0xfa, 0x3f, 0x24, 0x7a, 0x0f, 0x00, 0x18, 0x59, 0x00, 0x00, 0x68, 0xb5, 0x58, 0x03, 0x0c, 0x66, 0x03, 0x00, 0x0a, 0x59, 0x03, 0x0c, 0x00, 0x65, 0x59, 0x0f, 0x1c, 0x00, 0x13, 0x10, 0x0f, 0x04, 0x10, 0x59, 0x03, 0x1c, 0xfd, 0xa0, 0x03, 0x00, 0xf8, 0xb5, 0xc0, 0x46, 0xf8, 0xbc, 0xff, 0x08, 0xbc, 0x9e, 0x46, 0x70, 0x47, 0xdd, 0x20, 0xd6, 0x0f, 0x2c, 0xb5, 0x20, 0xc7, 0x06, 0xa3, 0x40, 0x00, 0xa0, 0x41, 0x1e, 0x03, 0x04, 0xa3, 0x00, 0x01, 0x00};
+
+#endif /* ADS_FW_LZ_H_ */
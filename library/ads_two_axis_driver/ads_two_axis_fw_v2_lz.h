@@ -0,0 +1,22 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+/* Generated by tools/ads_fw_lz, do not edit */
+
+#ifndef ADS_TWO_AXIS_FW_V2_LZ_H_
+#define ADS_TWO_AXIS_FW_V2_LZ_H_
+
+#include <stdint.h>
+
+const uint8_t ads_two_axis_fw_v2_lz_rev = 6;
+const uint32_t ads_two_axis_fw_v2_lz_len = 18324;		// Bytes of the image
+const uint16_t ads_two_axis_fw_v2_lz_crc = 0xcbe6;		// ads_crc16() of the image
+
+const uint8_t ads_two_axis_fw_v2_lz[] = {0xff, 0xe0, 0x08, 0x00, 0x20, 0x09, 0x27, 0x00, 0x00, 0xb1, 0x07, 0x03, 0x10, 0x00, 0x64, 0x1f, 0x24, 0x07, 0x27, 0x03, 0x2c, 0x4d, 0xf9, 0x42, 0x13, 0x3c, 0x03, 0xe4, 0x09, 0x46, 0x00, 0x00, 0x21, 0xda, 0x03, 0x00, 0x39, 0x03, 0x00, 0x51, 0x46, 0x3b, 0xac, 0x63, 0x3c, 0xef, 0x00, 0x00, 0x7b, 0x3c, 0x1f, 0x5c, 0x10, 0xb5, 0x40, 0xff, 0xf2, 0x14, 0x04, 0xc2, 0xf2, 0x00, 0x04, 0x23, 0xff, 0x78, 0x63, 0xb9, 0x40, 0xf2, 0x00, 0x03, 0xc0, 0x7e, 0x03, 0x00, 0x2b, 0xb1, 0x45, 0xf2, 0x80, 0x70, 0x09, 0x00, 0xff, 0x00, 0x00, 0xe0, 0x00, 0xbf, 0x01, 0x23, 0x23, 0xdf, 0x70, 0x10, 0xbd, 0xc0, 0x46, 0x1d, 0x14, 0x10, 0xb5, 0x3f, 0x4b, 0xb1, 0x40, 0xf2, 0x18, 0x01, 0x23, 0x04, 0x39, 0x00, 0xf9, 0x01, 0x27, 0x14, 0x33, 0x14, 0x03, 0x68, 0x03, 0xb9, 0x10, 0xfd, 0xbd, 0x2d, 0x14, 0x00, 0x2b, 0xf8, 0xd0, 0x98, 0x47, 0xff, 0xf6, 0xe7, 0xc0, 0x46, 0x10, 0xb5, 0x42, 0xf2, 0xfb, 0x8d, 0x73, 0x13, 0x04, 0x98, 0x47, 0x10, 0xbd, 0x00, 0xff, 0x00, 0xf0, 0xb5, 0xc6, 0x46, 0x00, 0xb5, 0x5e, 0xff, 0x4c, 0xa5, 0x44, 0x80, 0x46, 0x00, 0x24, 0x00, 0xff, 0x26, 0x00, 0x27, 0x01, 0x2c, 0x50, 0xdc, 0x45, 0xf7, 0xf2, 0x2c, 0x42, 0x23, 0x00, 0x02, 0x63, 0x00, 0x1b, 0xdf, 0x19, 0x99, 0x00, 0x88, 0x58, 0x47, 0x00, 0x12, 0x69, 0xef, 0x46, 0x43, 0xf6, 0x51, 0x39, 0x10, 0x08, 0xb9, 0x00, 0xff, 0x21, 0x08, 0xe0, 0x40, 0xf2, 0xde, 0x23, 0x42, 0xff, 0x46, 0x13, 0x80, 0x00, 0x27, 0x2f, 0xe0, 0x01, 0xff, 0x36, 0xf6, 0xb2, 0x01, 0x31, 0x62, 0x00, 0x12, 0xf7, 0x19, 0x93, 0x00, 0x3d, 0x14, 0x94, 0x46, 0x63, 0x44, 0xbf, 0x1b, 0x79, 0x99, 0x42, 0x24, 0xda, 0x17, 0x3c, 0x9b, 0xff, 0x68, 0x4a, 0x00, 0x52, 0x18, 0x50, 0x00, 0x1b, 0xff, 0x18, 0x1a, 0x88, 0x68, 0x46, 0x80, 0x5c, 0x01, 0xff, 0x32, 0x6d, 0x46, 0xaa, 0x5c, 0x12, 0x02, 0x02, 0xff, 0x43, 0x98, 0x88, 0x82, 0x42, 0xd7, 0xd0, 0x5b, 0xdf, 0x88, 0x9a, 0x42, 0xd6, 0xd0, 0x61, 0x1c, 0x00, 0x2f, 0xff, 0x62, 0xd0, 0x00, 0x24, 0x47, 0xe0, 0xdf, 0x19, 0xff, 0xff, 0xb2, 0x01, 0x34, 0xac, 0xe7, 0xb7, 0x42, 0xff, 0x01, 0xd0, 0x01, 0x27, 0xf3, 0xe7, 0x40, 0xf2, 0xed, 0xdf, 0x21, 0x10, 0xed, 0xe7, 0x65, 0x6c, 0x1d, 0x79, 0x40, 0xff, 0xa8, 0x85, 0x54, 0x1a, 0x88, 0x01, 0x32, 0x9b, 0xdf, 0x88, 0x1b, 0x0a, 0x83, 0x54, 0xad, 0x54, 0xdb, 0xdb, 0xbf, 0x30, 0x00, 0x43, 0xf6, 0xb5, 0x63, 0xe9, 0x0c, 0x40, 0x7f, 0xad, 0x09, 0xe0, 0x40, 0x22, 0x29, 0x00, 0x13, 0x04, 0xfd, 0x1d, 0xfd, 0x10, 0x40, 0x35, 0x40, 0x36, 0x80, 0xab, 0xff, 0x9d, 0x42, 0xf2, 0xd3, 0x01, 0x34, 0x01, 0x2c, 0x35, 0x12, 0x2d, 0x31, 0x8e, 0x2d, 0x09, 0x40, 0xa9, 0x31, 0x04, 0x2f, 0x15, 0xb7, 0x00, 0x21, 0xc8, 0xa9, 0x18, 0x38, 0x00, 0x1f, 0x00, 0x23, 0xff, 0x9d, 0x44, 0x04, 0xbc, 0x90, 0x46, 0xf0, 0xbd, 0xff, 0x00, 0xfe, 0xff, 0xff, 0xbf, 0xf3, 0x4f, 0x8f, 0xdf, 0x4e, 0xf6, 0x00, 0x53, 0xce, 0x2b, 0x00, 0x04, 0x22, 0xbf, 0xc0, 0xf2, 0xfa, 0x52, 0xda, 0x60, 0x13, 0x04, 0xc0, 0xdb, 0x46, 0xfd, 0x35, 0x00, 0x30, 0x03, 0xdf, 0x01, 0x03, 0x01, 0xff, 0x22, 0x1a, 0x70, 0x70, 0x47, 0x40, 0xf6, 0x00, 0xbb, 0x03, 0xc4, 0x0d, 0x00, 0xda, 0x69, 0x41, 0xf3, 0x01, 0x0a, 0xa7, 0x43, 0xda, 0x61, 0x13, 0x00, 0x21, 0x18, 0x5a, 0x21, 0x00, 0x70, 0xff, 0xb5, 0x0c, 0x00, 0x02, 0x28, 0x00, 0xd1, 0x69, 0xef, 0xe0, 0x09, 0xd9, 0x55, 0x07, 0x00, 0xdd, 0xe0, 0x56, 0xfe, 0x05, 0x00, 0xdc, 0xe0, 0x03, 0x28, 0x5f, 0xd1, 0x00, 0xff, 0x23, 0xa6, 0xe0, 0x98, 0xb3, 0x01, 0x28, 0x5a, 0xf9, 0xd1, 0x17, 0x06, 0x33, 0x04, 0x1b, 0x78, 0xdb, 0x07, 0x1f, 0xf5, 0xd5, 0x41, 0x00, 0x05, 0x0d, 0x00, 0x05, 0xa8, 0x88, 0x2e, 0xdf, 0x69, 0x45, 0xf2, 0x51, 0x23, 0xb3, 0x0c, 0x44, 0xf6, 0xfd, 0xf5, 0x03, 0x09, 0x31, 0x1c, 0x98, 0x47, 0x06, 0x1c, 0xf7, 0x45, 0xf2, 0xf1, 0x17, 0x08, 0x20, 0x00, 0x98, 0x47, 0x5f, 0x01, 0x1c, 0x44, 0xf6, 0x09, 0x0d, 0x08, 0x30, 0x1b, 0x00, 0xeb, 0xa8, 0x60, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x08, 0x30, 0x6f, 0x42, 0xf6, 0x07, 0x03, 0x3d, 0x0c, 0x28, 0xe0, 0x63, 0x14, 0x1f, 0x1c, 0x78, 0xe3, 0x07, 0x0a, 0x63, 0x20, 0x49, 0x14, 0x23, 0x00, 0xd3, 0x61, 0xa3, 0x19, 0x0c, 0xfb, 0x0a, 0xe0, 0x19, 0x20, 0x60, 0x61, 0xd6, 0x53, 0x44, 0x70, 0xbd, 0xb7, 0x1c, 0x9b, 0xb7, 0x20, 0xe8, 0x88, 0xf5, 0x6e, 0xb7, 0xc0, 0xe8, 0xb7, 0x48, 0xcc, 0xe7, 0x9a, 0x1d, 0xed, 0x92, 0xa1, 0x01, 0x30, 0x01, 0x55, 0x07, 0x8c, 0x46, 0x62, 0x7f, 0x44, 0x91, 0x68, 0x9a, 0x1c, 0x92, 0x00, 0x07, 0x00, 0xb7, 0x60, 0x1a, 0x1d, 0x07, 0x08, 0x68, 0x9a, 0x0d, 0x08, 0x01, 0x7f, 0x33, 0xdb, 0xb2, 0x01, 0x2b, 0xe7, 0xd9, 0x45, 0x44, 0xa3, 0xa9, 0xe7, 0x33, 0x04, 0x45, 0x30, 0x3d, 0x0c, 0x60, 0x3d, 0x08, 0x68, 0xfc, 0x4b, 0x10, 0x45, 0x68, 0x86, 0xe7, 0x00, 0x23, 0xf0, 0xe7, 0xae, 0xf3, 0x1c, 0xda, 0x07, 0x0f, 0xf3, 0x04, 0x02, 0x0d, 0x00, 0x02, 0xfe, 0x15, 0x00, 0x21, 0x91, 0x86, 0x51, 0x85, 0xd1, 0x39, 0xff, 0xff, 0x39, 0x01, 0x20, 0x50, 0x54, 0x94, 0x46, 0xff, 0x61, 0x44, 0x00, 0x22, 0x8a, 0x71, 0x9b, 0x07, 0xe7, 0x00, 0xd4, 0x6a, 0x35, 0x1a, 0x25, 0x00, 0x22, 0x9a, 0x87, 0xaf, 0x9a, 0x85, 0x30, 0x33, 0x3f, 0x02, 0x72, 0x0b, 0x00, 0x73, 0xff, 0x5c, 0xe7, 0x10, 0xb5, 0x48, 0xb9, 0x40, 0xf2, 0x7b, 0x6c, 0x20, 0x6d, 0x04, 0x43, 0xf2, 0xa1, 0x53, 0x6b, 0x0c, 0xeb, 0x10, 0xbd, 0x13, 0x1c, 0x5f, 0x13, 0x10, 0xf4, 0xe7, 0x30, 0xff, 0xb5, 0x83, 0xb0, 0x05, 0x00, 0x0c, 0x00, 0x05, 0xff, 0x22, 0xff, 0x21, 0x68, 0x46, 0x45, 0xf2, 0x1b, 0xed, 0x43, 0x19, 0x0c, 0x6b, 0x1e, 0xb5, 0x04, 0x01, 0xd9, 0x03, 0xff, 0xb0, 0x30, 0xbd, 0x6b, 0x46, 0x1d, 0x70, 0x5c, 0xdf, 0x70, 0x24, 0x0a, 0x9c, 0x70, 0x75, 0x18, 0x22, 0x9a, 0xff, 0x5c, 0x53, 0x1e, 0x9a, 0x41, 0xd2, 0xb2, 0x05, 0x2e, 0x35, 0x00, 0x44, 0xf6, 0x3f, 0xcf, 0x10, 0xe7, 0x7b, 0x00, 0xc1, 0x16, 0xfb, 0x5a, 0x69, 0xc1, 0x04, 0x0a, 0x43, 0x5a, 0x61, 0x44, 0xfb, 0xf2, 0x49, 0xb9, 0x11, 0x02, 0x00, 0x42, 0xf2, 0x00, 0x55, 0x41, 0x1d, 0x00, 0x01, 0x8b, 0x00, 0x24, 0x13, 0x06, 0x20, 0x8d, 0x00, 0x79, 0xe9, 0x73, 0x10, 0x07, 0x15, 0x59, 0x88, 0x89, 0xb2, 0x17, 0x04, 0xf1, 0xe3, 0xb9, 0x18, 0x55, 0x00, 0x69, 0x11, 0x01, 0x22, 0xca, 0x64, 0xef, 0x41, 0xf2, 0x11, 0x33, 0x19, 0x04, 0x0b, 0x65, 0x44, 0x57, 0x31, 0x0a, 0x74, 0x49, 0x24, 0x15, 0xd3, 0x13, 0x20, 0xe3, 0x20, 0xff, 0x10, 0xbd, 0xf0, 0xb5, 0xc6, 0x46, 0x00, 0xb5, 0x79, 0x84, 0xe7, 0x08, 0xc1, 0x1c, 0x9b, 0x5c, 0x33, 0xb9, 0x0d, 0x14, 0xbf, 0x18, 0x32, 0x9b, 0x5c, 0x43, 0xb1, 0x03, 0x05, 0x02, 0xbd, 0xa8, 0x03, 0x1d, 0x1d, 0xb1, 0x04, 0xb0, 0xc3, 0x0f, 0x02, 0xf7, 0xab, 0x1d, 0x70, 0xbf, 0x15, 0x04, 0x30, 0x04, 0x22, 0xdf, 0x21, 0x00, 0x45, 0xf2, 0x09, 0xb5, 0x30, 0x1b, 0x78, 0xff, 0x03, 0x2b, 0x46, 0xd0, 0x01, 0x2b, 0x63, 0xd0, 0xcf, 0x00, 0x23, 0x00, 0x93, 0xf3, 0x46, 0xb7, 0x16, 0x61, 0x69, 0xcf, 0x98, 0x47, 0xe1, 0x68, 0xa9, 0x16, 0xb5, 0x02, 0x90, 0x44, 0xf7, 0xf6, 0x9d, 0x46, 0x0b, 0x00, 0x06, 0x84, 0x21, 0xc9, 0xef, 0x05, 0x00, 0x98, 0xb0, 0x29, 0x00, 0xb5, 0x15, 0xc0, 0xfe, 0x4b, 0x07, 0x47, 0x03, 0xb2, 0x02, 0xac, 0x60, 0x70, 0xbf, 0x1b, 0x12, 0xa3, 0x70, 0x01, 0x98, 0x1d, 0x04, 0xb0, 0xb5, 0x47, 0x13, 0x04, 0xe0, 0x11, 0x00, 0x23, 0x71, 0x8d, 0x45, 0x20, 0x5d, 0x00, 0x8d, 0x1d, 0x9f, 0xe7, 0x20, 0x7d, 0x04, 0x28, 0x0d, 0x00, 0xa7, 0x08, 0xc0, 0x47, 0x4b, 0x17, 0x85, 0x00, 0x67, 0x11, 0x00, 0x07, 0xb7, 0x29, 0x69, 0xb8, 0x67, 0x00, 0x09, 0x26, 0x77, 0x04, 0xa9, 0xff, 0x68, 0xb0, 0x47, 0x00, 0x90, 0x60, 0x88, 0xc0, 0xeb, 0x47, 0x69, 0x15, 0x00, 0xe9, 0x0d, 0x00, 0x01, 0x90, 0xb4, 0x55, 0xe7, 0xc3, 0x14, 0xa0, 0xc3, 0x40, 0x21, 0xc3, 0x00, 0xa1, 0xc3, 0x20, 0xff, 0x00, 0x90, 0x00, 0x23, 0x01, 0x93, 0x9a, 0xe7, 0xfe, 0x6b, 0x0d, 0xc0, 0x23, 0xdb, 0x05, 0x98, 0x46, 0x40, 0x7f, 0x23, 0x42, 0x46, 0x53, 0x60, 0x43, 0xf2, 0x0f, 0x0e, 0xfb, 0x40, 0x22, 0x05, 0x00, 0x02, 0x9a, 0x62, 0xc0, 0x21, 0xff, 0x09, 0x06, 0x99, 0x62, 0x46, 0x20, 0x1a, 0x5c, 0xff, 0x40, 0xf2, 0x01, 0x0c, 0x64, 0x46, 0xa2, 0x43, 0xff, 0x01, 0x27, 0x3a, 0x43, 0xd2, 0xb2, 0x1a, 0x54, 0xff, 0x32, 0x34, 0x1a, 0x5d, 0x37, 0x38, 0x82, 0x43, 0xfe, 0x0d, 0x08, 0x55, 0x02, 0x22, 0x40, 0x46, 0x42, 0x60, 0xee, 0x33, 0x0c, 0x99, 0x62, 0x41, 0x2f, 0x00, 0x65, 0x46, 0xaa, 0xfe, 0x1b, 0x0c, 0x54, 0x30, 0x22, 0x98, 0x5c, 0x0f, 0x26, 0xff, 0x30, 0x40, 0x10, 0x25, 0x28, 0x43, 0xc0, 0xb2, 0xef, 0x98, 0x54, 0x50, 0x32, 0x2b, 0x24, 0x47, 0x22, 0x99, 0xff, 0x5c, 0x60, 0x46, 0x81, 0x43, 0x39, 0x43, 0xc9, 0xff, 0xb2, 0x99, 0x54, 0x1a, 0x5d, 0x32, 0x40, 0x2a, 0xfc, 0x51, 0x08, 0xcb, 0x0d, 0x10, 0xb5, 0x41, 0xf2, 0x1f, 0x33, 0xde, 0xb5, 0x0c, 0x43, 0xf6, 0x9f, 0x73, 0x09, 0x0c, 0x41, 0xf2, 0xf9, 0xdf, 0x09, 0x10, 0xaf, 0x10, 0x23, 0x99, 0x68, 0x04, 0x20, 0xff, 0x01, 0x43, 0x99, 0x60, 0xda, 0x68, 0x02, 0x43, 0x5b, 0xda, 0x60, 0x83, 0x06, 0x82, 0xb0, 0x71, 0x15, 0x58, 0x3d, 0x02, 0xbf, 0xdb, 0xb2, 0x83, 0x42, 0x24, 0xd0, 0x11, 0x14, 0x98, 0xe7, 0x54, 0x00, 0xbb, 0x0b, 0x14, 0x89, 0x03, 0x70, 0x43, 0xf6, 0xeb, 0xe5, 0x73, 0x1f, 0x16, 0x48, 0x75, 0x0b, 0x00, 0x21, 0x42, 0xab, 0xf6, 0x59, 0x13, 0x18, 0x1c, 0x13, 0x18, 0x49, 0x47, 0x12, 0x02, 0xcf, 0xb0, 0x10, 0xbd, 0x48, 0xc1, 0x00, 0x3b, 0x05, 0x9a, 0x61, 0x7e, 0x4b, 0x24, 0x00, 0x21, 0x3f, 0x32, 0x99, 0x54, 0x47, 0x00, 0xee, 0xe7, 0x12, 0x42, 0xf6, 0x1f, 0x47, 0x10, 0x6b, 0x46, 0x9a, 0xfd, 0x1d, 0x7f, 0x02, 0x23, 0x13, 0x80, 0x01, 0x23, 0x00, 0x9d, 0x21, 0x19, 0x04, 0x93, 0x74, 0xc0, 0xb1, 0x05, 0xd9, 0x00, 0xcf, 0x5a, 0x6b, 0x40, 0x03, 0x6b, 0x10, 0xc8, 0xe7, 0xcd, 0x24, 0x40, 0xcd, 0x10, 0xfd, 0x25, 0xcd, 0x20, 0x9b, 0x5c, 0x03, 0xbb, 0x00, 0x20, 0x0f, 0x41, 0xf2, 0x63, 0x53, 0x29, 0x15, 0xcf, 0xc4, 0xb3, 0x14, 0x9b, 0x0c, 0xf2, 0xb5, 0x2c, 0x58, 0xb5, 0xb8, 0x69, 0x17, 0x59, 0x88, 0x89, 0xb2, 0x5c, 0xf5, 0x03, 0x1f, 0x08, 0x43, 0xf2, 0xe3, 0xa1, 0x10, 0x01, 0xad, 0x20, 0xef, 0xc0, 0xe7, 0x20, 0xb1, 0x2d, 0x14, 0x18, 0x70, 0x70, 0xe7, 0x47, 0x10, 0xb5, 0x2f, 0x00, 0x3d, 0x11, 0x43, 0xf2, 0x31, 0xee, 0x25, 0x10, 0x44, 0xf2, 0x49, 0xbd, 0x12, 0x02, 0x00, 0x42, 0x57, 0xf2, 0x00, 0x41, 0xf5, 0x01, 0x01, 0x1f, 0x04, 0xe9, 0x6f, 0x40, 0xf9, 0x20, 0x69, 0x20, 0x0b, 0x06, 0x04, 0x00, 0x03, 0x78, 0x0c, 0xff, 0x2b, 0x09, 0xd8, 0x9b, 0x00, 0x4a, 0x4a, 0xd3, 0xff, 0x58, 0x9f, 0x46, 0x40, 0x78, 0x41, 0xf6, 0x87, 0xfd, 0x13, 0x1f, 0x14, 0x43, 0x78, 0x82, 0x78, 0x12, 0x02, 0xdf, 0x13, 0x43, 0x00, 0x2b, 0xf8, 0x53, 0x01, 0x00, 0x02, 0xee, 0x45, 0x00, 0x02, 0x53, 0x80, 0x4f, 0x25, 0x41, 0xf6, 0x75, 0x79, 0x23, 0x65, 0x14, 0x85, 0x1d, 0x00, 0x2b, 0xe0, 0xd0, 0xc7, 0x24, 0xdf, 0xd9, 0xe7, 0x41, 0xf2, 0xf5, 0x27, 0x10, 0x42, 0xf6, 0xf3, 0x41, 0x13, 0xab, 0x16, 0x13, 0x14, 0x40, 0x78, 0x42, 0xf6, 0xbd, 0x83, 0x15, 0x10, 0x00, 0x28, 0xc2, 0xd1, 0x19, 0x24, 0x41, 0xf7, 0xf6, 0xb9, 0x03, 0x0b, 0x0c, 0xb6, 0xe7, 0x06, 0x21, 0x7a, 0x55, 0x04, 0x8f, 0x55, 0x10, 0xae, 0xe7, 0x81, 0x78, 0x1f, 0x00, 0x5b, 0xf2, 0x41, 0x05, 0x13, 0xa6, 0xe7, 0x2d, 0x04, 0x67, 0x39, 0x10, 0x7f, 0x9f, 0xe7, 0x06, 0x20, 0x43, 0xf2, 0x05, 0x03, 0x11, 0xdf, 0x98, 0xe7, 0x16, 0x21, 0x02, 0x3b, 0x20, 0x90, 0xe7, 0xff, 0x42, 0x78, 0x53, 0x1e, 0xdb, 0xb2, 0x09, 0x2b, 0xaf, 0x00, 0xd9, 0x8a, 0xe7, 0xbb, 0x00, 0x00, 0x85, 0x05, 0x28, 0xff, 0x23, 0xc2, 0x54, 0x08, 0x30, 0x42, 0xf6, 0x07, 0xf6, 0x71, 0x10, 0x61, 0x78, 0xbf, 0x15, 0x42, 0xf6, 0x2f, 0x63, 0xfe, 0x13, 0x0c, 0x73, 0xe7, 0xc0, 0x46, 0x6c, 0x54, 0x00, 0x77, 0x00, 0x40, 0xf6, 0x5f, 0x0b, 0x03, 0xda, 0x69, 0x19, 0x01, 0xff, 0x11, 0x0a, 0x43, 0xda, 0x61, 0x41, 0xf6, 0x00, 0xfd, 0x43, 0x11, 0x04, 0xc0, 0x39, 0xc8, 0x22, 0x99, 0x50, 0x4e, 0xad, 0x05, 0x41, 0xf6, 0x01, 0x7f, 0x10, 0x97, 0x01, 0x01, 0x1b, 0x00, 0xbd, 0x21, 0x75, 0x16, 0x42, 0xf6, 0xcf, 0x63, 0x65, 0x15, 0xf0, 0x7f, 0xb5, 0xc6, 0x46, 0x00, 0xb5, 0x84, 0xb0, 0x51, 0x24, 0xef, 0x80, 0x08, 0x41, 0x46, 0x53, 0x24, 0x3e, 0x39, 0xc0, 0xf4, 0x53, 0x00, 0xa7, 0x00, 0x05, 0x3d, 0x00, 0x05, 0x2a, 0x00, 0x5c, 0xd5, 0x32, 0x19, 0x00, 0x41, 0x51, 0x0c, 0x1c, 0x9b, 0x0e, 0x23, 0x02, 0xdf, 0x93, 0x40, 0xf2, 0x54, 0x23, 0x6d, 0x0b, 0x93, 0x01, 0xdf, 0x26, 0x00, 0x96, 0x00, 0x23, 0x93, 0x06, 0x99, 0x27, 0xfe, 0x67, 0x00, 0x07, 0xb8, 0x47, 0x2a, 0x00, 0x60, 0x32, 0xed, 0x80, 0xa7, 0x12, 0x4f, 0x35, 0x13, 0x00, 0x05, 0xa8, 0x47, 0x7e, 0xa3, 0x07, 0x42, 0x46, 0x5a, 0x60, 0x43, 0xf2, 0x79, 0x0c, 0xfe, 0x03, 0x00, 0x02, 0x9a, 0x62, 0xc0, 0x22, 0x12, 0x06, 0xff, 0x9a, 0x62, 0x47, 0x21, 0x5a, 0x5c, 0xb2, 0x43, 0xff, 0x01, 0x20, 0x02, 0x43, 0xd2, 0xb2, 0x5a, 0x54, 0xff, 0x14, 0x39, 0x5a, 0x5c, 0x0f, 0x20, 0x02, 0x40, 0xdd, 0x10, 0x0f, 0x10, 0x41, 0xf2, 0x33, 0x75, 0x09, 0x00, 0x22, 0xf6, 0x51, 0x0c, 0x8f, 0x44, 0xf9, 0x0e, 0x04, 0xb0, 0x04, 0xbc, 0xef, 0x90, 0x46, 0xf0, 0xbd, 0xd1, 0x02, 0x88, 0x0d, 0x4a, 0xff, 0x99, 0x18, 0x40, 0xf2, 0xce, 0x72, 0x91, 0x42, 0xff, 0x01, 0xd8, 0x82, 0x79, 0x52, 0xb9, 0x47, 0xf6, 0xff, 0xfe, 0x72, 0x93, 0x42, 0x09, 0xd9, 0x83, 0x88, 0xff, 0x14, 0x3b, 0x83, 0x80, 0x83, 0x79, 0x01, 0x33, 0xff, 0x83, 0x71, 0x70, 0x47, 0x02, 0x23, 0x03, 0x70, 0x7b, 0xf8, 0xe7, 0x13, 0x00, 0x33, 0x83, 0x80, 0xf4, 0x5b, 0x01, 0xff, 0xe8, 0x83, 0xff, 0xff, 0x30, 0xb5, 0x83, 0xb0, 0xfe, 0xb5, 0x16, 0x1b, 0x78, 0x02, 0x2b, 0x00, 0xd1, 0x93, 0xbf, 0xe1, 0x03, 0x2b, 0x04, 0xd0, 0x01, 0x09, 0x00, 0xed, 0xaf, 0xe0, 0x03, 0xb0, 0x30, 0x91, 0x03, 0x30, 0x8d, 0x0a, 0x2a, 0xb1, 0x32, 0x51, 0x15, 0x83, 0x07, 0x81, 0x1f, 0x08, 0x22, 0xdb, 0x04, 0x9a, 0xb5, 0x61, 0xbf, 0x1d, 0x01, 0x6f, 0x11, 0x0a, 0xe0, 0xa9, 0x16, 0x1b, 0xff, 0x78, 0x0b, 0xb9, 0x04, 0x24, 0x0a, 0xe0, 0x00, 0xdf, 0x24, 0x08, 0xe0, 0x84, 0xb1, 0x15, 0x14, 0x5b, 0x78, 0xff, 0x00, 0x2b, 0xed, 0xd1, 0x02, 0x24, 0x00, 0x2c, 0xb3, 0xf4, 0xd0, 0x2d, 0x07, 0x41, 0x16, 0xed, 0xe7, 0x73, 0x14, 0x00, 0xbf, 0x23, 0x53, 0x70, 0x13, 0x70, 0x2c, 0x79, 0x1c, 0x33, 0x3a, 0x79, 0x3c, 0x5a, 0x79, 0x40, 0x05, 0xe0, 0x02, 0x91, 0x22, 0x6f, 0x24, 0x6d, 0xf2, 0x5d, 0x03, 0x30, 0x04, 0xc5, 0x0d, 0x63, 0x70, 0x39, 0x14, 0x6f, 0x04, 0x33, 0x01, 0xaa, 0x59, 0x04, 0x19, 0x55, 0xad, 0x0d, 0xeb, 0x01, 0xa9, 0x79, 0x07, 0x73, 0x4d, 0x10, 0x30, 0x23, 0xe3, 0xdf, 0x5c, 0x01, 0x2b, 0x2a, 0xd0, 0x47, 0x14, 0x30, 0x33, 0xff, 0x1b, 0x7a, 0x01, 0x2b, 0x50, 0xd1, 0x01, 0xab, 0xfb, 0x5b, 0x88, 0x4d, 0x14, 0x63, 0x87, 0x25, 0x00, 0x30, 0xff, 0x35, 0x20, 0x00, 0x38, 0x30, 0x41, 0xf6, 0x21, 0xfe, 0xf9, 0x12, 0xa3, 0x8f, 0xa3, 0x85, 0x2b, 0x7a, 0x02, 0xb7, 0x2b, 0x3b, 0xd1, 0x25, 0x14, 0x20, 0x00, 0xf3, 0x26, 0x00, 0xff, 0x23, 0x2b, 0x72, 0x2d, 0xe0, 0x01, 0xab, 0x1b, 0xde, 0x45, 0x1c, 0x86, 0x20, 0x00, 0x30, 0x41, 0x24, 0x8e, 0x63, 0xdd, 0x85, 0x7d, 0x04, 0x02, 0x2b, 0xc0, 0x43, 0x54, 0x22, 0x30, 0xff, 0x23, 0xe2, 0x54, 0xb1, 0xe7, 0x44, 0xf2, 0xbf, 0x95, 0x73, 0x11, 0x0c, 0x04, 0xf9, 0x40, 0x1b, 0x69, 0x05, 0xbf, 0x18, 0x00, 0x9f, 0x22, 0x1a, 0x70, 0x11, 0xe7, 0xd7, 0xdd, 0x5d, 0xb5, 0x02, 0xd6, 0x5d, 0x81, 0x2d, 0xd1, 0x07, 0x8d, 0x19, 0x07, 0x69, 0x0a, 0xe0, 0x66, 0x07, 0xb5, 0x08, 0x32, 0x43, 0x0e, 0x39, 0xbc, 0x70, 0xe6, 0x21, 0x15, 0xf0, 0x3b, 0x98, 0xd3, 0x12, 0xd1, 0xfe, 0x73, 0x85, 0x6a, 0x46, 0x06, 0x32, 0x4e, 0x75, 0x61, 0x34, 0x23, 0x7a, 0x75, 0x0d, 0xc3, 0x8e, 0x18, 0xc3, 0x62, 0xfe, 0x3b, 0xbd, 0xd2, 0xe5, 0x30, 0xb5, 0x83, 0xb0, 0x40, 0xfc, 0x0d, 0x00, 0x1f, 0x0c, 0x02, 0x2b, 0x00, 0xd1, 0x4a, 0xe1, 0xff, 0x03, 0x2b, 0x20, 0xd0, 0x01, 0x2b, 0x00, 0xd0, 0x9b, 0xc1, 0xe1, 0x9b, 0xde, 0xdb, 0xe0, 0xd7, 0xfe, 0x63, 0x75, 0x43, 0xbb, 0xf6, 0xe5, 0xed, 0x10, 0x43, 0xf6, 0xcf, 0x09, 0x10, 0x2d, 0x3a, 0x39, 0x00, 0x2d, 0x13, 0x11, 0x22, 0x00, 0x2c, 0x7b, 0x68, 0xdf, 0xfd, 0xd7, 0x00, 0x00, 0x08, 0x53, 0x83, 0x2c, 0x73, 0x19, 0x30, 0x33, 0xdb, 0x1b, 0x7a, 0x59, 0x05, 0x14, 0xe1, 0xef, 0x95, 0x00, 0xd0, 0x5b, 0xfe, 0xe0, 0xf1, 0x5d, 0xf0, 0xe0, 0xad, 0x8f, 0xbe, 0xad, 0x6b, 0x6b, 0xaf, 0xe7, 0xf3, 0xac, 0x04, 0xf3, 0x80, 0x04, 0xd0, 0x63, 0x15, 0x35, 0x9e, 0xa3, 0x90, 0xe6, 0xa3, 0x68, 0xd7, 0xe7, 0x4f, 0x16, 0xd3, 0xfd, 0x78, 0xdf, 0x7c, 0xb3, 0x87, 0xe1, 0x14, 0x9a, 0x61, 0x2d, 0xe0, 0xcd, 0x95, 0xed, 0xe5, 0xbd, 0x63, 0xd7, 0xe7, 0xbd, 0x4f, 0x68, 0x46, 0x42, 0xfb, 0xf6, 0xb5, 0x79, 0x10, 0xc0, 0x21, 0xc9, 0x05, 0x0c, 0xeb, 0x68, 0x43, 0x0b, 0x00, 0xc4, 0x03, 0x00, 0x1a, 0x6a, 0x0b, 0x7f, 0x69, 0x53, 0x40, 0x1c, 0x40, 0x54, 0x40, 0x23, 0x04, 0xfd, 0xc3, 0x23, 0x10, 0x23, 0x04, 0xda, 0xd5, 0x03, 0xb0, 0xff, 0x30, 0xbd, 0x10, 0xb5, 0x10, 0xe0, 0x41, 0xf6, 0xcd, 0x5d, 0x81, 0x10, 0x0a, 0xe0, 0x5d, 0x4c, 0x0d, 0x15, 0x40, 0x22, 0xa7, 0x9b, 0x5c, 0x00, 0x83, 0x0d, 0x0f, 0x08, 0x58, 0x0f, 0x08, 0xe4, 0xdf, 0xd0, 0x42, 0xf2, 0xd5, 0x13, 0x29, 0x0c, 0xe9, 0xe7, 0xff, 0x10, 0xb5, 0x04, 0x00, 0x08, 0x22, 0x00, 0x21, 0xf7, 0x45, 0xf2, 0x1b, 0x3d, 0x18, 0x00, 0x23, 0xa3, 0x80, 0xef, 0x10, 0xbd, 0x70, 0xb5, 0x09, 0x05, 0x08, 0x22, 0x5a, 0xe7, 0x61, 0x9a, 0x60, 0x9d, 0x14, 0x03, 0x00, 0x02, 0x9a, 0x62, 0xff, 0xc0, 0x22, 0x12, 0x06, 0x9a, 0x62, 0x43, 0x21, 0xff, 0x5a, 0x5c, 0x01, 0x20, 0x82, 0x43, 0x5a, 0x54, 0xef, 0x41, 0xf6, 0xc5, 0x20, 0x3b, 0x00, 0x00, 0x44, 0xf6, 0xbd, 0xaf, 0xfb, 0x10, 0x41, 0xf2, 0xdf, 0x53, 0x09, 0x14, 0x35, 0x74, 0xc3, 0x10, 0x6d, 0x05, 0x63, 0x15, 0x14, 0xf6, 0x23, 0x43, 0x09, 0x14, 0xcd, 0x81, 0x33, 0x14, 0xf6, 0x4b, 0x81, 0x18, 0xb3, 0x0d, 0x00, 0x23, 0xb7, 0x18, 0x22, 0x1f, 0xb1, 0x01, 0x61, 0x64, 0x0d, 0x0e, 0x42, 0x97, 0xf2, 0xe1, 0x73, 0xe1, 0x18, 0x00, 0xa9, 0x0b, 0x6f, 0x01, 0x85, 0xfe, 0x3f, 0x10, 0x05, 0x00, 0x08, 0xb1, 0x28, 0x00, 0x70, 0xbd, 0xbd, 0x8d, 0x15, 0x28, 0x23, 0xe1, 0x5c, 0x37, 0x1e, 0x2f, 0xbc, 0x85, 0x10, 0xa9, 0x06, 0x42, 0xf2, 0x01, 0x66, 0x0d, 0x00, 0x06, 0xfb, 0xb0, 0x47, 0xd1, 0x05, 0xb0, 0x47, 0xe3, 0xe7, 0xfe, 0x5e, 0x07, 0x01, 0x45, 0xf2, 0x80, 0x72, 0x15, 0x00, 0x02, 0xff, 0x00, 0x9e, 0x2d, 0x09, 0x9a, 0x42, 0x12, 0xd0, 0x0b, 0x14, 0x1b, 0x14, 0x03, 0xff, 0xe0, 0x11, 0x68, 0x19, 0x60, 0x04, 0x33, 0x04, 0xf6, 0xaf, 0x02, 0x14, 0x01, 0x19, 0x00, 0x01, 0x8b, 0x42, 0xf5, 0xf9, 0xd3, 0x0b, 0x00, 0x25, 0x08, 0x02, 0xe0, 0x00, 0x22, 0x1a, 0xde, 0x1d, 0x00, 0x40, 0xf2, 0xe0, 0x22, 0xd5, 0x06, 0x93, 0x42, 0xe7, 0xf6, 0xd3, 0x41, 0x17, 0x00, 0x79, 0x04, 0x7f, 0x22, 0x93, 0xbf, 0x43, 0x4e, 0xf6, 0x00, 0x52, 0xce, 0x17, 0x04, 0x60, 0xef, 0x45, 0xf2, 0xb9, 0x33, 0x8f, 0x0c, 0x44, 0xf2, 0x69, 0xfe, 0x99, 0x10, 0xfe, 0xe7, 0x70, 0xb5, 0x43, 0xf6, 0xb1, 0xfe, 0x03, 0x11, 0xc0, 0x22, 0xd2, 0x05, 0x08, 0x23, 0x53, 0xdb, 0x61, 0x93, 0x7b, 0x19, 0x08, 0x21, 0x05, 0x00, 0x01, 0x99, 0xff, 0x62, 0xc0, 0x24, 0x24, 0x06, 0x9c, 0x62, 0x43, 0xff, 0x25, 0x59, 0x5d, 0x01, 0x20, 0x81, 0x43, 0x59, 0x7b, 0x55, 0x48, 0x15, 0x00, 0x51, 0x61, 0x91, 0x60, 0x07, 0x00, 0x9d, 0x02, 0x9f, 0x0d, 0x9c, 0x62, 0x4f, 0x9b, 0x01, 0x99, 0x05, 0x70, 0xf6, 0x31, 0x02, 0x40, 0xf6, 0x59, 0x12, 0x69, 0x80, 0x21, 0x0a, 0xff, 0x43, 0x1a, 0x61, 0x9a, 0x69, 0x7c, 0x39, 0x0a, 0x3f, 0x43, 0x9a, 0x61, 0x43, 0xf6, 0x45, 0x79, 0x10, 0xeb, 0x09, 0xf7, 0xb0, 0x04, 0x00, 0xed, 0x00, 0x12, 0x00, 0x21, 0x68, 0xfd, 0x46, 0x0b, 0x2a, 0x12, 0x69, 0x46, 0x80, 0x20, 0xc0, 0x5f, 0x03, 0x43, 0xf6, 0x51, 0x73, 0x67, 0x15, 0x10, 0x67, 0x01, 0xff, 0x40, 0xb0, 0x70, 0xbd, 0x80, 0x26, 0xf6, 0x03, 0xf7, 0x30, 0x00, 0x43, 0xc9, 0x1a, 0x28, 0x22, 0x21, 0x00, 0xfa, 0x3d, 0x04, 0x09, 0x3d, 0x10, 0x00, 0x24, 0x03, 0x2c, 0xe9, 0xff, 0xd8, 0xa1, 0x01, 0x76, 0x18, 0x69, 0x44, 0x40, 0xf5, 0x22, 0x29, 0x04, 0x1d, 0x43, 0x18, 0x00, 0x28, 0xdc, 0xd1, 0xff, 0x01, 0x34, 0xe4, 0xb2, 0xed, 0xe7, 0x00, 0x00, 0x17, 0x70, 0xb5, 0x82, 0x7d, 0x00, 0x28, 0x85, 0x2a, 0x4b, 0x04, 0x77, 0x44, 0x7d, 0x02, 0x77, 0x00, 0x20, 0x68, 0x44, 0xf6, 0xa1, 0xc1, 0x12, 0xff, 0xc8, 0xbb, 0x00, 0x22, 0xe3, 0x8c, 0x1d, 0x49, 0xff, 0x8c, 0x46, 0x63, 0x44, 0x9b, 0xb2, 0x01, 0x2b, 0xff, 0x0a, 0xd9, 0x6b, 0x46, 0x9e, 0x1d, 0x30, 0x00, 0xf7, 0x41, 0xf2, 0x71, 0x21, 0x10, 0x33, 0x88, 0xe3, 0x84, 0xff, 0x01, 0x22, 0x00, 0x2a, 0xe0, 0xd0, 0x20, 0x00, 0xfe, 0x9d, 0x1f, 0xd9, 0xe7, 0x1a, 0x1d, 0x92, 0x00, 0x84, 0x9e, 0x7b, 0x03, 0x11, 0x51, 0x9a, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x8e, 0x76, 0x0d, 0x0c, 0x1c, 0x92, 0x0f, 0x00, 0x01, 0x33, 0xdb, 0x4d, 0x00, 0xff, 0xec, 0xd9, 0x07, 0x22, 0x20, 0x23, 0xe2, 0x54, 0xff, 0xe1, 0x33, 0xff, 0x33, 0xa3, 0x84, 0x63, 0x84, 0xff, 0x00, 0x23, 0xe3, 0x84, 0x06, 0x3a, 0xc6, 0xe7, 0xff, 0x00, 0x23, 0xf0, 0xe7, 0xc0, 0x46, 0x22, 0xfd, 0xbf, 0xff, 0xff, 0x10, 0xb5, 0x90, 0xb0, 0x25, 0x01, 0x14, 0x67, 0xc0, 0xf2, 0x40, 0xff, 0x03, 0x0b, 0x1d, 0x40, 0x22, 0x49, 0x2d, 0xff, 0x73, 0x23, 0x6a, 0x46, 0x13, 0x70, 0x40, 0x22, 0xf7, 0x69, 0x46, 0x20, 0x07, 0x21, 0x10, 0xb0, 0x10, 0xbd, 0xff, 0x30, 0xb5, 0x91, 0xb0, 0x05, 0x00, 0x43, 0xb2, 0xaf, 0x00, 0x2b, 0x20, 0xdd, 0x49, 0x00, 0x24, 0x49, 0x74, 0x6b, 0xd7, 0x46, 0x1d, 0x70, 0x4d, 0x04, 0x53, 0x4d, 0x38, 0x11, 0xb0, 0xff, 0x30, 0xbd, 0x0d, 0x20, 0x40, 0x42, 0xfa, 0xe7, 0x38, 0x53, 0x0c, 0x4d, 0x00, 0x97, 0x03, 0x40, 0x00, 0x02, 0x27, 0x00, 0x47, 0x1d, 0xff, 0x04, 0x00, 0x58, 0xb9, 0x6b, 0x46, 0x5b, 0x78, 0xff, 0x73, 0x2b, 0x0a, 0xd0, 0x13, 0x20, 0x42, 0xf6, 0xfd, 0x83, 0x27, 0x11, 0x13, 0x23, 0x2b, 0x70, 0x20, 0x00, 0xfe, 0x43, 0x04, 0x6b, 0x46, 0x1b, 0x78, 0x2b, 0x70, 0xf8, 0xde, 0x13, 0x03, 0x83, 0x69, 0x03, 0xb1, 0x1f, 0x06, 0x10, 0xb5, 0xdd, 0xc3, 0x09, 0x10, 0xf0, 0xb5, 0x83, 0x59, 0x00, 0x0e, 0x00, 0xff, 0x11, 0x00, 0x03, 0x6a, 0x9a, 0x5d, 0x53, 0x00, 0xff, 0x9b, 0x18, 0xdc, 0x00, 0x83, 0x6a, 0x9c, 0x46, 0xff, 0x64, 0x44, 0x27, 0x1d, 0x01, 0x91, 0x6b, 0x46, 0x7f, 0x19, 0x79, 0x38, 0x00, 0x43, 0xf2, 0xd5, 0x6b, 0x10, 0xf5, 0x28, 0x9d, 0x00, 0xcb, 0xe9, 0x12, 0x01, 0x28, 0x0a, 0xd9, 0xef, 0x01, 0x9b, 0x19, 0x0a, 0x1f, 0x24, 0xa3, 0x8a, 0x01, 0xf7, 0x33, 0xa3, 0x82, 0x05, 0x0c, 0x23, 0x68, 0x13, 0xb1, 0xff, 0x31, 0x00, 0x28, 0x00, 0x98, 0x47, 0x03, 0xb0, 0x7d, 0xf0, 0x67, 0x00, 0xd6, 0x46, 0x4f, 0x46, 0x80, 0x6d, 0x00, 0xff, 0x07, 0x00, 0x01, 0x91, 0x16, 0x00, 0x1d, 0x00, 0xff, 0x0a, 0xab, 0x1c, 0x78, 0x40, 0xb1, 0x49, 0xb1, 0xff, 0x52, 0xb1, 0x5c, 0xb1, 0x0b, 0x9b, 0x0b, 0xb1, 0x7f, 0x01, 0x20, 0x08, 0xe0, 0x00, 0x20, 0x06, 0x03, 0x00, 0xd9, 0x04, 0x03, 0x00, 0x7b, 0x03, 0x20, 0x00, 0x03, 0x00, 0x45, 0xf2, 0xfb, 0xf8, 0x4a, 0x5b, 0x00, 0x0a, 0x3f, 0x22, 0x51, 0x46, 0xef, 0x43, 0xf2, 0xdd, 0x69, 0x0b, 0x00, 0x09, 0xc8, 0x47, 0xff, 0x6a, 0x1c, 0xe3, 0x0f, 0xd0, 0x17, 0xa2, 0x42, 0xdf, 0x58, 0x41, 0xc0, 0xb2, 0x40, 0x19, 0x00, 0xc8, 0x47, 0xff, 0x00, 0x23, 0x03, 0xe0, 0xff, 0x22, 0xf2, 0x54, 0xfe, 0xe7, 0x05, 0xab, 0x42, 0xf9, 0xd9, 0x3e, 0x62, 0x24, 0xfb, 0x23, 0xfd, 0x0d, 0x00, 0xfc, 0x54, 0x0b, 0x9b, 0xbb, 0x77, 0x62, 0x01, 0x99, 0xa5, 0x00, 0xf6, 0x7b, 0x23, 0xa5, 0x0c, 0xdf, 0x70, 0xb9, 0x42, 0xf6, 0x31, 0x0b, 0x08, 0xbb, 0x60, 0x57, 0x42, 0xf6, 0x1d, 0x09, 0x08, 0x3b, 0x09, 0x00, 0x27, 0x09, 0x08, 0xff, 0x7b, 0x60, 0x03, 0xb0, 0x0c, 0xbc, 0x91, 0x46, 0xf7, 0x9a, 0x46, 0xf0, 0x1d, 0x09, 0x07, 0x00, 0x0c, 0x00, 0xff, 0x00, 0x92, 0x01, 0x93, 0xe8, 0xb1, 0xf2, 0xb1, 0xeb, 0xfb, 0xb9, 0x91, 0x08, 0x45, 0x27, 0x00, 0x05, 0x66, 0x22, 0xed, 0x29, 0xf9, 0x00, 0xdd, 0x66, 0x0b, 0x00, 0x06, 0xb0, 0x47, 0xff, 0x24, 0x23, 0xfb, 0x5c, 0x00, 0x20, 0xa3, 0x42, 0xf5, 0x40, 0x91, 0x00, 0x67, 0x19, 0x00, 0xb0, 0x47, 0x39, 0x6a, 0xff, 0x0b, 0x5d, 0xff, 0x2b, 0x2e, 0xd1, 0x00, 0x26, 0xf7, 0x00, 0x23, 0x07, 0xc9, 0x00, 0xe2, 0xe7, 0x00, 0x20, 0xbf, 0xe0, 0xe7, 0x01, 0x20, 0xde, 0xe7, 0xa3, 0x04, 0x24, 0xff, 0x22, 0xba, 0x5c, 0x93, 0x42, 0x05, 0xd8, 0xca, 0xff, 0x5c, 0xff, 0x2a, 0xf6, 0xd0, 0x01, 0x36, 0xf6, 0xef, 0xb2, 0xf3, 0xe7, 0x25, 0x43, 0x00, 0x9e, 0x42, 0x18, 0xff, 0xd8, 0x73, 0x00, 0x9b, 0x19, 0xdd, 0x00, 0xbb, 0xff, 0x6a, 0x58, 0x19, 0x04, 0x30, 0x01, 0x9a, 0x00, 0xef, 0x99, 0x43, 0xf2, 0x41, 0x5f, 0x11, 0x68, 0xb9, 0x3b, 0xff, 0x6a, 0x1e, 0x55, 0xbb, 0x6a, 0x5b, 0x19, 0x00, 0xa7, 0x22, 0x9a, 0x82, 0x57, 0x05, 0x1f, 0x0e, 0x1c, 0x05, 0x00, 0xf7, 0x3d, 0xe7, 0x0b, 0x04, 0xf4, 0xe7, 0xf8, 0xb5, 0xb1, 0x04, 0xa5, 0x00, 0xdd, 0x46, 0x99, 0x04, 0x43, 0x1e, 0x98, 0x91, 0x00, 0x83, 0x22, 0x55, 0x31, 0xab, 0x04, 0x65, 0xb7, 0x04, 0xa8, 0xab, 0x28, 0x84, 0x19, 0x00, 0xaf, 0xa8, 0x47, 0x21, 0x00, 0x1f, 0x05, 0xa5, 0xd9, 0x11, 0x00, 0x57, 0x20, 0xf8, 0xbd, 0x45, 0x44, 0x8f, 0x45, 0x58, 0x90, 0x45, 0x20, 0xdd, 0xb9, 0x45, 0x28, 0xce, 0x46, 0x47, 0xf5, 0x01, 0x04, 0x00, 0x5f, 0x89, 0x46, 0x90, 0x46, 0x1d, 0x4f, 0x04, 0x47, 0x1d, 0x00, 0x5d, 0x07, 0x4f, 0x0c, 0x9c, 0x22, 0x39, 0x41, 0x29, 0xe3, 0x4f, 0x00, 0xd7, 0x4a, 0x46, 0x93, 0x51, 0x08, 0x9d, 0x1b, 0x00, 0xb0, 0x47, 0xff, 0x23, 0x6a, 0x4a, 0x46, 0x9b, 0x5c, 0x42, 0x46, 0xff, 0x01, 0x2a, 0x1a, 0xd0, 0x22, 0xb1, 0x02, 0x2a, 0xfb, 0x19, 0xd0, 0xe3, 0x04, 0x10, 0xe0, 0x5a, 0x00, 0xd3, 0xff, 0x18, 0xda, 0x00, 0xa3, 0x6a, 0x9d, 0x50, 0x6b, 0xff, 0x1e, 0x9d, 0x41, 0xeb, 0xb2, 0x42, 0x46, 0x49, 0xb6, 0x39, 0x0b, 0x2d, 0x44, 0x4b, 0x00, 0x04, 0xa0, 0x7b, 0x00, 0x0c, 0xff, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xf8, 0xbd, 0xa5, 0xff, 0x61, 0xed, 0xe7, 0xe5, 0x61, 0xeb, 0xe7, 0xf0, 0xf6, 0x89, 0x10, 0x83, 0xb0, 0x8b, 0x0c, 0x1e, 0x00, 0x00, 0x28, 0xef, 0x49, 0xd0, 0x00, 0x2a, 0x03, 0x00, 0x2e, 0x49, 0xd1, 0x44, 0xd5, 0x09, 0x99, 0x08, 0xbc, 0x93, 0x0c, 0xe3, 0x18, 0x93, 0x24, 0xbd, 0x1b, 0x00, 0xf7, 0xa8, 0x47, 0x20, 0x03, 0x23, 0x96, 0xfb, 0xf0, 0xf3, 0x5f, 0x58, 0x43, 0x33, 0x1a, 0x58, 0x89, 0x0a, 0xbf, 0x1f, 0x08, 0x5e, 0xb3, 0x04, 0x9a, 0x5c, 0xa1, 0x6a, 0x4b, 0x07, 0xda, 0x6b, 0x00, 0xdf, 0x91, 0x44, 0x01, 0xa8, 0x42, 0xfd, 0x1b, 0x4b, 0x46, 0x1b, 0x1d, 0x1d, 0x45, 0x07, 0x17, 0x03, 0x0f, 0x0c, 0x0d, 0x03, 0x1d, 0x00, 0x5d, 0xc3, 0x1d, 0x10, 0x00, 0x24, 0x0e, 0x29, 0x02, 0xb8, 0x29, 0x02, 0xfd, 0xb6, 0x29, 0x02, 0xb4, 0xe7, 0x01, 0x34, 0xa4, 0xb2, 0xdb, 0x41, 0x44, 0x2f, 0x00, 0xf2, 0x8b, 0x01, 0x12, 0x21, 0x00, 0xff, 0xa7, 0x42, 0x01, 0xd9, 0xb4, 0x42, 0xf1, 0xd3, 0xbf, 0x4b, 0x46, 0x9b, 0x8a, 0x1b, 0x1b, 0x9b, 0x00, 0x82, 0x53, 0x20, 0x00, 0xb1, 0x06, 0xef, 0x04, 0xf0, 0xd9, 0x03, 0x04, 0x65, 0x05, 0x35, 0x41, 0x2d, 0x00, 0x01, 0x65, 0x0d, 0xd6, 0x22, 0xcf, 0x00, 0x5f, 0x10, 0xba, 0xbb, 0x04, 0xe1, 0x9f, 0x19, 0x10, 0xbd, 0x70, 0x2d, 0x00, 0x0d, 0x5a, 0x2f, 0x30, 0xe0, 0x2f, 0x20, 0x29, 0x00, 0x31, 0x04, 0x97, 0x31, 0x18, 0xfd, 0x70, 0x11, 0x0b, 0x05, 0x00, 0x00, 0x91, 0x01, 0x92, 0x55, 0x1c, 0x1d, 0x32, 0xff, 0x1d, 0x0e, 0x67, 0x45, 0x05, 0xb8, 0x39, 0x01, 0xfd, 0xeb, 0x1d, 0x1a, 0x40, 0xf2, 0x00, 0x12, 0x31, 0x00, 0xcf, 0xb8, 0x47, 0x23, 0x00, 0xcd, 0x06, 0xfd, 0x04, 0xf5, 0x34, 0xfc, 0xa7, 0x15, 0xc3, 0x06, 0xef, 0xf3, 0x10, 0x83, 0x03, 0x60, 0xff, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x70, 0x47, 0xfe, 0x05, 0x04, 0x03, 0x68, 0x83, 0xf3, 0x10, 0x88, 0x70, 0x7d, 0x47, 0x9f, 0x0c, 0xb8, 0xb1, 0xa1, 0xb1, 0x01, 0xa1, 0x01, 0x6b, 0x14, 0x51, 0xa5, 0x04, 0x32, 0x9f, 0x38, 0x4f, 0x53, 0xd7, 0x17, 0xd7, 0x00, 0x23, 0x0a, 0x3f, 0x01, 0xe9, 0x3f, 0x01, 0xe7, 0xe7, 0xff, 0xda, 0x00, 0xa2, 0x18, 0x00, 0x21, 0x51, 0x60, 0xfb, 0x91, 0x60, 0x6f, 0x07, 0x00, 0x2b, 0xf6, 0xd0, 0x70, 0xbe, 0xef, 0x10, 0xa0, 0xb1, 0xa9, 0xb1, 0x00, 0x4f, 0x18, 0x52, 0x76, 0x4f, 0x38, 0x7f, 0x53, 0xef, 0x1c, 0x00, 0x20, 0xea, 0x89, 0x01, 0x2b, 0xe8, 0xe7, 0x39, 0x44, 0x5e, 0x39, 0x38, 0x93, 0x39, 0x40, 0x79, 0x06, 0xdf, 0x00, 0xb5, 0x82, 0xb0, 0x07, 0x3f, 0x00, 0x14, 0x00, 0xff, 0x99, 0x46, 0x20, 0xb1, 0x29, 0xb9, 0xfa, 0xb1, 0xdf, 0x03, 0xbb, 0x00, 0x20, 0x02, 0xab, 0x00, 0x00, 0xe0, 0x3a, 0x4f, 0x1c, 0x6a, 0x4f, 0x20, 0x01, 0x97, 0x29, 0x93, 0x0f, 0x51, 0x10, 0xff, 0x28, 0xb3, 0x2e, 0x00, 0xeb, 0x00, 0xfb, 0x18, 0x5b, 0x5c, 0x60, 0x5d, 0x02, 0x60, 0x14, 0x35, 0x00, 0xe3, 0x5d, 0x00, 0xff, 0xe1, 0xe7, 0xf4, 0x00, 0x3c, 0x19, 0x63, 0x68, 0xff, 0x19, 0x88, 0x2a, 0x00, 0x01, 0x98, 0x43, 0xf6, 0xfd, 0xb7, 0x2d, 0x10, 0x63, 0x68, 0x02, 0x33, 0x63, 0x60, 0x7f, 0xa3, 0x68, 0x01, 0x3b, 0xa3, 0x60, 0xf3, 0x35, 0x00, 0xdf, 0x9b, 0x68, 0x00, 0x2b, 0xe9, 0xe5, 0x02, 0x02, 0xb0, 0xd7, 0x04, 0xbc, 0x91, 0x25, 0x02, 0x1d, 0x45, 0x03, 0xf8, 0xe7, 0x7f, 0x10, 0xb5, 0x40, 0xf2, 0x10, 0x13, 0xc2, 0x31, 0x00, 0x3f, 0x1c, 0x68, 0x43, 0xf6, 0x9b, 0x43, 0x79, 0x10, 0xc9, 0x08, 0xf5, 0xab, 0x0d, 0x10, 0x10, 0x51, 0x02, 0x03, 0x6a, 0x03, 0xb1, 0xfe, 0x09, 0x0c, 0x04, 0x00, 0x30, 0x30, 0x43, 0xf2, 0xd5, 0x7e, 0x8b, 0x12, 0xe3, 0x6a, 0x0b, 0xb1, 0x20, 0x00, 0x19, 0x0c, 0x7f, 0x44, 0x23, 0xc2, 0x5a, 0x1a, 0xb9, 0x43, 0x29, 0x10, 0xff, 0x46, 0x21, 0x43, 0x5a, 0x01, 0x33, 0x9b, 0xb2, 0xff, 0x43, 0x52, 0x9a, 0x42, 0x09, 0xd1, 0x00, 0x23, 0xff, 0x46, 0x22, 0x83, 0x52, 0x02, 0x3a, 0x83, 0x52, 0xff, 0x83, 0x6a, 0x00, 0x2b, 0xef, 0xd0, 0x98, 0x47, 0xff, 0xed, 0xe7, 0x02, 0x6c, 0xd1, 0x5c, 0x44, 0xf2, 0xf5, 0xb1, 0xaf, 0x10, 0xe5, 0x5f, 0x09, 0x0e, 0x00, 0x15, 0x00, 0xbf, 0x10, 0xb3, 0x19, 0xb3, 0x22, 0xbb, 0x13, 0x05, 0x30, 0xde, 0x13, 0x09, 0x40, 0xf2, 0x51, 0x12, 0x15, 0x1d, 0x46, 0x22, 0xff, 0x23, 0x00, 0x18, 0x3b, 0x9a, 0x5a, 0x44, 0x21, 0xff, 0x5b, 0x5a, 0x9a, 0x42, 0x12, 0xd1, 0x20, 0x00, 0xff, 0x18, 0x38, 0x06, 0x64, 0x44, 0x23, 0xc5, 0x52, 0x5b, 0x31, 0x78, 0x4d, 0x1c, 0x28, 0x00, 0x7d, 0x05, 0xdd, 0x05, 0x02, 0x5d, 0xdb, 0x23, 0x01, 0xd9, 0xe7, 0x04, 0xed, 0x00, 0xf5, 0x87, 0x01, 0xfb, 0x85, 0xb0, 0xc3, 0x05, 0x16, 0x00, 0x20, 0xb3, 0x29, 0xab, 0xb3, 0x32, 0x63, 0x28, 0x36, 0x63, 0x20, 0x03, 0xad, 0x23, 0x18, 0x5f, 0x34, 0x20, 0x00, 0x01, 0x94, 0xad, 0x27, 0x03, 0xad, 0x3b, 0xd5, 0xdb, 0x67, 0x00, 0xd9, 0x67, 0x00, 0xd7, 0xad, 0x0b, 0x69, 0x18, 0xdc, 0x87, 0x01, 0xad, 0x43, 0x20, 0x00, 0x05, 0xe9, 0x02, 0xf8, 0xb5, 0xfe, 0x81, 0x0c, 0x1f, 0x00, 0x00, 0x28, 0x42, 0xd0, 0x00, 0x75, 0x29, 0x03, 0x00, 0x2a, 0x03, 0x00, 0x2b, 0x42, 0xd1, 0x8d, 0x1c, 0xbd, 0x3a, 0xaf, 0x2b, 0x30, 0x30, 0x3a, 0x00, 0x57, 0x07, 0x41, 0xde, 0x51, 0x10, 0x00, 0x28, 0x2e, 0xd1, 0x6b, 0x06, 0x44, 0xf2, 0xfd, 0xb9, 0xa1, 0x11, 0xe8, 0xb9, 0x43, 0xf2, 0x1b, 0x13, 0xbe, 0x0b, 0x04, 0xe3, 0x61, 0x43, 0xf2, 0xb9, 0xa9, 0x08, 0xa3, 0xfa, 0x09, 0x00, 0x53, 0x09, 0x08, 0x63, 0x60, 0x43, 0xf2, 0x77, 0xb4, 0x13, 0x0c, 0x09, 0x00, 0x5d, 0x09, 0x08, 0xe3, 0x60, 0x91, 0x05, 0xa3, 0xae, 0x91, 0x01, 0xa3, 0x52, 0xf8, 0x29, 0x01, 0xc1, 0xc1, 0x00, 0xbf, 0xba, 0x03, 0x00, 0xbd, 0xc5, 0x00, 0xbb, 0xe7, 0x0d, 0x2d, 0x01, 0xf3, 0xe8, 0x8f, 0x09, 0x91, 0x14, 0xdf, 0x0f, 0x63, 0x97, 0x28, 0x44, 0xf2, 0x81, 0xde, 0x6d, 0x11, 0x05, 0x00, 0x08, 0xb1, 0x71, 0x05, 0x01, 0x22, 0xeb, 0x01, 0x21, 0x97, 0x08, 0x56, 0x17, 0x00, 0x06, 0xb0, 0x47, 0xa7, 0x01, 0x22, 0x02, 0x0f, 0x00, 0x07, 0x04, 0x00, 0x07, 0x08, 0xec, 0xd4, 0x43, 0x13, 0x55, 0x2c, 0x85, 0x55, 0x30, 0x95, 0x55, 0x10, 0x38, 0xb1, 0xfa, 0xe5, 0x0c, 0xa1, 0xdb, 0x17, 0xbd, 0x7f, 0x21, 0x29, 0x40, 0x3a, 0x11, 0x24, 0xf5, 0x4f, 0x00, 0x05, 0x00, 0x0c, 0x4d, 0x01, 0x51, 0x2c, 0xfd, 0x94, 0x45, 0x27, 0x2c, 0x0a, 0xd0, 0x34, 0xb1, 0x02, 0xbe, 0x05, 0x00, 0x03, 0x2c, 0x0b, 0xd0, 0x01, 0xd9, 0x00, 0x01, 0xd7, 0xe0, 0x2e, 0x62, 0x9d, 0x07, 0x6e, 0x05, 0x00, 0xfb, 0xe7, 0x5d, 0xae, 0x05, 0x00, 0xf8, 0xe7, 0xee, 0x05, 0x00, 0xf5, 0x9d, 0x10, 0x5f, 0x88, 0xb1, 0x71, 0xb1, 0x01, 0x8b, 0x19, 0xae, 0x4b, 0x20, 0xaf, 0x18, 0x34, 0x2c, 0x60, 0xd7, 0x0f, 0xef, 0x2b, 0x01, 0xed, 0xcb, 0xe7, 0x10, 0x21, 0x39, 0xba, 0xb9, 0x31, 0x37, 0x1e, 0x10, 0xbd, 0x5d, 0x70, 0xf9, 0x11, 0x98, 0xb1, 0x81, 0x5f, 0x08, 0x50, 0x37, 0x08, 0x3d, 0x34, 0x31, 0x20, 0x23, 0x68, 0x32, 0x00, 0xf3, 0x04, 0xeb, 0x04, 0x5e, 0x5f, 0x04, 0x00, 0x20, 0xeb, 0xe7, 0x35, 0x4c, 0x3d, 0x35, 0x20, 0xd9, 0x63, 0x35, 0x40, 0x8d, 0x03, 0xf2, 0x45, 0x79, 0x10, 0x30, 0xb9, 0xf7, 0x43, 0xf6, 0x93, 0x29, 0x12, 0x00, 0x20, 0x10, 0xbd, 0xfe, 0xdd, 0x05, 0xfb, 0xe7, 0xf8, 0xb5, 0x06, 0x68, 0x16, 0xff, 0xb1, 0x33, 0x00, 0x00, 0x25, 0x0f, 0xe0, 0x43, 0xfb, 0xf2, 0xf7, 0x4b, 0x10, 0x1a, 0xe0, 0x9f, 0x68, 0xbc, 0xff, 0x46, 0x64, 0x44, 0xa4, 0x1a, 0x01, 0x34, 0x8f, 0xff, 0x68, 0xbc, 0x42, 0x0a, 0xd2, 0x1d, 0x00, 0x1b, 0xff, 0x68, 0x3b, 0xb1, 0x5c, 0x68, 0x94, 0x42, 0xf1, 0xf7, 0xd8, 0xa4, 0x1a, 0x1d, 0x0c, 0xf1, 0xe7, 0xb3, 0x42, 0xd7, 0x06, 0xd0, 0x28, 0x93, 0x02, 0x29, 0x93, 0x12, 0xf8, 0xbd, 0xfa, 0x43, 0x1c, 0xf8, 0x5b, 0x00, 0x05, 0x00, 0x44, 0x69, 0x03, 0xff, 0x69, 0x5e, 0x1c, 0x06, 0x61, 0x03, 0x7e, 0xdb, 0xff, 0x07, 0x02, 0xd4, 0x03, 0x7e, 0x9b, 0x07, 0x0a, 0xff, 0xd5, 0x2b, 0x7e, 0x02, 0x22, 0x13, 0x43, 0xdb, 0xff, 0xb2, 0x2b, 0x76, 0xf8, 0xbd, 0x6f, 0x69, 0xe3, 0xfd, 0x68, 0xb3, 0x04, 0x3c, 0x00, 0x00, 0x2c, 0xf7, 0xd0, 0xff, 0x63, 0x68, 0xf3, 0x1a, 0xa2, 0x68, 0x93, 0x42, 0x7f, 0xf2, 0xd3, 0x2f, 0x00, 0x14, 0x37, 0x38, 0x59, 0x00, 0xfd, 0x31, 0x59, 0x10, 0x23, 0x7c, 0x01, 0x2b, 0xe8, 0xd1, 0xbf, 0x66, 0x60, 0x32, 0x00, 0x21, 0x00, 0x17, 0x04, 0x27, 0xba, 0xc9, 0x10, 0xde, 0x19, 0x11, 0xe8, 0xb1, 0xd1, 0x17, 0x09, 0x64, 0xd2, 0x17, 0x09, 0x3b, 0x17, 0x21, 0x3d, 0x0e, 0xc5, 0x05, 0x11, 0x00, 0x23, 0x55, 0x23, 0x11, 0x03, 0x83, 0x3d, 0x08, 0x23, 0xc5, 0x11, 0xe3, 0x2b, 0x01, 0xd5, 0xe1, 0xc5, 0x11, 0x64, 0xc5, 0x21, 0x48, 0x91, 0x32, 0x39, 0x13, 0xb4, 0x3d, 0x1d, 0x2d, 0x3c, 0x53, 0x2d, 0x30, 0x31, 0x23, 0xbf, 0x12, 0xb9, 0x4a, 0x0d, 0x04, 0x89, 0x3b, 0x20, 0x11, 0x79, 0x09, 0x41, 0x3c, 0x61, 0x41, 0x54, 0x45, 0xb1, 0x0d, 0x04, 0xe7, 0x41, 0x38, 0x45, 0x17, 0x43, 0x24, 0x6f, 0xf9, 0x38, 0x6b, 0x25, 0x23, 0x37, 0x14, 0x70, 0x7b, 0x02, 0x82, 0xb0, 0x33, 0x04, 0xff, 0x00, 0x28, 0x31, 0xd0, 0x00, 0x29, 0x2d, 0xd0, 0xda, 0x31, 0x1d, 0x7a, 0x7f, 0x26, 0x7e, 0x01, 0x9f, 0x09, 0x23, 0x76, 0x7f, 0x26, 0x00, 0x14, 0x36, 0x29, 0x00, 0x30, 0x6f, 0x01, 0xfd, 0xe3, 0x1b, 0x10, 0xb8, 0xb9, 0x23, 0x69, 0x6b, 0x60, 0xe3, 0x22, 0x69, 0x15, 0x0c, 0x85, 0x15, 0x31, 0x04, 0x93, 0x43, 0x23, 0xfb, 0x76, 0x23, 0xdf, 0x01, 0x18, 0xd4, 0x00, 0x20, 0x02, 0x35, 0xb0, 0x57, 0x05, 0xd0, 0x57, 0x01, 0xce, 0xe7, 0x1b, 0x14, 0x69, 0x14, 0xaf, 0x7e, 0x32, 0x00, 0x20, 0x6b, 0x1c, 0x12, 0xc9, 0x00, 0xe7, 0xbf, 0xe7, 0x01, 0xa8, 0x42, 0xf6, 0xb5, 0x7d, 0x18, 0x02, 0x64, 0x2f, 0x08, 0xbb, 0x04, 0x47, 0xbb, 0x10, 0x1f, 0x04, 0xc3, 0x63, 0xc7, 0x14, 0xff, 0xcf, 0xe7, 0x00, 0xb9, 0x00, 0xbe, 0x70, 0x47, 0xff, 0x03, 0x68, 0x1b, 0xb1, 0x8b, 0x42, 0x03, 0xd0, 0xf7, 0x1b, 0x68, 0xfa, 0x69, 0x00, 0x70, 0x47, 0x01, 0x20, 0xf9, 0xfc, 0x13, 0x11, 0xaf, 0x1c, 0x01, 0x23, 0x58, 0x40, 0xc0, 0xaf, 0xb2, 0x45, 0xf2, 0x7c, 0x7b, 0x08, 0x39, 0x65, 0x2b, 0x2b, 0xff, 0x60, 0x25, 0x60, 0x70, 0xbd, 0x03, 0x68, 0x0b, 0xf7, 0x60, 0x01, 0x60, 0x4d, 0x0c, 0x1a, 0x68, 0x02, 0x60, 0xe7, 0x18, 0x00, 0x70, 0x63, 0x00, 0x49, 0x0c, 0x0e, 0x00, 0x15, 0xff, 0x00, 0xb0, 0xb1, 0xb9, 0xb1, 0xc2, 0xb9, 0x00, 0xea, 0x29, 0x01, 0x9c, 0x43, 0x08, 0x28, 0x43, 0x20, 0x6b, 0x1e, 0x2b, 0xff, 0x42, 0x0c, 0xd1, 0x63, 0x60, 0x00, 0x23, 0xa3, 0x2f, 0x60, 0xe3, 0x60, 0x26, 0x4f, 0x12, 0xe9, 0x8d, 0x00, 0xd3, 0x00, 0xd7, 0x20, 0xe5, 0xe7, 0x63, 0x07, 0xf5, 0x93, 0x10, 0xd8, 0xb1, 0xe9, 0xc1, 0xa1, 0x0a, 0x45, 0x0c, 0x40, 0x45, 0x20, 0xa3, 0x68, 0xe2, 0xff, 0x68, 0x9a, 0x42, 0x0d, 0xd0, 0x62, 0x68, 0x13, 0xff, 0x40, 0x22, 0x68, 0xd3, 0x5c, 0x2b, 0x70, 0xa3, 0x6f, 0x68, 0x01, 0x33, 0xa3, 0x4d, 0x10, 0xe5, 0xe7, 0xa1, 0x06, 0x55, 0x0a, 0x49, 0x00, 0xf7, 0xf1, 0x19, 0x9c, 0xf1, 0x21, 0x51, 0x49, 0x20, 0xf9, 0x63, 0x49, 0x00, 0x43, 0x04, 0xd5, 0x54, 0xe3, 0x68, 0xa2, 0xff, 0x68, 0x9a, 0x1a, 0x61, 0x68, 0x8a, 0x42, 0x01, 0xff, 0xd9, 0x59, 0x1a, 0xa1, 0x60, 0x01, 0x33, 0xe3, 0xe8, 0x4f, 0x08, 0x75, 0x0e, 0x3f, 0x24, 0x67, 0x3f, 0x20, 0xe0, 0x68, 0xa3, 0x5f, 0x68, 0xc0, 0x1a, 0x10, 0xbd, 0x4d, 0x05, 0x25, 0x03, 0x00, 0xff, 0x41, 0xf6, 0x00, 0x43, 0xc4, 0xf2, 0x00, 0x23, 0xff, 0x98, 0x42, 0x00, 0xd0, 0x70, 0x47, 0x40, 0xf2, 0x77, 0x14, 0x13, 0xc2, 0x27, 0x00, 0x19, 0x60, 0xf8, 0xbd, 0x02, 0xff, 0x42, 0x69, 0x91, 0x79, 0x53, 0x79, 0x0b, 0x40, 0xff, 0xd9, 0x07, 0x04, 0xd4, 0x99, 0x07, 0x0a, 0xd4, 0xff, 0x5b, 0x07, 0x0e, 0xd4, 0x10, 0xbd, 0x01, 0x23, 0xff, 0x93, 0x71, 0x83, 0x68, 0x92, 0x8c, 0x92, 0xb2, 0x7f, 0x00, 0x21, 0x98, 0x47, 0xf6, 0xe7, 0x02, 0x0f, 0x00, 0xbb, 0x43, 0x68, 0x0b, 0x04, 0xf0, 0xe7, 0x04, 0x0b, 0x00, 0x03, 0xba, 0x0b, 0x08, 0xea, 0x3f, 0x00, 0x43, 0xf6, 0x3d, 0x93, 0x13, 0x02, 0xff, 0x00, 0x00, 0x20, 0x60, 0xb1, 0x45, 0xf2, 0xdc, 0xe6, 0x95, 0x08, 0x8e, 0x22, 0x1f, 0x26, 0xed, 0x06, 0x45, 0xf2, 0xc0, 0xfe, 0x19, 0x08, 0xc3, 0x00, 0x1b, 0x1a, 0x9c, 0x00, 0x63, 0xff, 0x5c, 0x9a, 0x42, 0xf4, 0xd0, 0x01, 0x30, 0xc0, 0xbb, 0xb2, 0xe4, 0x0f, 0x11, 0x46, 0xf2, 0x20, 0x49, 0x00, 0x80, 0xff, 0x03, 0x1b, 0x68, 0x1e, 0x02, 0x40, 0xf2, 0x00, 0xff, 0x72, 0x32, 0x40, 0xdb, 0x08, 0x07, 0x26, 0x1e, 0xf7, 0x40, 0x16, 0x43, 0x53, 0x14, 0x4e, 0xf2, 0x00, 0x43, 0xff, 0xcb, 0xf6, 0xff, 0x53, 0xc0, 0x18, 0x43, 0x42, 0xf5, 0x58, 0xf3, 0x00, 0xb2, 0x07, 0x26, 0x8c, 0xdb, 0x07, 0x14, 0xff, 0xd4, 0x23, 0x8c, 0x9b, 0x07, 0xfc, 0xd1, 0x23, 0x7f, 0x78, 0x9b, 0x07, 0x09, 0xd5, 0x23, 0x78, 0x81, 0x0a, 0xb9, 0x70, 0x13, 0x10, 0x05, 0x04, 0xd4, 0x01, 0x23, 0x0f, 0x1c, 0xdb, 0xfe, 0x0f, 0x00, 0xa6, 0x85, 0xea, 0x00, 0x52, 0x1b, 0x93, 0xf6, 0x4b, 0x01, 0xc0, 0x52, 0x47, 0x00, 0x02, 0x94, 0x46, 0x63, 0xff, 0x44, 0x9a, 0x78, 0x62, 0x70, 0xda, 0x78, 0xa2, 0xff, 0x70, 0x1a, 0x79, 0xe2, 0x70, 0xdb, 0x88, 0x23, 0x7f, 0x81, 0x23, 0x8c, 0x5b, 0x05, 0xfc, 0xd1, 0x27, 0x3c, 0xf7, 0x1b, 0x89, 0x63, 0x1b, 0x58, 0x9b, 0x7a, 0x23, 0x73, 0xee, 0x1b, 0x54, 0xdb, 0x7a, 0x63, 0x1b, 0x58, 0x9b, 0x89, 0xe3, 0xee, 0x53, 0x04, 0x06, 0xfc, 0xd4, 0x37, 0x40, 0x89, 0x23, 0x82, 0x77, 0x23, 0x8c, 0x1b, 0x1b, 0x48, 0x1b, 0x8a, 0x63, 0x1b, 0x00, 0xbb, 0xdb, 0x05, 0x1b, 0x44, 0x5b, 0x8a, 0xa3, 0x1b, 0x00, 0x9b, 0x7e, 0x1b, 0x00, 0xeb, 0x00, 0x59, 0x1b, 0x8a, 0x00, 0x87, 0x15, 0xff, 0x8c, 0x46, 0x62, 0x44, 0x12, 0x7d, 0x22, 0x77, 0xff, 0x00, 0x22, 0xa2, 0x62, 0x5d, 0x1b, 0xab, 0x00, 0xf2, 0x29, 0x00, 0x78, 0x1d, 0x15, 0x63, 0x06, 0x70, 0xb5, 0x05, 0x00, 0xd3, 0x0c, 0x00, 0x7b, 0x15, 0x65, 0x0e, 0xee, 0x71, 0x21, 0x20, 0x00, 0xb7, 0x43, 0xf6, 0x9f, 0xfb, 0x11, 0x01, 0x00, 0x0d, 0x04, 0xe5, 0xfe, 0x0d, 0x10, 0x06, 0x00, 0x08, 0xb1, 0x30, 0x00, 0x70, 0xaf, 0xbd, 0x6c, 0x61, 0x29, 0x17, 0x08, 0x45, 0x17, 0x10, 0x28, 0xfa, 0x0b, 0x00, 0x41, 0x0b, 0x10, 0x43, 0xb2, 0x00, 0x2b, 0x0f, 0xff, 0xdb, 0x5a, 0x09, 0x1f, 0x21, 0x01, 0x40, 0x01, 0xb7, 0x24, 0x8c, 0x40, 0xdb, 0x01, 0x11, 0xce, 0x67, 0x00, 0x20, 0xff, 0x32, 0x92, 0x00, 0x54, 0x50, 0xbf, 0xf3, 0x4f, 0xff, 0x8f, 0xbf, 0xf3, 0x6f, 0x8f, 0x00, 0x2b, 0x0b, 0xfa, 0x23, 0x40, 0x60, 0x23, 0x08, 0x00, 0x2b, 0x0a, 0xdb, 0x5b, 0xff, 0x09, 0x1f, 0x22, 0x02, 0x40, 0x01, 0x21, 0x91, 0xfa, 0x1b, 0x04, 0x12, 0x1b, 0x00, 0x02, 0x9b, 0x00, 0x99, 0x50, 0x5c, 0x55, 0x06, 0x5f, 0xfc, 0x00, 0x2b, 0x9c, 0x5f, 0x08, 0x10, 0x5f, 0x00, 0xfd, 0x81, 0x5f, 0x28, 0x90, 0xe7, 0x42, 0x69, 0x11, 0x73, 0xf9, 0x13, 0xc3, 0x09, 0x63, 0x07, 0x42, 0x69, 0x13, 0x78, 0x02, 0xff, 0x21, 0x0b, 0x43, 0xdb, 0xb2, 0x13, 0x70, 0x13, 0xec, 0x3f, 0x09, 0x13, 0x14, 0x8b, 0x43, 0x11, 0x1c, 0x43, 0x69, 0x5a, 0xff, 0x89, 0x12, 0x09, 0x03, 0x23, 0x13, 0x40, 0x03, 0xef, 0x2b, 0x01, 0xd0, 0x02, 0x37, 0x00, 0x01, 0x20, 0xfc, 0xd6, 0x49, 0x00, 0x13, 0x7e, 0x3b, 0x10, 0x76, 0x51, 0x0c, 0x70, 0x47, 0xff, 0x30, 0xb5, 0x44, 0x69, 0x23, 0x89, 0x1f, 0x25, 0x7f, 0xab, 0x43, 0x29, 0x40, 0x19, 0x43, 0x21, 0x65, 0x12, 0xff, 0x41, 0x69, 0x0b, 0x89, 0x06, 0x48, 0x03, 0x40, 0xfb, 0x10, 0x02, 0xcf, 0x03, 0x72, 0x02, 0x40, 0x1a, 0x43, 0xf7, 0x0a, 0x81, 0x0b, 0x19, 0x08, 0x30, 0xbd, 0xc0, 0x46, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x41, 0x69, 0x01, 0x2a, 0xff, 0x06, 0xd0, 0x02, 0x2a, 0x0b, 0xd0, 0x12, 0xb9, 0xff, 0x83, 0xb1, 0x01, 0x23, 0x4b, 0x71, 0x70, 0x47, 0x7f, 0x13, 0xb9, 0x04, 0x33, 0x0b, 0x71, 0xfa, 0xb5, 0x03, 0x7f, 0x4b, 0x71, 0xf7, 0xe7, 0x13, 0xb9, 0x02, 0x0d, 0x00, 0x7d, 0xf3, 0xcf, 0x03, 0x4b, 0x71, 0xf0, 0xe7, 0x01, 0x0b, 0x00, 0x7d, 0xed, 0xc3, 0x03, 0x40, 0xf2, 0x14, 0x13, 0xc2, 0x95, 0x01, 0xdf, 0x18, 0x68, 0x43, 0xf6, 0x5f, 0x9f, 0x11, 0x10, 0xbd, 0xfc, 0x17, 0x54, 0x3b, 0x05, 0x30, 0xbf, 0x70, 0x47, 0x83, 0x00, 0xff, 0x18, 0x18, 0x43, 0x01, 0x1d, 0x33, 0x1e, 0x20, 0xef, 0xb3, 0xfb, 0xf0, 0xf0, 0xcd, 0x00, 0x39, 0xfd, 0xd8, 0xdf, 0x70, 0x47, 0x10, 0xb5, 0x44, 0x27, 0x00, 0xc4, 0xf2, 0xff, 0x00, 0x13, 0x5a, 0x68, 0x5a, 0x60, 0x00, 0x20, 0x77, 0x44, 0xf2, 0x6f, 0xf1, 0x15, 0xf6, 0xf7, 0x73, 0x09, 0x0c, 0xb7, 0x44, 0xf2, 0x13, 0x13, 0x18, 0x37, 0x63, 0x13, 0x14, 0x43, 0x7e, 0x13, 0x10, 0x1f, 0x20, 0x43, 0xf6, 0xc3, 0x53, 0x6d, 0x14, 0x5b, 0x03, 0x69, 0xd7, 0x07, 0x03, 0x69, 0x43, 0x05, 0x03, 0xd7, 0x0b, 0x2d, 0x03, 0xd7, 0x0b, 0x03, 0x70, 0x13, 0x10, 0x69, 0xd7, 0x0f, 0x0f, 0x1c, 0xfe, 0xd7, 0x07, 0x00, 0x23, 0x83, 0x70, 0x41, 0x22, 0x42, 0x49, 0x70, 0x15, 0x14, 0x1f, 0x00, 0x75, 0xa9, 0x05, 0xd3, 0x16, 0xf4, 0xd3, 0x22, 0xad, 0x4c, 0xd3, 0x22, 0x2c, 0x60, 0xaf, 0x06, 0x01, 0x7d, 0x10, 0x70, 0x17, 0xbd, 0x02, 0x68, 0xd9, 0x21, 0x69, 0xc7, 0x0d, 0x13, 0x0c, 0xd9, 0x09, 0xfc, 0x11, 0x1c, 0x09, 0x08, 0x13, 0x78, 0x5b, 0x08, 0x01, 0x20, 0xfb, 0x18, 0x40, 0x11, 0x04, 0x11, 0x81, 0x13, 0x69, 0x5b, 0x7e, 0x89, 0x00, 0x70, 0x47, 0xc3, 0x07, 0x10, 0xd5, 0xb1, 0x01, 0xfd, 0x43, 0x13, 0x01, 0x03, 0x40, 0xf2, 0x05, 0x12, 0xc0, 0xdf, 0xf2, 0x01, 0x02, 0x1a, 0x62, 0x11, 0x14, 0x5b, 0x68, 0x7f, 0x7d, 0x22, 0x1a, 0x42, 0xf7, 0xd1, 0x43, 0x25, 0x20, 0x55, 0x42, 0x25, 0x10, 0x9a, 0x25, 0x38, 0x03, 0x4b, 0x28, 0x03, 0x25, 0x08, 0xbd, 0xda, 0x25, 0x38, 0x70, 0x47, 0x40, 0xf6, 0x83, 0x09, 0x03, 0xc7, 0x01, 0x22, 0x1a, 0x03, 0x02, 0xf9, 0x04, 0x95, 0x15, 0x1b, 0x8b, 0xef, 0x5b, 0x07, 0xf8, 0xd5, 0x0d, 0x14, 0x3f, 0x22, 0x1a, 0xff, 0x75, 0x02, 0x28, 0x1b, 0xd0, 0x04, 0x28, 0x19, 0x7f, 0xd0, 0x11, 0x4b, 0x18, 0x43, 0x80, 0xb2, 0x19, 0x14, 0xfb, 0x18, 0x80, 0x31, 0x18, 0x7d, 0xdb, 0x07, 0x10, 0xd4, 0xfe, 0x0d, 0x14, 0x1a, 0x7d, 0x1e, 0x23, 0x1a, 0x42, 0xf0, 0x7f, 0xd0, 0x1e, 0x20, 0x40, 0x42, 0x06, 0xe0, 0x15, 0x14, 0xef, 0xd9, 0x61, 0xdf, 0xe7, 0x65, 0x04, 0xc0, 0x46, 0x00, 0xff, 0xa5, 0xff, 0xff, 0x10, 0xb5, 0x01, 0x00, 0x02, 0xf6, 0xc5, 0x01, 0x49, 0x63, 0xc5, 0x15, 0x70, 0xb5, 0x06, 0x00, 0xff, 0x0d, 0x00, 0x14, 0x00, 0x83, 0x06, 0x1e, 0xd1, 0x7f, 0x40, 0x2a, 0x1f, 0xd8, 0x01, 0x00, 0x44, 0x1f, 0x20, 0xff, 0x70, 0x08, 0x00, 0x23, 0x04, 0xe0, 0x41, 0x00, 0xff, 0x0a, 0x80, 0x02, 0x33, 0x9b, 0xb2, 0x01, 0x30, 0xff, 0xa3, 0x42, 0x09, 0xd2, 0xe9, 0x5c, 0x8a, 0xb2, 0xff, 0x66, 0x1e, 0xb3, 0x42, 0xf3, 0xda, 0xea, 0x18, 0x7f, 0x52, 0x78, 0x12, 0x02, 0x0a, 0x43, 0xee, 0x61, 0x04, 0xdb, 0xbd, 0x0d, 0x77, 0x00, 0xfb, 0xe7, 0x05, 0x04, 0xf8, 0xe7, 0x5f, 0x70, 0xb5, 0x04, 0x00, 0x15, 0xaf, 0x01, 0xc7, 0x47, 0x10, 0xfb, 0x78, 0xb9, 0xb3, 0x18, 0x7a, 0xdb, 0x07, 0x01, 0xd4, 0x7f, 0x3f, 0x2d, 0x06, 0xd8, 0x21, 0x00, 0x04, 0x69, 0x24, 0xf5, 0xbd, 0x5b, 0x03, 0x08, 0x0b, 0x2d, 0xc3, 0x07, 0x07, 0xd5, 0xff, 0x01, 0x34, 0x01, 0x23, 0x98, 0x43, 0x03, 0x88, 0xef, 0x1b, 0x0a, 0x0b, 0x70, 0x2b, 0x02, 0xe0, 0x00, 0x23, 0xff, 0x01, 0xe0, 0x02, 0x33, 0x2c, 0x00, 0x93, 0x42, 0xff, 0x0b, 0xd2, 0x65, 0x1c, 0x64, 0x00, 0x20, 0x88, 0xff, 0x80, 0xb2, 0xc8, 0x54, 0x54, 0x1e, 0xa3, 0x42, 0xff, 0xf3, 0xd2, 0x5c, 0x1c, 0x00, 0x0a, 0x08, 0x55, 0xdd, 0xef, 0x8d, 0x00, 0x30, 0xbd, 0x43, 0x49, 0x0c, 0x23, 0x00, 0xff, 0x22, 0x1a, 0x70, 0x01, 0x32, 0x1a, 0x70, 0x40, 0xf7, 0xf2, 0x04, 0x02, 0x31, 0x03, 0x02, 0x11, 0x68, 0x59, 0xff, 0x60, 0x51, 0x68, 0x99, 0x60, 0x91, 0x68, 0xd9, 0xff, 0x60, 0x11, 0x7b, 0x19, 0x70, 0x52, 0x7b, 0x1a, 0x29, 0x74, 0x1f, 0x05, 0x2f, 0x00, 0x02, 0x2f, 0x00, 0x22, 0x55, 0x1e, 0x15, 0x10, 0xfa, 0x45, 0x08, 0x1a, 0x15, 0x00, 0x8a, 0x43, 0x1a, 0x70, 0x70, 0xf7, 0x47, 0x41, 0xf2, 0xd1, 0x0d, 0xda, 0x69, 0x12, 0x0a, 0x7d, 0x12, 0xef, 0x07, 0x71, 0x0a, 0x40, 0xda, 0x61, 0xcd, 0x01, 0x79, 0x74, 0x1b, 0x08, 0xdb, 0x09, 0x0e, 0x22, 0x1a, 0x76, 0x0b, 0x14, 0x7f, 0x1b, 0x69, 0xdb, 0x06, 0xf8, 0xd5, 0x41, 0x5d, 0x0c, 0x7f, 0x02, 0x13, 0x7e, 0x80, 0x21, 0x49, 0x42, 0x5f, 0x08, 0xfd, 0x76, 0xf3, 0x02, 0x47, 0x04, 0x28, 0x06, 0xd0, 0x06, 0x7f, 0x28, 0x04, 0xd0, 0x02, 0x28, 0x02, 0xd0, 0x39, 0x05, 0xbf, 0x0a, 0xe0, 0x40, 0xf2, 0x00, 0x42, 0x29, 0x04, 0x53, 0xfb, 0x78, 0x07, 0xc9, 0x02, 0x08, 0x40, 0x18, 0x43, 0x50, 0xfa, 0x89, 0x08, 0x40, 0x77, 0x10, 0x9b, 0x78, 0x03, 0x22, 0x13, 0xdf, 0x40, 0x98, 0x42, 0x12, 0xd0, 0x11, 0x14, 0xfc, 0x32, 0xdf, 0x9a, 0x71, 0x9a, 0x78, 0x03, 0x9f, 0x00, 0x08, 0x40, 0xef, 0x10, 0x43, 0x98, 0x70, 0x29, 0x18, 0x79, 0x00, 0x2b, 0xfb, 0xf8, 0xd0, 0xf7, 0x07, 0x04, 0x00, 0xc3, 0x68, 0x9b, 0xff, 0x89, 0xdb, 0x05, 0x06, 0xd5, 0x03, 0x68, 0x03, 0xdf, 0xb1, 0x98, 0x47, 0xe3, 0x68, 0x23, 0x00, 0x12, 0x9a, 0x59, 0x81, 0xfd, 0x05, 0x75, 0x0f, 0x0c, 0x61, 0x75, 0x1f, 0x30, 0x75, 0x23, 0xff, 0xec, 0x60, 0x01, 0x23, 0x23, 0x80, 0x23, 0x69, 0xff, 0x48, 0xf2, 0x03, 0x02, 0x1a, 0x42, 0xfa, 0xd1, 0xf1, 0xea, 0x4f, 0x03, 0xc5, 0x07, 0x3f, 0x00, 0x13, 0x53, 0x60, 0xe9, 0xbf, 0x68, 0x0b, 0x4b, 0x0b, 0x80, 0x0b, 0x1d, 0x20, 0xa3, 0xd7, 0x23, 0x13, 0x62, 0x71, 0x03, 0x06, 0x21, 0x0c, 0xea, 0x68, 0xbf, 0x53, 0x81, 0x40, 0xf2, 0x18, 0x13, 0x77, 0x01, 0x03, 0xdb, 0x1d, 0x60, 0x23, 0x06, 0x80, 0x80, 0x83, 0x06, 0x04, 0x00, 0xff, 0x10, 0xb3, 0xc3, 0x68, 0xf3, 0xb1, 0x01, 0x20, 0xaa, 0x79, 0x14, 0x52, 0x73, 0x20, 0x4e, 0x39, 0x00, 0xce, 0x09, 0x00, 0x04, 0xff, 0x21, 0x80, 0x22, 0x99, 0x50, 0xbf, 0xf3, 0x4f, 0xff, 0x8f, 0xbf, 0xf3, 0x6f, 0x8f, 0xe1, 0x68, 0x01, 0xbd, 0x23, 0x6b, 0x24, 0x10, 0xbd, 0x00, 0x20, 0xd9, 0x06, 0xdd, 0xb5, 0xe7, 0x4f, 0x04, 0x48, 0x4f, 0x00, 0x2b, 0xb3, 0x4f, 0x1c, 0x5e, 0xfe, 0x4f, 0x44, 0x22, 0x1a, 0x60, 0xe2, 0x68, 0x00, 0x23, 0xdf, 0x93, 0x61, 0x13, 0x69, 0x1b, 0xc3, 0x00, 0xe3, 0x68, 0xf7, 0x1a, 0x69, 0x12, 0x07, 0x00, 0x1a, 0x88, 0x02, 0x21, 0x7f, 0x0a, 0x43, 0x92, 0xb2, 0x1a, 0x80, 0x1a, 0x5d, 0x04, 0xab, 0x01, 0x11, 0x5d, 0x10, 0xd8, 0x5d, 0x00, 0xd6, 0x5d, 0x08, 0xc8, 0xaf, 0xb1, 0xc3, 0x68, 0xab, 0xad, 0x20, 0x6b, 0x5d, 0x20, 0xe1, 0x7f, 0x68, 0x0b, 0x88, 0x02, 0x22, 0x93, 0x43, 0x9b, 0x34, 0x7d, 0xe8, 0x3d, 0x00, 0xe6, 0xe7, 0xc2, 0x68, 0x11, 0x0f, 0x11, 0xef, 0x70, 0x47, 0xc1, 0x68, 0x21, 0x1c, 0x0b, 0x88, 0x5b, 0x9f, 0x08, 0x01, 0x20, 0x18, 0x40, 0x03, 0x06, 0xdd, 0x05, 0x10, 0xfd, 0xb5, 0x27, 0x15, 0x18, 0x68, 0x44, 0xf2, 0xa9, 0x03, 0xfe, 0x9d, 0x17, 0x30, 0xb5, 0x85, 0xb0, 0x01, 0xaa, 0x45, 0xfb, 0xf2, 0x24, 0x6d, 0x08, 0x32, 0xcb, 0x32, 0xc2, 0x00, 0xff, 0x23, 0x02, 0x2b, 0x08, 0xd8, 0x9a, 0x00, 0x01, 0xff, 0xa9, 0x52, 0x58, 0x82, 0x42, 0x01, 0xd0, 0x01, 0xff, 0x33, 0xf6, 0xe7, 0xd8, 0xb2, 0x00, 0xe0, 0x00, 0xdf, 0x20, 0x05, 0xb0, 0x30, 0xbd, 0xfb, 0x11, 0x23, 0x98, 0xd7, 0x42, 0x00, 0xd0, 0x33, 0x06, 0x1c, 0x53, 0x08, 0x19, 0x60, 0xbd, 0xf8, 0xc7, 0x00, 0x44, 0xf2, 0x65, 0x23, 0x57, 0x0c, 0x80, 0xff, 0x00, 0xc0, 0xb2, 0x16, 0x30, 0xc0, 0xb2, 0x10, 0xfd, 0xbd, 0x15, 0x24, 0x00, 0x23, 0x73, 0xb1, 0x45, 0xf2, 0xfd, 0x84, 0xe1, 0x08, 0x40, 0xf2, 0xe6, 0x72, 0x00, 0x20, 0x7a, 0xe5, 0x1c, 0x01, 0x9b, 0x02, 0x10, 0xbd, 0x1a, 0x01, 0x89, 0x00, 0xfe, 0x1f, 0x08, 0x8c, 0x46, 0x62, 0x44, 0x3c, 0x21, 0x52, 0xef, 0x5c, 0x90, 0x42, 0x02, 0x81, 0x00, 0xdb, 0xb2, 0xe1, 0xef, 0xe7, 0x58, 0xb2, 0xee, 0x2b, 0x09, 0x44, 0xf2, 0xc5, 0xbe, 0x4f, 0x10, 0x43, 0x1c, 0x3e, 0xd0, 0xe3, 0x2d, 0x02, 0x1f, 0xeb, 0xd4, 0x03, 0x37, 0x04, 0x62, 0x15, 0x00, 0x02, 0x94, 0x46, 0xff, 0x63, 0x44, 0x1a, 0x6c, 0x1c, 0x23, 0x1a, 0x40, 0xff, 0xe3, 0x69, 0x9b, 0x07, 0xfc, 0xd1, 0x23, 0x68, 0x7f, 0x9b, 0x07, 0x09, 0xd5, 0x23, 0x68, 0x02, 0xeb, 0x02, 0xf3, 0x23, 0x60, 0x13, 0x0c, 0x05, 0x08, 0xd4, 0x01, 0x23, 0x13, 0xd8, 0x11, 0x20, 0x73, 0x06, 0x45, 0x2c, 0x1b, 0x6c, 0x1d, 0x14, 0x00, 0x01, 0xfe, 0x1f, 0x15, 0x9c, 0x46, 0x60, 0x44, 0x43, 0x6c, 0x63, 0xff, 0x60, 0x26, 0x23, 0x63, 0x62, 0x00, 0x20, 0x10, 0xfd, 0xbd, 0x51, 0x07, 0xfb, 0xe7, 0x70, 0xb5, 0x06, 0x00, 0xff, 0x05, 0x68, 0x2c, 0x7e, 0xe4, 0xb2, 0x63, 0xb2, 0xff, 0x00, 0x2b, 0x24, 0xdb, 0xa3, 0x07, 0x01, 0xd5, 0x5f, 0x02, 0x23, 0x2b, 0x76, 0xe3, 0x07, 0x00, 0x01, 0x07, 0x00, 0xff, 0x63, 0x07, 0x19, 0xd5, 0x6b, 0x8b, 0x1b, 0x07, 0xdb, 0x2a, 0xd4, 0xfd, 0x14, 0xf0, 0x68, 0x09, 0x0f, 0x40, 0xf2, 0xfb, 0xa5, 0x72, 0x03, 0x1d, 0xf3, 0x68, 0x28, 0x22, 0xa9, 0xff, 0x5c, 0xc9, 0xb2, 0x30, 0x00, 0x98, 0x47, 0x04, 0xa6, 0x37, 0x00, 0x70, 0xbd, 0x2d, 0x19, 0x2f, 0x18, 0x9a, 0x2f, 0x20, 0x30, 0x7f, 0x00, 0x73, 0x68, 0x98, 0x47, 0xc7, 0xe7, 0x25, 0x14, 0xb5, 0xb0, 0x25, 0x18, 0xa8, 0x25, 0x20, 0xb3, 0x68, 0x4f, 0x04, 0xd6, 0xff, 0xe7, 0x00, 0x00, 0x70, 0xb5, 0x82, 0xb0, 0x04, 0xf7, 0x00, 0x0e, 0x00, 0xd5, 0x0c, 0x25, 0x68, 0x6d, 0x08, 0xff, 0x01, 0x23, 0x1d, 0x40, 0x01, 0xa8, 0x42, 0xf6, 0xe1, 0xb5, 0x2b, 0x10, 0x27, 0x01, 0x69, 0x02, 0xf7, 0x14, 0x61, 0x6a, 0x0c, 0xff, 0x4b, 0x19, 0x40, 0x76, 0x00, 0x40, 0xf2, 0xfe, 0x7f, 0x73, 0x33, 0x40, 0x19, 0x43, 0x61, 0x62, 0x2b, 0x04, 0xcd, 0xc3, 0x2b, 0x10, 0x35, 0xb1, 0x2d, 0x04, 0x43, 0x1d, 0x00, 0x20, 0xff, 0x02, 0xb0, 0x70, 0xbd, 0x01, 0xf8, 0xff, 0xff, 0xe9, 0xf8, 0x0f, 0x01, 0xf3, 0x07, 0x84, 0xf3, 0x23, 0x40, 0xf2, 0xbe, 0xb5, 0x62, 0x93, 0x1c, 0x20, 0xc5, 0x01, 0x13, 0x33, 0x0b, 0x0c, 0x05, 0xff, 0x00, 0x08, 0xb1, 0x28, 0x00, 0xf8, 0xbd, 0x34, 0xb7, 0x60, 0x31, 0x00, 0x17, 0x04, 0x95, 0x23, 0x23, 0x1c, 0xaf, 0xde, 0x39, 0x16, 0x21, 0x02, 0xe0, 0x01, 0x4f, 0x02, 0x01, 0x31, 0xdf, 0x03, 0x29, 0x2e, 0xd8, 0x43, 0x65, 0x01, 0x0f, 0xdb, 0xff, 0x5a, 0x09, 0x1f, 0x26, 0x06, 0x40, 0x01, 0x27, 0xeb, 0xb7, 0x40, 0x7f, 0x03, 0x16, 0x7f, 0x03, 0x06, 0x20, 0x32, 0xef, 0x92, 0x00, 0x97, 0x51, 0xcf, 0x17, 0x00, 0x2b, 0x0b, 0xfa, 0x23, 0x40, 0x60, 0x23, 0x08, 0x00, 0x2b, 0xd7, 0xdb, 0x5b, 0xff, 0x09, 0x1f, 0x22, 0x02, 0x40, 0x01, 0x26, 0x96, 0xfa, 0x1b, 0x04, 0x12, 0x1b, 0x00, 0x02, 0x9b, 0x00, 0x9e, 0x50, 0xff, 0xcb, 0xe7, 0x02, 0x23, 0xa3, 0x75, 0x01, 0x3b, 0x7f, 0xa3, 0x75, 0xb4, 0xe7, 0x02, 0x68, 0x13, 0x37, 0x02, 0xdf, 0x0b, 0x43, 0x13, 0x60, 0xd3, 0xe1, 0x10, 0x70, 0x47, 0xbf, 0x03, 0x68, 0x5b, 0x6a, 0xdb, 0x0b, 0x59, 0x0f, 0x10, 0xdb, 0xb5, 0x00, 0x4b, 0x03, 0x51, 0x43, 0x4b, 0x17, 0x02, 0x68, 0xcf, 0x28, 0x23, 0xd1, 0x54, 0x71, 0x03, 0xff, 0x00, 0x0d, 0x00, 0xf5, 0x14, 0x01, 0x39, 0x84, 0x95, 0x21, 0x6b, 0x1e, 0xdb, 0xb2, 0xff, 0x01, 0x2b, 0x06, 0xd9, 0x1d, 0xb9, 0x33, 0x68, 0xbf, 0x5c, 0xb1, 0x80, 0x22, 0x9a, 0x75, 0x5d, 0x00, 0xbd, 0xff, 0x33, 0x68, 0x14, 0xb9, 0x04, 0x22, 0x1a, 0x75, 0x77, 0xf8, 0xe7, 0x04, 0x11, 0x00, 0xf5, 0xe7, 0x80, 0x0b, 0x00, 0x2b, 0xf2, 0xe7, 0xbb, 0x07, 0x1c, 0xbb, 0x1f, 0x33, 0x6f, 0x14, 0x17, 0xfc, 0xde, 0x17, 0x14, 0x41, 0xf2, 0x61, 0x13, 0x0d, 0x0c, 0x42, 0xf2, 0x5b, 0x1b, 0x63, 0x09, 0x14, 0xaf, 0x53, 0x09, 0x0c, 0x06, 0xa7, 0x03, 0xdd, 0x05, 0xe5, 0x10, 0xf8, 0xe7, 0x48, 0x29, 0x01, 0xc0, 0x23, 0xff, 0xdb, 0x05, 0x9a, 0x61, 0x70, 0x47, 0x41, 0xf6, 0xf7, 0x00, 0x43, 0xc4, 0x17, 0x00, 0x42, 0x21, 0xac, 0x22, 0xff, 0x99, 0x50, 0x01, 0x31, 0x04, 0x3a, 0x99, 0x50, 0xef, 0x40, 0xf6, 0x00, 0x03, 0x13, 0x04, 0xda, 0x69, 0x41, 0xdf, 0x39, 0x0a, 0x43, 0xda, 0x61, 0x27, 0x05, 0x40, 0xf2, 0xfb, 0x20, 0x11, 0x77, 0x00, 0x01, 0x08, 0x6c, 0x05, 0x22, 0xb7, 0x43, 0xf2, 0x99, 0x91, 0x28, 0x98, 0x20, 0x19, 0x00, 0x00, 0xf7, 0x43, 0xf2, 0x6b, 0x15, 0x10, 0x04, 0x28, 0x00, 0xdc, 0xf3, 0x10, 0xbd, 0x31, 0x00, 0xa9, 0x08, 0x19, 0x00, 0x44, 0x31, 0x75, 0x18, 0x35, 0x08, 0xcf, 0x1f, 0x10, 0x40, 0xf2, 0xa0, 0x19, 0x08, 0xbf, 0x5b, 0x6b, 0x08, 0x2b, 0xea, 0xd0, 0x0d, 0x14, 0xd9, 0xff, 0x6a, 0x04, 0x33, 0x8a, 0x00, 0x52, 0x18, 0x9b, 0xd7, 0x18, 0x58, 0x1d, 0x3b, 0x00, 0x12, 0x13, 0x00, 0x02, 0x44, 0xff, 0x32, 0x03, 0xe0, 0x11, 0x78, 0x19, 0x70, 0x01, 0x7f, 0x33, 0x01, 0x32, 0x98, 0x42, 0xf9, 0xd8, 0x2b, 0x14, 0xff, 0xda, 0x6a, 0x51, 0x1c, 0x07, 0x22, 0x0a, 0x40, 0xff, 0xda, 0x62, 0x5a, 0x6b, 0x01, 0x32, 0x5a, 0x63, 0xed, 0xc7, 0xc1, 0x03, 0x43, 0xf2, 0xb5, 0x0c, 0x50, 0x20, 0x19, 0xff, 0x5c, 0x04, 0x22, 0x91, 0x43, 0x19, 0x54, 0x19, 0xff, 0x5c, 0x01, 0x25, 0xa9, 0x43, 0x01, 0x24, 0x21, 0xff, 0x43, 0xc9, 0xb2, 0x19, 0x54, 0x18, 0x38, 0x19, 0xff, 0x5c, 0x0f, 0x26, 0xb1, 0x43, 0x03, 0x26, 0x31, 0xfe, 0x0f, 0x08, 0x51, 0x21, 0x5e, 0x5c, 0x96, 0x43, 0x5e, 0xff, 0x54, 0x5a, 0x5c, 0xaa, 0x43, 0x22, 0x43, 0xd2, 0xff, 0xb2, 0x5a, 0x54, 0x1a, 0x5c, 0x42, 0x39, 0x0a, 0xef, 0x40, 0x30, 0x21, 0x0a, 0x0d, 0x00, 0x1a, 0x54, 0x70, 0xfe, 0xdb, 0x00, 0x84, 0xb0, 0x20, 0xe0, 0x19, 0x78, 0x11, 0xb6, 0x7f, 0x38, 0x1a, 0x6b, 0x7f, 0x0c, 0x1a, 0x63, 0x7f, 0x00, 0x3a, 0x6f, 0x5a, 0x63, 0x01, 0x24, 0x57, 0x27, 0x04, 0xb3, 0x27, 0x14, 0x3f, 0x9b, 0x6b, 0x02, 0xa8, 0x98, 0x47, 0x9f, 0x27, 0xfb, 0x1c, 0xdb, 0x5b, 0xb1, 0x0b, 0x14, 0x19, 0x6b, 0xf9, 0x1c, 0x02, 0xaa, 0xff, 0xca, 0xe7, 0x00, 0x24, 0xd7, 0xe7, 0x04, 0xb0, 0x4e, 0x5b, 0x05, 0x82, 0xb0, 0x03, 0x85, 0x02, 0x0d, 0x01, 0x10, 0x61, 0x05, 0x97, 0x0a, 0x00, 0x19, 0x91, 0x02, 0x09, 0xc7, 0x11, 0x55, 0x2c, 0x98, 0xfd, 0x23, 0x49, 0x04, 0x44, 0x22, 0x9b, 0x5a, 0x43, 0xb1, 0xfe, 0x0d, 0x14, 0x00, 0x22, 0x46, 0x21, 0x5a, 0x52, 0x02, 0x37, 0x39, 0x5a, 0x52, 0x9d, 0x24, 0x24, 0xb1, 0xff, 0x1d, 0x09, 0x14, 0xf7, 0x5a, 0x61, 0x02, 0x6f, 0x00, 0x30, 0xb5, 0x83, 0xb0, 0x3a, 0x93, 0x00, 0x14, 0x3b, 0x00, 0x04, 0xa0, 0x63, 0x17, 0x04, 0x1f, 0x04, 0xaf, 0x9a, 0x61, 0x9a, 0x60, 0x5b, 0x15, 0xc4, 0x0f, 0x04, 0x62, 0xff, 0xc0, 0x22, 0x12, 0x06, 0x9a, 0x62, 0x4f, 0x21, 0xff, 0x5a, 0x5c, 0x01, 0x20, 0x82, 0x43, 0x5a, 0x54, 0xf7, 0x44, 0xf2, 0xa3, 0x5b, 0x10, 0x22, 0x00, 0x3c, 0x32, 0xaf, 0x40, 0xf2, 0x00, 0x41, 0x27, 0x00, 0x21, 0x85, 0x00, 0x24, 0x6e, 0x49, 0x04, 0x40, 0x23, 0x20, 0x1b, 0x02, 0x9f, 0x15, 0x21, 0x00, 0x7f, 0x05, 0xa8, 0x47, 0x44, 0xf2, 0x6b, 0x73, 0xb3, 0x14, 0xd6, 0x51, 0x0e, 0x40, 0x31, 0x1f, 0x04, 0x3b, 0x1b, 0x12, 0x44, 0xf2, 0xbb, 0xe3, 0x62, 0x09, 0x00, 0x02, 0x03, 0x21, 0x15, 0x04, 0xed, 0x95, 0x25, 0x35, 0x14, 0x97, 0x15, 0x08, 0x02, 0x15, 0x00, 0x0d, 0x04, 0xc9, 0xfa, 0x0d, 0x08, 0x01, 0x0d, 0x08, 0x6b, 0x46, 0xd8, 0x1d, 0x42, 0xdb, 0xf6, 0xd7, 0xfd, 0x12, 0x58, 0xb1, 0x8f, 0x1e, 0x49, 0x23, 0xfe, 0x13, 0x0c, 0x00, 0x20, 0x03, 0xb0, 0x30, 0xbd, 0x6b, 0xd7, 0x46, 0xd9, 0x79, 0x53, 0x04, 0x9d, 0x15, 0x10, 0xea, 0xe7, 0xff, 0x00, 0x00, 0xff, 0x22, 0x43, 0x00, 0x5b, 0x08, 0xff, 0x01, 0x20, 0xd2, 0x05, 0x93, 0x42, 0x00, 0xdc, 0xfe, 0xbf, 0x03, 0x47, 0xc0, 0x46, 0x42, 0x00, 0x12, 0x0e, 0xff, 0x11, 0x00, 0x10, 0xb5, 0x01, 0x24, 0xc3, 0x17, 0xff, 0x7f, 0x39, 0x23, 0x43, 0x1e, 0x29, 0x0e, 0xdc, 0xff, 0x00, 0x29, 0x18, 0xdb, 0x80, 0x24, 0x40, 0x02, 0xff, 0x40, 0x0a, 0x24, 0x04, 0x04, 0x43, 0x16, 0x29, 0xff, 0x09, 0xdd, 0x20, 0x00, 0x96, 0x3a, 0x90, 0x40, 0xff, 0x43, 0x43, 0x18, 0x00, 0x10, 0xbd, 0x00, 0xf0, 0xff, 0x15, 0xfc, 0x03, 0x00, 0xf9, 0xe7, 0x80, 0x20, 0xff, 0xc0, 0x03, 0x08, 0x41, 0x17, 0x22, 0x00, 0x19, 0xff, 0x51, 0x1a, 0xc8, 0x40, 0xf0, 0xe7, 0x4a, 0x1c, 0xff, 0xef, 0xd0, 0x00, 0x23, 0xed, 0xe7, 0xc0, 0x46, 0xff, 0xf0, 0xb5, 0x57, 0x46, 0x4e, 0x46, 0xde, 0x46, 0xff, 0x45, 0x46, 0xe0, 0xb5, 0x43, 0x00, 0x44, 0x02, 0xff, 0xc6, 0x0f, 0x1b, 0x0e, 0x83, 0xb0, 0x0f, 0x1c, 0xff, 0x64, 0x0a, 0xb2, 0x46, 0x00, 0x2b, 0x54, 0xd0, 0xff, 0xff, 0x2b, 0x28, 0xd0, 0x80, 0x22, 0xe4, 0x00, 0xff, 0xd2, 0x04, 0x14, 0x43, 0x7f, 0x22, 0x52, 0x42, 0xeb, 0x90, 0x46, 0x45, 0x01, 0x09, 0x03, 0x00, 0x0b, 0x98, 0x44, 0xff, 0x78, 0x00, 0x7d, 0x02, 0xfb, 0x0f, 0x00, 0x0e, 0xff, 0x6d, 0x0a, 0x00, 0x93, 0x28, 0xb3, 0xff, 0x28, 0xff, 0x45, 0xd0, 0x80, 0x23, 0x00, 0x21, 0xed, 0x00, 0xff, 0xdb, 0x04, 0x1d, 0x43, 0x7f, 0x38, 0x47, 0x46, 0xff, 0x38, 0x1a, 0x4f, 0x46, 0x0f, 0x43, 0xbf, 0x00, 0xff, 0xb9, 0x46, 0x33, 0x00, 0x00, 0x9a, 0x87, 0x4f, 0xff, 0x53, 0x40, 0x4a, 0x46, 0xba, 0x58, 0x01, 0x93, 0xbf, 0x97, 0x46, 0x00, 0x2c, 0x4d, 0xd1, 0x3d, 0x14, 0x40, 0xfb, 0xf2, 0x08, 0x4f, 0x00, 0xff, 0x08, 0x40, 0xf2, 0x02, 0xfd, 0x0b, 0x49, 0x04, 0x00, 0x28, 0xd9, 0xd1, 0x25, 0xbb, 0xaf, 0x00, 0x20, 0x01, 0x21, 0x35, 0x04, 0x7a, 0x35, 0x00, 0x42, 0xff, 0x46, 0x10, 0x1a, 0x4a, 0x46, 0x0a, 0x43, 0x92, 0xdf, 0x00, 0xba, 0x58, 0x1d, 0x00, 0x3d, 0x00, 0x9b, 0x2c, 0xff, 0x00, 0x9a, 0x46, 0x8b, 0x46, 0x5b, 0x46, 0x02, 0xff, 0x2b, 0x30, 0xd1, 0x53, 0x46, 0xff, 0x21, 0x00, 0xff, 0x24, 0x37, 0xe0, 0xb4, 0xb9, 0x40, 0xf2, 0x04, 0xfc, 0x99, 0x04, 0x49, 0x00, 0x01, 0x0b, 0xb0, 0xe7, 0xff, 0x20, 0xff, 0x5d, 0xb9, 0x02, 0x21, 0xdc, 0xe7, 0x28, 0x00, 0xff, 0x00, 0xf0, 0x46, 0xfc, 0x43, 0x1f, 0x9d, 0x40, 0xff, 0x76, 0x23, 0x5b, 0x42, 0x18, 0x1a, 0x00, 0x21, 0x7f, 0xb1, 0xe7, 0x03, 0x21, 0xaf, 0xe7, 0x20, 0x17, 0x00, 0x75, 0x3a, 0x17, 0x00, 0x9c, 0x17, 0x08, 0x1b, 0x1a, 0x98, 0xd9, 0x18, 0xdf, 0x92, 0xe7, 0x40, 0xf2, 0x0c, 0x93, 0x10, 0x03, 0x0b, 0xff, 0x8b, 0xe7, 0x03, 0x2b, 0x00, 0xd1, 0xa5, 0xe0, 0xff, 0x55, 0x46, 0x01, 0x2b, 0x00, 0xd0, 0x81, 0xe0, 0xfd, 0x01, 0xe3, 0x00, 0x00, 0x24, 0x2b, 0x40, 0x64, 0x02, 0xff, 0xc9, 0x05, 0x60, 0x0a, 0xdb, 0x07, 0x08, 0x43, 0xff, 0x18, 0x43, 0x03, 0xb0, 0x3c, 0xbc, 0x90, 0x46, 0xff, 0x99, 0x46, 0xa2, 0x46, 0xab, 0x46, 0xf0, 0xbd, 0xff, 0x80, 0x24, 0x00, 0x23, 0xe4, 0x03, 0xff, 0x21, 0xfb, 0xed, 0xe7, 0x99, 0x04, 0xea, 0xe7, 0x01, 0x23, 0x59, 0xff, 0x1a, 0x1b, 0x29, 0x66, 0xdd, 0x01, 0x9a, 0x13, 0xfd, 0x40, 0x3b, 0x04, 0xe1, 0xe7, 0x80, 0x23, 0xdb, 0x03, 0xff, 0x1c, 0x42, 0x38, 0xd0, 0x1d, 0x42, 0x51, 0xd0, 0xff, 0x1c, 0x43, 0x64, 0x02, 0x64, 0x0a, 0x33, 0x00, 0xff, 0xff, 0x21, 0xd5, 0xe7, 0x63, 0x01, 0x6c, 0x01, 0xff, 0xa3, 0x42, 0x3b, 0xd2, 0x1b, 0x26, 0x00, 0x21, 0xff, 0x01, 0x38, 0x01, 0x25, 0x1f, 0x00, 0x49, 0x00, 0xff, 0x5b, 0x00, 0x00, 0x2f, 0x01, 0xdb, 0x9c, 0x42, 0xff, 0x01, 0xd8, 0x1b, 0x1b, 0x29, 0x43, 0x01, 0x3e, 0xff, 0x00, 0x2e, 0xf3, 0xd1, 0x1c, 0x00, 0x63, 0x1e, 0xff, 0x9c, 0x41, 0x0c, 0x43, 0x01, 0x00, 0x7f, 0x31, 0xff, 0x00, 0x29, 0xce, 0xdd, 0x63, 0x07, 0x04, 0xd0, 0xdf, 0x0f, 0x23, 0x23, 0x40, 0x04, 0xa1, 0x00, 0x04, 0x34, 0xff, 0x23, 0x01, 0x03, 0xd5, 0x01, 0x00, 0x2d, 0x4b, 0xff, 0x80, 0x31, 0x1c, 0x40, 0xfe, 0x29, 0x0d, 0xdd, 0xbf, 0x01, 0x23, 0x01, 0x9a, 0xff, 0x21, 0x7b, 0x00, 0x24, 0xd9, 0xa4, 0x79, 0x0c, 0x71, 0x18, 0x9c, 0xe7, 0x1b, 0x04, 0xa4, 0x01, 0xff, 0x64, 0x0a, 0xc9, 0xb2, 0x13, 0x40, 0x95, 0xe7, 0xff, 0x1b, 0x1b, 0x1a, 0x26, 0x01, 0x21, 0xc2, 0xe7, 0xff, 0x00, 0x9b, 0x8b, 0x46, 0x9a, 0x46, 0x00, 0x24, 0xff, 0x4d, 0xe7, 0x63, 0x02, 0xe5, 0xd5, 0x00, 0x25, 0xdf, 0x80, 0x24, 0xe4, 0x03, 0x2c, 0x35, 0x08, 0x00, 0x9b, 0xff, 0xff, 0x21, 0x81, 0xe7, 0x01, 0x95, 0xc1, 0xe7, 0xff, 0x23, 0x00, 0x20, 0x20, 0xcb, 0x40, 0x41, 0x1a, 0xff, 0x8c, 0x40, 0x61, 0x1e, 0x8c, 0x41, 0x1c, 0x43, 0x5e, 0x83, 0x2c, 0x63, 0x01, 0x05, 0xd5, 0x5b, 0x04, 0x01, 0x77, 0x08, 0x49, 0x68, 0x67, 0x18, 0x01, 0x05, 0x61, 0x85, 0x20, 0xbd, 0x05, 0x59, 0x87, 0x02, 0xdf, 0xa0, 0x56, 0x00, 0x00, 0xe0, 0x03, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf0, 0xb5, 0x46, 0x46, 0x4f, 0x46, 0xff, 0xd6, 0x46, 0x43, 0x02, 0xc0, 0xb5, 0x46, 0x00, 0xdf, 0x5b, 0x0a, 0x36, 0x0e, 0x88, 0x5b, 0x01, 0xc4, 0x0f, 0xff, 0x00, 0x2e, 0x51, 0xd0, 0xff, 0x2e, 0x23, 0xd0, 0xff, 0x80, 0x20, 0xdb, 0x00, 0xc0, 0x04, 0x18, 0x43, 0xef, 0x81, 0x46, 0x00, 0x27, 0xaf, 0x01, 0x0a, 0x7f, 0x3e, 0xff, 0x43, 0x46, 0x58, 0x00, 0x5d, 0x02, 0x00, 0x0e, 0x7f, 0xdb, 0x0f, 0x6d, 0x0a, 0x98, 0x46, 0x08, 0x8b, 0x02, 0x7f, 0x42, 0xd0, 0xeb, 0x00, 0x80, 0x25, 0xed, 0x89, 0x02, 0xff, 0x00, 0x23, 0x7f, 0x38, 0x41, 0x46, 0x36, 0x18, 0xff, 0x61, 0x40, 0x70, 0x1c, 0x1f, 0x43, 0x0f, 0x2f, 0xff, 0x69, 0xd8, 0x7b, 0x4a, 0xbf, 0x00, 0xd2, 0x59, 0xee, 0x47, 0x02, 0x2b, 0x48, 0xd1, 0x39, 0x1c, 0x08, 0x27, 0xff, 0xf5, 0x26, 0x83, 0x02, 0x0a, 0x41, 0x04, 0x00, 0x28, 0xdd, 0xd1, 0xef, 0x00, 0x2d, 0x3e, 0xd1, 0x85, 0x02, 0x23, 0xe0, 0xe7, 0x6d, 0x41, 0x67, 0x02, 0x20, 0xd0, 0x05, 0x06, 0xcf, 0xe0, 0x03, 0x06, 0xff, 0xad, 0xe0, 0x00, 0x22, 0x00, 0x20, 0x19, 0x40, 0xff, 0xcc, 0xb2, 0x40, 0x02, 0xd2, 0x05, 0x40, 0x0a, 0x7f, 0xe4, 0x07, 0x10, 0x43, 0x20, 0x43, 0x1c, 0x01, 0x12, 0x7f, 0xf0, 0xbd, 0x7b, 0xb9, 0x04, 0x27, 0x00, 0x4b, 0x00, 0xf7, 0x01, 0x0a, 0xb2, 0x85, 0x02, 0x02, 0x23, 0x00, 0x2d, 0xff, 0xbe, 0xd0, 0x03, 0x23, 0xbc, 0xe7, 0x01, 0x24, 0xff, 0xff, 0x22, 0x0c, 0x40, 0x00, 0x20, 0xe3, 0xe7, 0xfd, 0x18, 0x7b, 0x02, 0xfc, 0xfa, 0x4a, 0x46, 0x43, 0x1f, 0xff, 0x76, 0x26, 0x9a, 0x40, 0x76, 0x42, 0x91, 0x46, 0xbb, 0x36, 0x1a, 0xcb, 0x0c, 0x99, 0xe7, 0x0c, 0x87, 0x08, 0x03, 0xdb, 0x0a, 0x94, 0xb9, 0x0a, 0xe9, 0xfa, 0xb9, 0x22, 0x23, 0x9a, 0xfe, 0xc9, 0x03, 0x00, 0x24, 0xc0, 0x03, 0xff, 0x22, 0xc1, 0xbf, 0xe7, 0x4d, 0x46, 0x53, 0x46, 0xb2, 0x05, 0x00, 0x21, 0xff, 0x00, 0x53, 0x46, 0xae, 0xe7, 0x4b, 0x46, 0x1b, 0xff, 0x0c, 0x98, 0x46, 0x4a, 0x46, 0x4f, 0xf6, 0xff, 0xff, 0x73, 0x1a, 0x40, 0x2b, 0x40, 0x1c, 0x00, 0x54, 0xef, 0x43, 0x2f, 0x0c, 0xa4, 0xd7, 0x03, 0x44, 0x46, 0x7d, 0xff, 0x43, 0x57, 0x43, 0x62, 0x46, 0x63, 0x43, 0x12, 0xff, 0x0c, 0xff, 0x18, 0xd2, 0x19, 0x93, 0x42, 0x03, 0xff, 0xd9, 0x80, 0x23, 0x5b, 0x02, 0x98, 0x46, 0x45, 0xfb, 0x44, 0x67, 0x2f, 0x08, 0x14, 0x04, 0x3b, 0x40, 0xe4, 0xff, 0x18, 0xa3, 0x01, 0x5f, 0x1e, 0xbb, 0x41, 0x12, 0xff, 0x0c, 0xa4, 0x0e, 0x55, 0x19, 0x1c, 0x43, 0xad, 0xbf, 0x01, 0x25, 0x43, 0x2b, 0x01, 0x04, 0xc3, 0x01, 0x06, 0xff, 0x00, 0x6a, 0x08, 0x1d, 0x40, 0x15, 0x43, 0x32, 0xff, 0x00, 0x7f, 0x32, 0x00, 0x2a, 0x27, 0xdd, 0x6b, 0xda, 0xe7, 0x09, 0x2b, 0xe7, 0x0d, 0x35, 0x2b, 0x6b, 0x02, 0x32, 0x00, 0xff, 0x28, 0x4b, 0x80, 0x32, 0x1d, 0x40, 0xfe, 0x2a, 0xff, 0x8d, 0xdc, 0x01, 0x24, 0xa8, 0x01, 0x40, 0x0a, 0xdf, 0xd2, 0xb2, 0x0c, 0x40, 0x70, 0xab, 0x00, 0x4b, 0x46, 0xff, 0xc0, 0x03, 0x03, 0x42, 0x08, 0xd0, 0x05, 0x42, 0xff, 0x05, 0xd1, 0x28, 0x43, 0x40, 0x02, 0x40, 0x0a, 0x5f, 0x44, 0x46, 0xff, 0x22, 0x63, 0xad, 0x00, 0x18, 0x0d, 0x08, 0xf7, 0xff, 0x22, 0x5d, 0x15, 0x01, 0xa3, 0x1a, 0x1b, 0x2b, 0xf3, 0x05, 0xdd, 0x19, 0x01, 0x55, 0x01, 0x55, 0xe7, 0x06, 0x00, 0xf7, 0xc9, 0xe7, 0x2a, 0x5b, 0x02, 0xda, 0x40, 0xc3, 0x1a, 0xff, 0x9d, 0x40, 0x2b, 0x00, 0x5d, 0x1e, 0xab, 0x41, 0xf7, 0x13, 0x43, 0x5a, 0x75, 0x04, 0x22, 0x1a, 0x40, 0x04, 0x6d, 0x2a, 0x75, 0x00, 0x33, 0x5a, 0x99, 0x04, 0x24, 0x01, 0x4d, 0x09, 0xbd, 0x3c, 0x41, 0x00, 0x9b, 0x01, 0x58, 0x0a, 0x3f, 0x04, 0x36, 0xf2, 0x73, 0x00, 0x01, 0x1f, 0x01, 0x6b, 0x0c, 0x0c, 0x40, 0xff, 0x22, 0xed, 0x2d, 0x5b, 0x02, 0x20, 0x57, 0x57, 0x0e, 0xf8, 0xb5, 0xce, 0xff, 0x46, 0x47, 0x46, 0x44, 0x00, 0xc2, 0x0f, 0x80, 0xef, 0xb5, 0x47, 0x02, 0x48, 0x21, 0x00, 0x84, 0x46, 0x66, 0xff, 0x46, 0x7b, 0x0a, 0x48, 0x00, 0x99, 0x46, 0x24, 0xff, 0x0e, 0x15, 0x00, 0xdb, 0x00, 0x00, 0x0e, 0xc9, 0xff, 0x0f, 0xf6, 0x00, 0xff, 0x28, 0x00, 0xd1, 0x8d, 0xfd, 0xe0, 0xbf, 0x01, 0x08, 0x47, 0x46, 0x79, 0x40, 0x91, 0xff, 0x42, 0x65, 0xd0, 0x22, 0x1a, 0x00, 0x2a, 0x00, 0xff, 0xdc, 0x9c, 0xe0, 0x00, 0x28, 0x3c, 0xd1, 0x00, 0xff, 0x2e, 0x00, 0xd1, 0x8a, 0xe0, 0x51, 0x1e, 0x00, 0xdf, 0x29, 0x00, 0xd0, 0xb3, 0xe0, 0x7b, 0x00, 0x1b, 0x5a, 0xff, 0x01, 0x43, 0xd5, 0x9b, 0x01, 0x9f, 0x09, 0x38, 0xfe, 0xaf, 0x01, 0x11, 0xfa, 0x05, 0x38, 0x87, 0x40, 0x84, 0xff, 0x42, 0x00, 0xdd, 0x94, 0xe0, 0x04, 0x1b, 0x3a, 0xfe, 0xc7, 0x00, 0x01, 0x34, 0xe2, 0x40, 0x04, 0x1b, 0xa7, 0xb7, 0x40, 0x3b, 0x00, 0x5f, 0x05, 0x00, 0x24, 0xcb, 0x3c, 0x26, 0xff, 0xd5, 0x01, 0x34, 0xff, 0x2c, 0x00, 0xd1, 0x77, 0xff, 0xe0, 0x01, 0x22, 0x9b, 0x01, 0x5b, 0x0a, 0xe4, 0xff, 0xb2, 0x2a, 0x40, 0x5b, 0x02, 0xe4, 0x05, 0x58, 0xff, 0x0a, 0xd2, 0x07, 0x20, 0x43, 0x10, 0x43, 0x0c, 0xfe, 0x59, 0x0a, 0xf8, 0xbd, 0xff, 0x2c, 0xe1, 0xd0, 0x80, 0xff, 0x21, 0xc9, 0x04, 0x0e, 0x43, 0x1b, 0x2a, 0x7a, 0xfb, 0xdc, 0x31, 0x5b, 0x00, 0xd1, 0x40, 0x82, 0x1a, 0x96, 0x7f, 0x40, 0x72, 0x1e, 0x96, 0x41, 0x0e, 0x43, 0x87, 0x04, 0xff, 0xbb, 0xd4, 0x5a, 0x07, 0xd1, 0xd1, 0x01, 0x22, 0xff, 0xdf, 0x08, 0x2a, 0x40, 0xff, 0x2c, 0x33, 0xd1, 0xbf, 0x00, 0x2f, 0x00, 0xd1, 0xa6, 0xe0, 0x6d, 0x07, 0x3b, 0xff, 0x43, 0x5b, 0x02, 0x5b, 0x0a, 0xff, 0x24, 0xd2, 0xff, 0xe7, 0x21, 0x1a, 0x00, 0x29, 0x4b, 0xdd, 0x58, 0xef, 0xb3, 0xff, 0x2c, 0xba, 0x49, 0x03, 0xc0, 0x04, 0x06, 0xff, 0x43, 0x1b, 0x29, 0x00, 0xdd, 0xac, 0xe0, 0x30, 0xff, 0x00, 0x20, 0x27, 0xc8, 0x40, 0x79, 0x1a, 0x8e, 0xff, 0x40, 0x71, 0x1e, 0x8e, 0x41, 0x06, 0x43, 0x9b, 0xaf, 0x19, 0x59, 0x01, 0xd7, 0x99, 0x10, 0x84, 0x99, 0x00, 0x76, 0xff, 0x49, 0x1a, 0x40, 0x5b, 0x08, 0x0b, 0x40, 0x13, 0xf7, 0x43, 0x9e, 0xe7, 0x03, 0x01, 0xd0, 0x72, 0xe7, 0x6d, 0xff, 0xe7, 0x3b, 0x00, 0x00, 0x2f, 0xc5, 0xd1, 0x00, 0xf7, 0x22, 0x7b, 0x02, 0xb5, 0x04, 0xa4, 0xe7, 0x14, 0x00, 0xfd, 0x90, 0x1b, 0x00, 0x4b, 0xd0, 0x48, 0x1e, 0x00, 0x28, 0xff, 0x55, 0xd1, 0x9b, 0x19, 0x01, 0x24, 0x5a, 0x01, 0xff, 0xb5, 0xd5, 0x02, 0x24, 0xdf, 0xe7, 0x2a, 0xbb, 0xff, 0x62, 0x1c, 0xd2, 0xb2, 0x01, 0x2a, 0x71, 0xdd, 0xff, 0x9f, 0x1b, 0x7a, 0x01, 0x34, 0xd5, 0xf7, 0x1a, 0xff, 0x0d, 0x00, 0x66, 0xe7, 0x01, 0x22, 0x00, 0x23, 0xf7, 0x2a, 0x40, 0x88, 0x47, 0x00, 0x5f, 0x4a, 0x24, 0x1a, 0xff, 0x13, 0x40, 0x71, 0xe7, 0x00, 0x29, 0x69, 0xd1, 0xff, 0x61, 0x1c, 0xc8, 0xb2, 0x01, 0x28, 0x4d, 0xdd, 0xff, 0xff, 0x29, 0x48, 0xd0, 0x9b, 0x19, 0x5b, 0x08, 0xff, 0x0c, 0x00, 0x65, 0xe7, 0xff, 0x2a, 0x40, 0xd0, 0xff, 0x0a, 0x00, 0x82, 0xe7, 0x01, 0x26, 0x9b, 0x1b, 0xff, 0x8a, 0xe7, 0xe4, 0xb1, 0xff, 0x28, 0x21, 0xd0, 0x7f, 0x80, 0x24, 0xe4, 0x04, 0x52, 0x42, 0x23, 0x0d, 0x01, 0xff, 0x00, 0xdd, 0x90, 0xe0, 0x1c, 0x00, 0x20, 0x25, 0xff, 0xd4, 0x40, 0xaa, 0x1a, 0x93, 0x40, 0x5a, 0x1e, 0xff, 0x93, 0x41, 0x23, 0x43, 0xf3, 0x1a, 0x04, 0x00, 0xef, 0x0d, 0x00, 0x30, 0xe7, 0x03, 0x01, 0xd0, 0x31, 0xe7, 0xfe, 0x5b, 0x02, 0x24, 0xab, 0xe7, 0x0c, 0x00, 0x40, 0xe7, 0xff, 0x00, 0x2b, 0x52, 0xd0, 0xd2, 0x43, 0x00, 0x2a, 0xff, 0xee, 0xd0, 0xff, 0x28, 0xe1, 0xd1, 0x33, 0x00, 0xff, 0xff, 0x24, 0x0d, 0x00, 0x35, 0xe7, 0xff, 0x29, 0xdf, 0x10, 0xd0, 0x01, 0x00, 0x79, 0x1d, 0x00, 0x68, 0xd0, 0xfb, 0xff, 0x24, 0xe3, 0x05, 0x2b, 0xe7, 0x80, 0x22, 0x49, 0xff, 0x46, 0xd2, 0x03, 0x11, 0x42, 0x03, 0xd0, 0x61, 0x6f, 0x46, 0x11, 0x42, 0x00, 0x2b, 0x08, 0x20, 0xe7, 0x1d, 0x00, 0xff, 0x23, 0x2f, 0xe7, 0x00, 0x2c, 0xe9, 0xd1, 0x00, 0xf7, 0x2b, 0x5d, 0xd0, 0x29, 0x04, 0x16, 0xe7, 0x9b, 0x19, 0xff, 0x5a, 0x01, 0x00, 0xd4, 0x40, 0xe7, 0x2e, 0x4a, 0xff, 0x0c, 0x00, 0x13, 0x40, 0x0e, 0xe7, 0xdc, 0xb9, 0xab, 0x5b, 0xbb, 0x07, 0x05, 0x33, 0x81, 0x00, 0x07, 0xb3, 0x00, 0x58, 0xff, 0xe7, 0xe4, 0xb9, 0x00, 0x2b, 0x40, 0xd0, 0xc9, 0xfb, 0x43, 0x59, 0xb9, 0x00, 0x37, 0xd0, 0x1b, 0x29, 0x42, 0xed, 0xdc, 0xaf, 0x00, 0x27, 0xcc, 0x6f, 0x01, 0x8b, 0x40, 0x59, 0xfb, 0x1e, 0x8b, 0xaf, 0x00, 0x9b, 0x19, 0x04, 0x00, 0x45, 0xff, 0xe7, 0xcb, 0xb9, 0x26, 0xbb, 0x80, 0x27, 0x00, 0x7f, 0x22, 0xff, 0x03, 0x23, 0xe7, 0x33, 0x00, 0xc1, 0x04, 0x5f, 0xe7, 0xe6, 0xff, 0x28, 0x1e, 0xeb, 0x08, 0x49, 0xeb, 0x00, 0xdd, 0xe1, 0x7b, 0x05, 0xd1, 0xdd, 0xe6, 0x45, 0x05, 0x00, 0xd4, 0xb7, 0x3e, 0xe7, 0xf3, 0x47, 0x01, 0xd6, 0xe6, 0xb1, 0x0c, 0xd2, 0xef, 0xe6, 0x80, 0x22, 0x48, 0xb1, 0x00, 0x10, 0x42, 0xaa, 0x7f, 0xd0, 0x60, 0x46, 0x10, 0x42, 0xa7, 0xd1, 0x7f, 0x04, 0xef, 0xff, 0x24, 0xc6, 0xe6, 0xb9, 0x04, 0xc3, 0xe6, 0x01, 0xbb, 0x23, 0x74, 0x53, 0x08, 0xbe, 0xe6, 0x00, 0x61, 0x00, 0x24, 0x5a, 0x0b, 0x00, 0xb9, 0x13, 0x00, 0xc2, 0xe7, 0x1b, 0x03, 0x7d, 0x03, 0x00, 0xef, 0xfb, 0x41, 0x02, 0x43, 0x1b, 0x03, 0x49, 0x0a, 0x1b, 0xff, 0x0e, 0x00, 0x20, 0x7e, 0x2b, 0x0c, 0xdd, 0x9d, 0xff, 0x2b, 0x0b, 0xdc, 0x80, 0x20, 0x00, 0x04, 0x01, 0xff, 0x43, 0x95, 0x2b, 0x09, 0xdc, 0x96, 0x20, 0xc3, 0xff, 0x1a, 0xd9, 0x40, 0x48, 0x42, 0x02, 0xb9, 0x08, 0xff, 0x00, 0x70, 0x47, 0x02, 0x4b, 0xd0, 0x18, 0xfb, 0xbf, 0xe7, 0x96, 0x3b, 0x99, 0x40, 0xf5, 0x3f, 0x04, 0x7f, 0xff, 0x70, 0xb5, 0x00, 0x28, 0x30, 0xd0, 0xc3, 0x17, 0x7f, 0xc4, 0x18, 0x5c, 0x40, 0xc5, 0x0f, 0x20, 0x09, 0x03, 0xff, 0x8c, 0xf8, 0x9e, 0x23, 0x1b, 0x1a, 0x96, 0x2b, 0xff, 0x0d, 0xdc, 0x96, 0x22, 0xd2, 0x1a, 0x94, 0x40, 0xff, 0x2a, 0x00, 0x64, 0x02, 0x64, 0x0a, 0xdb, 0xb2, 0x5f, 0x64, 0x02, 0xdb, 0x05, 0x60, 0xd9, 0x02, 0x18, 0xd9, 0x02, 0x7f, 0x70, 0xbd, 0x99, 0x2b, 0x19, 0xdc, 0x99, 0x1f, 0x00, 0xff, 0x00, 0x2a, 0x29, 0xdd, 0x94, 0x40, 0x22, 0x00, 0xdf, 0x14, 0x4c, 0x14, 0x40, 0x51, 0x1f, 0x07, 0x21, 0x0a, 0xfe, 0x1f, 0x0f, 0x34, 0x62, 0x01, 0x13, 0xd4, 0xa4, 0x01, 0xee, 0x39, 0x04, 0x2a, 0x00, 0xe0, 0xc7, 0x05, 0x23, 0x00, 0x24, 0xff, 0xdc, 0xe7, 0x05, 0x22, 0x21, 0x00, 0x12, 0x1a, 0xf7, 0xd1, 0x40, 0xb9, 0x5b, 0x08, 0x62, 0x1e, 0x94, 0x41, 0xff, 0x0c, 0x43, 0xda, 0xe7, 0x05, 0x4b, 0x2a, 0x00, 0xff, 0x1c, 0x40, 0x9f, 0x23, 0xa4, 0x01, 0x1b, 0x1a, 0xbe, 0x31, 0x04, 0xc8, 0xe7, 0x22, 0x00, 0xd5, 0x9f, 0x04, 0xfb, 0xff, 0x10, 0xb5, 0x04, 0x00, 0x38, 0xb3, 0x00, 0xf0, 0x85, 0x41, 0x95, 0x10, 0x0a, 0x95, 0x10, 0x93, 0x24, 0x91, 0x00, 0x8f, 0x00, 0x17, 0xaa, 0x8f, 0x10, 0x27, 0x8f, 0x08, 0x13, 0x8f, 0x40, 0x12, 0x8f, 0x10, 0xe3, 0xdd, 0xe7, 0x8b, 0x04, 0xe0, 0xe7, 0xb9, 0x8b, 0x00, 0xd2, 0x1a, 0xff, 0x91, 0x40, 0x0a, 0x00, 0x51, 0x1e, 0x8a, 0x41, 0xff, 0x05, 0x21, 0x09, 0x1a, 0xcc, 0x40, 0x14, 0x43, 0xaf, 0xdb, 0xe7, 0x04, 0x4b, 0x8b, 0x24, 0xcc, 0x8b, 0x00, 0xd7, 0xfe, 0x8b, 0x08, 0x1c, 0x21, 0x01, 0x23, 0x1b, 0x04, 0x98, 0xff, 0x42, 0x01, 0xd3, 0x00, 0x0c, 0x10, 0x39, 0x1b, 0x7d, 0x0a, 0x09, 0x08, 0x0a, 0x08, 0x39, 0x1b, 0x09, 0x09, 0x08, 0xff, 0x09, 0x04, 0x39, 0x02, 0xa2, 0x10, 0x5c, 0x40, 0xff, 0x18, 0x70, 0x47, 0xc0, 0x46, 0x04, 0x03, 0x02, 0xcb, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x67, 0x01, 0x25, 0x0e, 0xff, 0x4b, 0x0f, 0x4c, 0xe4, 0x1a, 0xa4, 0x10, 0xa5, 0xff, 0x42, 0x09, 0xd1, 0x00, 0x25, 0x00, 0xf0, 0xc9, 0xdf, 0xf9, 0x0c, 0x4c, 0x0c, 0x4b, 0x11, 0x0c, 0x07, 0xd1, 0xff, 0x70, 0xbd, 0x06, 0x4a, 0xab, 0x00, 0x9b, 0x18, 0xff, 0x1b, 0x68, 0x98, 0x47, 0x01, 0x35, 0xec, 0xe7, 0x7e, 0x0d, 0x24, 0xee, 0xe7, 0x6c, 0x57, 0x00, 0x00, 0x03, 0x04, 0x7d, 0x70, 0x07, 0x10, 0x00, 0x23, 0x10, 0xb5, 0x9a, 0xdb, 0x02, 0xff, 0x10, 0xbd, 0xcc, 0x5c, 0xc4, 0x54, 0x01, 0x33, 0x7f, 0xf8, 0xe7, 0x03, 0x00, 0x82, 0x18, 0x93, 0x11, 0x00, 0xff, 0x70, 0x47, 0x19, 0x70, 0x01, 0x33, 0xf9, 0xe7, 0xde, 0x23, 0x00, 0x02, 0x00, 0x00, 0x05, 0x06, 0x00, 0x4c, 0x54, 0xae, 0x04, 0x00, 0x09, 0x00, 0x00, 0x8c, 0x04, 0x44, 0x0b, 0x00, 0xe6, 0xff, 0x00, 0x63, 0x02, 0x23, 0x04, 0x00, 0x00, 0x9a, 0xff, 0x00, 0x80, 0x20, 0x01, 0x20, 0xa0, 0x00, 0x00, 0xff, 0x22, 0xc0, 0x03, 0xa8, 0x00, 0xc0, 0x03, 0x02, 0xf7, 0x46, 0xb2, 0x00, 0x3a, 0x01, 0x22, 0xba, 0x00, 0x56, 0xff, 0x22, 0x4f, 0x22, 0x00, 0x00, 0xd6, 0x1a, 0x00, 0xfb, 0x00, 0xe4, 0x03, 0x00, 0x2e, 0x1b, 0x00, 0x00, 0x38, 0xaa, 0x03, 0x00, 0x4c, 0x03, 0x00, 0x66, 0x03, 0x00, 0x74, 0x03, 0x00, 0x84, 0xaa, 0x03, 0x00, 0x94, 0x03, 0x00, 0xa2, 0x03, 0x00, 0xb0, 0x03, 0x00, 0xe2, 0xfa, 0x27, 0x00, 0xc0, 0x07, 0x00, 0x56, 0x45, 0x52, 0x5f, 0x4e, 0xff, 0x4f, 0x54, 0x45, 0x53, 0x3a, 0x20, 0x28, 0x44, 0xff, 0x45, 0x42, 0x55, 0x47, 0x29, 0x20, 0x42, 0x6f, 0xff, 0x6f, 0x74, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x72, 0xff, 0x20, 0x70, 0x61, 0x74, 0x63, 0x68, 0x2c, 0x20, 0xff, 0x46, 0x69, 0x78, 0x65, 0x64, 0x20, 0x49, 0x32, 0xff, 0x43, 0x20, 0x68, 0x61, 0x6e, 0x67, 0x20, 0x63, 0xff, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0xfe, 0x9f, 0x00, 0x52, 0x45, 0x56, 0x3a, 0x20, 0x30, 0x2e, 0xef, 0x32, 0x32, 0x2e, 0x30, 0x4b, 0x04, 0x3a, 0x20, 0x36, 0xfb, 0x2e, 0x30, 0x0a, 0x00, 0x00, 0x2e, 0x2e, 0x2f, 0x68, 0xbf, 0x61, 0x6c, 0x2f, 0x73, 0x72, 0x63, 0x07, 0x04, 0x5f, 0xff, 0x61, 0x64, 0x63, 0x5f, 0x61, 0x73, 0x79, 0x6e, 0xf7, 0x63, 0x2e, 0x63, 0x1b, 0x38, 0x64, 0x61, 0x63, 0x5f, 0x8c, 0x1a, 0x14, 0x1b, 0x34, 0x69, 0x32, 0x1b, 0x00, 0x39, 0x1c, 0x1f, 0x3c, 0x6f, 0x7c, 0x16, 0x00, 0x13, 0x30, 0x74, 0x69, 0x6d, 0x65, 0x72, 0x67, 0x20, 0x9f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x1d, 0x08, 0x09, 0x08, 0x5f, 0xcf, 0x6c, 0x69, 0x73, 0x74, 0x6b, 0x24, 0x1f, 0x34, 0x72, 0x69, 0x3f, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x44, 0x0c, 0x92, 0x09, 0x3f, 0x02, 0x18, 0x10, 0x00, 0x07, 0x00, 0x00, 0x34, 0x3f, 0x04, 0x07, 0x70, 0x6c, 0x2f, 0xdb, 0x00, 0x07, 0x04, 0xe3, 0x04, 0xa3, 0x1c, 0x17, 0x00, 0x30, 0xd7, 0x00, 0x17, 0x08, 0x07, 0x00, 0x17, 0x28, 0x72, 0x74, 0x17, 0x0c, 0x07, 0x00, 0x7e, 0x17, 0x0c, 0x00, 0x04, 0x00, 0x42, 0x00, 0x08, 0x03, 0x00, 0xb9, 0x0c, 0x03, 0x00, 0x00, 0xc0, 0x90, 0x00, 0x20, 0xa5, 0x08, 0x26, 0xfc, 0x1f, 0x50, 0x77, 0x10, 0x73, 0x65, 0x72, 0x63, 0x6f, 0x6d, 0x98, 0x7a, 0x08, 0x0a, 0x0c, 0x7d, 0x04, 0x96, 0x4b, 0x23, 0x02, 0x03, 0x00, 0x78, 0x56, 0x03, 0x00, 0xbc, 0x4a, 0x07, 0x0c, 0x5c, 0x0f, 0x20, 0x66, 0x1f, 0x10, 0xb5, 0x5c, 0x0f, 0x10, 0xc4, 0x03, 0x20, 0x7e, 0x4b, 0x1f, 0x1c, 0x3a, 0x16, 0x03, 0x00, 0x1e, 0x4c, 0x07, 0x0c, 0x5c, 0x0f, 0x20, 0x3f, 0x24, 0x0f, 0x04, 0x9a, 0x3f, 0x24, 0x28, 0x0f, 0x00, 0xd0, 0x4d, 0x9f, 0x00, 0x03, 0x10, 0x2c, 0x2a, 0x03, 0x00, 0xc2, 0x03, 0x10, 0xb8, 0x0f, 0x20, 0xb8, 0x07, 0x10, 0x0f, 0x04, 0xfd, 0xc8, 0x03, 0x20, 0x64, 0x4e, 0x00, 0x00, 0xf8, 0xb5, 0xff, 0xc0, 0x46, 0xf8, 0xbc, 0x08, 0xbc, 0x9e, 0x46, 0xef, 0x70, 0x47, 0x21, 0x11, 0x0f, 0x2c, 0xf5, 0x10, 0x00, 0xff, 0x00, 0x03, 0x00, 0xa3, 0x00, 0x02, 0x0b, 0x30, 0xf7, 0x00, 0x02, 0x0c, 0x03, 0x00, 0xcb, 0x17, 0x00, 0x80, 0x07, 0xb2, 0x00, 0x00};
+
+#endif /* ADS_TWO_AXIS_FW_V2_LZ_H_ */
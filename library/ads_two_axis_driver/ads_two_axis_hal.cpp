@@ -0,0 +1,615 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+/*
+ * Platform independent part of the HAL. Keeps the table of devices, routes
+ * data ready edges to them and implements the single device functions on
+ * top of a default device. The platform backends (ads_two_axis_hal_i2c.cpp,
+ * ads_two_axis_hal_sim.cpp, ads_two_axis_hal_linux.cpp) only provide the
+ * ads_hal_bus_*() and ads_hal_pin_*() primitives.
+ */
+
+#include <stddef.h>
+#include "ads_two_axis_hal.h"
+#include "ads_two_axis_stats.h"
+
+static ads_hal_dev_t * ads_hal_devs[ADS_COUNT];
+
+/* Device used by the single device functions until the driver installs its own */
+static ads_hal_dev_t ads_hal_legacy_dev = {
+	ADS_DEFAULT_ADDR, 0, 0, NULL, NULL, NULL, false, false, false, false, 0, 0, 0, 0, {0},
+};
+
+static ads_hal_dev_t * ads_hal_default = &ads_hal_legacy_dev;
+
+static uint8_t ads_hal_bus_depth = 0;					// Nesting of ads_hal_bus_acquire()
+
+static void (*ads_read_callback)(uint8_t *);
+
+/* Device I2C address array. Use ads_hal_update_addr() to
+ * populate this array. */
+static uint8_t ads_addrs[ADS_COUNT] = {
+	ADS_DEFAULT_ADDR,
+};
+
+
+/**
+ * @brief true if another device with an enabled interrupt uses the data
+ *				ready line of dev
+ */
+static bool ads_hal_pin_shared(ads_hal_dev_t * dev)
+{
+	for(uint8_t i = 0; i < ADS_COUNT; i++)
+	{
+		ads_hal_dev_t * other = ads_hal_devs[i];
+
+		if(other && other != dev && other->int_enabled && other->datardy_pin == dev->datardy_pin)
+			return true;
+	}
+
+	return false;
+}
+
+/**
+ * @brief Masks the data ready interrupt of every device that reads from
+ *				interrupt context, so no read can interleave with a transfer
+ *				made by the application. Deferred devices never touch the
+ *				bus from interrupt context and stay enabled. Nests, only the
+ *				outermost call masks.
+ */
+static void ads_hal_bus_acquire(void)
+{
+	if(ads_hal_bus_depth++)
+		return;
+
+	for(uint8_t i = 0; i < ADS_COUNT; i++)
+	{
+		ads_hal_dev_t * dev = ads_hal_devs[i];
+
+		if(dev && dev->int_enabled && !dev->deferred && !dev->masked)
+		{
+			dev->masked = true;
+			ads_hal_pin_attach(dev, false);
+		}
+	}
+}
+
+/**
+ * @brief Unmasks the interrupts masked by ads_hal_bus_acquire() and reads
+ *				out any packet whose edge was missed meanwhile
+ */
+static void ads_hal_bus_release(void)
+{
+	if(--ads_hal_bus_depth)
+		return;
+
+	for(uint8_t i = 0; i < ADS_COUNT; i++)
+	{
+		ads_hal_dev_t * dev = ads_hal_devs[i];
+
+		if(dev && dev->masked)
+		{
+			dev->masked = false;
+			ads_hal_pin_attach(dev, true);
+
+			// Read data packet if interrupt was missed
+			if(ads_hal_pin_asserted(dev) && ads_hal_dev_interrupt(dev, ads_hal_get_time_us()))
+				ADS_STATS_INC(missed_recovered);
+		}
+	}
+}
+
+/**
+ * @brief Service of a single device, edges must already be delivered
+ */
+static int ads_hal_dev_service_pending(ads_hal_dev_t * dev)
+{
+	if(!dev->int_enabled || dev->held)
+		return 0;
+
+	ads_hal_lock();
+	bool pending = dev->pending;
+	uint32_t drdy_time = dev->drdy_time;
+	dev->pending = false;
+	ads_hal_unlock();
+
+	if(!pending)
+	{
+		// Read data packet if interrupt was missed
+		if(!ads_hal_pin_asserted(dev))
+			return 0;
+
+		drdy_time = ads_hal_get_time_us();
+	}
+
+	if(ads_hal_dev_read_sample(dev, drdy_time) != ADS_OK)
+		return ADS_ERR_IO;
+
+	if(!pending)
+		ADS_STATS_INC(missed_recovered);
+
+	return 1;
+}
+
+static void ads_hal_legacy_callback(ads_hal_dev_t * dev, uint8_t * buffer)
+{
+	(void)dev;
+
+	if(ads_read_callback)
+		ads_read_callback(buffer);
+}
+
+
+/************************************************************************/
+/*                        Per Device Functions                          */
+/************************************************************************/
+
+int ads_hal_dev_interrupt(ads_hal_dev_t * dev, uint32_t time_us)
+{
+	if(!dev->int_enabled || dev->masked)
+		return 0;
+
+	ADS_STATS_START(start);
+
+	dev->drdy_time = time_us;
+
+	// The response of a query is pending, the holder reads the packet
+	if(dev->held)
+		return 0;
+
+	if(dev->deferred)
+	{
+		dev->pending = true;
+
+		if(dev->notify)
+			dev->notify();
+
+		ADS_STATS_TIME(isr, start);
+		return 0;
+	}
+
+	dev->sample_time = time_us;
+
+	int handled = 0;
+
+	if(ads_hal_bus_read(dev->address, dev->read_buffer, ADS_TRANSFER_SIZE) == ADS_OK)
+	{
+		dev->read_callback(dev, dev->read_buffer);
+		handled = 1;
+	}
+
+	ADS_STATS_TIME(isr, start);
+
+	return handled;
+}
+
+int ads_hal_pin_interrupt(uint32_t datardy_pin, uint32_t time_us)
+{
+	int handled = 0;
+
+#if ADS_STATS
+	ads_stats_isr = true;
+#endif
+
+	for(uint8_t i = 0; i < ADS_COUNT; i++)
+	{
+		ads_hal_dev_t * dev = ads_hal_devs[i];
+
+		if(dev && dev->datardy_pin == datardy_pin)
+			handled += ads_hal_dev_interrupt(dev, time_us);
+	}
+
+#if ADS_STATS
+	ads_stats_isr = false;
+#endif
+
+	return handled;
+}
+
+int ads_hal_dev_register(ads_hal_dev_t * dev, ads_hal_read_callback callback, void * ctx,
+						 uint8_t address, uint32_t reset_pin, uint32_t datardy_pin)
+{
+	uint8_t slot = ADS_COUNT;
+
+	for(uint8_t i = 0; i < ADS_COUNT; i++)
+	{
+		if(ads_hal_devs[i] == dev)
+		{
+			slot = i;
+			break;
+		}
+
+		if(ads_hal_devs[i] == NULL && slot == ADS_COUNT)
+			slot = i;
+	}
+
+	if(slot == ADS_COUNT)
+		return ADS_ERR_BAD_PARAM;
+
+	if(ads_hal_devs[slot] == dev)
+		ads_hal_dev_pin_int_enable(dev, false);
+
+	dev->address = address;
+	dev->reset_pin = reset_pin;
+	dev->datardy_pin = datardy_pin;
+	dev->read_callback = callback;
+	dev->ctx = ctx;
+	dev->notify = NULL;
+	dev->int_enabled = false;
+	dev->masked = false;
+	dev->held = false;
+	dev->deferred = false;
+	dev->pending = false;
+	dev->drdy_time = 0;
+	dev->sample_time = 0;
+	dev->reset_time = 0;
+	dev->slot = slot;
+
+	ads_hal_devs[slot] = dev;
+
+	if(ads_hal_bus_init() != ADS_OK || ads_hal_pin_init(dev) != ADS_OK)
+	{
+		ads_hal_devs[slot] = NULL;
+		return ADS_ERR_IO;
+	}
+
+	// Reset the ads
+	ads_hal_dev_reset(dev);
+
+	return ADS_OK;
+}
+
+int ads_hal_dev_init(ads_hal_dev_t * dev, ads_hal_read_callback callback, void * ctx,
+					uint8_t address, uint32_t reset_pin, uint32_t datardy_pin)
+{
+	int ret = ads_hal_dev_register(dev, callback, ctx, address, reset_pin, datardy_pin);
+
+	if(ret != ADS_OK)
+		return ret;
+
+	// Wait for ads to initialize
+	ads_hal_delay(ADS_BOOT_DELAY_MS);
+
+	ads_hal_dev_pin_int_enable(dev, true);
+
+	return ADS_OK;
+}
+
+void ads_hal_dev_remove(ads_hal_dev_t * dev)
+{
+	ads_hal_dev_pin_int_enable(dev, false);
+
+	if(dev->slot < ADS_COUNT && ads_hal_devs[dev->slot] == dev)
+		ads_hal_devs[dev->slot] = NULL;
+
+	if(ads_hal_default == dev)
+		ads_hal_default = &ads_hal_legacy_dev;
+}
+
+ads_hal_dev_t * ads_hal_get_device(uint8_t slot)
+{
+	if(slot < ADS_COUNT)
+		return ads_hal_devs[slot];
+
+	return NULL;
+}
+
+void ads_hal_dev_pin_int_enable(ads_hal_dev_t * dev, bool enable)
+{
+	if(dev->int_enabled == enable)
+		return;
+
+	dev->int_enabled = enable;
+
+	if(enable || !ads_hal_pin_shared(dev))
+		ads_hal_pin_attach(dev, enable);
+}
+
+void ads_hal_dev_hold(ads_hal_dev_t * dev, bool hold)
+{
+	dev->held = hold;
+}
+
+/**
+ * @brief Write buffer of data to the Angular Displacement Sensor
+ *
+ * @param buffer[in]	Write buffer
+ * @param len			Length of buffer.
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_hal_dev_write_buffer(ads_hal_dev_t * dev, uint8_t * buffer, uint8_t len)
+{
+	ads_hal_bus_acquire();
+
+	int ret = ads_hal_bus_write(dev->address, buffer, len);
+
+	ads_hal_bus_release();
+
+	return ret;
+}
+
+/**
+ * @brief Read buffer of data from the Angular Displacement Sensor
+ *
+ * @param buffer[out]	Read buffer
+ * @param len			Length of buffer.
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_hal_dev_read_buffer(ads_hal_dev_t * dev, uint8_t * buffer, uint8_t len)
+{
+	ads_hal_bus_acquire();
+
+	int ret = ads_hal_bus_read(dev->address, buffer, len);
+
+	ads_hal_bus_release();
+
+	return ret;
+}
+
+/**
+ * @brief Writes a query command and reads back the response. The data ready
+ *				interrupt of dev is disabled for the exchange so the sample
+ *				path does not consume the response.
+ */
+int ads_hal_dev_write_read_buffer(ads_hal_dev_t * dev, uint8_t * buffer, uint8_t write_len, uint8_t read_len)
+{
+	bool int_enabled = dev->int_enabled;
+
+	ads_hal_dev_pin_int_enable(dev, false);
+	ads_hal_bus_acquire();
+
+	int ret = ads_hal_bus_query(dev->address, buffer, write_len, read_len);
+
+	ads_hal_bus_release();
+
+	if(int_enabled)
+		ads_hal_dev_pin_int_enable(dev, true);
+
+	return ret;
+}
+
+static void ads_hal_dev_stamp_reset(ads_hal_dev_t * dev)
+{
+	uint32_t now = ads_hal_get_time_us();
+
+	dev->reset_time = now;
+
+	// A shared reset line restarts every device on it
+	for(uint8_t i = 0; i < ADS_COUNT; i++)
+	{
+		if(ads_hal_devs[i] && ads_hal_devs[i]->reset_pin == dev->reset_pin)
+			ads_hal_devs[i]->reset_time = now;
+	}
+}
+
+void ads_hal_dev_reset(ads_hal_dev_t * dev)
+{
+	ads_hal_pin_reset(dev);
+	ads_hal_dev_stamp_reset(dev);
+}
+
+int ads_hal_dev_reset_bootloader(ads_hal_dev_t * dev)
+{
+	// A device on both lines would sample data ready low as well
+	for(uint8_t i = 0; i < ADS_COUNT; i++)
+	{
+		ads_hal_dev_t * other = ads_hal_devs[i];
+
+		if(other && other != dev && other->reset_pin == dev->reset_pin && other->datardy_pin == dev->datardy_pin)
+			return ADS_ERR_BAD_PARAM;
+	}
+
+	bool int_enabled = dev->int_enabled;
+
+	// Driving data ready low must not look like a sample
+	ads_hal_dev_pin_int_enable(dev, false);
+
+	int ret = ads_hal_pin_reset_bootloader(dev);
+
+	if(ret == ADS_OK)
+		ads_hal_dev_stamp_reset(dev);
+
+	if(int_enabled)
+		ads_hal_dev_pin_int_enable(dev, true);
+
+	return ret;
+}
+
+void ads_hal_dev_set_deferred(ads_hal_dev_t * dev, bool deferred, void (*notify)(void))
+{
+	ads_hal_lock();
+	dev->notify = notify;
+	dev->deferred = deferred;
+	dev->pending = false;
+	ads_hal_unlock();
+}
+
+int ads_hal_dev_service(ads_hal_dev_t * dev)
+{
+	ads_hal_pin_poll();
+
+	return ads_hal_dev_service_pending(dev);
+}
+
+int ads_hal_dev_read_packet(ads_hal_dev_t * dev)
+{
+	// Devices reading from interrupt context must not start a transfer
+	// in the middle of this one
+	ads_hal_bus_acquire();
+
+	int ret = ads_hal_bus_read(dev->address, dev->read_buffer, ADS_TRANSFER_SIZE);
+
+	ads_hal_bus_release();
+
+	return ret == ADS_OK ? ADS_OK : ADS_ERR_IO;
+}
+
+int ads_hal_dev_read_sample(ads_hal_dev_t * dev, uint32_t sample_time)
+{
+	dev->sample_time = sample_time;
+
+	if(ads_hal_dev_read_packet(dev) != ADS_OK)
+		return ADS_ERR_IO;
+
+	dev->read_callback(dev, dev->read_buffer);
+
+	return ADS_OK;
+}
+
+void ads_hal_set_default_device(ads_hal_dev_t * dev)
+{
+	ads_hal_default = dev ? dev : &ads_hal_legacy_dev;
+}
+
+ads_hal_dev_t * ads_hal_get_default_device(void)
+{
+	return ads_hal_default;
+}
+
+void ads_hal_transfer_begin(void)
+{
+	ads_hal_bus_acquire();
+}
+
+void ads_hal_transfer_end(void)
+{
+	ads_hal_bus_release();
+}
+
+
+/************************************************************************/
+/*            Single Device Functions, act on the default device        */
+/************************************************************************/
+
+void ads_hal_pin_int_enable(bool enable)
+{
+	ads_hal_dev_pin_int_enable(ads_hal_default, enable);
+}
+
+uint32_t ads_hal_get_sample_time_us(void)
+{
+	return ads_hal_default->sample_time;
+}
+
+void ads_hal_set_deferred(bool deferred, void (*notify)(void))
+{
+	ads_hal_dev_set_deferred(ads_hal_default, deferred, notify);
+}
+
+int ads_hal_service(void)
+{
+	int handled = 0;
+
+	ads_hal_pin_poll();
+
+	for(uint8_t i = 0; i < ADS_COUNT; i++)
+	{
+		if(ads_hal_devs[i] == NULL)
+			continue;
+
+		int ret = ads_hal_dev_service_pending(ads_hal_devs[i]);
+
+		if(ret < 0)
+			return ret;
+
+		handled += ret;
+	}
+
+	return handled;
+}
+
+int ads_hal_write_buffer(uint8_t * buffer, uint8_t len)
+{
+	return ads_hal_dev_write_buffer(ads_hal_default, buffer, len);
+}
+
+int ads_hal_read_buffer(uint8_t * buffer, uint8_t len)
+{
+	return ads_hal_dev_read_buffer(ads_hal_default, buffer, len);
+}
+
+int ads_hal_write_read_buffer(uint8_t * buffer, uint8_t write_len, uint8_t read_len)
+{
+	return ads_hal_dev_write_read_buffer(ads_hal_default, buffer, write_len, read_len);
+}
+
+void ads_hal_reset(void)
+{
+	ads_hal_dev_reset(ads_hal_default);
+}
+
+/**
+ * @brief Initializes the hardware abstraction layer
+ *
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_hal_init(void (*callback)(uint8_t*), uint32_t reset_pin, uint32_t datardy_pin)
+{
+	// Set callback pointer
+	ads_read_callback = callback;
+
+	ads_hal_default = &ads_hal_legacy_dev;
+
+	return ads_hal_dev_init(&ads_hal_legacy_dev, ads_hal_legacy_callback, NULL,
+							ads_hal_legacy_dev.address, reset_pin, datardy_pin);
+}
+
+/**
+ * @brief Selects the current device address of the ADS driver is communicating with
+ *
+ * @param device select device 0 - ADS_COUNT
+ * @return	ADS_OK if successful ADS_ERR_BAD_PARAM if invalid device number
+ */
+int ads_hal_select_device(uint8_t device)
+{
+	if(device < ADS_COUNT)
+		ads_hal_default->address = ads_addrs[device];
+	else
+		return ADS_ERR_BAD_PARAM;
+
+	return ADS_OK;
+}
+
+/**
+ * @brief Updates the I2C address in the ads_addrs[] array. Updates the current
+ *		  selected address.
+ *
+ * @param	device	device number of the device that is being updated
+ * @param	address	new address of the ADS
+ * @return	ADS_OK if successful ADS_ERR_BAD_PARAM if failed
+ */
+int ads_hal_update_device_addr(uint8_t device, uint8_t address)
+{
+	if(device < ADS_COUNT)
+		ads_addrs[device] = address;
+	else
+		return ADS_ERR_BAD_PARAM;
+
+	ads_hal_default->address = address;
+
+	return ADS_OK;
+}
+
+/**
+ * @brief Gets the current i2c address that the hal layer is addressing.
+ *				Used by device firmware update (dfu)
+ * @return	uint8_t _address
+ */
+uint8_t ads_hal_get_address(void)
+{
+	return ads_hal_default->address;
+}
+
+/**
+ * @brief Sets the i2c address that the hal layer is addressing
+ *				Used by device firmware update (dfu)
+ */
+void ads_hal_set_address(uint8_t address)
+{
+	ads_hal_default->address = address;
+}
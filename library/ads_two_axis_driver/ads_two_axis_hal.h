@@ -12,17 +12,95 @@
 #define ADS_TWO_AXIS_HAL_
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "ads_two_axis_err.h"
 
 #define ADS_TRANSFER_SIZE		(5)
+#define ADS_READ_BUFFER_SIZE	(24)				// Room for the sample record the driver builds in place of a packet
 
 #define ADS_COUNT				(10)				// Number of ADS devices attached to bus
 
+#define ADS_QUERY_DELAY_MS		(2)					// Time the ADS needs to prepare a query response
+
+#define ADS_DEFAULT_ADDR		(0x13)				// Default I2C address of the ADS
+#define ADS_BOOT_DELAY_MS		(2000)				// Worst case time from reset until the ADS answers
+#define ADS_BOOTLOADER_HOLD_MS	(1000)				// Time data ready is held low after reset to stay in the bootloader
+
+typedef struct ads_hal_dev_s ads_hal_dev_t;
+
+typedef void (*ads_hal_read_callback)(ads_hal_dev_t * dev, uint8_t * buffer);
+
+/* State of one ADS on the bus. Each device owns its address, pins, read
+ * buffer and data ready bookkeeping so devices stream independently. */
+struct ads_hal_dev_s {
+	uint8_t address;					// Current I2C address
+	uint32_t reset_pin;
+	uint32_t datardy_pin;
+	ads_hal_read_callback read_callback;
+	void * ctx;							// Owner of the device, e.g. the driver context
+	void (*notify)(void);				// Deferred mode edge notification, may be NULL
+	volatile bool int_enabled;
+	volatile bool masked;				// Data ready ignored while the bus is in use
+	volatile bool held;					// Edges only stamp drdy_time while a query response is pending
+	bool deferred;
+	volatile bool pending;				// Deferred edge not yet serviced
+	volatile uint32_t drdy_time;
+	uint32_t sample_time;				// Edge time of the packet in read_buffer
+	uint32_t reset_time;				// Time of the last pulse on reset_pin
+	uint8_t slot;						// Index in the HAL device table
+	union {
+		uint8_t read_buffer[ADS_READ_BUFFER_SIZE];
+		uint32_t read_align;			// Aligns read_buffer for records built in it
+	};
+};
+
+
+/************************************************************************/
+/*            Single Device Functions, act on the default device        */
+/************************************************************************/
 
 void ads_hal_delay(uint16_t delay_ms);
 
+/**
+ * @brief Busy or sleeping wait with microsecond resolution, for waits
+ *				shorter than a few ms
+ */
+void ads_hal_delay_us(uint32_t delay_us);
+
 void ads_hal_pin_int_enable(bool enable);
 
+/**
+ * @brief Free running microsecond counter used to timestamp samples.
+ *				Wraps every ~71 minutes.
+ */
+uint32_t ads_hal_get_time_us(void);
+
+/**
+ * @brief Time of the data ready edge of the packet being handed to the
+ *				read callback, in ads_hal_get_time_us() units
+ */
+uint32_t ads_hal_get_sample_time_us(void);
+
+/**
+ * @brief Selects deferred read mode. The data ready interrupt then only
+ *				records the edge time and a pending flag; ads_hal_service()
+ *				performs the read outside of interrupt context.
+ *
+ * @param deferred	true for deferred reads, false to read in the interrupt
+ * @param notify	called from interrupt context on every edge, e.g. to wake
+ *					the task that calls ads_hal_service(). NULL if polled.
+ */
+void ads_hal_set_deferred(bool deferred, void (*notify)(void));
+
+/**
+ * @brief Reads out pending packets of every registered device and fires
+ *				their read callbacks. Also recovers packets whose edge was
+ *				missed while the interrupt was disabled.
+ *
+ * @return	number of packets handled or ADS_ERR_IO if a read failed
+ */
+int ads_hal_service(void);
+
 /**
  * @brief Write buffer of data to the Angular Displacement Sensor
  *
@@ -41,6 +119,18 @@ int ads_hal_write_buffer(uint8_t * buffer, uint8_t len);
  */
 int ads_hal_read_buffer(uint8_t * buffer, uint8_t len);
 
+/**
+ * @brief Writes a query command and reads back the response. The data ready
+ *				interrupt is masked for the exchange so the sample path does
+ *				not consume the response.
+ *
+ * @param buffer[in,out]	Command on entry, response on return
+ * @param write_len			Length of the command
+ * @param read_len			Length of the response
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_hal_write_read_buffer(uint8_t * buffer, uint8_t write_len, uint8_t read_len);
+
 /**
  * @brief Reset the Angular Displacement Sensor
  */
@@ -84,4 +174,214 @@ uint8_t ads_hal_get_address(void);
  */
 void ads_hal_set_address(uint8_t address);
 
+/************************************************************************/
+/*                        Per Device Functions                          */
+/************************************************************************/
+
+/**
+ * @brief Registers a device with the HAL, resets it, waits
+ *				ADS_BOOT_DELAY_MS and enables its data ready interrupt.
+ *				dev must stay valid while registered.
+ *
+ * @param dev			device to initialize
+ * @param callback		receives every packet read on data ready
+ * @param ctx			stored in dev->ctx for the callback
+ * @param address		I2C address of the device
+ * @param reset_pin		reset line of the device
+ * @param datardy_pin	data ready line, may be shared with other devices
+ * @return	ADS_OK if successful ADS_ERR_IO if failed ADS_ERR_BAD_PARAM if
+ *				ADS_COUNT devices are already registered
+ */
+int ads_hal_dev_init(ads_hal_dev_t * dev, ads_hal_read_callback callback, void * ctx,
+					uint8_t address, uint32_t reset_pin, uint32_t datardy_pin);
+
+/**
+ * @brief Registers a device with the HAL and resets it like
+ *				ads_hal_dev_init(), but returns without waiting for it to
+ *				boot. The data ready interrupt stays disabled until
+ *				ads_hal_dev_pin_int_enable(). Lets the caller poll for
+ *				readiness or reset several devices at once.
+ *
+ * @return	ADS_OK if successful ADS_ERR_IO if failed ADS_ERR_BAD_PARAM if
+ *				ADS_COUNT devices are already registered
+ */
+int ads_hal_dev_register(ads_hal_dev_t * dev, ads_hal_read_callback callback, void * ctx,
+						 uint8_t address, uint32_t reset_pin, uint32_t datardy_pin);
+
+/**
+ * @brief Disables the data ready interrupt of dev and removes it from the HAL
+ */
+void ads_hal_dev_remove(ads_hal_dev_t * dev);
+
+/**
+ * @brief Registered device in slot 0 - ADS_COUNT, NULL if the slot is free
+ */
+ads_hal_dev_t * ads_hal_get_device(uint8_t slot);
+
+void ads_hal_dev_pin_int_enable(ads_hal_dev_t * dev, bool enable);
+
+/**
+ * @brief Keeps the sample path away from dev while a query response is
+ *				pending. Data ready edges are still stamped in drdy_time, so
+ *				a sample that replaces the response keeps its edge time.
+ */
+void ads_hal_dev_hold(ads_hal_dev_t * dev, bool hold);
+
+int ads_hal_dev_write_buffer(ads_hal_dev_t * dev, uint8_t * buffer, uint8_t len);
+
+int ads_hal_dev_read_buffer(ads_hal_dev_t * dev, uint8_t * buffer, uint8_t len);
+
+int ads_hal_dev_write_read_buffer(ads_hal_dev_t * dev, uint8_t * buffer, uint8_t write_len, uint8_t read_len);
+
+/**
+ * @brief Pulses the reset line of dev and stamps reset_time of every
+ *				registered device wired to the same line
+ */
+void ads_hal_dev_reset(ads_hal_dev_t * dev);
+
+/**
+ * @brief Restarts dev in its bootloader by holding the data ready line low
+ *				through a reset, the only way into a device without an
+ *				application. Stamps reset_time like ads_hal_dev_reset().
+ *
+ * @return	ADS_OK if successful ADS_ERR_BAD_PARAM if another registered
+ *				device shares both lines and would enter the bootloader too,
+ *				ADS_ERR if the backend can't drive the data ready line
+ */
+int ads_hal_dev_reset_bootloader(ads_hal_dev_t * dev);
+
+void ads_hal_dev_set_deferred(ads_hal_dev_t * dev, bool deferred, void (*notify)(void));
+
+/**
+ * @brief Reads out a pending or missed packet of dev and fires its callback
+ *
+ * @return	number of packets handled or ADS_ERR_IO if the read failed
+ */
+int ads_hal_dev_service(ads_hal_dev_t * dev);
+
+/**
+ * @brief Reads a sample packet from dev now and fires its callback, used by
+ *				schedulers that decide themselves when a device is read.
+ *				The caller clears a pending deferred edge under
+ *				ads_hal_lock(), an edge flagged during the read stays
+ *				pending.
+ *
+ * @param sample_time	edge time reported for the packet
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_hal_dev_read_sample(ads_hal_dev_t * dev, uint32_t sample_time);
+
+/**
+ * @brief Reads a packet from dev into its read buffer without firing the
+ *				callback, for callers that check the packet first
+ *
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_hal_dev_read_packet(ads_hal_dev_t * dev);
+
+/**
+ * @brief Routes the legacy single device functions above to dev. Used by
+ *				the driver so DFU and address selection act on its device.
+ */
+void ads_hal_set_default_device(ads_hal_dev_t * dev);
+
+/**
+ * @brief Device the single device functions act on
+ */
+ads_hal_dev_t * ads_hal_get_default_device(void);
+
+/**
+ * @brief Groups the transfers up to ads_hal_transfer_end(), so data ready
+ *				interrupts are masked once before and missed packets read
+ *				once after all of them instead of around each. Nests.
+ */
+void ads_hal_transfer_begin(void);
+void ads_hal_transfer_end(void);
+
+/**
+ * @brief Data ready edge of dev. Called by the backend from interrupt
+ *				context, or from the thread collecting edge events.
+ *
+ * @return	number of packets read, 0 if deferred or the device is masked
+ */
+int ads_hal_dev_interrupt(ads_hal_dev_t * dev, uint32_t time_us);
+
+/**
+ * @brief Data ready edge on a line, dispatched to every enabled device
+ *				wired to it. Only for the interrupt context or the thread
+ *				delivering edges, the statistics take it as the interrupt.
+ *
+ * @return	number of packets read
+ */
+int ads_hal_pin_interrupt(uint32_t datardy_pin, uint32_t time_us);
+
+/************************************************************************/
+/*               Backend Functions, one set per platform                */
+/************************************************************************/
+
+/**
+ * @brief Brings up the I2C bus. Called for every device, must tolerate
+ *				repeated calls.
+ */
+int ads_hal_bus_init(void);
+
+int ads_hal_bus_write(uint8_t address, uint8_t * buffer, uint8_t len);
+
+int ads_hal_bus_read(uint8_t address, uint8_t * buffer, uint8_t len);
+
+/**
+ * @brief Largest len ads_hal_bus_write() sends in one transaction, e.g.
+ *				the size of the Wire buffer
+ */
+uint8_t ads_hal_bus_max_write(void);
+
+/**
+ * @brief Writes a query command, waits ADS_QUERY_DELAY_MS and reads the
+ *				response into buffer
+ */
+int ads_hal_bus_query(uint8_t address, uint8_t * buffer, uint8_t write_len, uint8_t read_len);
+
+/**
+ * @brief Configures the data ready line of dev as an input
+ */
+int ads_hal_pin_init(ads_hal_dev_t * dev);
+
+/**
+ * @brief Connects or disconnects the data ready line of dev from
+ *				ads_hal_pin_interrupt()
+ */
+void ads_hal_pin_attach(ads_hal_dev_t * dev, bool attach);
+
+/**
+ * @brief true if the data ready line of dev is currently asserted. Backends
+ *				that queue every edge return false.
+ */
+bool ads_hal_pin_asserted(ads_hal_dev_t * dev);
+
+/**
+ * @brief Pulses the reset line of dev
+ */
+void ads_hal_pin_reset(ads_hal_dev_t * dev);
+
+/**
+ * @brief Pulses the reset line of dev with its data ready line held low for
+ *				ADS_BOOTLOADER_HOLD_MS, then releases data ready as an input
+ *
+ * @return	ADS_OK if successful ADS_ERR if data ready can't be driven
+ */
+int ads_hal_pin_reset_bootloader(ads_hal_dev_t * dev);
+
+/**
+ * @brief Delivers queued data ready edges through ads_hal_pin_interrupt().
+ *				Backends with interrupts have nothing to do here.
+ */
+void ads_hal_pin_poll(void);
+
+/**
+ * @brief Masks and unmasks the context that calls ads_hal_dev_interrupt()
+ *				around short critical sections
+ */
+void ads_hal_lock(void);
+void ads_hal_unlock(void);
+
 #endif /* ADS_TWO_AXIS_HAL_ */
@@ -1,6 +1,6 @@
 /**
  * Created by nrudh on 1/15/2025.
- * 
+ *
  * This software is provided "as is", without any warranty of any kind, express or implied,
  * including but not limited to the warranties of merchantability, fitness for a particular purpose,
  * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
@@ -9,61 +9,55 @@
  */
 
 #include "ads_two_axis_hal.h"
+#include "ads_two_axis_stats.h"
 
 /* Hardware Specific Includes */
 #include "Arduino.h"
 #include <Wire.h>
 
-static void (*ads_read_callback)(uint8_t *);
-
-
-static uint8_t read_buffer[ADS_TRANSFER_SIZE];
-
-#define ADS_DEFAULT_ADDR		(0x13)			// Default I2C address of the ADS
-
-static uint32_t ADS_RESET_PIN = 0;
-static uint32_t ADS_INTERRUPT_PIN = 0;
-
-static uint8_t _address = ADS_DEFAULT_ADDR;
+/* Wire buffers one transaction, its size differs between cores */
+#if defined(I2C_BUFFER_LENGTH)
+#define ADS_HAL_WIRE_BUFFER		(I2C_BUFFER_LENGTH)
+#elif defined(BUFFER_LENGTH)
+#define ADS_HAL_WIRE_BUFFER		(BUFFER_LENGTH)
+#elif defined(SERIAL_BUFFER_SIZE)
+#define ADS_HAL_WIRE_BUFFER		(SERIAL_BUFFER_SIZE)
+#else
+#define ADS_HAL_WIRE_BUFFER		(32)
+#endif
 
-volatile bool _ads_int_enabled = false;
-
-/* Device I2C address array. Use ads_hal_update_addr() to 
- * populate this array. */
-static uint8_t ads_addrs[ADS_COUNT] = {
-	ADS_DEFAULT_ADDR,
-};
+static bool _ads_bus_started = false;
 
 
 /************************************************************************/
 /*                        HAL Stub Functions                            */
 /************************************************************************/
 static inline void ads_hal_gpio_pin_write(uint8_t pin, uint8_t val);
-static void ads_hal_pin_int_init(void);
 
 
 /**
- * @brief ADS data ready interrupt. Reads out packet from ADS and fires callback in
- *  		  ads.c
- *
- * @param buffer[in]	Write buffer
- * @param len			Length of buffer.
- * @return	ADS_OK if successful ADS_ERR_IO if failed
+ * @brief ADS data ready interrupt. attachInterrupt() takes no argument, so
+ *				each device slot has its own entry point. The edge is handed to
+ *				every device on the same line.
  */
-void ads_hal_interrupt(void)
+template<uint8_t SLOT>
+static void ads_hal_interrupt(void)
 {
-	if(ads_hal_read_buffer(read_buffer, ADS_TRANSFER_SIZE) == ADS_OK)
-	{
-		ads_read_callback(read_buffer);
-	}
-}
+	ads_hal_dev_t * dev = ads_hal_get_device(SLOT);
 
-static void ads_hal_pin_int_init(void)
-{
-	pinMode(ADS_INTERRUPT_PIN, INPUT_PULLUP);
-	ads_hal_pin_int_enable(true);
+	if(dev)
+		ads_hal_pin_interrupt(dev->datardy_pin, micros());
 }
 
+static void (* const ads_hal_interrupts[])(void) = {
+	ads_hal_interrupt<0>, ads_hal_interrupt<1>, ads_hal_interrupt<2>, ads_hal_interrupt<3>,
+	ads_hal_interrupt<4>, ads_hal_interrupt<5>, ads_hal_interrupt<6>, ads_hal_interrupt<7>,
+	ads_hal_interrupt<8>, ads_hal_interrupt<9>,
+};
+
+static_assert(sizeof(ads_hal_interrupts) / sizeof(ads_hal_interrupts[0]) >= ADS_COUNT,
+			"Add an interrupt entry point for each device slot");
+
 
 static inline void ads_hal_gpio_pin_write(uint8_t pin, uint8_t val)
 {
@@ -75,182 +69,173 @@ void ads_hal_delay(uint16_t delay_ms)
 	delay(delay_ms);
 }
 
-void ads_hal_pin_int_enable(bool enable)
+void ads_hal_delay_us(uint32_t delay_us)
 {
-	_ads_int_enabled = enable;
-	
-	if(enable)
-	{
-		attachInterrupt(digitalPinToInterrupt(ADS_INTERRUPT_PIN), ads_hal_interrupt, FALLING);
-	}
-	else
+	// delayMicroseconds() is only accurate up to ~16 ms
+	if(delay_us >= 16000)
 	{
-		detachInterrupt(digitalPinToInterrupt(ADS_INTERRUPT_PIN));
+		delay(delay_us / 1000);
+		delay_us %= 1000;
 	}
+
+	delayMicroseconds((unsigned int)delay_us);
+}
+
+uint32_t ads_hal_get_time_us(void)
+{
+	return micros();
+}
+
+int ads_hal_bus_init(void)
+{
+	if(_ads_bus_started)
+		return ADS_OK;
+
+	// Configure I2C bus
+	Wire.begin();
+	Wire.setClock(400000);
+
+	_ads_bus_started = true;
+
+	return ADS_OK;
 }
 
 /**
  * @brief Write buffer of data to the Angular Displacement Sensor
  *
+ * @param address		I2C address of the ADS
  * @param buffer[in]	Write buffer
  * @param len			Length of buffer.
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_hal_write_buffer(uint8_t * buffer, uint8_t len)
+int ads_hal_bus_write(uint8_t address, uint8_t * buffer, uint8_t len)
 {
-	// Disable the interrupt
-	if(_ads_int_enabled)
-		detachInterrupt(digitalPinToInterrupt(ADS_INTERRUPT_PIN));
-	
-	Wire.beginTransmission(_address);
+	Wire.beginTransmission(address);
 	uint8_t nb_written = Wire.write(buffer, len);
 	Wire.endTransmission();
-	
-	// Enable the interrupt
-	if(_ads_int_enabled)
-	{
-		attachInterrupt(digitalPinToInterrupt(ADS_INTERRUPT_PIN), ads_hal_interrupt, FALLING);
-		
-		// Read data packet if interrupt was missed
-		if(digitalRead(ADS_INTERRUPT_PIN) == 0)
-		{
-			if(ads_hal_read_buffer(read_buffer, ADS_TRANSFER_SIZE) == ADS_OK)
-			{
-				ads_read_callback(read_buffer);
-			}
-		}
-	}
-	
+
 	if(nb_written == len)
 		return ADS_OK;
-	else
-		return ADS_ERR_IO;
+
+	ADS_STATS_INC(short_writes);
+	return ADS_ERR_IO;
 }
 
 /**
  * @brief Read buffer of data from the Angular Displacement Sensor
  *
+ * @param address		I2C address of the ADS
  * @param buffer[out]	Read buffer
  * @param len			Length of buffer.
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_hal_read_buffer(uint8_t * buffer, uint8_t len)
+int ads_hal_bus_read(uint8_t address, uint8_t * buffer, uint8_t len)
 {
-	Wire.requestFrom(_address, len);
-	
-	uint8_t i = 0; 
-	
+	Wire.requestFrom(address, len);
+
+	uint8_t i = 0;
+
 	while(Wire.available())
 	{
 		buffer[i] = Wire.read();
 		i++;
 	}
-	
+
 	if(i == len)
 		return ADS_OK;
-	else
-		return ADS_ERR_IO;
+
+	ADS_STATS_INC(short_reads);
+	return ADS_ERR_IO;
 }
 
-/**
- * @brief Reset the Angular Displacement Sensor
- *
- * @param dfuMode	Resets ADS into firmware update mode if true
- */
-void ads_hal_reset(void)
+uint8_t ads_hal_bus_max_write(void)
 {
-	// Configure reset line as an output
-	pinMode(ADS_RESET_PIN, OUTPUT);
-	
-	ads_hal_gpio_pin_write(ADS_RESET_PIN, 0);
-	ads_hal_delay(10);
-	ads_hal_gpio_pin_write(ADS_RESET_PIN, 1);
-	
-	pinMode(ADS_RESET_PIN, INPUT_PULLUP);
+	return ADS_HAL_WIRE_BUFFER > 255 ? 255 : ADS_HAL_WIRE_BUFFER;
 }
 
-/**
- * @brief Initializes the hardware abstraction layer 
- *
- * @return	ADS_OK if successful ADS_ERR_IO if failed
- */
-int ads_hal_init(void (*callback)(uint8_t*), uint32_t reset_pin, uint32_t datardy_pin)
+int ads_hal_bus_query(uint8_t address, uint8_t * buffer, uint8_t write_len, uint8_t read_len)
 {
-	ADS_RESET_PIN     = reset_pin;
-	ADS_INTERRUPT_PIN = datardy_pin;
-	
-	// Set callback pointer
-	ads_read_callback = callback;
-	
-	// Reset the ads
-	ads_hal_reset();
-	
-	// Wait for ads to initialize
-	ads_hal_delay(2000);
-	
-	// Configure and enable interrupt pin
-	ads_hal_pin_int_init();
-	
-	// Configure I2C bus
-	Wire.begin();
-	Wire.setClock(400000);
+	int ret = ads_hal_bus_write(address, buffer, write_len);
 
-	return ADS_OK;
+	if(ret == ADS_OK)
+	{
+		ads_hal_delay(ADS_QUERY_DELAY_MS);
+		ret = ads_hal_bus_read(address, buffer, read_len);
+	}
+
+	return ret;
 }
 
-/**
- * @brief Selects the current device address of the ADS driver is communicating with
- *
- * @param device select device 0 - ADS_COUNT
- * @return	ADS_OK if successful ADS_ERR_BAD_PARAM if invalid device number
- */
-int ads_hal_select_device(uint8_t device)
+int ads_hal_pin_init(ads_hal_dev_t * dev)
 {
-	if(device < ADS_COUNT)
-		_address = ads_addrs[device];
-	else
-		return ADS_ERR_BAD_PARAM;
-		
+	pinMode(dev->datardy_pin, INPUT_PULLUP);
+
 	return ADS_OK;
 }
 
-/**
- * @brief Updates the I2C address in the ads_addrs[] array. Updates the current
- *		  selected address.
- *
- * @param	device	device number of the device that is being updated
- * @param	address	new address of the ADS
- * @return	ADS_OK if successful ADS_ERR_BAD_PARAM if failed
- */
-int ads_hal_update_device_addr(uint8_t device, uint8_t address)
+void ads_hal_pin_attach(ads_hal_dev_t * dev, bool attach)
 {
-	if(device < ADS_COUNT)
-		ads_addrs[device] = address;
+	if(attach)
+	{
+		attachInterrupt(digitalPinToInterrupt(dev->datardy_pin), ads_hal_interrupts[dev->slot], FALLING);
+	}
 	else
-		return ADS_ERR_BAD_PARAM;
-		
-	_address = address;
-		
-	return ADS_OK;	
+	{
+		detachInterrupt(digitalPinToInterrupt(dev->datardy_pin));
+	}
+}
+
+bool ads_hal_pin_asserted(ads_hal_dev_t * dev)
+{
+	return digitalRead(dev->datardy_pin) == 0;
 }
 
 /**
- * @brief Gets the current i2c address that the hal layer is addressing. 	
- *				Used by device firmware update (dfu)
- * @return	uint8_t _address
+ * @brief Reset the Angular Displacement Sensor
  */
-uint8_t ads_hal_get_address(void)
+void ads_hal_pin_reset(ads_hal_dev_t * dev)
 {
-	return _address;
+	// Configure reset line as an output
+	pinMode(dev->reset_pin, OUTPUT);
+
+	ads_hal_gpio_pin_write(dev->reset_pin, 0);
+	ads_hal_delay(10);
+	ads_hal_gpio_pin_write(dev->reset_pin, 1);
+
+	pinMode(dev->reset_pin, INPUT_PULLUP);
 }
 
 /**
- * @brief Sets the i2c address that the hal layer is addressing *	
- *				Used by device firmware update (dfu)
+ * @brief Reset the Angular Displacement Sensor into its bootloader
  */
-void ads_hal_set_address(uint8_t address)
+int ads_hal_pin_reset_bootloader(ads_hal_dev_t * dev)
 {
-	_address = address;
+	pinMode(dev->reset_pin, OUTPUT);
+	pinMode(dev->datardy_pin, OUTPUT);
+
+	ads_hal_gpio_pin_write(dev->reset_pin, 0);
+	ads_hal_delay(100);
+
+	// The bootloader stays resident while data ready is low at startup
+	ads_hal_gpio_pin_write(dev->datardy_pin, 0);
+	ads_hal_gpio_pin_write(dev->reset_pin, 1);
+	ads_hal_delay(ADS_BOOTLOADER_HOLD_MS);
+
+	pinMode(dev->reset_pin, INPUT_PULLUP);
+
+	return ads_hal_pin_init(dev);
 }
 
+void ads_hal_pin_poll(void)
+{
+}
 
+void ads_hal_lock(void)
+{
+	noInterrupts();
+}
+
+void ads_hal_unlock(void)
+{
+	interrupts();
+}
@@ -0,0 +1,561 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+/* Linux i2c-dev HAL. Not part of Arduino builds. */
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include "ads_two_axis_hal_linux.h"
+#include "ads_two_axis_stats.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <linux/gpio.h>
+
+#define ADS_EVENT_BATCH			(16)			// Data ready events drained per read()
+
+static ads_hal_linux_config_t linux_config = {
+	"/dev/i2c-1",
+	"/dev/gpiochip0",
+	ADS_QUERY_DELAY_MS * 1000,
+	NULL
+};
+
+static bool bus_open = false;
+static int i2c_fd   = -1;
+
+/* All data ready lines are held in one request so a single fd carries
+ * the edges of every device */
+static int drdy_fd  = -1;
+static uint32_t drdy_lines[ADS_COUNT];
+static uint8_t drdy_line_count = 0;
+
+static int reset_fds[ADS_COUNT];
+static uint32_t reset_lines[ADS_COUNT];
+static uint8_t reset_line_count = 0;
+
+static ads_hal_linux_stats_t linux_stats;
+
+static bool events_drained = false;			// Skips the redundant drain in ads_hal_service()
+
+
+static inline const ads_hal_linux_ops_t * ads_hal_linux_ops(void)
+{
+	return linux_config.ops;
+}
+
+/**
+ * @brief Issues one I2C_RDWR transaction
+ *
+ * @return	ADS_OK if every message completed ADS_ERR_IO if not
+ */
+static int ads_hal_linux_transfer(struct i2c_msg * msgs, uint32_t count)
+{
+	const ads_hal_linux_ops_t * ops = ads_hal_linux_ops();
+	int ret;
+
+	linux_stats.i2c_syscalls++;
+
+	if(ops && ops->transfer)
+	{
+		ret = ops->transfer(ops->ctx, msgs, count);
+	}
+	else
+	{
+		struct i2c_rdwr_ioctl_data data;
+		data.msgs = msgs;
+		data.nmsgs = count;
+
+		ret = ioctl(i2c_fd, I2C_RDWR, &data);
+	}
+
+	if(ret == (int)count)
+		return ADS_OK;
+	else
+		return ADS_ERR_IO;
+}
+
+static void ads_hal_linux_delay_us(uint32_t us)
+{
+	const ads_hal_linux_ops_t * ops = ads_hal_linux_ops();
+
+	if(ops && ops->delay_us)
+	{
+		ops->delay_us(ops->ctx, us);
+		return;
+	}
+
+	struct timespec ts;
+	ts.tv_sec = us / 1000000;
+	ts.tv_nsec = (long)(us % 1000000) * 1000;
+
+	while(clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, &ts) == EINTR)
+		;
+}
+
+static int ads_hal_linux_request_lines(const uint32_t * offsets, uint8_t count, uint64_t flags)
+{
+	int chip_fd = open(linux_config.gpio_chip, O_RDWR | O_CLOEXEC);
+	if(chip_fd < 0)
+		return -1;
+
+	struct gpio_v2_line_request req;
+	memset(&req, 0, sizeof(req));
+
+	for(uint8_t i = 0; i < count; i++)
+		req.offsets[i] = offsets[i];
+
+	req.num_lines = count;
+	req.config.flags = flags;
+	strncpy(req.consumer, "ads_two_axis", sizeof(req.consumer) - 1);
+
+	int ret = ioctl(chip_fd, GPIO_V2_GET_LINE_IOCTL, &req);
+
+	// Not every GPIO controller supports bias settings
+	if(ret < 0 && (flags & GPIO_V2_LINE_FLAG_BIAS_PULL_UP))
+	{
+		req.config.flags = flags & ~GPIO_V2_LINE_FLAG_BIAS_PULL_UP;
+		ret = ioctl(chip_fd, GPIO_V2_GET_LINE_IOCTL, &req);
+	}
+
+	close(chip_fd);
+
+	return (ret < 0) ? -1 : req.fd;
+}
+
+static void ads_hal_linux_gpio_write(int fd, bool val)
+{
+	struct gpio_v2_line_values values;
+	values.bits = val ? 1 : 0;
+	values.mask = 1;
+
+	ioctl(fd, GPIO_V2_LINE_SET_VALUES_IOCTL, &values);
+}
+
+/**
+ * @brief Reset line of pin, requested as an output on first use and held
+ *				until ads_hal_linux_close()
+ */
+static int ads_hal_linux_reset_fd(uint32_t pin)
+{
+	for(uint8_t i = 0; i < reset_line_count; i++)
+	{
+		if(reset_lines[i] == pin)
+			return reset_fds[i];
+	}
+
+	if(reset_line_count == ADS_COUNT)
+		return -1;
+
+	int fd = ads_hal_linux_request_lines(&pin, 1, GPIO_V2_LINE_FLAG_OUTPUT);
+	if(fd < 0)
+		return -1;
+
+	reset_lines[reset_line_count] = pin;
+	reset_fds[reset_line_count] = fd;
+	reset_line_count++;
+
+	return fd;
+}
+
+/**
+ * @brief Reads every queued data ready event and dispatches one edge per
+ *				line. The ADS holds a single packet, so one read serves every
+ *				queued edge of a line.
+ *
+ * @return	number of packets read or ADS_ERR_IO
+ */
+static int ads_hal_linux_drain(int fd)
+{
+	uint32_t lines[ADS_COUNT];
+	uint64_t times[ADS_COUNT];
+	uint8_t nb_lines = 0;
+
+	for(;;)
+	{
+		struct gpio_v2_line_event events[ADS_EVENT_BATCH];
+
+		linux_stats.event_syscalls++;
+
+		ssize_t nb_read = read(fd, events, sizeof(events));
+
+		if(nb_read < 0)
+		{
+			if(errno == EAGAIN || errno == EINTR)
+				break;
+
+			return ADS_ERR_IO;
+		}
+
+		size_t nb_events = nb_read / sizeof(events[0]);
+
+		linux_stats.edges += nb_events;
+
+		for(size_t i = 0; i < nb_events; i++)
+		{
+			uint8_t j = 0;
+
+			while(j < nb_lines && lines[j] != events[i].offset)
+				j++;
+
+			if(j == nb_lines)
+			{
+				if(nb_lines == ADS_COUNT)
+					continue;
+
+				lines[nb_lines++] = events[i].offset;
+			}
+
+			times[j] = events[i].timestamp_ns;
+		}
+
+		if(nb_events < ADS_EVENT_BATCH)
+			break;
+	}
+
+	int handled = 0;
+
+	// Event timestamps are CLOCK_MONOTONIC, the ads_hal_get_time_us() base
+	for(uint8_t j = 0; j < nb_lines; j++)
+		handled += ads_hal_pin_interrupt(lines[j], (uint32_t)(times[j] / 1000));
+
+	return handled;
+}
+
+void ads_hal_delay(uint16_t delay_ms)
+{
+	ads_hal_linux_delay_us((uint32_t)delay_ms * 1000);
+}
+
+void ads_hal_delay_us(uint32_t delay_us)
+{
+	ads_hal_linux_delay_us(delay_us);
+}
+
+uint32_t ads_hal_get_time_us(void)
+{
+	const ads_hal_linux_ops_t * ops = ads_hal_linux_ops();
+
+	if(ops && ops->time_us)
+		return ops->time_us(ops->ctx);
+
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+int ads_hal_bus_init(void)
+{
+	const ads_hal_linux_ops_t * ops = ads_hal_linux_ops();
+
+	if(bus_open)
+		return ADS_OK;
+
+	if(!(ops && ops->transfer))
+	{
+		i2c_fd = open(linux_config.i2c_dev, O_RDWR | O_CLOEXEC);
+		if(i2c_fd < 0)
+			return ADS_ERR_IO;
+	}
+
+	memset(&linux_stats, 0, sizeof(linux_stats));
+	bus_open = true;
+
+	return ADS_OK;
+}
+
+int ads_hal_bus_write(uint8_t address, uint8_t * buffer, uint8_t len)
+{
+	struct i2c_msg msg;
+	msg.addr = address;
+	msg.flags = 0;
+	msg.len = len;
+	msg.buf = buffer;
+
+	if(ads_hal_linux_transfer(&msg, 1) == ADS_OK)
+		return ADS_OK;
+
+	ADS_STATS_INC(short_writes);
+	return ADS_ERR_IO;
+}
+
+int ads_hal_bus_read(uint8_t address, uint8_t * buffer, uint8_t len)
+{
+	struct i2c_msg msg;
+	msg.addr = address;
+	msg.flags = I2C_M_RD;
+	msg.len = len;
+	msg.buf = buffer;
+
+	if(ads_hal_linux_transfer(&msg, 1) == ADS_OK)
+		return ADS_OK;
+
+	ADS_STATS_INC(short_reads);
+	return ADS_ERR_IO;
+}
+
+/* i2c-dev takes up to 8192 bytes per message, the length is a uint8_t */
+uint8_t ads_hal_bus_max_write(void)
+{
+	return 255;
+}
+
+/**
+ * @brief Writes a query command and reads back the response. Without a
+ *				query delay both halves go out in a single I2C_RDWR with a
+ *				repeated start.
+ */
+int ads_hal_bus_query(uint8_t address, uint8_t * buffer, uint8_t write_len, uint8_t read_len)
+{
+	if(linux_config.query_delay_us)
+	{
+		int ret = ads_hal_bus_write(address, buffer, write_len);
+
+		if(ret == ADS_OK)
+		{
+			ads_hal_linux_delay_us(linux_config.query_delay_us);
+			ret = ads_hal_bus_read(address, buffer, read_len);
+		}
+
+		return ret;
+	}
+
+	uint8_t command[ADS_TRANSFER_SIZE];
+	uint8_t command_len = write_len < sizeof(command) ? write_len : sizeof(command);
+	memcpy(command, buffer, command_len);
+
+	struct i2c_msg msgs[2];
+	msgs[0].addr = address;
+	msgs[0].flags = 0;
+	msgs[0].len = command_len;
+	msgs[0].buf = command;
+	msgs[1].addr = address;
+	msgs[1].flags = I2C_M_RD;
+	msgs[1].len = read_len;
+	msgs[1].buf = buffer;
+
+	return ads_hal_linux_transfer(msgs, 2);
+}
+
+/**
+ * @brief Adds the data ready line of dev to the line request. The request
+ *				is rebuilt when a new line appears.
+ */
+int ads_hal_pin_init(ads_hal_dev_t * dev)
+{
+	if(ads_hal_linux_ops() || linux_config.gpio_chip == NULL)
+		return ADS_OK;
+
+	for(uint8_t i = 0; i < drdy_line_count; i++)
+	{
+		if(drdy_lines[i] == dev->datardy_pin)
+			return ADS_OK;
+	}
+
+	if(drdy_line_count == ADS_COUNT)
+		return ADS_ERR_IO;
+
+	drdy_lines[drdy_line_count++] = dev->datardy_pin;
+
+	if(drdy_fd >= 0)
+		close(drdy_fd);
+
+	drdy_fd = ads_hal_linux_request_lines(drdy_lines, drdy_line_count,
+				GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_FALLING | GPIO_V2_LINE_FLAG_BIAS_PULL_UP);
+
+	if(drdy_fd < 0)
+	{
+		drdy_line_count--;
+		return ADS_ERR_IO;
+	}
+
+	fcntl(drdy_fd, F_SETFL, fcntl(drdy_fd, F_GETFL) | O_NONBLOCK);
+
+	return ADS_OK;
+}
+
+/* The kernel queues edges whether or not a device is masked */
+void ads_hal_pin_attach(ads_hal_dev_t * dev, bool attach)
+{
+	(void)dev;
+	(void)attach;
+}
+
+/* No edge can be missed, every one is queued by the kernel */
+bool ads_hal_pin_asserted(ads_hal_dev_t * dev)
+{
+	(void)dev;
+	return false;
+}
+
+/**
+ * @brief Reset the Angular Displacement Sensor
+ */
+void ads_hal_pin_reset(ads_hal_dev_t * dev)
+{
+	const ads_hal_linux_ops_t * ops = ads_hal_linux_ops();
+
+	if(ops && ops->reset)
+	{
+		ops->reset(ops->ctx, dev->reset_pin);
+		return;
+	}
+
+	if(ops || linux_config.gpio_chip == NULL)
+		return;
+
+	int fd = ads_hal_linux_reset_fd(dev->reset_pin);
+	if(fd < 0)
+		return;
+
+	ads_hal_linux_gpio_write(fd, false);
+	ads_hal_delay(10);
+	ads_hal_linux_gpio_write(fd, true);
+}
+
+/* Data ready belongs to the edge detection request and is never driven */
+int ads_hal_pin_reset_bootloader(ads_hal_dev_t * dev)
+{
+	(void)dev;
+	return ADS_ERR;
+}
+
+void ads_hal_pin_poll(void)
+{
+	int fd = ads_hal_linux_event_fd();
+
+	if(events_drained)
+	{
+		events_drained = false;
+		return;
+	}
+
+	if(fd >= 0)
+		ads_hal_linux_drain(fd);
+}
+
+/* Edges are only delivered from the thread calling into the HAL */
+void ads_hal_lock(void)
+{
+}
+
+void ads_hal_unlock(void)
+{
+}
+
+void ads_hal_linux_get_default_config(ads_hal_linux_config_t * config)
+{
+	config->i2c_dev = "/dev/i2c-1";
+	config->gpio_chip = "/dev/gpiochip0";
+	config->query_delay_us = ADS_QUERY_DELAY_MS * 1000;
+	config->ops = NULL;
+}
+
+int ads_hal_linux_configure(const ads_hal_linux_config_t * config)
+{
+	if(config == NULL || (config->i2c_dev == NULL && !(config->ops && config->ops->transfer)))
+		return ADS_ERR_BAD_PARAM;
+
+	ads_hal_linux_close();
+
+	linux_config = *config;
+
+	return ADS_OK;
+}
+
+int ads_hal_linux_event_fd(void)
+{
+	const ads_hal_linux_ops_t * ops = ads_hal_linux_ops();
+
+	if(ops)
+		return ops->event_fd;
+
+	return drdy_fd;
+}
+
+int ads_hal_linux_poll(int timeout_ms)
+{
+	const ads_hal_linux_ops_t * ops = ads_hal_linux_ops();
+	int fd = ads_hal_linux_event_fd();
+
+	if(fd < 0)
+		return 0;
+
+	int ready;
+
+	linux_stats.event_syscalls++;
+
+	if(ops && ops->wait)
+	{
+		ready = ops->wait(ops->ctx, fd, timeout_ms);
+	}
+	else
+	{
+		struct pollfd pfd;
+		pfd.fd = fd;
+		pfd.events = POLLIN;
+		pfd.revents = 0;
+
+		ready = poll(&pfd, 1, timeout_ms);
+	}
+
+	if(ready < 0)
+		return (errno == EINTR) ? 0 : ADS_ERR_IO;
+
+	if(ready == 0)
+		return 0;
+
+	int handled = ads_hal_linux_drain(fd);
+
+	if(handled < 0)
+		return handled;
+
+	// Deferred devices were only marked pending by the drain
+	events_drained = true;
+	int deferred = ads_hal_service();
+	events_drained = false;
+
+	if(deferred < 0)
+		return deferred;
+
+	handled += deferred;
+	linux_stats.samples += handled;
+
+	return handled;
+}
+
+void ads_hal_linux_close(void)
+{
+	if(i2c_fd >= 0)
+		close(i2c_fd);
+
+	if(drdy_fd >= 0)
+		close(drdy_fd);
+
+	for(uint8_t i = 0; i < reset_line_count; i++)
+		close(reset_fds[i]);
+
+	i2c_fd = drdy_fd = -1;
+	drdy_line_count = 0;
+	reset_line_count = 0;
+	bus_open = false;
+}
+
+void ads_hal_linux_get_stats(ads_hal_linux_stats_t * stats)
+{
+	*stats = linux_stats;
+}
+
+#endif /* __linux__ && !ARDUINO */
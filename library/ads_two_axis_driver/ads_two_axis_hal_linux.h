@@ -0,0 +1,102 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_HAL_LINUX_H_
+#define ADS_TWO_AXIS_HAL_LINUX_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ads_two_axis_hal.h"
+
+/*
+ * HAL for Linux hosts using /dev/i2c-N and a GPIO character device.
+ *
+ * Every transfer is a single I2C_RDWR ioctl. The data ready lines of all
+ * devices are requested together with falling edge detection and their
+ * events are handled from the application thread by ads_hal_linux_poll();
+ * there is no interrupt context on Linux. Reset and data ready pins are line
+ * offsets on the configured GPIO chip.
+ */
+
+struct i2c_msg;
+
+/* Replaces the kernel interfaces, e.g. with a loopback stand-in */
+typedef struct {
+	int  (*transfer)(void * ctx, struct i2c_msg * msgs, uint32_t count);	// Same contract as ioctl(I2C_RDWR)
+	int  (*wait)(void * ctx, int fd, int timeout_ms);						// Same contract as poll() on fd
+	void (*delay_us)(void * ctx, uint32_t us);
+	void (*reset)(void * ctx, uint32_t pin);
+	uint32_t (*time_us)(void * ctx);										// Replaces CLOCK_MONOTONIC
+	void * ctx;
+	int event_fd;					// Delivers struct gpio_v2_line_event records, -1 if none
+} ads_hal_linux_ops_t;
+
+typedef struct {
+	const char * i2c_dev;			// I2C adapter, e.g. "/dev/i2c-1"
+	const char * gpio_chip;			// GPIO chip with reset and data ready lines, NULL if not wired
+	uint32_t query_delay_us;		// Delay between a query and its response, 0 issues both in one I2C_RDWR
+	const ads_hal_linux_ops_t * ops;	// NULL to use the kernel interfaces
+} ads_hal_linux_config_t;
+
+typedef struct {
+	uint32_t i2c_syscalls;			// I2C_RDWR calls
+	uint32_t event_syscalls;		// poll() and read() calls on the data ready line
+	uint32_t edges;					// Falling edges reported by the kernel
+	uint32_t samples;				// Packets handed to the driver by ads_hal_linux_poll()
+} ads_hal_linux_stats_t;
+
+
+/**
+ * @brief Fills config with /dev/i2c-1, /dev/gpiochip0 and the
+ *				ADS_QUERY_DELAY_MS query delay
+ */
+void ads_hal_linux_get_default_config(ads_hal_linux_config_t * config);
+
+/**
+ * @brief Selects the adapter and GPIO chip used by the HAL. Must be called
+ *				before the first device is initialized. Strings must outlive
+ *				the HAL.
+ *
+ * @return	ADS_OK if successful ADS_ERR_BAD_PARAM if config is invalid
+ */
+int ads_hal_linux_configure(const ads_hal_linux_config_t * config);
+
+/**
+ * @brief Waits for data ready edges and reads out one packet per device
+ *				with a queued edge. Call from the application loop.
+ *
+ * @param timeout_ms	maximum wait, 0 to return immediately, -1 to block
+ * @return	number of packets handed to the driver or ADS_ERR_IO
+ */
+int ads_hal_linux_poll(int timeout_ms);
+
+/**
+ * @brief Data ready event file descriptor for integration in an external
+ *				poll loop, -1 if data ready is not wired
+ */
+int ads_hal_linux_event_fd(void);
+
+/**
+ * @brief Releases the I2C adapter and GPIO lines
+ */
+void ads_hal_linux_close(void);
+
+/**
+ * @brief Syscall and event counters since ads_hal_init()
+ */
+void ads_hal_linux_get_stats(ads_hal_linux_stats_t * stats);
+
+/**
+ * @brief Fills ops with a loopback that routes transfers, data ready events,
+ *				reset and delays to ads_two_axis_sim
+ *
+ * @return	ADS_OK if successful ADS_ERR_IO if the event pipe could not be created
+ */
+int ads_hal_linux_sim_ops(ads_hal_linux_ops_t * ops);
+
+#endif /* ADS_TWO_AXIS_HAL_LINUX_H_ */
@@ -0,0 +1,143 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+/* Loopback that runs the Linux HAL against ads_two_axis_sim. Not part of Arduino builds. */
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include "ads_two_axis_hal_linux.h"
+#include "ads_two_axis_sim.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <linux/i2c.h>
+#include <linux/gpio.h>
+
+static int event_pipe[2] = {-1, -1};
+
+/**
+ * @brief Data ready edges from the simulation become GPIO line events
+ */
+static void ads_hal_linux_sim_drdy(uint8_t device, uint64_t time_us)
+{
+	struct gpio_v2_line_event event;
+	memset(&event, 0, sizeof(event));
+
+	event.timestamp_ns = time_us * 1000;
+	event.id = GPIO_V2_LINE_EVENT_FALLING_EDGE;
+	event.offset = device;
+
+	// A full pipe drops the edge, as a full kernel event FIFO would
+	if(write(event_pipe[1], &event, sizeof(event)) < 0)
+		return;
+}
+
+static int ads_hal_linux_sim_transfer(void * ctx, struct i2c_msg * msgs, uint32_t count)
+{
+	(void)ctx;
+
+	for(uint32_t i = 0; i < count; i++)
+	{
+		uint16_t nb;
+
+		if(msgs[i].flags & I2C_M_RD)
+			nb = ads_sim_i2c_read((uint8_t)msgs[i].addr, msgs[i].buf, msgs[i].len);
+		else
+			nb = ads_sim_i2c_write((uint8_t)msgs[i].addr, msgs[i].buf, msgs[i].len);
+
+		if(nb != msgs[i].len)
+		{
+			errno = EREMOTEIO;
+			return -1;
+		}
+	}
+
+	return (int)count;
+}
+
+static int ads_hal_linux_sim_readable(int fd)
+{
+	struct pollfd pfd;
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+
+	return poll(&pfd, 1, 0);
+}
+
+/**
+ * @brief Runs simulation time forward until an edge is queued or the
+ *				timeout expires
+ */
+static int ads_hal_linux_sim_wait(void * ctx, int fd, int timeout_ms)
+{
+	(void)ctx;
+
+	uint64_t deadline = (timeout_ms < 0) ? UINT64_MAX : ads_sim_time_us() + (uint64_t)timeout_ms * 1000;
+
+	for(;;)
+	{
+		int ready = ads_hal_linux_sim_readable(fd);
+
+		if(ready != 0 || ads_sim_time_us() >= deadline)
+			return ready;
+
+		uint64_t next = ads_sim_next_event_us();
+
+		// Nothing will ever happen on a blocking wait
+		if(next == UINT64_MAX && timeout_ms < 0)
+			return 0;
+
+		uint64_t target = (next < deadline) ? next : deadline;
+		ads_sim_advance_us(target > ads_sim_time_us() ? target - ads_sim_time_us() : 0);
+	}
+}
+
+static void ads_hal_linux_sim_delay_us(void * ctx, uint32_t us)
+{
+	(void)ctx;
+	ads_sim_advance_us(us);
+}
+
+static void ads_hal_linux_sim_reset(void * ctx, uint32_t pin)
+{
+	(void)ctx;
+	ads_sim_advance_us(10000);
+	ads_sim_reset(ads_sim_pin_device(pin), false);
+}
+
+static uint32_t ads_hal_linux_sim_time_us(void * ctx)
+{
+	(void)ctx;
+	return (uint32_t)ads_sim_time_us();
+}
+
+int ads_hal_linux_sim_ops(ads_hal_linux_ops_t * ops)
+{
+	if(!ads_sim_initialized())
+		ads_sim_init(NULL);
+
+	if(event_pipe[0] < 0 && pipe2(event_pipe, O_NONBLOCK | O_CLOEXEC) < 0)
+		return ADS_ERR_IO;
+
+	ads_sim_set_drdy_handler(ads_hal_linux_sim_drdy);
+
+	ops->transfer = ads_hal_linux_sim_transfer;
+	ops->wait = ads_hal_linux_sim_wait;
+	ops->delay_us = ads_hal_linux_sim_delay_us;
+	ops->reset = ads_hal_linux_sim_reset;
+	ops->time_us = ads_hal_linux_sim_time_us;
+	ops->ctx = NULL;
+	ops->event_fd = event_pipe[0];
+
+	return ADS_OK;
+}
+
+#endif /* __linux__ && !ARDUINO */
@@ -0,0 +1,335 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+/* Host HAL playing back a recording. Not part of Arduino builds. */
+#if !defined(ARDUINO)
+
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include "ads_two_axis_hal_replay.h"
+
+typedef std::chrono::steady_clock ads_replay_clock;
+
+static ads_hal_replay_config_t replay_config;
+static ads_hal_replay_stats_t replay_stats;
+
+static bool replay_configured = false;
+static bool replay_started = false;
+static bool replay_delivering = false;
+
+static ads_rec_event_t replay_next;
+static bool replay_has_next = false;
+
+static uint32_t replay_now;					// Clock seen by the driver
+static uint32_t replay_rec_start;			// Recording time of the first event
+static ads_replay_clock::time_point replay_wall_start;
+
+/* Packet the next bus read of each device slot returns */
+static uint8_t replay_staged[ADS_COUNT][ADS_TRANSFER_SIZE];
+static bool replay_unread[ADS_COUNT];
+
+/* Query response waiting to be read, takes precedence over a staged packet */
+static uint8_t replay_response[ADS_COUNT][ADS_TRANSFER_SIZE];
+static bool replay_responding[ADS_COUNT];
+
+
+static ads_hal_dev_t * ads_hal_replay_find(uint8_t address)
+{
+	for(uint8_t i = 0; i < ADS_COUNT; i++)
+	{
+		ads_hal_dev_t * dev = ads_hal_get_device(i);
+
+		if(dev && dev->address == address)
+			return dev;
+	}
+
+	return NULL;
+}
+
+static void ads_hal_replay_load(void)
+{
+	replay_has_next = ads_rec_next(replay_config.reader, &replay_next) == 1;
+}
+
+/**
+ * @brief In paced mode sleeps until the recording time t is due
+ */
+static void ads_hal_replay_wait(uint32_t t)
+{
+	if(replay_config.mode != ADS_REPLAY_PACED)
+		return;
+
+	std::this_thread::sleep_until(replay_wall_start + std::chrono::microseconds((int32_t)(t - replay_rec_start)));
+}
+
+/**
+ * @brief Delivers the loaded event and loads the one after it
+ *
+ * @param service	read deferred devices right away
+ */
+static void ads_hal_replay_deliver(bool service)
+{
+	ads_rec_event_t ev = replay_next;
+
+	ads_hal_replay_load();
+
+	replay_now = ev.time_us;
+
+	if(ev.type == ADS_REC_STATE)
+	{
+		replay_stats.states++;
+
+		if(replay_config.state)
+			replay_config.state(ev.address, ev.sps, ev.axes, ev.time_us);
+
+		return;
+	}
+
+	ads_hal_dev_t * dev = ads_hal_replay_find(ev.address);
+
+	if(dev == NULL)
+	{
+		replay_stats.unmatched++;
+		return;
+	}
+
+	memcpy(replay_staged[dev->slot], ev.packet, ADS_TRANSFER_SIZE);
+	replay_unread[dev->slot] = true;
+	replay_stats.packets++;
+
+	replay_delivering = true;
+
+	ads_hal_dev_interrupt(dev, ev.time_us);
+
+	if(service && dev->deferred)
+		ads_hal_dev_service(dev);
+
+	replay_delivering = false;
+}
+
+void ads_hal_replay_get_default_config(ads_hal_replay_config_t * config)
+{
+	config->reader = NULL;
+	config->mode = ADS_REPLAY_MAX_SPEED;
+	config->dev_type = ADS_DEV_TWO_AXIS_V2;
+	config->fw_ver = 0xFFFF;
+	config->state = NULL;
+}
+
+int ads_hal_replay_init(const ads_hal_replay_config_t * config)
+{
+	if(config == NULL || config->reader == NULL)
+		return ADS_ERR_BAD_PARAM;
+
+	replay_config = *config;
+	memset(&replay_stats, 0, sizeof(replay_stats));
+	memset(replay_unread, 0, sizeof(replay_unread));
+	memset(replay_responding, 0, sizeof(replay_responding));
+
+	replay_configured = true;
+	replay_started = false;
+	replay_has_next = false;
+	replay_now = 0;
+
+	return ADS_OK;
+}
+
+void ads_hal_replay_start(void)
+{
+	ads_rec_rewind(replay_config.reader);
+	ads_hal_replay_load();
+
+	replay_rec_start = replay_has_next ? replay_next.time_us : replay_now;
+	replay_now = replay_rec_start;
+	replay_wall_start = ads_replay_clock::now();
+	replay_started = true;
+}
+
+uint32_t ads_hal_replay_run(uint32_t max_events)
+{
+	uint32_t n = 0;
+
+	while(replay_started && replay_has_next && n < max_events)
+	{
+		ads_hal_replay_wait(replay_next.time_us);
+		ads_hal_replay_deliver(true);
+		n++;
+	}
+
+	return n;
+}
+
+bool ads_hal_replay_done(void)
+{
+	return replay_started && !replay_has_next;
+}
+
+void ads_hal_replay_get_stats(ads_hal_replay_stats_t * stats)
+{
+	*stats = replay_stats;
+}
+
+
+/************************************************************************/
+/*                          Backend Functions                           */
+/************************************************************************/
+
+void ads_hal_delay(uint16_t delay_ms)
+{
+	ads_hal_delay_us((uint32_t)delay_ms * 1000);
+}
+
+void ads_hal_delay_us(uint32_t delay_us)
+{
+	uint32_t target = replay_now + delay_us;
+
+	if(replay_started && !replay_delivering)
+	{
+		while(replay_has_next && (int32_t)(replay_next.time_us - target) <= 0)
+		{
+			ads_hal_replay_wait(replay_next.time_us);
+			ads_hal_replay_deliver(false);
+		}
+
+		ads_hal_replay_wait(target);
+	}
+
+	replay_now = target;
+}
+
+uint32_t ads_hal_get_time_us(void)
+{
+	return replay_now;
+}
+
+int ads_hal_bus_init(void)
+{
+	return replay_configured ? ADS_OK : ADS_ERR;
+}
+
+/* Commands change nothing, the recording already holds their effect.
+ * Queries are answered from the config. */
+int ads_hal_bus_write(uint8_t address, uint8_t * buffer, uint8_t len)
+{
+	ads_hal_dev_t * dev = ads_hal_replay_find(address);
+
+	if(dev == NULL || len == 0)
+		return ADS_OK;
+
+	uint8_t * response = replay_response[dev->slot];
+
+	memset(response, 0, ADS_TRANSFER_SIZE);
+
+	if(buffer[0] == ADS_GET_DEV_ID)
+	{
+		response[0] = ADS_DEV_ID;
+		response[1] = (uint8_t)replay_config.dev_type;
+	}
+	else if(buffer[0] == ADS_GET_FW_VER)
+	{
+		response[0] = ADS_FW_VER;
+		ads_uint16_encode(replay_config.fw_ver, &response[1]);
+	}
+	else
+	{
+		return ADS_OK;
+	}
+
+	replay_responding[dev->slot] = true;
+
+	return ADS_OK;
+}
+
+int ads_hal_bus_read(uint8_t address, uint8_t * buffer, uint8_t len)
+{
+	ads_hal_dev_t * dev = ads_hal_replay_find(address);
+
+	if(dev == NULL || len > ADS_TRANSFER_SIZE)
+		return ADS_ERR_IO;
+
+	if(replay_responding[dev->slot])
+	{
+		memcpy(buffer, replay_response[dev->slot], len);
+		replay_responding[dev->slot] = false;
+		return ADS_OK;
+	}
+
+	memcpy(buffer, replay_staged[dev->slot], len);
+	replay_unread[dev->slot] = false;
+
+	return ADS_OK;
+}
+
+/* Writes are answered from the recording, any length fits */
+uint8_t ads_hal_bus_max_write(void)
+{
+	return 255;
+}
+
+/* Answered at once, a query delay would deliver packets in the middle of it */
+int ads_hal_bus_query(uint8_t address, uint8_t * buffer, uint8_t write_len, uint8_t read_len)
+{
+	int ret = ads_hal_bus_write(address, buffer, write_len);
+
+	if(ret != ADS_OK)
+		return ret;
+
+	return ads_hal_bus_read(address, buffer, read_len);
+}
+
+int ads_hal_pin_init(ads_hal_dev_t * dev)
+{
+	(void)dev;
+	return ADS_OK;
+}
+
+/* Edges of masked devices are dropped by ads_hal_dev_interrupt() and read
+ * out when unmasked, as the line is still asserted */
+void ads_hal_pin_attach(ads_hal_dev_t * dev, bool attach)
+{
+	(void)dev;
+	(void)attach;
+}
+
+bool ads_hal_pin_asserted(ads_hal_dev_t * dev)
+{
+	return replay_unread[dev->slot];
+}
+
+void ads_hal_pin_reset(ads_hal_dev_t * dev)
+{
+	(void)dev;
+}
+
+int ads_hal_pin_reset_bootloader(ads_hal_dev_t * dev)
+{
+	(void)dev;
+	return ADS_OK;
+}
+
+void ads_hal_pin_poll(void)
+{
+	// Catch up with events the clock has passed
+	while(replay_started && !replay_delivering && replay_has_next &&
+		  (int32_t)(replay_next.time_us - replay_now) <= 0)
+	{
+		ads_hal_replay_deliver(false);
+	}
+}
+
+/* Events are delivered synchronously, nothing to mask */
+void ads_hal_lock(void)
+{
+}
+
+void ads_hal_unlock(void)
+{
+}
+
+#endif /* !ARDUINO */
@@ -0,0 +1,87 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_HAL_REPLAY_H_
+#define ADS_TWO_AXIS_HAL_REPLAY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ads_two_axis_hal.h"
+#include "ads_two_axis_rec.h"
+#include "ads_two_axis_util.h"
+
+/*
+ * HAL that plays a recording back into the driver. Link it instead of
+ * another backend. Every recorded packet becomes a data ready edge of the
+ * device with the recorded address, and the bus read that follows returns
+ * the recorded bytes, so callbacks, rings and recorders downstream see the
+ * same packets with the same sample times as the original session.
+ *
+ * Devices are initialized as usual; queries are answered from the config
+ * and commands are accepted and dropped. Nothing is delivered before
+ * ads_hal_replay_start(). After it ads_hal_get_time_us() follows the
+ * recording and ads_hal_delay() delivers the packets recorded within the
+ * delay, in ADS_REPLAY_PACED mode also taking that long in real time.
+ * ads_hal_replay_run() delivers packets without waiting for the clock.
+ */
+
+typedef enum {
+	ADS_REPLAY_MAX_SPEED = 0,		// Deliver as fast as the driver takes them
+	ADS_REPLAY_PACED				// Deliver at the recorded pace
+} ADS_REPLAY_MODE_T;
+
+typedef struct {
+	ads_rec_reader_t * reader;		// Opened recording, owned by the caller
+	ADS_REPLAY_MODE_T mode;
+	ADS_DEV_TYPE_T dev_type;		// Answer to device id queries
+	uint16_t fw_ver;				// Answer to firmware version queries
+	void (*state)(uint8_t address, uint16_t sps, uint8_t axes, uint32_t time_us);	// Recorded configuration changes, NULL to ignore
+} ads_hal_replay_config_t;
+
+typedef struct {
+	uint32_t packets;				// Packets handed to a device
+	uint32_t unmatched;				// Packets for an address no device was initialized with
+	uint32_t states;				// Configuration changes
+} ads_hal_replay_stats_t;
+
+
+/**
+ * @brief Fills config with a two axis device, the newest firmware version
+ *				and maximum speed
+ */
+void ads_hal_replay_get_default_config(ads_hal_replay_config_t * config);
+
+/**
+ * @brief Selects the recording. Call before initializing devices.
+ *
+ * @return	ADS_OK or ADS_ERR_BAD_PARAM without a reader
+ */
+int ads_hal_replay_init(const ads_hal_replay_config_t * config);
+
+/**
+ * @brief Starts delivering from the first event of the recording
+ */
+void ads_hal_replay_start(void);
+
+/**
+ * @brief Delivers up to max_events events, waiting for each in
+ *				ADS_REPLAY_PACED mode. Samples of devices in deferred mode
+ *				are serviced right away.
+ *
+ * @return	number of events delivered, 0 at the end of the recording
+ */
+uint32_t ads_hal_replay_run(uint32_t max_events);
+
+/**
+ * @brief true once every event has been delivered
+ */
+bool ads_hal_replay_done(void);
+
+void ads_hal_replay_get_stats(ads_hal_replay_stats_t * stats);
+
+#endif /* ADS_TWO_AXIS_HAL_REPLAY_H_ */
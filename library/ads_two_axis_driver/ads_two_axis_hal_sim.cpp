@@ -0,0 +1,147 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+/* Host HAL running the driver against ads_two_axis_sim. Not part of Arduino builds. */
+#if !defined(ARDUINO)
+
+#include "ads_two_axis_hal.h"
+#include "ads_two_axis_sim.h"
+#include "ads_two_axis_stats.h"
+
+
+/**
+ * @brief Data ready edge from the simulation. Acts as the pin interrupt of
+ *				every device wired to the simulated device's line.
+ */
+static void ads_hal_sim_drdy(uint8_t device, uint64_t time_us)
+{
+	for(uint8_t i = 0; i < ADS_COUNT; i++)
+	{
+		ads_hal_dev_t * dev = ads_hal_get_device(i);
+
+		if(dev == NULL)
+			continue;
+
+		uint8_t pin_device = ads_sim_pin_device(dev->datardy_pin);
+
+		if(pin_device == ADS_SIM_ALL || pin_device == device)
+			ads_hal_dev_interrupt(dev, (uint32_t)time_us);
+	}
+}
+
+void ads_hal_delay(uint16_t delay_ms)
+{
+	ads_sim_advance_us((uint64_t)delay_ms * 1000);
+}
+
+void ads_hal_delay_us(uint32_t delay_us)
+{
+	ads_sim_advance_us(delay_us);
+}
+
+uint32_t ads_hal_get_time_us(void)
+{
+	return (uint32_t)ads_sim_time_us();
+}
+
+int ads_hal_bus_init(void)
+{
+	// Start a default bus if the application did not configure one
+	if(!ads_sim_initialized())
+		ads_sim_init(NULL);
+
+	ads_sim_set_drdy_handler(ads_hal_sim_drdy);
+
+	return ADS_OK;
+}
+
+int ads_hal_bus_write(uint8_t address, uint8_t * buffer, uint8_t len)
+{
+	if(ads_sim_i2c_write(address, buffer, len) == len)
+		return ADS_OK;
+
+	ADS_STATS_INC(short_writes);
+	return ADS_ERR_IO;
+}
+
+int ads_hal_bus_read(uint8_t address, uint8_t * buffer, uint8_t len)
+{
+	if(ads_sim_i2c_read(address, buffer, len) == len)
+		return ADS_OK;
+
+	ADS_STATS_INC(short_reads);
+	return ADS_ERR_IO;
+}
+
+uint8_t ads_hal_bus_max_write(void)
+{
+	return 255;
+}
+
+int ads_hal_bus_query(uint8_t address, uint8_t * buffer, uint8_t write_len, uint8_t read_len)
+{
+	int ret = ads_hal_bus_write(address, buffer, write_len);
+
+	if(ret == ADS_OK)
+	{
+		ads_hal_delay(ADS_QUERY_DELAY_MS);
+		ret = ads_hal_bus_read(address, buffer, read_len);
+	}
+
+	return ret;
+}
+
+int ads_hal_pin_init(ads_hal_dev_t * dev)
+{
+	(void)dev;
+	return ADS_OK;
+}
+
+/* Edges of masked devices are dropped by ads_hal_dev_interrupt() */
+void ads_hal_pin_attach(ads_hal_dev_t * dev, bool attach)
+{
+	(void)dev;
+	(void)attach;
+}
+
+bool ads_hal_pin_asserted(ads_hal_dev_t * dev)
+{
+	return ads_sim_drdy_asserted(ads_sim_pin_device(dev->datardy_pin));
+}
+
+void ads_hal_pin_reset(ads_hal_dev_t * dev)
+{
+	ads_hal_delay(10);
+
+	ads_sim_reset(ads_sim_pin_device(dev->reset_pin), false);
+}
+
+int ads_hal_pin_reset_bootloader(ads_hal_dev_t * dev)
+{
+	ads_hal_delay(10);
+
+	ads_sim_reset(ads_sim_pin_device(dev->reset_pin), true);
+	ads_hal_delay(ADS_BOOTLOADER_HOLD_MS);
+
+	return ADS_OK;
+}
+
+void ads_hal_pin_poll(void)
+{
+}
+
+/* Simulated edges are delivered synchronously, nothing to mask */
+void ads_hal_lock(void)
+{
+}
+
+void ads_hal_unlock(void)
+{
+}
+
+#endif /* !ARDUINO */
@@ -0,0 +1,185 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#include <stddef.h>
+#include "ads_two_axis_lz.h"
+
+#define ADS_LZ_MASK					(ADS_LZ_WINDOW - 1)
+
+
+void ads_lz_dec_init(ads_lz_dec_t * dec, const uint8_t * data, uint32_t size)
+{
+	dec->data = data;
+	dec->size = size;
+	dec->pos = 0;
+	dec->produced = 0;
+	dec->flags = 0;
+	dec->items = 0;
+	dec->distance = 0;
+	dec->copy = 0;
+	dec->head = 0;
+}
+
+uint32_t ads_lz_read(ads_lz_dec_t * dec, uint8_t * out, uint32_t len)
+{
+	uint32_t n = 0;
+
+	while(n < len)
+	{
+		uint8_t b;
+
+		if(dec->copy)
+		{
+			b = dec->window[(dec->head - dec->distance) & ADS_LZ_MASK];
+			dec->copy--;
+		}
+		else
+		{
+			if(dec->items == 0)
+			{
+				if(dec->pos >= dec->size)
+					break;
+
+				dec->flags = dec->data[dec->pos++];
+				dec->items = 8;
+			}
+
+			bool literal = dec->flags & 1;
+
+			if(dec->pos + (literal ? 1 : 2) > dec->size)
+				break;
+
+			dec->flags >>= 1;
+			dec->items--;
+
+			if(!literal)
+			{
+				uint16_t token = (uint16_t)dec->data[dec->pos] | ((uint16_t)dec->data[dec->pos + 1] << 8);
+				dec->pos += 2;
+
+				dec->distance = (token & ADS_LZ_MASK) + 1;
+				dec->copy = (uint8_t)((token >> ADS_LZ_WINDOW_BITS) + ADS_LZ_MIN_MATCH);
+
+				// Reaches back before the start of the image
+				if(dec->distance > dec->produced)
+				{
+					dec->pos = dec->size;
+					dec->copy = 0;
+					break;
+				}
+
+				continue;
+			}
+
+			b = dec->data[dec->pos++];
+		}
+
+		dec->window[dec->head] = b;
+		dec->head = (dec->head + 1) & ADS_LZ_MASK;
+		dec->produced++;
+		out[n++] = b;
+	}
+
+	return n;
+}
+
+
+/************************************************************************/
+/*                               Encoder                                */
+/************************************************************************/
+
+#if !defined(ARDUINO)
+
+/**
+ * @brief Longest match for in[i] in the window before it
+ */
+static uint32_t ads_lz_match(const uint8_t * in, uint32_t len, uint32_t i, uint32_t * distance)
+{
+	uint32_t best = 0;
+	uint32_t start = i > ADS_LZ_WINDOW ? i - ADS_LZ_WINDOW : 0;
+	uint32_t limit = len - i < ADS_LZ_MAX_MATCH ? len - i : ADS_LZ_MAX_MATCH;
+
+	for(uint32_t j = i; j-- > start; )
+	{
+		uint32_t l = 0;
+
+		// May run into in[i], the decoder copies byte by byte
+		while(l < limit && in[j + l] == in[i + l])
+			l++;
+
+		if(l > best)
+		{
+			best = l;
+			*distance = i - j;
+
+			if(best == limit)
+				break;
+		}
+	}
+
+	return best;
+}
+
+int32_t ads_lz_encode(const uint8_t * in, uint32_t len, uint8_t * out, uint32_t max)
+{
+	uint32_t pos = 0;
+	uint32_t flags_pos = 0;
+	uint8_t items = 8;
+	uint32_t i = 0;
+
+	while(i < len)
+	{
+		if(items == 8)
+		{
+			if(pos >= max)
+				return ADS_ERR_BAD_PARAM;
+
+			flags_pos = pos;
+			out[pos++] = 0;
+			items = 0;
+		}
+
+		uint32_t distance = 0;
+		uint32_t match = ads_lz_match(in, len, i, &distance);
+
+		// Lazy: a literal first is better if the next byte starts a longer match
+		if(match >= ADS_LZ_MIN_MATCH && i + 1 < len)
+		{
+			uint32_t next_distance;
+
+			if(ads_lz_match(in, len, i + 1, &next_distance) > match)
+				match = 0;
+		}
+
+		if(match >= ADS_LZ_MIN_MATCH)
+		{
+			if(pos + 2 > max)
+				return ADS_ERR_BAD_PARAM;
+
+			uint16_t token = (uint16_t)((distance - 1) | ((match - ADS_LZ_MIN_MATCH) << ADS_LZ_WINDOW_BITS));
+
+			out[pos++] = (uint8_t)token;
+			out[pos++] = (uint8_t)(token >> 8);
+			i += match;
+		}
+		else
+		{
+			if(pos + 1 > max)
+				return ADS_ERR_BAD_PARAM;
+
+			out[flags_pos] |= (uint8_t)(1 << items);
+			out[pos++] = in[i++];
+		}
+
+		items++;
+	}
+
+	return (int32_t)pos;
+}
+
+#endif /* !ARDUINO */
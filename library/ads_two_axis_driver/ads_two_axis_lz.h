@@ -0,0 +1,86 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_LZ_H_
+#define ADS_TWO_AXIS_LZ_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ads_two_axis_err.h"
+
+/*
+ * LZSS compression of the embedded firmware images. The decoder streams:
+ * ads_lz_read() hands out the image in pieces of any size, e.g. one
+ * bootloader page at a time, from the compressed array in flash and a
+ * window of the last ADS_LZ_WINDOW bytes. Nothing else is buffered.
+ *
+ * Stream:
+ *
+ *   u8  flags			Kind of the next 8 items, LSB first, 1 for a literal
+ *   8 items:
+ *     literal			u8, copied to the output
+ *     match			u16 little endian, bits 0-9 distance - 1,
+ *						bits 10-15 length - ADS_LZ_MIN_MATCH, copies
+ *						length bytes starting distance bytes back
+ *
+ * The last group may hold fewer than 8 items. The image size is kept
+ * next to the stream, see the headers written by tools/ads_fw_lz.
+ *
+ * Compression is only built for hosts.
+ */
+
+#define ADS_LZ_WINDOW_BITS			(10)
+#define ADS_LZ_WINDOW				(1 << ADS_LZ_WINDOW_BITS)		// Largest match distance, RAM of the decoder
+#define ADS_LZ_MIN_MATCH			(3)
+#define ADS_LZ_MAX_MATCH			(ADS_LZ_MIN_MATCH + (1 << (16 - ADS_LZ_WINDOW_BITS)) - 1)
+
+typedef struct {
+	const uint8_t * data;				// Compressed stream
+	uint32_t size;						// Bytes in data
+	uint32_t pos;						// Next byte of data
+	uint32_t produced;					// Bytes decoded
+	uint8_t flags;						// Flags of the current group, consumed ones shifted out
+	uint8_t items;						// Items left in the current group
+	uint16_t distance;					// Match being copied
+	uint8_t copy;						// Bytes of the match left
+	uint16_t head;						// Next position in window
+	uint8_t window[ADS_LZ_WINDOW];
+} ads_lz_dec_t;
+
+
+/**
+ * @brief Starts decoding a stream
+ *
+ * @param data	compressed stream, e.g. an array in flash
+ * @param size	bytes in data
+ */
+void ads_lz_dec_init(ads_lz_dec_t * dec, const uint8_t * data, uint32_t size);
+
+/**
+ * @brief Decodes the next len bytes of the image
+ *
+ * @param out	receives the bytes
+ * @return	bytes written to out, fewer than len at the end of the stream
+ *				or if it is malformed
+ */
+uint32_t ads_lz_read(ads_lz_dec_t * dec, uint8_t * out, uint32_t len);
+
+#if !defined(ARDUINO)
+
+/**
+ * @brief Compresses an image. Host only.
+ *
+ * @param out	receives the stream
+ * @param max	room in out
+ * @return	size of the stream or ADS_ERR_BAD_PARAM if it does not fit max
+ */
+int32_t ads_lz_encode(const uint8_t * in, uint32_t len, uint8_t * out, uint32_t max);
+
+#endif /* !ARDUINO */
+
+#endif /* ADS_TWO_AXIS_LZ_H_ */
@@ -0,0 +1,152 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#include <stddef.h>
+#include "ads_two_axis_pkt.h"
+#include "ads_two_axis_util.h"
+
+#define ADS_PKT_MAX_OFFSET			((uint32_t)0xFFFF * ADS_PKT_TIME_UNIT_US)
+
+
+static uint32_t ads_pkt_uint32_decode(const uint8_t * p)
+{
+	return (uint32_t)ads_uint16_decode(&p[0]) | ((uint32_t)ads_uint16_decode(&p[2]) << 16);
+}
+
+/**
+ * @brief Samples that fit a packet of the current size
+ */
+static uint8_t ads_pkt_capacity(const ads_pkt_t * pkt)
+{
+	return (uint8_t)((pkt->size - ADS_PKT_HEADER_SIZE) / ADS_PKT_SAMPLE_SIZE);
+}
+
+static int ads_pkt_send(ads_pkt_t * pkt)
+{
+	if(pkt->count == 0)
+		return ADS_OK;
+
+	pkt->buffer[0] = pkt->stream;
+	pkt->buffer[1] = pkt->seq;
+	pkt->buffer[2] = pkt->count;
+	ads_uint16_encode((uint16_t)pkt->first_us, &pkt->buffer[3]);
+	ads_uint16_encode((uint16_t)(pkt->first_us >> 16), &pkt->buffer[5]);
+
+	if(!pkt->send(pkt->ctx, pkt->buffer, ADS_PKT_HEADER_SIZE + (uint16_t)pkt->count * ADS_PKT_SAMPLE_SIZE))
+		return ADS_ERR_OP_IN_PROGRESS;
+
+	pkt->seq++;
+	pkt->packets++;
+	pkt->count = 0;
+
+	return ADS_OK;
+}
+
+int ads_pkt_init(ads_pkt_t * pkt, uint8_t stream, uint16_t size, uint16_t max_age_ms,
+				 ads_pkt_send_fn send, void * ctx)
+{
+	if(send == NULL || size < ADS_PKT_MIN_SIZE)
+		return ADS_ERR_BAD_PARAM;
+
+	pkt->send = send;
+	pkt->ctx = ctx;
+	pkt->size = size > ADS_PKT_MAX_SIZE ? ADS_PKT_MAX_SIZE : size;
+	pkt->max_age_ms = max_age_ms;
+	pkt->stream = stream;
+	pkt->seq = 0;
+	pkt->count = 0;
+	pkt->first_us = 0;
+	pkt->packets = 0;
+	pkt->dropped = 0;
+
+	return ADS_OK;
+}
+
+int ads_pkt_set_size(ads_pkt_t * pkt, uint16_t size)
+{
+	if(size < ADS_PKT_MIN_SIZE)
+		return ADS_ERR_BAD_PARAM;
+
+	// Packed for the old size, which may not fit the new one
+	if(ads_pkt_send(pkt) != ADS_OK)
+	{
+		pkt->dropped += pkt->count;
+		pkt->count = 0;
+	}
+
+	pkt->size = size > ADS_PKT_MAX_SIZE ? ADS_PKT_MAX_SIZE : size;
+
+	return ADS_OK;
+}
+
+int ads_pkt_add(ads_pkt_t * pkt, const int16_t * raw, uint32_t time_us)
+{
+	if(pkt->count && (pkt->count >= ads_pkt_capacity(pkt) || time_us - pkt->first_us > ADS_PKT_MAX_OFFSET))
+	{
+		if(ads_pkt_send(pkt) != ADS_OK)
+		{
+			pkt->dropped++;
+			return ADS_ERR_OP_IN_PROGRESS;
+		}
+	}
+
+	if(pkt->count == 0)
+		pkt->first_us = time_us;
+
+	uint8_t * p = &pkt->buffer[ADS_PKT_HEADER_SIZE + (uint16_t)pkt->count * ADS_PKT_SAMPLE_SIZE];
+
+	ads_uint16_encode((uint16_t)((time_us - pkt->first_us) / ADS_PKT_TIME_UNIT_US), &p[0]);
+	ads_uint16_encode((uint16_t)raw[0], &p[2]);
+	ads_uint16_encode((uint16_t)raw[1], &p[4]);
+
+	pkt->count++;
+
+	return ADS_OK;
+}
+
+int ads_pkt_poll(ads_pkt_t * pkt, uint32_t now_us)
+{
+	if(pkt->count == 0 || now_us - pkt->first_us < (uint32_t)pkt->max_age_ms * 1000)
+		return ADS_OK;
+
+	return ads_pkt_send(pkt);
+}
+
+int ads_pkt_flush(ads_pkt_t * pkt)
+{
+	return ads_pkt_send(pkt);
+}
+
+int ads_pkt_parse(const uint8_t * packet, uint16_t len, uint8_t * stream, uint8_t * seq,
+				  ads_ring_sample_t * samples, uint8_t max)
+{
+	if(len < ADS_PKT_HEADER_SIZE)
+		return ADS_ERR_BAD_PARAM;
+
+	uint8_t count = packet[2];
+
+	if(count > max || len != ADS_PKT_HEADER_SIZE + (uint16_t)count * ADS_PKT_SAMPLE_SIZE)
+		return ADS_ERR_BAD_PARAM;
+
+	if(stream)
+		*stream = packet[0];
+	if(seq)
+		*seq = packet[1];
+
+	uint32_t first_us = ads_pkt_uint32_decode(&packet[3]);
+	const uint8_t * p = &packet[ADS_PKT_HEADER_SIZE];
+
+	for(uint8_t i = 0; i < count; i++, p += ADS_PKT_SAMPLE_SIZE)
+	{
+		samples[i].timestamp = first_us + (uint32_t)ads_uint16_decode(&p[0]) * ADS_PKT_TIME_UNIT_US;
+		samples[i].raw[0] = ads_int16_decode(&p[2]);
+		samples[i].raw[1] = ads_int16_decode(&p[4]);
+	}
+
+	return count;
+}
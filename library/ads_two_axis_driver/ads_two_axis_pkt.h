@@ -0,0 +1,125 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_PKT_H_
+#define ADS_TWO_AXIS_PKT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ads_two_axis_err.h"
+#include "ads_two_axis_ring.h"
+
+/*
+ * Packs timestamped samples into radio sized packets, e.g. BLE
+ * notifications. A packet fills up to the negotiated payload size and is
+ * sent once the next sample does not fit, or when its first sample gets
+ * older than max_age_ms, whichever comes first.
+ *
+ * Packet, little endian:
+ *
+ *   u8  stream			Set at init, tells the sensors on one link apart
+ *   u8  seq			Counts sent packets, a skip means a packet was lost
+ *   u8  count			Samples in the packet
+ *   u32 time_us		Time of the first sample
+ *   count times:
+ *     u16 offset		Time after time_us, ADS_PKT_TIME_UNIT_US units
+ *     i16 raw[2]		Both axes, Q10.5
+ *
+ * With a 247 byte ATT MTU a notification carries 39 samples, so a sensor
+ * at ADS_500_HZ needs 13 notifications per second. Every packet decodes on
+ * its own with ads_pkt_parse().
+ *
+ * A packetizer is used from one context only, typically loop() draining a
+ * sample ring. No allocation, the packet is built in the packetizer.
+ */
+
+#define ADS_PKT_MAX_SIZE			(244)	// Largest payload, ATT MTU 247 minus the 3 byte header
+#define ADS_PKT_MIN_SIZE			(13)	// Header and one sample
+#define ADS_PKT_HEADER_SIZE			(7)
+#define ADS_PKT_SAMPLE_SIZE			(6)
+#define ADS_PKT_TIME_UNIT_US		(16)	// Sample offsets up to ~1 s in a packet
+
+/* Sends one packet, returns false if the link cannot take it now */
+typedef bool (*ads_pkt_send_fn)(void * ctx, const uint8_t * packet, uint16_t len);
+
+typedef struct {
+	ads_pkt_send_fn send;
+	void * ctx;
+	uint16_t size;						// Payload size of the link
+	uint16_t max_age_ms;
+	uint8_t stream;
+	uint8_t seq;
+	uint8_t count;						// Samples in buffer
+	uint32_t first_us;					// Time of the first sample in buffer
+	uint32_t packets;					// Packets sent
+	uint32_t dropped;					// Samples dropped while the link was busy
+	uint8_t buffer[ADS_PKT_MAX_SIZE];
+} ads_pkt_t;
+
+
+/**
+ * @brief Initializes a packetizer
+ *
+ * @param stream		identifies the sensor in every packet
+ * @param size			payload size of the link, ATT MTU - 3 for BLE notifications
+ * @param max_age_ms	longest time a sample waits for its packet
+ * @param send			sends a packet
+ * @param ctx			handed to send
+ * @return	ADS_OK or ADS_ERR_BAD_PARAM if size is below ADS_PKT_MIN_SIZE
+ */
+int ads_pkt_init(ads_pkt_t * pkt, uint8_t stream, uint16_t size, uint16_t max_age_ms,
+				 ads_pkt_send_fn send, void * ctx);
+
+/**
+ * @brief Changes the payload size, e.g. after an MTU exchange. Samples
+ *				already packed are sent first.
+ *
+ * @return	ADS_OK or ADS_ERR_BAD_PARAM if size is below ADS_PKT_MIN_SIZE
+ */
+int ads_pkt_set_size(ads_pkt_t * pkt, uint16_t size);
+
+/**
+ * @brief Adds a sample, sends the packet before it if the sample does not fit
+ *
+ * @param raw		both axes, Q10.5
+ * @param time_us	sample time, e.g. the timestamp of a ring sample
+ * @return	ADS_OK or ADS_ERR_OP_IN_PROGRESS if the link refused the full
+ *				packet and the sample was dropped
+ */
+int ads_pkt_add(ads_pkt_t * pkt, const int16_t * raw, uint32_t time_us);
+
+/**
+ * @brief Sends the packet if its first sample is max_age_ms old. Call
+ *				regularly, e.g. once per loop().
+ *
+ * @param now_us	current time in the units of the sample times
+ * @return	ADS_OK or ADS_ERR_OP_IN_PROGRESS if the link refused the packet
+ */
+int ads_pkt_poll(ads_pkt_t * pkt, uint32_t now_us);
+
+/**
+ * @brief Sends the packet regardless of its age
+ *
+ * @return	ADS_OK or ADS_ERR_OP_IN_PROGRESS if the link refused the packet
+ */
+int ads_pkt_flush(ads_pkt_t * pkt);
+
+/**
+ * @brief Unpacks a received packet
+ *
+ * @param stream	receives the stream of the packet, may be NULL
+ * @param seq		receives the sequence number, may be NULL
+ * @param samples	receives the samples with their times
+ * @param max		room in samples
+ * @return	number of samples or ADS_ERR_BAD_PARAM if the packet is malformed
+ *				or holds more than max
+ */
+int ads_pkt_parse(const uint8_t * packet, uint16_t len, uint8_t * stream, uint8_t * seq,
+				  ads_ring_sample_t * samples, uint8_t max);
+
+#endif /* ADS_TWO_AXIS_PKT_H_ */
@@ -0,0 +1,223 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#include <stddef.h>
+#include "ads_two_axis_rate.h"
+
+static const ads_rate_level_t ads_rate_default_levels[] = {
+	{ ADS_10_HZ,  20 },
+	{ ADS_50_HZ,  100 },
+	{ ADS_100_HZ, 250 },
+	{ ADS_500_HZ, 0 },
+};
+
+/* Sample velocities are capped here, Q10.5, so the average stays in 32 bits */
+#define ADS_RATE_VELOCITY_MAX		(0x7FFFFFUL)
+
+
+/**
+ * @brief Velocity limit of level in Q10.5 degrees per second
+ */
+static uint32_t ads_rate_limit(const ads_rate_t * rate, uint8_t level)
+{
+	return (uint32_t)rate->config.levels[level].max_dps * 32;
+}
+
+/**
+ * @brief Adds elapsed_us to the time of the current level
+ */
+static void ads_rate_account(ads_rate_t * rate, uint32_t elapsed_us)
+{
+	uint32_t us = rate->level_us + elapsed_us;
+
+	rate->level_ms[rate->level] += us / 1000;
+	rate->level_us = (uint16_t)(us % 1000);
+}
+
+/**
+ * @brief Velocity of a delta Q10.5 degrees wide over elapsed_us, in Q10.5
+ *				degrees per second. 32 bit math only, delta * 10^6 is
+ *				split as 64 * delta * 15625.
+ */
+static uint32_t ads_rate_velocity(uint32_t delta, uint32_t elapsed_us)
+{
+	uint32_t scaled = delta * 15625;
+
+	if(elapsed_us >= (1UL << 26))
+		return scaled / (elapsed_us >> 6);
+
+	uint32_t quotient = scaled / elapsed_us;
+
+	if(quotient > ADS_RATE_VELOCITY_MAX / 64)
+		return ADS_RATE_VELOCITY_MAX;
+
+	return quotient * 64 + (scaled % elapsed_us) * 64 / elapsed_us;
+}
+
+/**
+ * @brief weight_us / smooth_us as a fraction of 256, weight_us <= smooth_us
+ */
+static uint32_t ads_rate_weight(uint32_t weight_us, uint32_t smooth_us)
+{
+	if(weight_us < (1UL << 24))
+		return (weight_us << 8) / smooth_us;
+
+	return weight_us / (smooth_us >> 8);
+}
+
+/**
+ * @brief Picks level for the following samples
+ */
+static void ads_rate_pick(ads_rate_t * rate, uint8_t level)
+{
+	rate->target = level;
+	rate->calm_us = 0;
+}
+
+int ads_rate_init(ads_rate_t * rate, const ads_rate_config_t * config)
+{
+	if(config == NULL)
+	{
+		rate->config.levels = ads_rate_default_levels;
+		rate->config.count = sizeof(ads_rate_default_levels) / sizeof(ads_rate_default_levels[0]);
+		rate->config.hold_ms = ADS_RATE_HOLD_MS;
+		rate->config.smooth_ms = ADS_RATE_SMOOTH_MS;
+	}
+	else
+	{
+		if(config->levels == NULL || config->count == 0 || config->count > ADS_RATE_MAX_LEVELS)
+			return ADS_ERR_BAD_PARAM;
+
+		rate->config = *config;
+	}
+
+	if(rate->config.smooth_ms == 0)
+		rate->config.smooth_ms = 1;
+
+	// Start fast, motion is never missed while the controller settles
+	rate->level = rate->config.count - 1;
+	rate->target = rate->level;
+	rate->primed = false;
+	rate->velocity = 0;
+	rate->calm_us = 0;
+	rate->level_us = 0;
+	rate->switches = 0;
+	rate->errors = 0;
+
+	for(uint8_t i = 0; i < ADS_RATE_MAX_LEVELS; i++)
+		rate->level_ms[i] = 0;
+
+	return ADS_OK;
+}
+
+void ads_rate_update(ads_rate_t * rate, const int16_t * raw, const ads_sample_time_t * time)
+{
+	uint8_t top = rate->config.count - 1;
+
+	if(!rate->primed)
+	{
+		rate->last[0] = raw[0];
+		rate->last[1] = raw[1];
+		rate->last_us = time->time_us;
+		rate->primed = true;
+		return;
+	}
+
+	uint32_t elapsed_us = time->time_us - rate->last_us;
+
+	if(elapsed_us == 0)
+		elapsed_us = 1;
+
+	ads_rate_account(rate, elapsed_us);
+
+	uint32_t delta = 0;
+
+	for(uint8_t i = 0; i < 2; i++)
+	{
+		int32_t d = (int32_t)raw[i] - rate->last[i];
+		uint32_t mag = (uint32_t)(d < 0 ? -d : d);
+
+		if(mag > delta)
+			delta = mag;
+
+		rate->last[i] = raw[i];
+	}
+
+	rate->last_us = time->time_us;
+
+	uint32_t velocity = ads_rate_velocity(delta, elapsed_us);
+	uint32_t smooth_us = (uint32_t)rate->config.smooth_ms * 1000;
+	uint32_t weight = ads_rate_weight(elapsed_us < smooth_us ? elapsed_us : smooth_us, smooth_us);
+
+	rate->velocity = (uint32_t)((int32_t)rate->velocity +
+								((int32_t)velocity - (int32_t)rate->velocity) * (int32_t)weight / 256);
+
+	uint8_t level = rate->target;
+
+	// Motion starts, go to the top rate at once
+	if(level < top && velocity > ads_rate_limit(rate, level))
+	{
+		if(rate->velocity < velocity)
+			rate->velocity = velocity;
+
+		ads_rate_pick(rate, top);
+		return;
+	}
+
+	if(level == 0 || rate->velocity >= ads_rate_limit(rate, level - 1) / 2)
+	{
+		rate->calm_us = 0;
+		return;
+	}
+
+	rate->calm_us += elapsed_us;
+
+	if(rate->calm_us >= (uint32_t)rate->config.hold_ms * 1000)
+		ads_rate_pick(rate, level - 1);
+}
+
+int ads_rate_apply(ads_rate_t * rate, ads_dev_t * dev)
+{
+	uint8_t level = rate->target;
+
+	// Also puts back a rate changed from outside the controller
+	if(dev->sps == rate->config.levels[level].sps)
+	{
+		rate->level = level;
+		return ADS_OK;
+	}
+
+	int ret = ads_two_axis_dev_set_sample_rate(dev, rate->config.levels[level].sps);
+
+	if(ret != ADS_OK)
+	{
+		rate->errors++;
+		return ret;
+	}
+
+	rate->level = level;
+	rate->switches++;
+
+	return ADS_OK;
+}
+
+ADS_SPS_T ads_rate_get_sps(const ads_rate_t * rate)
+{
+	return rate->config.levels[rate->level].sps;
+}
+
+uint32_t ads_rate_get_time_ms(const ads_rate_t * rate, ADS_SPS_T sps)
+{
+	for(uint8_t i = 0; i < rate->config.count; i++)
+	{
+		if(rate->config.levels[i].sps == sps)
+			return rate->level_ms[i];
+	}
+
+	return 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_RATE_H_
+#define ADS_TWO_AXIS_RATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ads_two_axis.h"
+
+/*
+ * Sample rate that follows the motion of the joint. Attached to a device
+ * with ads_two_axis_dev_set_rate_control(), the controller sees every
+ * sample of it and computes the angular velocity of the faster axis from
+ * the drift corrected sample times.
+ *
+ * Each level is a sample rate and the highest velocity it follows. A
+ * sample moving faster than the current level allows switches straight to
+ * the top level, before the next sample at the old rate. The rate steps
+ * down one level at a time once the smoothed velocity has stayed below
+ * half the limit of the lower level for hold_ms.
+ *
+ * The sample path only picks the level, it never touches the bus, so it
+ * is safe in the data ready interrupt. The change is written through
+ * ads_two_axis_dev_set_sample_rate() by ads_two_axis_service() or
+ * ads_two_axis_dev_service(), so dev->sps, the sample clock estimate, the
+ * filters that follow dev->sps and recordings all see it in order. Call
+ * one of them from the application loop in either read mode, a rate
+ * change waits for the next call.
+ */
+
+#define ADS_RATE_MAX_LEVELS			(8)
+#define ADS_RATE_HOLD_MS			(500)	// Default time to stay calm before stepping down
+#define ADS_RATE_SMOOTH_MS			(100)	// Default time constant of the velocity average
+
+typedef struct {
+	ADS_SPS_T sps;
+	uint16_t max_dps;					// Highest angular velocity followed at sps, degrees per second
+} ads_rate_level_t;
+
+typedef struct {
+	const ads_rate_level_t * levels;	// Slowest first, the last max_dps is ignored
+	uint8_t count;
+	uint16_t hold_ms;
+	uint16_t smooth_ms;
+} ads_rate_config_t;
+
+struct ads_rate_s {
+	ads_rate_config_t config;
+	uint8_t level;						// Index of the current rate in config.levels
+	volatile uint8_t target;			// Level picked by the samples, written by ads_rate_apply()
+	bool primed;						// last holds a sample
+	int16_t last[2];
+	uint32_t last_us;
+	uint32_t velocity;					// Smoothed angular velocity, Q10.5 degrees per second
+	uint32_t calm_us;					// Time the velocity allowed the next lower level
+	uint32_t level_ms[ADS_RATE_MAX_LEVELS];	// Time spent at each level
+	uint16_t level_us;					// Part of a millisecond not yet in level_ms
+	uint32_t switches;					// Rate changes written
+	uint32_t errors;					// Rate changes that failed, retried by the next ads_rate_apply()
+};
+
+
+/**
+ * @brief Initializes a controller
+ *
+ * @param config	levels and timing, NULL for ADS_10_HZ, ADS_50_HZ,
+ *					ADS_100_HZ and ADS_500_HZ at 20, 100 and 250 deg/s
+ * @return	ADS_OK or ADS_ERR_BAD_PARAM if the levels do not fit
+ */
+int ads_rate_init(ads_rate_t * rate, const ads_rate_config_t * config);
+
+/**
+ * @brief Feeds one sample and picks the level for the following ones, no
+ *				bus access. Called by the driver for an attached controller,
+ *				also from the data ready interrupt.
+ *
+ * @param raw	both axes, Q10.5
+ * @param time	timing of the sample
+ */
+void ads_rate_update(ads_rate_t * rate, const int16_t * raw, const ads_sample_time_t * time);
+
+/**
+ * @brief Writes the rate of the picked level to dev if it differs. Called
+ *				by the driver service functions, never from interrupt context.
+ *
+ * @return	ADS_OK or the error of the rate change
+ */
+int ads_rate_apply(ads_rate_t * rate, ads_dev_t * dev);
+
+/**
+ * @brief Current sample rate of the controller
+ */
+ADS_SPS_T ads_rate_get_sps(const ads_rate_t * rate);
+
+/**
+ * @brief Time spent at sps since init
+ *
+ * @return	milliseconds, 0 if sps is no level of the controller
+ */
+uint32_t ads_rate_get_time_ms(const ads_rate_t * rate, ADS_SPS_T sps);
+
+#endif /* ADS_TWO_AXIS_RATE_H_ */
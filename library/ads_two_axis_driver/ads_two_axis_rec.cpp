@@ -0,0 +1,397 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#include <string.h>
+#include "ads_two_axis_rec.h"
+#include "ads_two_axis_util.h"
+
+#if !defined(ARDUINO) && (defined(__unix__) || defined(__APPLE__))
+#define ADS_REC_POSIX				(1)
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+#define ADS_REC_POSIX				(0)
+#endif
+
+#define ADS_REC_TIME_SIZE			(5)
+#define ADS_REC_PACKET_SIZE			(4 + ADS_TRANSFER_SIZE)
+#define ADS_REC_STATE_SIZE			(7)
+#define ADS_REC_MIN_CHUNK			(32)
+
+static const uint8_t ads_rec_magic[4] = { 'A', 'D', 'S', 'R' };
+
+
+static void ads_rec_uint32_encode(uint32_t value, uint8_t * p)
+{
+	ads_uint16_encode((uint16_t)value, &p[0]);
+	ads_uint16_encode((uint16_t)(value >> 16), &p[2]);
+}
+
+static uint32_t ads_rec_uint32_decode(const uint8_t * p)
+{
+	return (uint32_t)ads_uint16_decode(&p[0]) | ((uint32_t)ads_uint16_decode(&p[2]) << 16);
+}
+
+
+
+/************************************************************************/
+/*                                Writer                                */
+/************************************************************************/
+
+/**
+ * @brief Hands the active buffer to ads_rec_service() and starts the other
+ *
+ * @return	false if the other buffer has not been written yet
+ */
+static bool ads_rec_handover(ads_rec_writer_t * w)
+{
+	if(ADS_RING_LOAD(&w->ready))
+		return false;
+
+	w->ready_fill = w->fill;
+	w->ready_count = w->count;
+	w->ready_base = w->base_time;
+	ADS_RING_STORE(&w->ready, true);
+
+	w->active ^= 1;
+	w->fill = 0;
+	w->count = 0;
+
+	return true;
+}
+
+/**
+ * @brief Makes room for a record of len bytes at time_us
+ *
+ * @return	record position, NULL if the record was dropped
+ */
+static uint8_t * ads_rec_reserve(ads_rec_writer_t * w, uint32_t time_us, uint8_t len, uint16_t * dt)
+{
+	uint32_t delta = time_us - w->prev_time;
+	bool resync = w->count && delta > 0xFFFF;
+
+	if(w->fill + len + (resync ? ADS_REC_TIME_SIZE : 0) > w->chunk_size)
+	{
+		if(!ads_rec_handover(w))
+		{
+			w->dropped++;
+			return NULL;
+		}
+
+		resync = false;
+	}
+
+	uint8_t * buf = w->buffer[w->active];
+
+	if(w->count == 0)
+	{
+		// The chunk header carries the time of the first record
+		w->base_time = time_us;
+	}
+	else if(resync)
+	{
+		buf[w->fill] = ADS_REC_TIME;
+		ads_rec_uint32_encode(time_us, &buf[w->fill + 1]);
+		w->fill += ADS_REC_TIME_SIZE;
+	}
+
+	*dt = (w->count && !resync) ? (uint16_t)delta : 0;
+
+	w->prev_time = time_us;
+	w->count++;
+
+	uint8_t * rec = &buf[w->fill];
+	w->fill += len;
+
+	return rec;
+}
+
+int ads_rec_writer_init(ads_rec_writer_t * w, uint8_t * storage, uint16_t chunk_size, ads_rec_sink sink, void * ctx)
+{
+	if(storage == NULL || sink == NULL || chunk_size < ADS_REC_MIN_CHUNK)
+		return ADS_ERR_BAD_PARAM;
+
+	memset(w, 0, sizeof(*w));
+
+	w->buffer[0] = storage;
+	w->buffer[1] = storage + chunk_size;
+	w->chunk_size = chunk_size;
+	w->sink = sink;
+	w->ctx = ctx;
+
+	uint8_t header[ADS_REC_FILE_HEADER_SIZE] = { 0 };
+
+	memcpy(header, ads_rec_magic, sizeof(ads_rec_magic));
+	ads_uint16_encode(ADS_REC_VERSION, &header[4]);
+
+	w->error = sink(ctx, header, sizeof(header));
+
+	return w->error;
+}
+
+void ads_rec_write_packet(ads_rec_writer_t * w, uint32_t time_us, uint8_t address, const uint8_t * packet)
+{
+	uint16_t dt;
+	uint8_t * rec = ads_rec_reserve(w, time_us, ADS_REC_PACKET_SIZE, &dt);
+
+	if(rec == NULL)
+		return;
+
+	rec[0] = ADS_REC_PACKET;
+	rec[1] = address;
+	ads_uint16_encode(dt, &rec[2]);
+	memcpy(&rec[4], packet, ADS_TRANSFER_SIZE);
+}
+
+void ads_rec_write_state(ads_rec_writer_t * w, uint32_t time_us, uint8_t address, uint16_t sps, uint8_t axes)
+{
+	uint16_t dt;
+
+	// May interleave with packets recorded from the data ready interrupt
+	ads_hal_lock();
+
+	uint8_t * rec = ads_rec_reserve(w, time_us, ADS_REC_STATE_SIZE, &dt);
+
+	if(rec)
+	{
+		rec[0] = ADS_REC_STATE;
+		rec[1] = address;
+		ads_uint16_encode(dt, &rec[2]);
+		ads_uint16_encode(sps, &rec[4]);
+		rec[6] = axes;
+	}
+
+	ads_hal_unlock();
+}
+
+int ads_rec_service(ads_rec_writer_t * w)
+{
+	if(!ADS_RING_LOAD(&w->ready))
+		return ADS_OK;
+
+	const uint8_t * payload = w->buffer[w->active ^ 1];
+	uint8_t header[ADS_REC_CHUNK_HEADER_SIZE];
+
+	ads_uint16_encode(ADS_REC_CHUNK_SYNC, &header[0]);
+	ads_uint16_encode(w->ready_fill, &header[2]);
+	ads_rec_uint32_encode(w->ready_base, &header[4]);
+	ads_uint16_encode(w->ready_count, &header[8]);
+	ads_uint16_encode(ads_crc16(payload, w->ready_fill), &header[10]);
+
+	int ret = w->sink(w->ctx, header, sizeof(header));
+
+	if(ret == ADS_OK)
+		ret = w->sink(w->ctx, payload, w->ready_fill);
+
+	if(ret != ADS_OK)
+		w->error = ret;
+
+	// Released even on error, a stuck buffer would stop the recording for good
+	ADS_RING_STORE(&w->ready, false);
+
+	return ret;
+}
+
+int ads_rec_flush(ads_rec_writer_t * w)
+{
+	int ret = ads_rec_service(w);
+
+	if(ret != ADS_OK)
+		return ret;
+
+	ads_hal_lock();
+	bool handed = w->count && ads_rec_handover(w);
+	ads_hal_unlock();
+
+	return handed ? ads_rec_service(w) : ADS_OK;
+}
+
+
+/************************************************************************/
+/*                                Reader                                */
+/************************************************************************/
+
+static bool ads_rec_is_file_header(const uint8_t * data, size_t len, size_t pos)
+{
+	return pos + ADS_REC_FILE_HEADER_SIZE <= len && memcmp(&data[pos], ads_rec_magic, sizeof(ads_rec_magic)) == 0;
+}
+
+/**
+ * @brief Moves to the chunk at r->chunk_end
+ *
+ * @return	false at the end of the recording
+ */
+static bool ads_rec_next_chunk(ads_rec_reader_t * r)
+{
+	size_t pos = r->chunk_end;
+
+	// Another recording appended to this one
+	while(ads_rec_is_file_header(r->data, r->len, pos))
+		pos += ADS_REC_FILE_HEADER_SIZE;
+
+	if(pos == r->len)
+		return false;
+
+	const uint8_t * h = &r->data[pos];
+
+	if(pos + ADS_REC_CHUNK_HEADER_SIZE > r->len || ads_uint16_decode(&h[0]) != ADS_REC_CHUNK_SYNC)
+	{
+		r->truncated = true;
+		return false;
+	}
+
+	size_t payload = ads_uint16_decode(&h[2]);
+	size_t start = pos + ADS_REC_CHUNK_HEADER_SIZE;
+
+	if(start + payload > r->len || ads_crc16(&r->data[start], (uint32_t)payload) != ads_uint16_decode(&h[10]))
+	{
+		r->truncated = true;
+		return false;
+	}
+
+	r->rec = start;
+	r->chunk_end = start + payload;
+	r->time = ads_rec_uint32_decode(&h[4]);
+
+	return true;
+}
+
+int ads_rec_reader_init(ads_rec_reader_t * r, const uint8_t * data, size_t len)
+{
+	memset(r, 0, sizeof(*r));
+
+	if(data == NULL || !ads_rec_is_file_header(data, len, 0))
+		return ADS_ERR_BAD_PARAM;
+
+	r->data = data;
+	r->len = len;
+
+	ads_rec_rewind(r);
+
+	return ADS_OK;
+}
+
+void ads_rec_rewind(ads_rec_reader_t * r)
+{
+	r->rec = ADS_REC_FILE_HEADER_SIZE;
+	r->chunk_end = ADS_REC_FILE_HEADER_SIZE;
+	r->time = 0;
+	r->truncated = false;
+}
+
+int ads_rec_next(ads_rec_reader_t * r, ads_rec_event_t * ev)
+{
+	for(;;)
+	{
+		if(r->rec >= r->chunk_end && !ads_rec_next_chunk(r))
+			return 0;
+
+		const uint8_t * p = &r->data[r->rec];
+		size_t left = r->chunk_end - r->rec;
+
+		switch(p[0])
+		{
+		case ADS_REC_TIME:
+			if(left < ADS_REC_TIME_SIZE)
+				break;
+
+			r->time = ads_rec_uint32_decode(&p[1]);
+			r->rec += ADS_REC_TIME_SIZE;
+			continue;
+
+		case ADS_REC_PACKET:
+			if(left < ADS_REC_PACKET_SIZE)
+				break;
+
+			r->time += ads_uint16_decode(&p[2]);
+			ev->type = ADS_REC_PACKET;
+			ev->time_us = r->time;
+			ev->address = p[1];
+			memcpy(ev->packet, &p[4], ADS_TRANSFER_SIZE);
+			r->rec += ADS_REC_PACKET_SIZE;
+			return 1;
+
+		case ADS_REC_STATE:
+			if(left < ADS_REC_STATE_SIZE)
+				break;
+
+			r->time += ads_uint16_decode(&p[2]);
+			ev->type = ADS_REC_STATE;
+			ev->time_us = r->time;
+			ev->address = p[1];
+			ev->sps = ads_uint16_decode(&p[4]);
+			ev->axes = p[6];
+			r->rec += ADS_REC_STATE_SIZE;
+			return 1;
+		}
+
+		// Unknown or cut off record in a chunk that passed its CRC
+		r->truncated = true;
+		r->chunk_end = r->len;
+		r->rec = r->len;
+		return 0;
+	}
+}
+
+#if ADS_REC_POSIX
+int ads_rec_open(ads_rec_reader_t * r, const char * path)
+{
+	struct stat st;
+	int fd = open(path, O_RDONLY);
+
+	if(fd < 0)
+		return ADS_ERR_IO;
+
+	if(fstat(fd, &st) != 0 || st.st_size == 0)
+	{
+		close(fd);
+		return ADS_ERR_IO;
+	}
+
+	void * map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if(map == MAP_FAILED)
+		return ADS_ERR_IO;
+
+	// Replay reads front to back, let the kernel read ahead
+	madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+	int ret = ads_rec_reader_init(r, (const uint8_t *)map, (size_t)st.st_size);
+
+	if(ret != ADS_OK)
+	{
+		munmap(map, (size_t)st.st_size);
+		return ret;
+	}
+
+	r->map = map;
+	r->map_len = (size_t)st.st_size;
+
+	return ADS_OK;
+}
+
+void ads_rec_close(ads_rec_reader_t * r)
+{
+	if(r->map)
+		munmap(r->map, r->map_len);
+
+	r->map = NULL;
+	r->map_len = 0;
+	r->data = NULL;
+	r->len = 0;
+}
+
+int ads_rec_file_sink(void * ctx, const uint8_t * data, uint32_t len)
+{
+	return fwrite(data, 1, len, (FILE *)ctx) == len ? ADS_OK : ADS_ERR_IO;
+}
+#endif /* ADS_REC_POSIX */
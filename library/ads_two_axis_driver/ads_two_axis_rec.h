@@ -0,0 +1,189 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_REC_H_
+#define ADS_TWO_AXIS_REC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "ads_two_axis_err.h"
+#include "ads_two_axis_hal.h"
+#include "ads_two_axis_ring.h"
+
+/*
+ * Recording of raw ADS packets. A recording is a file header followed by
+ * chunks, all little endian, and only ever grows by whole chunks:
+ *
+ *   file header	"ADSR", u16 version, u16 reserved, u32 reserved, u32 reserved
+ *   chunk header	u16 sync 0x5CAD, u16 payload length, u32 time of the first
+ *					record, u16 record count, u16 CRC-16/CCITT of the payload
+ *   record			u8 type, then by type:
+ *		PACKET		u8 address, u16 us since the previous record, 5 byte packet
+ *		STATE		u8 address, u16 us since the previous record, u16 sps, u8 axes
+ *		TIME		u32 absolute time, the next record's delta counts from it
+ *
+ * A chunk that fails its CRC or is cut short ends the recording, so a
+ * capture interrupted by a crash or power loss keeps everything before the
+ * last complete chunk. Concatenated recordings read as one.
+ *
+ * The writer is double buffered. Records are appended to one chunk buffer
+ * from the sample path with a few byte stores. A full chunk is handed over
+ * and written out by ads_rec_service() in the application, so the sink,
+ * usually a file, is never called from interrupt context.
+ */
+
+#define ADS_REC_VERSION				(1)
+#define ADS_REC_FILE_HEADER_SIZE	(16)
+#define ADS_REC_CHUNK_HEADER_SIZE	(12)
+#define ADS_REC_CHUNK_SYNC			(0x5CAD)
+#define ADS_REC_MAX_RECORD			(9)
+
+typedef enum {
+	ADS_REC_PACKET = 1,
+	ADS_REC_STATE,
+	ADS_REC_TIME
+} ADS_REC_TYPE_T;
+
+/* Writes len bytes to the recording, returns ADS_OK or an error */
+typedef int (*ads_rec_sink)(void * ctx, const uint8_t * data, uint32_t len);
+
+typedef struct {
+	uint8_t * buffer[2];		// Two chunk buffers of chunk_size bytes
+	uint16_t chunk_size;
+	ads_rec_sink sink;
+	void * ctx;
+
+	/* Sample path */
+	uint8_t active;				// Buffer being filled
+	uint16_t fill;
+	uint16_t count;
+	uint32_t base_time;
+	uint32_t prev_time;
+	uint32_t dropped;			// Records lost because both buffers were full
+
+	/* Handover of the other buffer, set by the sample path, cleared by ads_rec_service() */
+	bool ready;
+	uint16_t ready_fill;
+	uint16_t ready_count;
+	uint32_t ready_base;
+
+	int error;					// Last sink error, ADS_OK if none
+} ads_rec_writer_t;
+
+typedef struct {
+	ADS_REC_TYPE_T type;
+	uint32_t time_us;
+	uint8_t address;
+	uint8_t packet[ADS_TRANSFER_SIZE];	// ADS_REC_PACKET
+	uint16_t sps;						// ADS_REC_STATE
+	uint8_t axes;						// ADS_REC_STATE
+} ads_rec_event_t;
+
+typedef struct {
+	const uint8_t * data;
+	size_t len;
+	size_t rec;					// Next record in the current chunk
+	size_t chunk_end;
+	uint32_t time;
+	bool truncated;				// Stopped at a damaged or partial chunk
+
+	/* Backing storage of ads_rec_open() */
+	void * map;
+	size_t map_len;
+} ads_rec_reader_t;
+
+
+/************************************************************************/
+/*                                Writer                                */
+/************************************************************************/
+
+/**
+ * @brief Initializes a writer on caller provided storage and writes the
+ *				file header through sink
+ *
+ * @param storage		2 * chunk_size bytes
+ * @param chunk_size	chunk buffer size, at least 32 and at most 65535 bytes
+ * @param sink			writes chunks to the recording
+ * @param ctx			passed to sink
+ * @return	ADS_OK, ADS_ERR_BAD_PARAM or the sink error
+ */
+int ads_rec_writer_init(ads_rec_writer_t * w, uint8_t * storage, uint16_t chunk_size, ads_rec_sink sink, void * ctx);
+
+/**
+ * @brief Records a packet read from the ADS. Sample path, no sink calls.
+ */
+void ads_rec_write_packet(ads_rec_writer_t * w, uint32_t time_us, uint8_t address, const uint8_t * packet);
+
+/**
+ * @brief Records a sample rate or axis enable change
+ */
+void ads_rec_write_state(ads_rec_writer_t * w, uint32_t time_us, uint8_t address, uint16_t sps, uint8_t axes);
+
+/**
+ * @brief Writes a completed chunk, if any, through the sink. Call from the
+ *				application loop often enough that a chunk fills slower.
+ *
+ * @return	ADS_OK or the sink error
+ */
+int ads_rec_service(ads_rec_writer_t * w);
+
+/**
+ * @brief Writes every record so far, including the partial chunk
+ *
+ * @return	ADS_OK or the sink error
+ */
+int ads_rec_flush(ads_rec_writer_t * w);
+
+
+/************************************************************************/
+/*                                Reader                                */
+/************************************************************************/
+
+/**
+ * @brief Reads a recording held in memory. data must stay valid while
+ *				the reader is used.
+ *
+ * @return	ADS_OK or ADS_ERR_BAD_PARAM if it is not a recording
+ */
+int ads_rec_reader_init(ads_rec_reader_t * r, const uint8_t * data, size_t len);
+
+/**
+ * @brief Next event of the recording
+ *
+ * @param ev[out]	event
+ * @return	1 if an event was read, 0 at the end of the recording
+ */
+int ads_rec_next(ads_rec_reader_t * r, ads_rec_event_t * ev);
+
+/**
+ * @brief Restarts at the first event
+ */
+void ads_rec_rewind(ads_rec_reader_t * r);
+
+#if !defined(ARDUINO) && (defined(__unix__) || defined(__APPLE__))
+/**
+ * @brief Memory maps a recording file, nothing is copied
+ *
+ * @return	ADS_OK, ADS_ERR_IO if the file can not be mapped or
+ *			ADS_ERR_BAD_PARAM if it is not a recording
+ */
+int ads_rec_open(ads_rec_reader_t * r, const char * path);
+
+/**
+ * @brief Unmaps a file opened with ads_rec_open()
+ */
+void ads_rec_close(ads_rec_reader_t * r);
+
+/**
+ * @brief Sink appending to a stdio FILE, pass the FILE as ctx
+ */
+int ads_rec_file_sink(void * ctx, const uint8_t * data, uint32_t len);
+#endif
+
+#endif /* ADS_TWO_AXIS_REC_H_ */
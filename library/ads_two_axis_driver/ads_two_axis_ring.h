@@ -0,0 +1,154 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_RING_H_
+#define ADS_TWO_AXIS_RING_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "ads_two_axis_err.h"
+
+/*
+ * Lock-free single producer / single consumer ring of samples. The data
+ * ready interrupt is the only producer and the application the only
+ * consumer, so each index has exactly one writer and no lock is needed.
+ * head and tail run freely and are masked on access, size must be a power
+ * of two. When the ring is full new samples are dropped and counted.
+ */
+
+#if defined(__AVR__)
+/* Single byte indices are naturally atomic on AVR, a compiler barrier orders
+ * them. A wider overrun count could be read torn, it wraps at 256 instead. */
+typedef uint8_t ads_ring_index_t;
+typedef uint8_t ads_ring_count_t;
+#define ADS_RING_LOAD(p)		__extension__({ __typeof__(*(p)) v_ = *(volatile __typeof__(*(p)) *)(p); \
+									__asm__ __volatile__("" ::: "memory"); v_; })
+#define ADS_RING_STORE(p, v)	do { __asm__ __volatile__("" ::: "memory"); \
+									*(volatile __typeof__(*(p)) *)(p) = (v); } while(0)
+#else
+typedef uint16_t ads_ring_index_t;
+typedef uint32_t ads_ring_count_t;
+#define ADS_RING_LOAD(p)		__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define ADS_RING_STORE(p, v)	__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#endif
+
+#define ADS_RING_MAX_SIZE		((ads_ring_index_t)~0 / 2 + 1)
+
+typedef struct {
+	uint32_t timestamp;			// Drift corrected sample time, see ads_sample_time_t
+	int16_t  raw[2];			// Axis 0 and axis 1, degrees in Q10.5 (divide by 32)
+} ads_ring_sample_t;
+
+typedef struct {
+	ads_ring_sample_t * buffer;
+	ads_ring_index_t mask;
+	ads_ring_index_t head;		// Written by the producer only
+	ads_ring_index_t tail;		// Written by the consumer only
+	ads_ring_count_t overruns;	// Samples dropped because the ring was full, producer only, wraps
+	ads_ring_count_t overruns_taken;	// Overruns already reported, consumer only
+	ads_ring_index_t high_water;	// Highest fill level seen by the producer
+} ads_ring_t;
+
+
+/**
+ * @brief Initializes a ring on caller provided storage
+ *
+ * @param ring		ring to initialize
+ * @param buffer	storage for size samples
+ * @param size		number of samples, power of two up to ADS_RING_MAX_SIZE
+ * @return	ADS_OK if successful ADS_ERR_BAD_PARAM if size is not a power of two
+ */
+static inline int ads_ring_init(ads_ring_t * ring, ads_ring_sample_t * buffer, uint16_t size)
+{
+	if(buffer == NULL || size < 2 || size > ADS_RING_MAX_SIZE || (size & (size - 1)))
+		return ADS_ERR_BAD_PARAM;
+
+	ring->buffer = buffer;
+	ring->mask = (ads_ring_index_t)(size - 1);
+	ring->head = 0;
+	ring->tail = 0;
+	ring->overruns = 0;
+	ring->overruns_taken = 0;
+	ring->high_water = 0;
+
+	return ADS_OK;
+}
+
+/**
+ * @brief Number of samples waiting in the ring
+ */
+static inline uint16_t ads_ring_count(const ads_ring_t * ring)
+{
+	return (ads_ring_index_t)(ADS_RING_LOAD(&ring->head) - ADS_RING_LOAD(&ring->tail));
+}
+
+/**
+ * @brief Adds a sample. Producer side, safe to call from interrupt context.
+ *
+ * @return	true if stored, false if the ring was full and the sample dropped
+ */
+static inline bool ads_ring_push(ads_ring_t * ring, const ads_ring_sample_t * sample)
+{
+	ads_ring_index_t head = ring->head;
+	ads_ring_index_t used = (ads_ring_index_t)(head - ADS_RING_LOAD(&ring->tail));
+
+	if(used > ring->mask)
+	{
+		ADS_RING_STORE(&ring->overruns, (ads_ring_count_t)(ring->overruns + 1));
+		return false;
+	}
+
+	ring->buffer[head & ring->mask] = *sample;
+
+	if(used >= ring->high_water)
+		ring->high_water = used + 1;
+
+	ADS_RING_STORE(&ring->head, (ads_ring_index_t)(head + 1));
+
+	return true;
+}
+
+/**
+ * @brief Removes up to max samples in arrival order. Consumer side.
+ *
+ * @param samples	recipient of the samples
+ * @param max		capacity of samples
+ * @return	number of samples copied
+ */
+static inline uint16_t ads_ring_pop(ads_ring_t * ring, ads_ring_sample_t * samples, uint16_t max)
+{
+	ads_ring_index_t tail = ring->tail;
+	ads_ring_index_t avail = (ads_ring_index_t)(ADS_RING_LOAD(&ring->head) - tail);
+	uint16_t n = (avail < max) ? avail : max;
+
+	for(uint16_t i = 0; i < n; i++)
+		samples[i] = ring->buffer[(ads_ring_index_t)(tail + i) & ring->mask];
+
+	ADS_RING_STORE(&ring->tail, (ads_ring_index_t)(tail + n));
+
+	return n;
+}
+
+/**
+ * @brief Samples dropped since the previous call. Consumer side, the
+ *				producer owned counter itself is never written here. On AVR
+ *				the count is modulo 256, call at least that often while
+ *				the ring overflows.
+ */
+static inline uint32_t ads_ring_take_overruns(ads_ring_t * ring)
+{
+	ads_ring_count_t overruns = ADS_RING_LOAD(&ring->overruns);
+	uint32_t taken = (ads_ring_count_t)(overruns - ring->overruns_taken);
+
+	ring->overruns_taken = overruns;
+
+	return taken;
+}
+
+#endif /* ADS_TWO_AXIS_RING_H_ */
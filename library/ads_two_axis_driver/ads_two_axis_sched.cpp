@@ -0,0 +1,330 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#include <string.h>
+#include "ads_two_axis_sched.h"
+
+/* ADS_SPS_T is in ticks of the 16384 Hz sensor clock */
+#define ADS_SCHED_TICK_HZ			(16384)
+
+
+/**
+ * @brief Sets the sample period of e from its device, in us and 1/256 us
+ */
+static void ads_sched_set_period(ads_sched_entry_t * e)
+{
+	// 10^6 / 16384 = 15625 / 256
+	uint32_t period = (uint32_t)e->dev->sps * (1000000 * 256 / ADS_SCHED_TICK_HZ);
+
+	e->period_us = period >> 8;
+	e->period_frac = (uint8_t)period;
+}
+
+/**
+ * @brief Sets the next expected sample one period after time_us
+ */
+static void ads_sched_set_due(ads_sched_entry_t * e, uint32_t time_us)
+{
+	e->due_us = time_us + e->period_us;
+	e->due_frac = e->period_frac;
+}
+
+/**
+ * @brief Moves the expected sample on by one period, keeping the fraction
+ *				so a streaming device's estimate does not drift
+ */
+static void ads_sched_advance_due(ads_sched_entry_t * e)
+{
+	uint16_t frac = (uint16_t)e->due_frac + e->period_frac;
+
+	e->due_us += e->period_us + (frac >> 8);
+	e->due_frac = (uint8_t)frac;
+}
+
+/**
+ * @brief True once the expected sample is a quarter period late. The
+ *				grace keeps time driven reads from landing just before a
+ *				sample with some jitter on it.
+ */
+static inline bool ads_sched_overdue(const ads_sched_entry_t * e, uint32_t now)
+{
+	return (int32_t)(now - e->due_us) >= (int32_t)(e->period_us / 4);
+}
+
+/**
+ * @brief True while a shared line device is not expected to have a sample
+ *				yet. An edge on the line most likely came from another device.
+ */
+static inline bool ads_sched_early(const ads_sched_entry_t * e, uint32_t now)
+{
+	return e->shared && (int32_t)(now - e->due_us) < -(int32_t)(e->period_us / 8);
+}
+
+static bool ads_sched_ready(const ads_sched_entry_t * e, uint32_t now)
+{
+	ads_hal_dev_t * hal = &e->dev->hal;
+
+	if(hal->pending || ads_hal_pin_asserted(hal))
+		return true;
+
+	return e->shared && ads_sched_overdue(e, now);
+}
+
+/**
+ * @brief True if an entry before position k of order shares dev's line
+ */
+static bool ads_sched_line_read(ads_sched_t * sched, const uint8_t * order, uint8_t k, ads_hal_dev_t * hal)
+{
+	for(uint8_t j = 0; j < k; j++)
+	{
+		if(sched->entries[order[j]].dev->hal.datardy_pin == hal->datardy_pin)
+			return true;
+	}
+
+	return false;
+}
+
+static void ads_sched_update_shared(ads_sched_t * sched)
+{
+	for(uint8_t i = 0; i < sched->count; i++)
+	{
+		sched->entries[i].shared = false;
+
+		for(uint8_t j = 0; j < sched->count; j++)
+		{
+			if(i != j && sched->entries[i].dev->hal.datardy_pin == sched->entries[j].dev->hal.datardy_pin)
+				sched->entries[i].shared = true;
+		}
+	}
+}
+
+/**
+ * @brief Reads one device, delivers the packet unless it repeats the last
+ *				one, and updates its deadline and counters
+ *
+ * @return	1 if a sample was delivered, 0 for a repeat or ADS_ERR_IO
+ */
+static int ads_sched_read(ads_sched_entry_t * e)
+{
+	ads_hal_dev_t * hal = &e->dev->hal;
+	uint32_t start, end, expected, sample_time;
+	bool edge;
+
+	// A device alone on its line has an exact edge time, a shared line
+	// only has the edge of whichever device asserted it first. The read
+	// below serves the edge, so it is taken here.
+	ads_hal_lock();
+	edge = hal->pending && !e->shared;
+	sample_time = hal->drdy_time;
+	hal->pending = false;
+	ads_hal_unlock();
+
+	start = ads_hal_get_time_us();
+
+	expected = edge ? sample_time : e->due_us;
+
+	if(!edge)
+		sample_time = start;
+
+	if(ads_hal_dev_read_packet(hal) != ADS_OK)
+		return ADS_ERR_IO;
+
+	end = ads_hal_get_time_us();
+	e->stats.bus_us += end - start;
+
+	int32_t late = (int32_t)(start - expected);
+	uint32_t prev_read = e->read_us;
+
+	e->read_us = start;
+
+	// Without its own edge a device answers with its previous packet until
+	// the next sample. A different packet is always new, an equal one only
+	// once the sample is due by a margin for clock error, a still joint may
+	// repeat its reading.
+	bool changed = !e->primed || memcmp(e->last, hal->read_buffer, ADS_TRANSFER_SIZE) != 0;
+
+	if(e->shared && !edge && !changed && late < (int32_t)(e->period_us / 8))
+	{
+		e->stats.repeats++;
+		return 0;
+	}
+
+	// The previous read still found the old packet, so an estimate placing
+	// the sample before that read runs early and would pass repeats
+	bool behind = e->shared && !edge && changed && e->primed && (int32_t)(expected - prev_read) < 0;
+
+	// The callback may reuse the read buffer
+	memcpy(e->last, hal->read_buffer, ADS_TRANSFER_SIZE);
+	e->primed = true;
+
+	if(hal->read_buffer[0] == ADS_SAMPLE)
+		e->stats.samples++;
+
+	hal->sample_time = sample_time;
+	hal->read_callback(hal, hal->read_buffer);
+
+	if(late > (int32_t)e->period_us)
+		e->stats.missed_deadlines += (uint32_t)late / e->period_us;
+
+	if((int32_t)(end - expected) > (int32_t)e->stats.max_latency_us)
+		e->stats.max_latency_us = end - expected;
+
+	// Stay phase locked while reads are on time, otherwise restart the
+	// estimate from this read. A read ahead of the estimate on a shared
+	// line means the line was asserted, so the sample was there.
+	if(edge)
+		ads_sched_set_due(e, expected);
+	else if(late >= 0 && late < (int32_t)e->period_us && !behind)
+		ads_sched_advance_due(e);
+	else
+		ads_sched_set_due(e, start);
+
+	return 1;
+}
+
+void ads_sched_init(ads_sched_t * sched)
+{
+	sched->count = 0;
+	sched->rr = 0;
+	sched->stats_start_us = ads_hal_get_time_us();
+}
+
+int ads_sched_add(ads_sched_t * sched, ads_dev_t * dev)
+{
+	if(sched->count >= ADS_COUNT)
+		return ADS_ERR;
+
+	ads_sched_entry_t * e = &sched->entries[sched->count];
+
+	e->dev = dev;
+	ads_sched_set_period(e);
+	e->due_us = ads_hal_get_time_us();
+	e->due_frac = 0;
+	e->read_us = e->due_us;
+	e->primed = false;
+	e->stats = ads_sched_stats_t();
+
+	ads_two_axis_dev_set_deferred(dev, true, dev->hal.notify);
+
+	sched->count++;
+
+	ads_sched_update_shared(sched);
+
+	return sched->count - 1;
+}
+
+int ads_sched_poll(ads_sched_t * sched)
+{
+	uint8_t order[ADS_COUNT];
+	uint32_t deadline[ADS_COUNT];
+	uint32_t seen[ADS_COUNT];
+	bool early[ADS_COUNT];
+	uint8_t n = 0;
+	int read = 0;
+
+	if(sched->count == 0)
+		return 0;
+
+	ads_hal_pin_poll();
+
+	uint32_t now = ads_hal_get_time_us();
+
+	// Collect ready devices sorted by deadline, starting the scan at the
+	// round robin position so ties are served in turn. Shared line devices
+	// that are not expected yet go last.
+	for(uint8_t k = 0; k < sched->count; k++)
+	{
+		uint8_t i = (uint8_t)((sched->rr + k) % sched->count);
+		ads_sched_entry_t * e = &sched->entries[i];
+
+		ads_sched_set_period(e);
+
+		if(!ads_sched_ready(e, now))
+			continue;
+
+		ads_hal_lock();
+		uint32_t drdy_time = e->dev->hal.drdy_time;
+		ads_hal_unlock();
+
+		uint32_t expected = (e->dev->hal.pending && !e->shared) ? drdy_time : e->due_us;
+		uint32_t d = expected + e->period_us;
+		bool is_early = ads_sched_early(e, now);
+		uint8_t j = n;
+
+		while(j > 0 && (early[j - 1] > is_early ||
+		                (early[j - 1] == is_early && (int32_t)(deadline[j - 1] - d) > 0)))
+		{
+			order[j] = order[j - 1];
+			deadline[j] = deadline[j - 1];
+			seen[j] = seen[j - 1];
+			early[j] = early[j - 1];
+			j--;
+		}
+
+		order[j] = i;
+		deadline[j] = d;
+		seen[j] = drdy_time;
+		early[j] = is_early;
+		n++;
+	}
+
+	sched->rr = (uint8_t)((sched->rr + 1) % sched->count);
+
+	for(uint8_t k = 0; k < n; k++)
+	{
+		ads_sched_entry_t * e = &sched->entries[order[k]];
+		ads_hal_dev_t * hal = &e->dev->hal;
+
+		// Once one device on a shared line is read, the rest are only read
+		// while the line is still held or when their sample is overdue.
+		// Devices not expected yet need the line held in any case.
+		bool skip = early[k] ? !ads_hal_pin_asserted(hal) :
+		            (e->shared && ads_sched_line_read(sched, order, k, hal) &&
+		             !ads_hal_pin_asserted(hal) && !ads_sched_overdue(e, now));
+
+		if(skip)
+		{
+			// Drops the edge seen above, not one the interrupt flagged since
+			ads_hal_lock();
+			if(hal->drdy_time == seen[k])
+				hal->pending = false;
+			ads_hal_unlock();
+			continue;
+		}
+
+		int ret = ads_sched_read(e);
+
+		if(ret < 0)
+			return ret;
+
+		read += ret;
+	}
+
+	return read;
+}
+
+int ads_sched_get_stats(ads_sched_t * sched, uint8_t index, ads_sched_stats_t * stats)
+{
+	if(index >= sched->count)
+		return ADS_ERR_BAD_PARAM;
+
+	uint32_t elapsed = ads_hal_get_time_us() - sched->stats_start_us;
+
+	*stats = sched->entries[index].stats;
+	stats->bus_permille = elapsed ? (uint16_t)(((uint64_t)stats->bus_us * 1000) / elapsed) : 0;
+
+	return ADS_OK;
+}
+
+void ads_sched_reset_stats(ads_sched_t * sched)
+{
+	for(uint8_t i = 0; i < sched->count; i++)
+		sched->entries[i].stats = ads_sched_stats_t();
+
+	sched->stats_start_us = ads_hal_get_time_us();
+}
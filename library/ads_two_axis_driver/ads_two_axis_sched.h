@@ -0,0 +1,103 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_SCHED_H_
+#define ADS_TWO_AXIS_SCHED_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ads_two_axis.h"
+
+/*
+ * Bus scheduler for several ADS on one I2C bus. Devices are switched to
+ * deferred mode, so the data ready interrupts only flag work, and each
+ * ads_sched_poll() reads every ready device in one pass, earliest deadline
+ * first. A device's deadline is its next sample: reading later than that
+ * loses a sample, which is counted as a missed deadline.
+ *
+ * Devices may share one wired-OR data ready line. The line then says that
+ * some device has data, not which one. Devices on a shared line are read in
+ * deadline order while the line stays asserted, devices not expected to
+ * have a sample yet last. A device is also read once its sample period has
+ * elapsed since its last read, so a line without a readable level (Linux
+ * GPIO events) or a lost edge cannot stall it. Reads that find no new sample
+ * return the previous packet again. A shared line device's packet is only
+ * delivered if it differs from the last one or is read an eighth of a period
+ * after the expected sample, repeats are dropped and counted in repeats and
+ * bus_us.
+ * Only add devices that are streaming, a stopped device on a shared line is
+ * still read once per period.
+ */
+
+typedef struct {
+	uint32_t samples;			// Samples delivered
+	uint32_t repeats;			// Previous packets read again on a shared line, dropped
+	uint32_t missed_deadlines;	// Samples estimated lost because the read came too late
+	uint32_t bus_us;			// Time spent reading this device
+	uint16_t bus_permille;		// bus_us per 1000 us since ads_sched_reset_stats()
+	uint32_t max_latency_us;	// Longest time from expected sample to end of read
+} ads_sched_stats_t;
+
+typedef struct {
+	ads_dev_t * dev;
+	uint32_t period_us;			// From dev->sps
+	uint32_t due_us;			// Expected time of the next sample
+	uint8_t period_frac;		// Fractions of period_us and due_us, 1/256 us
+	uint8_t due_frac;
+	bool shared;				// Data ready line shared with another device
+	uint32_t read_us;			// Start of the last read
+	bool primed;				// last holds a packet
+	uint8_t last[ADS_TRANSFER_SIZE];	// Last packet delivered
+	ads_sched_stats_t stats;
+} ads_sched_entry_t;
+
+typedef struct {
+	ads_sched_entry_t entries[ADS_COUNT];
+	uint8_t count;
+	uint8_t rr;					// First entry considered on deadline ties, rotates every pass
+	uint32_t stats_start_us;
+} ads_sched_t;
+
+
+/**
+ * @brief Initializes an empty scheduler
+ */
+void ads_sched_init(ads_sched_t * sched);
+
+/**
+ * @brief Adds an initialized device. The device is switched to deferred mode
+ *				and must be read through ads_sched_poll() from now on.
+ *
+ * @param dev		device set up with ads_two_axis_dev_init()
+ * @return	entry index or ADS_ERR if the scheduler is full
+ */
+int ads_sched_add(ads_sched_t * sched, ads_dev_t * dev);
+
+/**
+ * @brief Reads every ready device once, earliest deadline first. Call at
+ *				least twice per sample period of the fastest device.
+ *
+ * @return	number of samples read or ADS_ERR_IO if a read failed
+ */
+int ads_sched_poll(ads_sched_t * sched);
+
+/**
+ * @brief Counters of one device
+ *
+ * @param index		entry index returned by ads_sched_add()
+ * @param stats[out]	counters, bus_permille is computed on the call
+ * @return	ADS_OK if successful ADS_ERR_BAD_PARAM if index is invalid
+ */
+int ads_sched_get_stats(ads_sched_t * sched, uint8_t index, ads_sched_stats_t * stats);
+
+/**
+ * @brief Clears the counters of every device and restarts the utilization window
+ */
+void ads_sched_reset_stats(ads_sched_t * sched);
+
+#endif /* ADS_TWO_AXIS_SCHED_H_ */
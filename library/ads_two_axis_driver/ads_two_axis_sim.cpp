@@ -0,0 +1,690 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+/* The simulation is a host tool. Keep it out of Arduino builds of the library. */
+#if !defined(ARDUINO)
+
+#include "ads_two_axis_sim.h"
+#include <string.h>
+#include <math.h>
+
+#define ADS_SIM_DFU_START_US		(10000)			// Time from ADS_DFU until the bootloader answers
+#define ADS_SIM_ACK					('s')
+
+typedef struct {
+	ads_sim_config_t config;
+	bool initialized;
+	uint64_t now_us;
+	uint8_t count;
+	ads_sim_device_t devs[ADS_SIM_MAX_DEVICES];
+	ads_sim_drdy_handler drdy_handler;
+	ads_sim_signal_fn signal;
+	bool in_dispatch;
+	uint32_t rng;
+	ADS_SIM_ERR_T fail_err;
+	uint16_t fail_count;
+	ads_sim_bus_stats_t stats;
+} ads_sim_t;
+
+static ads_sim_t sim;
+
+static inline uint64_t ads_sim_tick_to_us(const ads_sim_device_t * dev, uint64_t tick)
+{
+	// 1e6 / 16384 == 15625 / 256, rounded up so an event is never early.
+	// The oscillator of dev runs clock_ppm fast.
+	uint64_t scale = 256 * (uint64_t)(1000000 + dev->clock_ppm);
+
+	return (tick * 15625 * 1000000 + scale - 1) / scale;
+}
+
+static inline uint64_t ads_sim_us_to_tick(const ads_sim_device_t * dev, uint64_t us)
+{
+	return (us * 256 * (uint64_t)(1000000 + dev->clock_ppm)) / ((uint64_t)15625 * 1000000);
+}
+
+static void ads_sim_default_signal(uint8_t device, uint64_t time_us, float * angle)
+{
+	float t = (float)time_us * 1e-6f;
+	float phase = (float)device * 0.7f;
+
+	angle[0] = 60.0f * sinf(2.0f * 3.14159265f * 0.5f * t + phase);
+	angle[1] = 30.0f * cosf(2.0f * 3.14159265f * 0.3f * t + phase);
+}
+
+/**
+ * @brief xorshift32, deterministic for a given seed
+ */
+static uint32_t ads_sim_rand(void)
+{
+	uint32_t x = sim.rng;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	sim.rng = x;
+	return x;
+}
+
+static ADS_SIM_ERR_T ads_sim_take_error(void)
+{
+	if(sim.fail_count)
+	{
+		sim.fail_count--;
+		sim.stats.errors_injected++;
+		return sim.fail_err;
+	}
+
+	if(sim.config.error_rate_ppm && (ads_sim_rand() % 1000000) < sim.config.error_rate_ppm)
+	{
+		sim.stats.errors_injected++;
+		return (ads_sim_rand() & 1) ? ADS_SIM_ERR_NAK : ADS_SIM_ERR_SHORT;
+	}
+
+	return ADS_SIM_ERR_NONE;
+}
+
+static void ads_sim_device_boot(ads_sim_device_t * dev, uint64_t delay_us)
+{
+	dev->mode = dev->erased ? ADS_SIM_OFF : ADS_SIM_BOOTING;
+	dev->ready_us = sim.now_us + delay_us;
+	dev->run = false;
+	dev->int_enable = true;
+	dev->sps = ADS_SIM_TICK_HZ / 100;
+	dev->axes = ADS_AXIS_0_EN | ADS_AXIS_1_EN;
+	dev->drdy = false;
+	dev->edge = false;
+	dev->busy = false;
+	memset(dev->tx, 0, sizeof(dev->tx));
+}
+
+static void ads_sim_device_bootloader(ads_sim_device_t * dev, uint64_t delay_us)
+{
+	dev->mode = ADS_SIM_BOOTLOADER;
+	dev->ready_us = sim.now_us + delay_us;
+	dev->run = false;
+	dev->drdy = false;
+	dev->edge = false;
+	dev->busy = true;			// Not answering until ready_us
+	dev->fw_len = 0;
+	dev->fw_received = 0;
+	dev->len_received = 0;
+	dev->page_fill = 0;
+	dev->ack = 0;
+	dev->fw_complete = false;
+}
+
+static void ads_sim_assert_drdy(ads_sim_device_t * dev, uint64_t time_us)
+{
+	if(!dev->int_enable)
+		return;
+
+	if(!dev->drdy)
+	{
+		dev->drdy = true;
+		dev->edge = true;
+		dev->edge_us = time_us;
+	}
+}
+
+static void ads_sim_produce_sample(uint8_t index, ads_sim_device_t * dev, uint64_t time_us)
+{
+	float angle[2];
+	sim.signal(index, time_us, angle);
+
+	for(uint8_t i = 0; i < 2; i++)
+	{
+		int32_t raw = 0;
+
+		if(dev->axes & (1 << i))
+		{
+			float scaled = angle[i] * 32.0f;
+			raw = (int32_t)(scaled < 0 ? scaled - 0.5f : scaled + 0.5f) - dev->offset[i];
+
+			if(raw > INT16_MAX)
+				raw = INT16_MAX;
+			else if(raw < INT16_MIN)
+				raw = INT16_MIN;
+		}
+
+		ads_uint16_encode((uint16_t)(int16_t)raw, &dev->tx[1 + 2*i]);
+	}
+
+	// A sample that was never read out is lost
+	if(dev->drdy && dev->tx[0] == ADS_SAMPLE)
+		dev->samples_lost++;
+
+	dev->tx[0] = ADS_SAMPLE;
+	dev->samples++;
+
+	ads_sim_assert_drdy(dev, time_us);
+}
+
+/**
+ * @brief Brings every device up to the current time. Edges are latched and
+ *				delivered by ads_sim_dispatch()
+ */
+static void ads_sim_update(void)
+{
+	for(uint8_t i = 0; i < sim.count; i++)
+	{
+		ads_sim_device_t * dev = &sim.devs[i];
+
+		switch(dev->mode)
+		{
+		case ADS_SIM_BOOTING:
+			if(sim.now_us >= dev->ready_us)
+				dev->mode = ADS_SIM_APP;
+			break;
+
+		case ADS_SIM_APP:
+			while(dev->run && ads_sim_tick_to_us(dev, dev->next_tick) <= sim.now_us)
+			{
+				ads_sim_produce_sample(i, dev, ads_sim_tick_to_us(dev, dev->next_tick));
+				dev->next_tick += dev->sps;
+			}
+			break;
+
+		case ADS_SIM_BOOTLOADER:
+			if(dev->busy && sim.now_us >= dev->ready_us)
+			{
+				dev->busy = false;
+				if(dev->len_received == 4)
+					dev->ack = ADS_SIM_ACK;
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+}
+
+static uint64_t ads_sim_next_event(void)
+{
+	uint64_t next = UINT64_MAX;
+
+	for(uint8_t i = 0; i < sim.count; i++)
+	{
+		ads_sim_device_t * dev = &sim.devs[i];
+		uint64_t t = UINT64_MAX;
+
+		if(dev->mode == ADS_SIM_BOOTING || (dev->mode == ADS_SIM_BOOTLOADER && dev->busy))
+			t = dev->ready_us;
+		else if(dev->mode == ADS_SIM_APP && dev->run)
+			t = ads_sim_tick_to_us(dev, dev->next_tick);
+
+		if(t < next)
+			next = t;
+	}
+
+	return next;
+}
+
+/**
+ * @brief Edge time of dev as the host captures it, up to drdy_jitter_us
+ *				late. Models interrupt latency on the timestamp only, the
+ *				edge is still delivered at once.
+ */
+static uint64_t ads_sim_edge_time(const ads_sim_device_t * dev)
+{
+	if(sim.config.drdy_jitter_us == 0)
+		return dev->edge_us;
+
+	return dev->edge_us + ads_sim_rand() % (sim.config.drdy_jitter_us + 1);
+}
+
+/**
+ * @brief Delivers latched data ready edges. Not reentrant: edges raised by
+ *				transactions inside the handler are delivered on the next pass.
+ */
+static void ads_sim_dispatch(void)
+{
+	if(sim.in_dispatch)
+		return;
+
+	sim.in_dispatch = true;
+
+	bool delivered;
+	do
+	{
+		delivered = false;
+
+		for(uint8_t i = 0; i < sim.count; i++)
+		{
+			ads_sim_device_t * dev = &sim.devs[i];
+
+			if(dev->edge)
+			{
+				dev->edge = false;
+				delivered = true;
+
+				if(sim.drdy_handler)
+					sim.drdy_handler(i, ads_sim_edge_time(dev));
+			}
+		}
+	} while(delivered);
+
+	sim.in_dispatch = false;
+}
+
+/**
+ * @brief Occupies the bus for one transaction of len data bytes
+ */
+static void ads_sim_bus_time(uint16_t len)
+{
+	// Start, address byte, data bytes with ack bit, stop
+	uint32_t bits = 2 + 9 * (1 + (uint32_t)len);
+	uint64_t us = sim.config.i2c_overhead_us + ((uint64_t)bits * 1000000 + sim.config.i2c_clock_hz - 1) / sim.config.i2c_clock_hz;
+
+	sim.now_us += us;
+	sim.stats.transactions++;
+	sim.stats.bytes += len;
+	sim.stats.busy_us += us;
+
+	ads_sim_update();
+}
+
+static void ads_sim_app_command(ads_sim_device_t * dev, const uint8_t * buffer, uint16_t len)
+{
+	switch(buffer[0])
+	{
+	case ADS_RUN:
+		dev->run = len > 1 && buffer[1];
+		if(dev->run)
+			dev->next_tick = ads_sim_us_to_tick(dev, sim.now_us) + dev->sps;
+		break;
+
+	case ADS_SPS:
+		if(len >= 3)
+		{
+			uint16_t sps = ads_uint16_decode(&buffer[1]);
+			if(sps)
+			{
+				dev->sps = sps;
+				if(dev->run)
+					dev->next_tick = ads_sim_us_to_tick(dev, sim.now_us) + dev->sps;
+			}
+		}
+		break;
+
+	case ADS_RESET:
+		ads_sim_device_boot(dev, (uint64_t)sim.config.boot_time_ms * 1000);
+		break;
+
+	case ADS_DFU:
+		ads_sim_device_bootloader(dev, ADS_SIM_DFU_START_US);
+		break;
+
+	case ADS_SET_ADDRESS:
+		if(len > 1)
+			dev->address = buffer[1];
+		break;
+
+	case ADS_INTERRUPT_ENABLE:
+		dev->int_enable = len > 1 && buffer[1];
+		if(!dev->int_enable)
+			dev->drdy = false;
+		break;
+
+	case ADS_GET_FW_VER:
+		memset(dev->tx, 0, sizeof(dev->tx));
+		dev->tx[0] = ADS_FW_VER;
+		ads_uint16_encode(dev->fw_ver, &dev->tx[1]);
+		ads_sim_assert_drdy(dev, sim.now_us);
+		break;
+
+	case ADS_CALIBRATE:
+		if(len > 1 && buffer[1] == 0)			// ADS_CALIBRATE_FIRST
+		{
+			float angle[2];
+			sim.signal((uint8_t)(dev - sim.devs), sim.now_us, angle);
+			dev->offset[0] = (int16_t)(angle[0] * 32.0f);
+			dev->offset[1] = (int16_t)(angle[1] * 32.0f);
+		}
+		else if(len > 1 && buffer[1] == 3)		// ADS_CALIBRATE_CLEAR
+		{
+			dev->offset[0] = dev->offset[1] = 0;
+		}
+		break;
+
+	case ADS_AXES_ENALBED:
+		if(len > 1)
+			dev->axes = buffer[1];
+		break;
+
+	case ADS_SHUTDOWN:
+		dev->mode = ADS_SIM_SHUTDOWN;
+		dev->run = false;
+		dev->drdy = false;
+		break;
+
+	case ADS_GET_DEV_ID:
+		memset(dev->tx, 0, sizeof(dev->tx));
+		dev->tx[0] = ADS_DEV_ID;
+		dev->tx[1] = (uint8_t)dev->dev_type;
+		ads_sim_assert_drdy(dev, sim.now_us);
+		break;
+
+	default:
+		break;
+	}
+}
+
+static void ads_sim_bootloader_write(ads_sim_device_t * dev, const uint8_t * buffer, uint16_t len)
+{
+	uint16_t i = 0;
+
+	// The first four bytes are the little endian image length
+	while(dev->len_received < 4 && i < len)
+	{
+		dev->fw_len |= (uint32_t)buffer[i++] << (8 * dev->len_received);
+		dev->len_received++;
+
+		// Acknowledged once the application area is erased
+		if(dev->len_received == 4)
+		{
+			dev->erased = true;
+			dev->busy = true;
+			dev->ready_us = sim.now_us + sim.config.erase_us;
+		}
+	}
+
+	if(i == len)
+		return;
+
+	dev->ack = 0;
+
+	uint16_t data = len - i;
+	dev->fw_received += data;
+	dev->page_fill += data;
+
+	if(dev->page_fill >= ADS_SIM_PAGE_SIZE || dev->fw_received >= dev->fw_len)
+	{
+		dev->page_fill = 0;
+		dev->pages_written++;
+		dev->busy = true;
+		dev->ready_us = sim.now_us + sim.config.page_program_us;
+
+		if(dev->fw_received >= dev->fw_len)
+			dev->fw_complete = true;
+	}
+}
+
+void ads_sim_get_default_config(ads_sim_config_t * config)
+{
+	config->i2c_clock_hz = 400000;
+	config->i2c_overhead_us = 10;
+	config->error_rate_ppm = 0;
+	config->seed = 0x2A5D5EED;
+	config->boot_time_ms = 75;
+	config->page_program_us = 2500;
+	config->erase_us = 20000;
+	config->clock_drift_ppm = 0;
+	config->drdy_jitter_us = 0;
+}
+
+void ads_sim_init(const ads_sim_config_t * config)
+{
+	memset(&sim, 0, sizeof(sim));
+
+	if(config)
+		sim.config = *config;
+	else
+		ads_sim_get_default_config(&sim.config);
+
+	if(sim.config.i2c_clock_hz == 0)
+		sim.config.i2c_clock_hz = 400000;
+
+	sim.rng = sim.config.seed ? sim.config.seed : 1;
+	sim.signal = ads_sim_default_signal;
+	sim.initialized = true;
+
+	ads_sim_add_device(ADS_SIM_DEFAULT_ADDR, ADS_DEV_TWO_AXIS_V2, 6);
+}
+
+bool ads_sim_initialized(void)
+{
+	return sim.initialized;
+}
+
+int ads_sim_add_device(uint8_t address, ADS_DEV_TYPE_T dev_type, uint16_t fw_ver)
+{
+	if(sim.count >= ADS_SIM_MAX_DEVICES)
+		return ADS_ERR_BAD_PARAM;
+
+	ads_sim_device_t * dev = &sim.devs[sim.count];
+	memset(dev, 0, sizeof(*dev));
+
+	dev->address = address;
+	dev->dev_type = dev_type;
+	dev->fw_ver = fw_ver;
+	dev->update_fw_ver = fw_ver;
+	dev->clock_ppm = sim.config.clock_drift_ppm;
+
+	ads_sim_device_boot(dev, 0);
+	dev->mode = ADS_SIM_APP;
+
+	return sim.count++;
+}
+
+uint8_t ads_sim_device_count(void)
+{
+	return sim.count;
+}
+
+ads_sim_device_t * ads_sim_get_device(uint8_t device)
+{
+	if(device >= sim.count)
+		return NULL;
+
+	return &sim.devs[device];
+}
+
+uint8_t ads_sim_pin_device(uint32_t pin)
+{
+	if(pin < sim.count)
+		return (uint8_t)pin;
+
+	return ADS_SIM_ALL;
+}
+
+uint64_t ads_sim_time_us(void)
+{
+	return sim.now_us;
+}
+
+uint64_t ads_sim_next_event_us(void)
+{
+	return ads_sim_next_event();
+}
+
+void ads_sim_advance_us(uint64_t us)
+{
+	uint64_t target = sim.now_us + us;
+
+	for(;;)
+	{
+		uint64_t next = ads_sim_next_event();
+
+		if(next > target)
+			break;
+
+		if(next > sim.now_us)
+			sim.now_us = next;
+
+		ads_sim_update();
+		ads_sim_dispatch();
+	}
+
+	// Handlers may have pushed time past the target with bus transactions
+	if(sim.now_us < target)
+		sim.now_us = target;
+
+	ads_sim_update();
+	ads_sim_dispatch();
+}
+
+void ads_sim_set_drdy_handler(ads_sim_drdy_handler handler)
+{
+	sim.drdy_handler = handler;
+}
+
+void ads_sim_set_signal(ads_sim_signal_fn signal)
+{
+	sim.signal = signal ? signal : ads_sim_default_signal;
+}
+
+bool ads_sim_drdy_asserted(uint8_t device)
+{
+	if(device != ADS_SIM_ALL)
+		return device < sim.count && sim.devs[device].drdy;
+
+	for(uint8_t i = 0; i < sim.count; i++)
+	{
+		if(sim.devs[i].drdy)
+			return true;
+	}
+
+	return false;
+}
+
+void ads_sim_reset(uint8_t device, bool bootloader)
+{
+	for(uint8_t i = 0; i < sim.count; i++)
+	{
+		if(device != ADS_SIM_ALL && device != i)
+			continue;
+
+		if(bootloader)
+			ads_sim_device_bootloader(&sim.devs[i], (uint64_t)sim.config.boot_time_ms * 1000);
+		else
+			ads_sim_device_boot(&sim.devs[i], (uint64_t)sim.config.boot_time_ms * 1000);
+	}
+}
+
+uint16_t ads_sim_i2c_write(uint8_t address, const uint8_t * buffer, uint16_t len)
+{
+	ADS_SIM_ERR_T err = ads_sim_take_error();
+
+	if(err == ADS_SIM_ERR_NAK)
+	{
+		ads_sim_bus_time(0);
+		sim.stats.naks++;
+		return 0;
+	}
+
+	if(err == ADS_SIM_ERR_SHORT && len > 1)
+		len = 1;
+
+	ads_sim_bus_time(len);
+
+	bool acked = false;
+
+	for(uint8_t i = 0; i < sim.count; i++)
+	{
+		ads_sim_device_t * dev = &sim.devs[i];
+
+		if(dev->mode == ADS_SIM_APP && dev->address == address && len)
+		{
+			ads_sim_app_command(dev, buffer, len);
+			acked = true;
+		}
+		else if(dev->mode == ADS_SIM_BOOTLOADER && !dev->busy && address == ADS_SIM_BOOTLOADER_ADDR && !dev->fw_complete)
+		{
+			// Every device in bootloader mode listens on the same address
+			ads_sim_bootloader_write(dev, buffer, len);
+			acked = true;
+		}
+	}
+
+	if(!acked)
+	{
+		sim.stats.naks++;
+		return 0;
+	}
+
+	return len;
+}
+
+uint16_t ads_sim_i2c_read(uint8_t address, uint8_t * buffer, uint16_t len)
+{
+	ADS_SIM_ERR_T err = ads_sim_take_error();
+
+	if(err == ADS_SIM_ERR_NAK)
+	{
+		ads_sim_bus_time(0);
+		sim.stats.naks++;
+		return 0;
+	}
+
+	if(err == ADS_SIM_ERR_SHORT && len > 1)
+		len = 1;
+
+	bool acked = false;
+
+	// The device latches its response when addressed, a sample completed
+	// while the bytes are clocked out is left for the next read
+
+	// Open drain bus: devices answering the same address AND their data
+	memset(buffer, 0xFF, len);
+
+	for(uint8_t i = 0; i < sim.count; i++)
+	{
+		ads_sim_device_t * dev = &sim.devs[i];
+
+		if(dev->mode == ADS_SIM_APP && dev->address == address)
+		{
+			for(uint16_t j = 0; j < len; j++)
+				buffer[j] &= (j < ADS_TRANSFER_SIZE) ? dev->tx[j] : 0xFF;
+
+			if(dev->drdy && dev->tx[0] == ADS_SAMPLE)
+				dev->samples_read++;
+
+			// An interrupt would have been taken before the line could be
+			// read, an edge still waiting for dispatch is served by this read
+			dev->drdy = false;
+			dev->edge = false;
+			acked = true;
+		}
+		else if(dev->mode == ADS_SIM_BOOTLOADER && address == ADS_SIM_BOOTLOADER_ADDR && sim.now_us >= dev->ready_us)
+		{
+			buffer[0] &= dev->busy ? 0 : dev->ack;
+			acked = true;
+
+			// Image complete and acknowledged, start the new application
+			if(dev->fw_complete && !dev->busy && dev->ack == ADS_SIM_ACK)
+			{
+				dev->fw_ver = dev->update_fw_ver;
+				dev->erased = false;
+				ads_sim_device_boot(dev, (uint64_t)sim.config.boot_time_ms * 1000);
+			}
+		}
+	}
+
+	ads_sim_bus_time(len);
+
+	if(!acked)
+	{
+		sim.stats.naks++;
+		return 0;
+	}
+
+	return len;
+}
+
+void ads_sim_fail_next(ADS_SIM_ERR_T err, uint16_t count)
+{
+	sim.fail_err = err;
+	sim.fail_count = (err == ADS_SIM_ERR_NONE) ? 0 : count;
+}
+
+void ads_sim_get_bus_stats(ads_sim_bus_stats_t * stats)
+{
+	*stats = sim.stats;
+}
+
+#endif /* !ARDUINO */
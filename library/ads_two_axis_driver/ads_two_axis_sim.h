@@ -0,0 +1,231 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_SIM_H_
+#define ADS_TWO_AXIS_SIM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "ads_two_axis_hal.h"
+#include "ads_two_axis_err.h"
+#include "ads_two_axis_util.h"
+
+/*
+ * Software model of one or more two axis ADS on a shared I2C bus. Time is
+ * virtual: it only moves forward through ads_sim_advance_us() and the modeled
+ * duration of bus transactions, so a run is deterministic and independent of
+ * the speed of the host.
+ *
+ * Pin numbers handed to a HAL backed by the simulation select the device they
+ * are wired to: pin N is attached to device N. Any other value is a line that
+ * is shared by every device on the bus (wired-OR data ready, common reset).
+ */
+
+#define ADS_SIM_MAX_DEVICES			(ADS_COUNT)
+#define ADS_SIM_DEFAULT_ADDR		(0x13)			// Application address after reset
+#define ADS_SIM_BOOTLOADER_ADDR		(0x12)			// Address the bootloader answers on
+#define ADS_SIM_TICK_HZ				(16384)			// ADS_SPS_T is expressed in ticks of this clock
+#define ADS_SIM_PAGE_SIZE			(64)			// Bootloader flash page size
+#define ADS_SIM_ALL					(0xFF)			// Device index addressing every device
+
+/* Operating mode of a simulated device */
+typedef enum {
+	ADS_SIM_OFF = 0,
+	ADS_SIM_BOOTING,
+	ADS_SIM_APP,
+	ADS_SIM_SHUTDOWN,
+	ADS_SIM_BOOTLOADER
+} ADS_SIM_MODE_T;
+
+/* Injected bus errors */
+typedef enum {
+	ADS_SIM_ERR_NONE = 0,
+	ADS_SIM_ERR_NAK,			// Transaction is not acknowledged, no data is transferred
+	ADS_SIM_ERR_SHORT			// Transaction stops after the first byte
+} ADS_SIM_ERR_T;
+
+typedef struct {
+	uint32_t i2c_clock_hz;		// Modeled bus clock, sets the duration of each transaction
+	uint32_t i2c_overhead_us;	// Fixed latency added to every transaction
+	uint32_t error_rate_ppm;	// Probability of a random bus error, parts per million
+	uint32_t seed;				// Seed of the error injection generator
+	uint32_t boot_time_ms;		// Time from reset until the application answers
+	uint32_t page_program_us;	// Time the bootloader needs to program one page
+	uint32_t erase_us;			// Time the bootloader needs to erase the application after the image length
+	int32_t  clock_drift_ppm;	// Oscillator error of added devices, positive samples fast
+	uint32_t drdy_jitter_us;	// Largest random delay of the data ready edge time seen by the host
+} ads_sim_config_t;
+
+typedef struct {
+	uint8_t  address;
+	ADS_DEV_TYPE_T dev_type;
+	uint16_t fw_ver;
+	uint16_t update_fw_ver;		// Version reported after a completed firmware update
+	ADS_SIM_MODE_T mode;
+
+	bool     run;
+	bool     int_enable;
+	uint16_t sps;
+	uint8_t  axes;
+	int16_t  offset[2];			// Zero offset set by ADS_CALIBRATE_FIRST, Q10.5
+	int32_t  clock_ppm;			// Oscillator error, positive samples fast
+
+	bool     drdy;				// True while the data ready line is driven low
+	bool     edge;				// Falling edge not yet delivered to the drdy handler
+	uint64_t edge_us;
+	uint8_t  tx[ADS_TRANSFER_SIZE];
+	uint64_t next_tick;			// Next sample, in ADS_SIM_TICK_HZ ticks
+	uint64_t ready_us;			// End of boot or of the current page program
+
+	uint32_t fw_len;
+	uint32_t fw_received;
+	uint8_t  len_received;
+	uint8_t  page_fill;
+	uint8_t  ack;
+	bool     busy;
+	bool     fw_complete;
+	bool     erased;			// Application erased by an unfinished update, a plain reset stays silent
+
+	uint32_t samples;			// Samples produced
+	uint32_t samples_read;		// Samples read out by the host
+	uint32_t samples_lost;		// Samples overwritten before they were read
+	uint32_t pages_written;
+} ads_sim_device_t;
+
+typedef struct {
+	uint32_t transactions;
+	uint32_t bytes;
+	uint32_t naks;
+	uint32_t errors_injected;
+	uint64_t busy_us;			// Total time the bus was occupied
+} ads_sim_bus_stats_t;
+
+/* Signal source. Writes the true bend angle of both axes, in degrees */
+typedef void (*ads_sim_signal_fn)(uint8_t device, uint64_t time_us, float * angle);
+
+/* Called on every falling edge of a device data ready line */
+typedef void (*ads_sim_drdy_handler)(uint8_t device, uint64_t time_us);
+
+
+/**
+ * @brief Fills config with the default model parameters, 400 kHz bus
+ *				without injected errors
+ */
+void ads_sim_get_default_config(ads_sim_config_t * config);
+
+/**
+ * @brief Resets the simulation to time zero with a single two axis ADS at
+ *				ADS_SIM_DEFAULT_ADDR that is already booted
+ *
+ * @param config	model parameters, NULL for defaults
+ */
+void ads_sim_init(const ads_sim_config_t * config);
+
+/**
+ * @brief Returns true once ads_sim_init() has been called
+ */
+bool ads_sim_initialized(void);
+
+/**
+ * @brief Adds a device to the simulated bus. The device starts booted.
+ *
+ * @param address	I2C address of the application
+ * @param dev_type	device type reported by ADS_GET_DEV_ID
+ * @param fw_ver	firmware version reported by ADS_GET_FW_VER
+ * @return	index of the new device or ADS_ERR_BAD_PARAM if the bus is full
+ */
+int ads_sim_add_device(uint8_t address, ADS_DEV_TYPE_T dev_type, uint16_t fw_ver);
+
+/**
+ * @brief Number of devices on the simulated bus
+ */
+uint8_t ads_sim_device_count(void);
+
+/**
+ * @brief Returns the state of a simulated device for inspection, NULL if
+ *				the index is invalid
+ */
+ads_sim_device_t * ads_sim_get_device(uint8_t device);
+
+/**
+ * @brief Maps a pin number to the device it is wired to
+ *
+ * @return	device index or ADS_SIM_ALL for a shared line
+ */
+uint8_t ads_sim_pin_device(uint32_t pin);
+
+/**
+ * @brief Current simulation time in microseconds
+ */
+uint64_t ads_sim_time_us(void);
+
+/**
+ * @brief Time of the next scheduled event (sample, end of boot or of a page
+ *				program), UINT64_MAX if nothing is scheduled
+ */
+uint64_t ads_sim_next_event_us(void);
+
+/**
+ * @brief Advances simulation time, producing samples and delivering data
+ *				ready edges in time order
+ */
+void ads_sim_advance_us(uint64_t us);
+
+/**
+ * @brief Registers the handler that receives data ready edges
+ */
+void ads_sim_set_drdy_handler(ads_sim_drdy_handler handler);
+
+/**
+ * @brief Replaces the signal source, NULL restores the default waveform
+ */
+void ads_sim_set_signal(ads_sim_signal_fn signal);
+
+/**
+ * @brief Level of a data ready line
+ *
+ * @param device	device index or ADS_SIM_ALL for the wired-OR line
+ * @return	true if the line is driven low
+ */
+bool ads_sim_drdy_asserted(uint8_t device);
+
+/**
+ * @brief Pulses the reset line of a device
+ *
+ * @param device		device index or ADS_SIM_ALL
+ * @param bootloader	true if data ready is held low during reset, which
+ *						starts the bootloader instead of the application
+ */
+void ads_sim_reset(uint8_t device, bool bootloader);
+
+/**
+ * @brief Writes to the bus. Advances time by the duration of the transaction.
+ *
+ * @return	number of bytes acknowledged
+ */
+uint16_t ads_sim_i2c_write(uint8_t address, const uint8_t * buffer, uint16_t len);
+
+/**
+ * @brief Reads from the bus. Advances time by the duration of the transaction.
+ *
+ * @return	number of bytes received
+ */
+uint16_t ads_sim_i2c_read(uint8_t address, uint8_t * buffer, uint16_t len);
+
+/**
+ * @brief Forces the next count transactions to fail with err
+ */
+void ads_sim_fail_next(ADS_SIM_ERR_T err, uint16_t count);
+
+/**
+ * @brief Bus counters since ads_sim_init()
+ */
+void ads_sim_get_bus_stats(ads_sim_bus_stats_t * stats);
+
+#endif /* ADS_TWO_AXIS_SIM_H_ */
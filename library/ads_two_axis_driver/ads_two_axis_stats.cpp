@@ -0,0 +1,34 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#include <string.h>
+#include "ads_two_axis_hal.h"
+#include "ads_two_axis_stats.h"
+
+#if ADS_STATS
+ads_stats_t ads_stats;
+volatile bool ads_stats_isr;
+#endif
+
+void ads_stats_get(ads_stats_t * snapshot, bool reset)
+{
+#if ADS_STATS
+	ads_hal_lock();
+
+	*snapshot = ads_stats;
+
+	if(reset)
+		memset(&ads_stats, 0, sizeof(ads_stats));
+
+	ads_hal_unlock();
+#else
+	(void)reset;
+
+	memset(snapshot, 0, sizeof(*snapshot));
+#endif
+}
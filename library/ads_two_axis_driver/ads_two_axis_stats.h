@@ -0,0 +1,127 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+#ifndef ADS_TWO_AXIS_STATS_H_
+#define ADS_TWO_AXIS_STATS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ads_two_axis_hal.h"
+
+/*
+ * Driver wide counters and timing histograms, for finding out where
+ * samples go. Off by default, build with ADS_STATS set to 1 to count.
+ * Counting then costs two time reads per data ready interrupt and per
+ * sample callback, an interrupt lock around each update made outside
+ * the data ready interrupt, and sizeof(ads_stats_t), 156 bytes, of RAM.
+ * With ADS_STATS set to 0 ads_stats_get() returns zeros.
+ *
+ * Counters are updated from both the data ready interrupt and the
+ * application, ads_hal_pin_interrupt() flags the interrupt so updates
+ * made outside it lock the interrupt out instead of racing it.
+ *
+ * Histogram bucket 0 counts durations of 0 us, bucket b durations of
+ * 2^(b-1) to 2^b - 1 us, the last bucket everything longer.
+ */
+
+#ifndef ADS_STATS
+#define ADS_STATS					(0)		// Set this to 1 to count the driver statistics
+#endif
+
+#define ADS_STATS_BUCKETS			(16)
+
+typedef struct {
+	uint32_t short_reads;					// Bus reads that returned fewer bytes than requested
+	uint32_t short_writes;					// Bus writes that sent fewer bytes than requested
+	uint32_t missed_recovered;				// Packets read because their data ready edge was missed
+	uint32_t samples;						// ADS_SAMPLE packets parsed
+	uint32_t dropped_packets;				// Other packets that reached the sample path
+	uint32_t isr_max_us;
+	uint32_t callback_max_us;
+	uint32_t isr_us[ADS_STATS_BUCKETS];		// Data ready interrupt duration, read and callback included
+	uint32_t callback_us[ADS_STATS_BUCKETS];	// Sample callback duration
+} ads_stats_t;
+
+#if ADS_STATS
+
+extern ads_stats_t ads_stats;
+extern volatile bool ads_stats_isr;		// Set while ads_hal_pin_interrupt() runs
+
+/**
+ * @brief Increments a counter, locking the interrupt out unless called from it
+ */
+static inline void ads_stats_inc(uint32_t * counter)
+{
+	if(ads_stats_isr)
+	{
+		(*counter)++;
+		return;
+	}
+
+	ads_hal_lock();
+	(*counter)++;
+	ads_hal_unlock();
+}
+
+#define ADS_STATS_INC(field)		ads_stats_inc(&ads_stats.field)
+
+/**
+ * @brief Adds a duration to a histogram and its maximum, locking the
+ *				interrupt out unless called from it
+ */
+static inline void ads_stats_record(uint32_t * hist, uint32_t * max_us, uint32_t us)
+{
+	bool isr = ads_stats_isr;
+	uint8_t bucket = 0;
+
+#if defined(__GNUC__)
+	if(us)
+		bucket = (uint8_t)(8 * sizeof(unsigned long) - __builtin_clzl((unsigned long)us));
+#else
+	for(uint32_t v = us; v; v >>= 1)
+		bucket++;
+#endif
+
+	if(bucket >= ADS_STATS_BUCKETS)
+		bucket = ADS_STATS_BUCKETS - 1;
+
+	if(!isr)
+		ads_hal_lock();
+
+	hist[bucket]++;
+
+	if(us > *max_us)
+		*max_us = us;
+
+	if(!isr)
+		ads_hal_unlock();
+}
+
+/* Times a section, ADS_STATS_TIME(isr, start) records it in isr_us and isr_max_us */
+#define ADS_STATS_START(start)			uint32_t start = ads_hal_get_time_us()
+#define ADS_STATS_TIME(field, start)	ads_stats_record(ads_stats.field##_us, &ads_stats.field##_max_us, \
+														 ads_hal_get_time_us() - (start))
+
+#else
+
+#define ADS_STATS_INC(field)			do { } while(0)
+#define ADS_STATS_START(start)			do { } while(0)
+#define ADS_STATS_TIME(field, start)	do { } while(0)
+
+#endif /* ADS_STATS */
+
+/**
+ * @brief Copies the statistics with interrupts locked out, cheap enough
+ *				to call at any rate while streaming
+ *
+ * @param snapshot	receives the statistics
+ * @param reset		true to start counting from zero again
+ */
+void ads_stats_get(ads_stats_t * snapshot, bool reset);
+
+#endif /* ADS_TWO_AXIS_STATS_H_ */
@@ -84,5 +84,68 @@ inline uint8_t ads_uint16_encode(uint16_t value, uint8_t * p_encoded_data)
     return sizeof(uint16_t);
 }
 
+/**@brief Function for converting a Q10.5 sample to degrees. Scales by an
+ *        exact power of two, so no division is needed.
+ *
+ * @param[in]   value            Sample as sent by the ADS.
+ * @return      Angle in degrees.
+ */
+inline float ads_q5_to_float(int16_t value)
+{
+    return (float)value * (1.0f / 32.0f);
+}
+
+/**@brief Function for converting degrees to a Q10.5 sample, rounded to
+ *        nearest and saturated to the int16 range.
+ *
+ * @param[in]   degrees          Angle in degrees.
+ * @return      Angle in Q10.5.
+ */
+inline int16_t ads_float_to_q5(float degrees)
+{
+    float value = degrees * 32.0f;
+
+    if(value >= 32767.0f)
+        return 32767;
+    if(value <= -32768.0f)
+        return -32768;
+
+    return (int16_t)(value < 0.0f ? value - 0.5f : value + 0.5f);
+}
+
+/**@brief Function for continuing a CRC-16/CCITT-FALSE over more bytes,
+ *        for data that is not in memory at once.
+ *
+ * @param[in]   crc              CRC of the bytes before, 0xFFFF to start.
+ * @param[in]   data             Bytes to check.
+ * @param[in]   len              Number of bytes.
+ * @return      CRC of the bytes before and data.
+ */
+inline uint16_t ads_crc16_update(uint16_t crc, const uint8_t * data, uint32_t len)
+{
+    for(uint32_t i = 0; i < len; i++)
+    {
+        crc ^= (uint16_t)data[i] << 8;
+
+        for(uint8_t b = 0; b < 8; b++)
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+
+    return crc;
+}
+
+/**@brief Function for computing a CRC-16/CCITT-FALSE, polynomial 0x1021,
+ *        initial value 0xFFFF. Used by recordings, calibration blobs and
+ *        compressed firmware images.
+ *
+ * @param[in]   data             Bytes to check.
+ * @param[in]   len              Number of bytes.
+ * @return      CRC of data.
+ */
+inline uint16_t ads_crc16(const uint8_t * data, uint32_t len)
+{
+    return ads_crc16_update(0xFFFF, data, len);
+}
+
 
 #endif /* ADS_TWO_AXIS_UTIL_H_ */
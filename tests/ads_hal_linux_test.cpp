@@ -0,0 +1,81 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+/*
+ * Linux HAL against the simulation loopback. Checks that every sample read
+ * and, without a query delay, every query is a single I2C_RDWR.
+ */
+
+#include <stdio.h>
+#include "ads_two_axis.h"
+#include "ads_two_axis_hal_linux.h"
+#include "ads_two_axis_sim.h"
+
+#define TEST_SAMPLES				(50)
+
+#define CHECK(cond)		do { if(!(cond)) { fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond); return 1; } } while(0)
+
+static uint32_t samples = 0;
+
+static void test_raw_callback(ads_dev_t * dev, const int16_t * raw)
+{
+	(void)dev;
+	(void)raw;
+	samples++;
+}
+
+int main(void)
+{
+	ads_hal_linux_ops_t ops;
+	ads_hal_linux_config_t config;
+	ads_hal_linux_stats_t before, after;
+
+	ads_sim_init(NULL);
+	CHECK(ads_hal_linux_sim_ops(&ops) == ADS_OK);
+
+	ads_hal_linux_get_default_config(&config);
+	config.query_delay_us = 0;
+	config.ops = &ops;
+	CHECK(ads_hal_linux_configure(&config) == ADS_OK);
+
+	ads_init_t init{};
+	init.sps = ADS_100_HZ;
+
+	ads_two_axis_set_raw_callback(&test_raw_callback);
+	CHECK(ads_two_axis_init(&init) == ADS_OK);
+
+	// Query: command and response in one transaction with a repeated start
+	ADS_DEV_TYPE_T dev_type;
+
+	ads_hal_linux_get_stats(&before);
+	CHECK(ads_get_dev_type(&dev_type) == ADS_OK);
+	ads_hal_linux_get_stats(&after);
+
+	CHECK(dev_type == ADS_DEV_TWO_AXIS_V2);
+	CHECK(after.i2c_syscalls - before.i2c_syscalls == 1);
+
+	// Samples: one read per data ready edge
+	CHECK(ads_two_axis_run(true) == ADS_OK);
+
+	ads_hal_linux_get_stats(&before);
+	samples = 0;
+
+	while(samples < TEST_SAMPLES)
+		CHECK(ads_hal_linux_poll(100) > 0);
+
+	ads_hal_linux_get_stats(&after);
+
+	CHECK(after.samples - before.samples == samples);
+	CHECK(after.i2c_syscalls - before.i2c_syscalls == samples);
+
+	ads_hal_linux_close();
+
+	printf("ok: %u samples, %u I2C_RDWR\n", samples, after.i2c_syscalls - before.i2c_syscalls);
+
+	return 0;
+}
@@ -0,0 +1,230 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+/*
+ * Bus scheduler against a simulated multi-device bus: devices at mixed
+ * rates on their own data ready lines and on one shared line, missed
+ * deadlines of a late poller, bus utilization and round robin on ties.
+ */
+
+#include <stdio.h>
+#include "ads_two_axis.h"
+#include "ads_two_axis_sched.h"
+#include "ads_two_axis_sim.h"
+
+#define TEST_DEVICES				(6)
+#define TEST_RUN_US					(2000000)
+
+#define CHECK(cond)		do { if(!(cond)) { fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond); return 1; } } while(0)
+
+static const ADS_SPS_T test_rates[TEST_DEVICES] = {
+	ADS_500_HZ, ADS_200_HZ, ADS_100_HZ, ADS_100_HZ, ADS_50_HZ, ADS_10_HZ
+};
+
+static ads_dev_t devs[TEST_DEVICES];
+static uint32_t callbacks[TEST_DEVICES];
+static int order[2];
+static uint8_t order_count;
+
+static void test_callback(ads_dev_t * dev, const int16_t * raw)
+{
+	(void)raw;
+	callbacks[dev - devs]++;
+}
+
+/**
+ * @brief Read callback of a stopped device, whose packets are not samples.
+ *				Records the order of the reads.
+ */
+static void test_read_callback(ads_hal_dev_t * hal, uint8_t * buffer)
+{
+	(void)buffer;
+
+	if(order_count < 2)
+		order[order_count++] = (int)((ads_dev_t *)hal->ctx - devs);
+}
+
+/**
+ * @brief Simulated bus with count devices, all on pin 0xFF if shared
+ *
+ * @param drift_ppm	oscillator error of the devices, with edge jitter if set
+ */
+static int test_setup(ads_sched_t * sched, const ADS_SPS_T * rates, uint8_t count, bool shared, bool run,
+					  int32_t drift_ppm)
+{
+	ads_sim_config_t config;
+	ads_sim_get_default_config(&config);
+	config.clock_drift_ppm = drift_ppm;
+	config.drdy_jitter_us = drift_ppm ? 300 : 0;
+	ads_sim_init(&config);
+
+	for(uint8_t i = 1; i < count; i++)
+		ads_sim_add_device(ADS_DEFAULT_ADDR + i, ADS_DEV_TWO_AXIS_V2, 6);
+
+	for(uint8_t i = 0; i < count; i++)
+	{
+		ads_init_t init{};
+		init.sps = rates[i];
+		init.reset_pin = i;
+		init.datardy_pin = shared ? 0xFF : i;
+
+		devs[i] = ads_dev_t();
+		ads_two_axis_dev_set_raw_callback(&devs[i], &test_callback);
+		CHECK(ads_two_axis_dev_init(&devs[i], ADS_DEFAULT_ADDR + i, &init) == ADS_OK);
+	}
+
+	ads_sched_init(sched);
+
+	for(uint8_t i = 0; i < count; i++)
+	{
+		CHECK(ads_sched_add(sched, &devs[i]) == i);
+
+		if(run)
+			CHECK(ads_two_axis_dev_run(&devs[i], true) == ADS_OK);
+	}
+
+	for(uint8_t i = 0; i < count; i++)
+	{
+		ads_sim_device_t * sim = ads_sim_get_device(i);
+
+		sim->samples = sim->samples_read = sim->samples_lost = 0;
+		callbacks[i] = 0;
+	}
+
+	ads_sched_reset_stats(sched);
+
+	return 0;
+}
+
+static int test_run(ads_sched_t * sched, uint32_t poll_us, uint32_t run_us)
+{
+	uint64_t end = ads_sim_time_us() + run_us;
+
+	while(ads_sim_time_us() < end)
+	{
+		ads_sim_advance_us(poll_us);
+		CHECK(ads_sched_poll(sched) >= 0);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Every sample of every device is read in time and delivered once,
+ *				repeats on a shared line dropped, and the utilization matches
+ *				the bus time
+ */
+static int test_mixed(bool shared, int32_t drift_ppm)
+{
+	static ads_sched_t sched;
+	uint32_t permille = 0;
+
+	CHECK(test_setup(&sched, test_rates, TEST_DEVICES, shared, true, drift_ppm) == 0);
+	CHECK(test_run(&sched, 500, TEST_RUN_US) == 0);
+
+	uint32_t elapsed = ads_hal_get_time_us() - sched.stats_start_us;
+
+	for(uint8_t i = 0; i < TEST_DEVICES; i++)
+	{
+		ads_sim_device_t * sim = ads_sim_get_device(i);
+		ads_sched_stats_t stats;
+
+		CHECK(ads_sched_get_stats(&sched, i, &stats) == ADS_OK);
+
+		CHECK(sim->samples > 0);
+		CHECK(sim->samples_lost == 0);
+		CHECK(stats.missed_deadlines == 0);
+		CHECK(callbacks[i] == stats.samples);
+		CHECK(callbacks[i] == sim->samples);
+
+		// Repeats are read on a shared line only
+		if(!shared)
+			CHECK(stats.repeats == 0);
+
+		CHECK(stats.bus_us > 0);
+		CHECK(stats.bus_permille == (uint16_t)(((uint64_t)stats.bus_us * 1000) / elapsed));
+
+		permille += stats.bus_permille;
+	}
+
+	CHECK(permille > 0 && permille < 1000);
+
+	printf("mixed %s %d ppm: bus %u permille\n", shared ? "shared" : "separate", (int)drift_ppm, permille);
+
+	return 0;
+}
+
+/**
+ * @brief A poller slower than the sample period counts what it loses
+ */
+static int test_missed(void)
+{
+	static ads_sched_t sched;
+	static const ADS_SPS_T rates[1] = { ADS_200_HZ };
+	ads_sched_stats_t stats;
+
+	CHECK(test_setup(&sched, rates, 1, false, true, 0) == 0);
+	CHECK(test_run(&sched, 20000, 1000000) == 0);
+	CHECK(ads_sched_get_stats(&sched, 0, &stats) == ADS_OK);
+
+	ads_sim_device_t * sim = ads_sim_get_device(0);
+
+	CHECK(sim->samples_lost > 0);
+	CHECK(stats.missed_deadlines > 0);
+	CHECK(stats.missed_deadlines + sim->samples / 10 >= sim->samples_lost);
+	CHECK(stats.missed_deadlines <= sim->samples_lost + sim->samples / 10);
+
+	printf("missed: %u estimated, %u lost\n", stats.missed_deadlines, sim->samples_lost);
+
+	return 0;
+}
+
+/**
+ * @brief Devices with the same deadline take turns at being read first
+ */
+static int test_round_robin(void)
+{
+	static ads_sched_t sched;
+	static const ADS_SPS_T rates[2] = { ADS_100_HZ, ADS_100_HZ };
+	int first = -1;
+
+	// Stopped devices, edges with equal times are injected below
+	CHECK(test_setup(&sched, rates, 2, false, false, 0) == 0);
+
+	devs[0].hal.read_callback = &test_read_callback;
+	devs[1].hal.read_callback = &test_read_callback;
+
+	for(int pass = 0; pass < 4; pass++)
+	{
+		uint32_t now = ads_hal_get_time_us();
+
+		ads_hal_dev_interrupt(&devs[0].hal, now);
+		ads_hal_dev_interrupt(&devs[1].hal, now);
+
+		order_count = 0;
+		CHECK(ads_sched_poll(&sched) == 2);
+		CHECK(order_count == 2 && order[0] != order[1]);
+		CHECK(order[0] != first);
+
+		first = order[0];
+		ads_sim_advance_us(1000);
+	}
+
+	printf("round robin: ok\n");
+
+	return 0;
+}
+
+int main(void)
+{
+	if(test_mixed(false, 0) || test_mixed(true, 0) || test_mixed(true, 500) || test_mixed(true, -500) ||
+	   test_missed() || test_round_robin())
+		return 1;
+
+	return 0;
+}
@@ -0,0 +1,167 @@
+/**
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ */
+
+/*
+ * Writes the compressed firmware header the DFU embeds by default.
+ *
+ *   ads_fw_lz <image> <name> <rev> <header>
+ *
+ * image is a raw .bin, or a firmware header like ads_two_axis_fw_v2.h of
+ * which the first array is taken. The header declares <name>_rev,
+ * <name>_len, <name>_crc and the stream <name>. The stream is decoded
+ * again and compared with the image before anything is written.
+ *
+ *   ./build/tools/ads_fw_lz library/ads_two_axis_driver/ads_two_axis_fw_v2.h \
+ *       ads_two_axis_fw_v2_lz 6 library/ads_two_axis_driver/ads_two_axis_fw_v2_lz.h
+ *
+ * Built by the ads_fw_lz target of the top level CMakeLists.txt.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "ads_two_axis_lz.h"
+#include "ads_two_axis_util.h"
+
+static bool fw_lz_load(const char * path, std::vector<uint8_t> & image)
+{
+	FILE * f = fopen(path, "rb");
+
+	if(f == NULL)
+		return false;
+
+	std::vector<char> text;
+	char chunk[4096];
+	size_t n;
+
+	while((n = fread(chunk, 1, sizeof(chunk), f)) > 0)
+		text.insert(text.end(), chunk, chunk + n);
+
+	fclose(f);
+
+	size_t len = strlen(path);
+
+	if(len < 2 || strcmp(&path[len - 2], ".h") != 0)
+	{
+		image.assign(text.begin(), text.end());
+		return true;
+	}
+
+	// Hex bytes of the first array initializer
+	text.push_back('\0');
+
+	const char * p = strstr(text.data(), "[] = {");
+
+	if(p == NULL)
+		return false;
+
+	for(p += 6; *p && *p != '}'; )
+	{
+		char * end;
+
+		if(p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+		{
+			image.push_back((uint8_t)strtoul(p, &end, 16));
+			p = end;
+		}
+		else
+		{
+			p++;
+		}
+	}
+
+	return *p == '}';
+}
+
+static bool fw_lz_verify(const std::vector<uint8_t> & image, const uint8_t * stream, uint32_t size)
+{
+	static ads_lz_dec_t dec;
+	std::vector<uint8_t> out(image.size() + 1);
+
+	ads_lz_dec_init(&dec, stream, size);
+
+	return ads_lz_read(&dec, out.data(), (uint32_t)out.size()) == image.size() &&
+		   memcmp(out.data(), image.data(), image.size()) == 0;
+}
+
+static bool fw_lz_write(const char * path, const char * name, unsigned rev, const std::vector<uint8_t> & image,
+						const uint8_t * stream, uint32_t size)
+{
+	FILE * f = fopen(path, "w");
+
+	if(f == NULL)
+		return false;
+
+	fprintf(f, "/**\n"
+			   " * This software is provided \"as is\", without any warranty of any kind, express or implied,\n"
+			   " * including but not limited to the warranties of merchantability, fitness for a particular purpose,\n"
+			   " * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,\n"
+			   " * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,\n"
+			   " * out of, or in connection with the software or the use or other dealings in the software.\n"
+			   " */\n\n"
+			   "/* Generated by tools/ads_fw_lz, do not edit */\n\n");
+
+	std::vector<char> guard(name, name + strlen(name) + 1);
+
+	for(size_t i = 0; guard[i]; i++)
+		guard[i] = (char)toupper((unsigned char)guard[i]);
+
+	fprintf(f, "#ifndef %s_H_\n#define %s_H_\n\n#include <stdint.h>\n\n", guard.data(), guard.data());
+	fprintf(f, "const uint8_t %s_rev = %u;\n", name, rev);
+	fprintf(f, "const uint32_t %s_len = %u;\t\t// Bytes of the image\n", name, (unsigned)image.size());
+	fprintf(f, "const uint16_t %s_crc = 0x%04x;\t\t// ads_crc16() of the image\n\n", name,
+			ads_crc16(image.data(), (uint32_t)image.size()));
+
+	fprintf(f, "const uint8_t %s[] = {", name);
+
+	for(uint32_t i = 0; i < size; i++)
+		fprintf(f, "0x%02x%s", stream[i], i + 1 < size ? ", " : "");
+
+	fprintf(f, "};\n\n#endif /* %s_H_ */\n", guard.data());
+
+	return fclose(f) == 0;
+}
+
+int main(int argc, char ** argv)
+{
+	if(argc != 5)
+	{
+		fprintf(stderr, "usage: %s <image.bin|image.h> <name> <rev> <header>\n", argv[0]);
+		return 1;
+	}
+
+	std::vector<uint8_t> image;
+
+	if(!fw_lz_load(argv[1], image) || image.empty())
+	{
+		fprintf(stderr, "can not read an image from %s\n", argv[1]);
+		return 1;
+	}
+
+	// Incompressible data grows by one flag byte per 8 literals
+	std::vector<uint8_t> stream(image.size() + image.size() / 8 + 1);
+	int32_t size = ads_lz_encode(image.data(), (uint32_t)image.size(), stream.data(), (uint32_t)stream.size());
+
+	if(size < 0 || !fw_lz_verify(image, stream.data(), (uint32_t)size))
+	{
+		fprintf(stderr, "compression of %s failed\n", argv[1]);
+		return 1;
+	}
+
+	if(!fw_lz_write(argv[4], argv[2], (unsigned)strtoul(argv[3], NULL, 0), image, stream.data(), (uint32_t)size))
+	{
+		fprintf(stderr, "can not write %s\n", argv[4]);
+		return 1;
+	}
+
+	fprintf(stderr, "%s: %u -> %d bytes, %.2fx\n", argv[4], (unsigned)image.size(), size, (double)image.size() / size);
+
+	return 0;
+}